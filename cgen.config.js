@@ -13,8 +13,12 @@ module.exports = function (options, ctx) {
         ],
         ...(options.DLL ? { defines: ['JSCPP_BUILD_DLL'] } : {}),
         publicIncludePaths: ['include'],
+        publicDefines: [
+          ...(ctx.isEmscripten ? ['JSCPP_USE_ERROR=1'] : []),
+          ...(options.STRING_UTF8 ? ['JSCPP_STRING_UTF8=1'] : []),
+          ...(options.STRING_UTF16 ? ['JSCPP_STRING_UTF16=1'] : [])
+        ],
         ...(ctx.isEmscripten ? {
-          publicDefines: ['JSCPP_USE_ERROR=1'],
           publicCompileOptions: ['-fexceptions'],
           publicLinkOptions: ['-fexceptions']
         } : {}),
@@ -29,7 +33,10 @@ module.exports = function (options, ctx) {
         sources: [
           './test/main.cpp',
           './test/path.cpp',
-          './test/test_fs.cpp'
+          './test/test_fs.cpp',
+          './test/bench.cpp',
+          './test/bench_fs.cpp',
+          './test/bench_string.cpp'
         ],
         ...(options.DLL ? { defines: ['JSCPP_IMPORT_DLL'] } : {}),
         // compileOptions: ['/execution-charset:utf-8']
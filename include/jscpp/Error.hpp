@@ -6,23 +6,50 @@
 #if JSCPP_USE_ERROR
 #include <string>
 #include <exception>
+#include <memory>
+#include <system_error>
+#include "String.hpp"
 #endif
 
 namespace js {
 
 #if JSCPP_USE_ERROR
 
-class String;
-
 class JSCPP_API Error : public std::exception {
 public:
   Error(const String& msg);
   virtual ~Error() noexcept override = default;
   char const* what() const noexcept override;
 protected:
+  Error() noexcept;
   std::string _msg;
 };
 
+/**
+ * A failed system call, like Node's fs errors. The message is rendered by
+ * the first what() only, so callers that branch on code() never pay for it.
+ */
+class JSCPP_API SystemError : public Error {
+public:
+  SystemError(const std::error_code& code, const char* syscall, const String& path, const String& dest = String());
+  virtual ~SystemError() noexcept override = default;
+  char const* what() const noexcept override;
+
+  // errno value, such as ENOENT
+  int code() const noexcept;
+  // "ENOENT", or "UNKNOWN" for codes without a POSIX name
+  const char* codeName() const noexcept;
+  const std::error_code& errorCode() const noexcept;
+  const char* syscall() const noexcept;
+  const String& path() const noexcept;
+  // Second path of operations such as rename, empty otherwise
+  const String& dest() const noexcept;
+private:
+  struct Detail;
+  // Shared, as exceptions are copied when thrown
+  std::shared_ptr<Detail> detail_;
+};
+
 #endif
 
 }
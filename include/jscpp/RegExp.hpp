@@ -0,0 +1,69 @@
+#ifndef __JSCPP_REGEXP_HPP__
+#define __JSCPP_REGEXP_HPP__
+
+#include "String.hpp"
+#include <memory>
+
+namespace js {
+
+namespace internal {
+  class RegExpPattern;
+}
+
+/**
+ * Result of RegExp::exec. Converts to false when nothing matched.
+ * captures[0] is the whole match; groups that did not participate are
+ * empty strings, as JS undefined has no String equivalent.
+ */
+class JSCPP_API RegExpMatch {
+public:
+  size_t index;
+  std::vector<String> captures;
+
+  RegExpMatch() noexcept: index(static_cast<size_t>(-1)) {}
+
+  explicit operator bool() const noexcept { return !captures.empty(); }
+  const String& operator[](size_t i) const noexcept { return captures[i]; }
+  size_t size() const noexcept { return captures.size(); }
+};
+
+/**
+ * ECMAScript regular expression with flags g, i, m, s and y.
+ *
+ * Patterns without backreferences or lookaround run on a linear-time
+ * engine, so matching time never grows worse than pattern size times input
+ * length. Others fall back to std::wregex, which does not support m or s.
+ * The extra flag l requires the linear engine and throws when the pattern
+ * needs backtracking.
+ *
+ * Compiled patterns are shared through a process-wide cache of
+ * JSCPP_REGEXP_CACHE_SIZE entries, so constructing the same RegExp in a
+ * loop only parses it once.
+ */
+class JSCPP_API RegExp {
+public:
+  explicit RegExp(const String& pattern, const String& flags = L"");
+
+  const String& source() const noexcept;
+  const String& flags() const noexcept;
+  bool global() const noexcept;
+  bool ignoreCase() const noexcept;
+  bool multiline() const noexcept;
+  bool dotAll() const noexcept;
+  bool sticky() const noexcept;
+  bool linear() const noexcept;
+
+  // Like JS, these start from and update lastIndex when global or sticky.
+  bool test(const String& str);
+  RegExpMatch exec(const String& str);
+
+  size_t lastIndex;
+
+private:
+  friend class String;
+  std::shared_ptr<const internal::RegExpPattern> _pattern;
+};
+
+}
+
+#endif
@@ -0,0 +1,255 @@
+#ifndef __JSCPP_SMALL_STRING_HPP__
+#define __JSCPP_SMALL_STRING_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace js {
+
+/**
+ * Contiguous, null-terminated code unit buffer that keeps up to N units
+ * inline and only allocates beyond that. Implements the subset of the
+ * std::basic_string interface js::String relies on.
+ */
+template <typename CharT, size_t N>
+class SmallString {
+public:
+  typedef CharT value_type;
+  typedef size_t size_type;
+  typedef CharT* iterator;
+  typedef const CharT* const_iterator;
+  typedef std::reverse_iterator<iterator> reverse_iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  static const size_type npos = static_cast<size_type>(-1);
+
+private:
+  static const size_type HEAP_FLAG = ~(npos >> 1);
+
+  struct Heap {
+    CharT* ptr;
+    size_type cap;
+  };
+
+  size_type _size;
+  union {
+    Heap _heap;
+    CharT _inline[N + 1];
+  };
+
+  bool _isInline() const noexcept { return (_size & HEAP_FLAG) == 0; }
+  CharT* _ptr() noexcept { return _isInline() ? _inline : _heap.ptr; }
+  const CharT* _ptr() const noexcept { return _isInline() ? _inline : _heap.ptr; }
+  void _setSize(size_type n) noexcept {
+    _size = (_size & HEAP_FLAG) | n;
+    _ptr()[n] = CharT();
+  }
+
+  void _grow(size_type minCap) {
+    size_type cap = capacity();
+    if (minCap <= cap) return;
+    size_type newCap = cap * 2 > minCap ? cap * 2 : minCap;
+    CharT* p = static_cast<CharT*>(::operator new((newCap + 1) * sizeof(CharT)));
+    size_type n = size();
+    std::memcpy(p, _ptr(), (n + 1) * sizeof(CharT));
+    if (!_isInline()) ::operator delete(_heap.ptr);
+    _heap.ptr = p;
+    _heap.cap = newCap;
+    _size = n | HEAP_FLAG;
+  }
+
+  void _assign(const CharT* s, size_type n) {
+    _grow(n);
+    if (n != 0) std::memmove(_ptr(), s, n * sizeof(CharT));
+    _setSize(n);
+  }
+
+  static size_type _length(const CharT* s) noexcept {
+    size_type n = 0;
+    while (s[n] != CharT()) n++;
+    return n;
+  }
+
+public:
+  SmallString() noexcept: _size(0) { _inline[0] = CharT(); }
+  SmallString(const CharT* s): SmallString() { _assign(s, _length(s)); }
+  SmallString(const CharT* s, size_type n): SmallString() { _assign(s, n); }
+  SmallString(size_type n, CharT c): SmallString() { resize(n, c); }
+  SmallString(std::initializer_list<CharT> il): SmallString() { _assign(il.begin(), il.size()); }
+  SmallString(const SmallString& o): SmallString() { _assign(o.data(), o.size()); }
+  SmallString(SmallString&& o) noexcept: _size(o._size) {
+    if (o._isInline()) {
+      std::memcpy(_inline, o._inline, sizeof(_inline));
+    } else {
+      _heap = o._heap;
+      o._size = 0;
+      o._inline[0] = CharT();
+    }
+  }
+  ~SmallString() {
+    if (!_isInline()) ::operator delete(_heap.ptr);
+  }
+
+  SmallString& operator=(const SmallString& o) {
+    if (this != &o) _assign(o.data(), o.size());
+    return *this;
+  }
+  SmallString& operator=(SmallString&& o) noexcept {
+    if (this != &o) {
+      SmallString tmp(std::move(o));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  size_type size() const noexcept { return _size & ~HEAP_FLAG; }
+  size_type length() const noexcept { return size(); }
+  bool empty() const noexcept { return size() == 0; }
+  size_type capacity() const noexcept { return _isInline() ? N : _heap.cap; }
+
+  const CharT* data() const noexcept { return _ptr(); }
+  const CharT* c_str() const noexcept { return _ptr(); }
+  CharT& operator[](size_type i) noexcept { return _ptr()[i]; }
+  const CharT& operator[](size_type i) const noexcept { return _ptr()[i]; }
+
+  iterator begin() noexcept { return _ptr(); }
+  iterator end() noexcept { return _ptr() + size(); }
+  const_iterator begin() const noexcept { return _ptr(); }
+  const_iterator end() const noexcept { return _ptr() + size(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+  const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+  void reserve(size_type n) { _grow(n); }
+  void clear() noexcept { _setSize(0); }
+  void resize(size_type n) { resize(n, CharT()); }
+  void resize(size_type n, CharT c) {
+    size_type old = size();
+    _grow(n);
+    CharT* p = _ptr();
+    for (size_type i = old; i < n; i++) p[i] = c;
+    _setSize(n);
+  }
+
+  SmallString& append(const CharT* s, size_type n) {
+    size_type old = size();
+    if (old + n > capacity()) {
+      // s may point into this buffer
+      SmallString tmp;
+      tmp.reserve(old + n > capacity() * 2 ? old + n : capacity() * 2);
+      std::memcpy(tmp._ptr(), _ptr(), old * sizeof(CharT));
+      std::memcpy(tmp._ptr() + old, s, n * sizeof(CharT));
+      tmp._setSize(old + n);
+      swap(tmp);
+      return *this;
+    }
+    std::memmove(_ptr() + old, s, n * sizeof(CharT));
+    _setSize(old + n);
+    return *this;
+  }
+  SmallString& operator+=(const SmallString& s) { return append(s.data(), s.size()); }
+  SmallString& operator+=(CharT c) { return append(&c, 1); }
+  void push_back(CharT c) { append(&c, 1); }
+
+  SmallString substr(size_type pos = 0, size_type n = npos) const {
+    size_type len = size();
+    if (pos > len) pos = len;
+    if (n > len - pos) n = len - pos;
+    return SmallString(data() + pos, n);
+  }
+
+  SmallString& replace(size_type pos, size_type n, const SmallString& s) {
+    size_type len = size();
+    if (pos > len) pos = len;
+    if (n > len - pos) n = len - pos;
+    SmallString tmp;
+    tmp.reserve(len - n + s.size());
+    tmp.append(data(), pos).append(s.data(), s.size()).append(data() + pos + n, len - pos - n);
+    swap(tmp);
+    return *this;
+  }
+
+  size_type find(const SmallString& s, size_type pos = 0) const noexcept {
+    size_type len = size();
+    size_type n = s.size();
+    if (pos > len || n > len - pos) return npos;
+    const CharT* p = data();
+    for (size_type i = pos; i + n <= len; i++) {
+      if (std::memcmp(p + i, s.data(), n * sizeof(CharT)) == 0) return i;
+    }
+    return npos;
+  }
+
+  size_type rfind(const SmallString& s, size_type pos = npos) const noexcept {
+    size_type len = size();
+    size_type n = s.size();
+    if (n > len) return npos;
+    size_type i = len - n < pos ? len - n : pos;
+    const CharT* p = data();
+    for (;; i--) {
+      if (std::memcmp(p + i, s.data(), n * sizeof(CharT)) == 0) return i;
+      if (i == 0) break;
+    }
+    return npos;
+  }
+
+  int compare(const SmallString& s) const noexcept {
+    size_type l = size();
+    size_type r = s.size();
+    const CharT* a = data();
+    const CharT* b = s.data();
+    for (size_type i = 0; i < l && i < r; i++) {
+      if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    }
+    return l < r ? -1 : (l > r ? 1 : 0);
+  }
+
+  void swap(SmallString& o) noexcept {
+    if (this == &o) return;
+    char tmp[sizeof(SmallString)];
+    std::memcpy(tmp, (void*)this, sizeof(SmallString));
+    std::memcpy((void*)this, (void*)&o, sizeof(SmallString));
+    std::memcpy((void*)&o, tmp, sizeof(SmallString));
+  }
+};
+
+template <typename CharT, size_t N>
+const typename SmallString<CharT, N>::size_type SmallString<CharT, N>::npos;
+
+template <typename CharT, size_t N>
+SmallString<CharT, N> operator+(const SmallString<CharT, N>& l, const SmallString<CharT, N>& r) {
+  SmallString<CharT, N> res;
+  res.reserve(l.size() + r.size());
+  res.append(l.data(), l.size()).append(r.data(), r.size());
+  return res;
+}
+
+}
+
+namespace std {
+
+template <typename CharT, size_t N>
+struct hash<::js::SmallString<CharT, N>> {
+  size_t operator()(const ::js::SmallString<CharT, N>& str) const noexcept {
+    // FNV-1a
+    uint64_t h = 14695981039346656037ULL;
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(str.data());
+    for (size_t i = 0, n = str.size() * sizeof(CharT); i < n; i++) {
+      h = (h ^ p[i]) * 1099511628211ULL;
+    }
+    return (size_t)h;
+  }
+};
+
+}
+
+#endif
@@ -4,15 +4,44 @@
 #include "config.h"
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 #include <iostream>
 #include <vector>
 #include <regex>
 
+#if JSCPP_STRING_UTF16
+#include "SmallString.hpp"
+#endif
+
 namespace js {
 
+class StringView;
+class RegExp;
+class RegExpMatch;
+
 class JSCPP_API String {
+public:
+  // Code unit storage. Wide by default, UTF-8 bytes when built with
+  // JSCPP_STRING_UTF8, in which case lengths and indices count bytes.
+  // JSCPP_STRING_UTF16 stores UTF-16 on every platform (wchar_t is already
+  // UTF-16 on Windows) in a buffer that keeps short strings inline.
+#if JSCPP_STRING_UTF8
+  typedef char value_type;
+  typedef std::string string_type;
+#elif JSCPP_STRING_UTF16
+#ifdef _WIN32
+  typedef wchar_t value_type;
+#else
+  typedef char16_t value_type;
+#endif
+  typedef SmallString<value_type, 23> string_type;
+#else
+  typedef wchar_t value_type;
+  typedef std::wstring string_type;
+#endif
+
 private:
-  std::wstring _str;
+  string_type _str;
 
 public:
   static String fromCharCode() noexcept;
@@ -30,6 +59,11 @@ public:
 
 private:
   void _trimZero();
+  String& _append(const char* str);
+  String& _append(const wchar_t* wstr);
+
+  static const String* _addr(const String& s) noexcept { return &s; }
+  static String _concat(std::initializer_list<const String*> parts);
 
 public:
   String() = default;
@@ -40,6 +74,14 @@ public:
   String(const std::string& str) noexcept;
   String(const wchar_t* wstr) noexcept;
   String(const std::wstring& wstr) noexcept;
+#if JSCPP_STRING_UTF16
+  String(char16_t c) noexcept;
+  String(const char16_t* u16str) noexcept;
+  String(const std::u16string& u16str) noexcept;
+  String(const string_type& units) noexcept;
+  String(string_type&& units) noexcept;
+#endif
+  explicit String(StringView view);
   String(bool b);
   String(int n);
   String(unsigned int n);
@@ -51,8 +93,8 @@ public:
   String(double n);
   String(long double n);
 
-  using iterator = std::wstring::iterator;
-  using const_iterator = std::wstring::const_iterator;
+  using iterator = string_type::iterator;
+  using const_iterator = string_type::const_iterator;
 
   iterator begin() noexcept;
   const_iterator cbegin() const noexcept;
@@ -65,20 +107,26 @@ public:
 
   size_t length() const noexcept;
 
-  const std::wstring& ref() const noexcept;
+  const string_type& ref() const noexcept;
 
   std::wstring wstr() const noexcept;
 
+#if JSCPP_STRING_UTF8
+  const std::string& str() const noexcept;
+#else
   std::string str() const noexcept;
+#endif
   std::string toString() const noexcept;
 
-  const wchar_t* data() const noexcept;
+  const value_type* data() const noexcept;
 
-  const wchar_t& operator[](size_t index) const noexcept;
-  wchar_t& operator[](size_t index) noexcept;
+  const value_type& operator[](size_t index) const noexcept;
+  value_type& operator[](size_t index) noexcept;
 
   String& operator+=(const String& str);
 
+  friend JSCPP_API String operator+(String&& l, const char* r);
+  friend JSCPP_API String operator+(String&& l, const wchar_t* r);
   friend JSCPP_API std::ostream& operator<<(std::ostream& out, const String& str);
   friend JSCPP_API std::istream& operator>>(std::istream& in, String& str);
 
@@ -90,20 +138,26 @@ public:
   String concat() const noexcept;
   String concat(const String& s) const;
 
+  // Sizes all parts first so the result is allocated once.
   template <typename... Args>
   String concat(const String& s, const Args&... args) const {
-    String tmp = this->concat(s);
-    return tmp.concat(args...);
+    return _concat({ this, &s, _addr(args)... });
   }
 
   bool startsWith(const String& searchString, size_t position = 0) const;
+  bool startsWith(StringView searchString, size_t position = 0) const noexcept;
   bool endsWith(const String& search) const;
+  bool endsWith(StringView search) const noexcept;
   bool endsWith(const String& search, size_t length) const;
+  bool endsWith(StringView search, size_t length) const noexcept;
 
   bool includes(const String& searchString = L"undefined", size_t position = 0U) const noexcept;
+  bool includes(StringView searchString, size_t position = 0U) const noexcept;
 
   size_t indexOf(const String& searchValue = L"undefined", size_t fromIndex = 0U) const noexcept;
+  size_t indexOf(StringView searchValue, size_t fromIndex = 0U) const noexcept;
   size_t lastIndexOf(const String& searchValue = L"undefined", size_t fromIndex = std::wstring::npos) const noexcept;
+  size_t lastIndexOf(StringView searchValue, size_t fromIndex = std::wstring::npos) const noexcept;
 
   String substring(size_t indexStart) const;
   String substring(size_t indexStart, size_t indexEnd) const;
@@ -118,13 +172,26 @@ public:
 
   String replace(const String& substr, const String& newSubStr) const;
   String replace(const std::wregex& regexp, const String& newSubStr) const;
+  String replace(const RegExp& regexp, const String& newSubStr) const;
+  String replaceAll(const String& substr, const String& newSubStr) const;
+  String replaceAll(const RegExp& regexp, const String& newSubStr) const;
+
+  std::vector<String> match(const RegExp& regexp) const;
+  std::vector<RegExpMatch> matchAll(const RegExp& regexp) const;
+  size_t search(const RegExp& regexp) const;
 
   std::vector<String> split() const noexcept;
   std::vector<String> split(const String& seprator, int limit = -1) const;
+  std::vector<String> split(StringView seprator, int limit = -1) const;
+  std::vector<String> split(const RegExp& separator, int limit = -1) const;
 
+  // Full Unicode case mapping, including ß -> SS and a final Σ -> ς.
   String toLowerCase() const noexcept;
   String toUpperCase() const noexcept;
 
+  // form is one of NFC, NFD, NFKC or NFKD.
+  String normalize(const String& form = L"NFC") const;
+
   String trim() const;
   String trimEnd() const;
   String trimStart() const;
@@ -132,6 +199,9 @@ public:
   String trimLeft() const;
 
   int compare(const String& s) const noexcept;
+  // Orders by base letters, then accents, then case, without a locale
+  // database. Returns a negative, zero or positive value like compare().
+  int localeCompare(const String& compareString) const;
 
   void swap(String& s) noexcept;
 };
@@ -148,6 +218,19 @@ JSCPP_API String operator+(const String& l, char r);
 JSCPP_API String operator+(const String& l, const wchar_t* r);
 JSCPP_API String operator+(const String& l, wchar_t r);
 
+// Appends into the left operand's buffer when it is a temporary, so chains
+// like a + L"/" + b grow one string instead of allocating per step.
+JSCPP_API String operator+(String&& l, const String& r);
+JSCPP_API String operator+(String&& l, const char* r);
+JSCPP_API String operator+(String&& l, char r);
+JSCPP_API String operator+(String&& l, const wchar_t* r);
+JSCPP_API String operator+(String&& l, wchar_t r);
+#if JSCPP_STRING_UTF16
+JSCPP_API String operator+(char16_t l, const String& r);
+JSCPP_API String operator+(const String& l, char16_t r);
+JSCPP_API String operator+(String&& l, char16_t r);
+#endif
+
 JSCPP_API String operator+(const String& l, bool r);
 JSCPP_API String operator+(const String& l, int r);
 JSCPP_API String operator+(const String& l, unsigned int r);
@@ -159,6 +242,17 @@ JSCPP_API String operator+(const String& l, float r);
 JSCPP_API String operator+(const String& l, double r);
 JSCPP_API String operator+(const String& l, long double r);
 
+JSCPP_API String operator+(String&& l, bool r);
+JSCPP_API String operator+(String&& l, int r);
+JSCPP_API String operator+(String&& l, unsigned int r);
+JSCPP_API String operator+(String&& l, long r);
+JSCPP_API String operator+(String&& l, unsigned long r);
+JSCPP_API String operator+(String&& l, long long r);
+JSCPP_API String operator+(String&& l, unsigned long long r);
+JSCPP_API String operator+(String&& l, float r);
+JSCPP_API String operator+(String&& l, double r);
+JSCPP_API String operator+(String&& l, long double r);
+
 JSCPP_API String operator+(bool l, const String& r);
 JSCPP_API String operator+(int l, const String& r);
 JSCPP_API String operator+(unsigned int l, const String& r);
@@ -185,10 +279,13 @@ namespace std {
 template<>
 struct hash<::js::String> {
   size_t operator()(const ::js::String& str) const noexcept {
-    return std::hash<std::wstring>{}(str.ref());
+    return std::hash<::js::String::string_type>{}(str.ref());
   }
 };
 
 }
 
+#include "StringView.hpp"
+#include "RegExp.hpp"
+
 #endif
@@ -0,0 +1,76 @@
+#ifndef __JSCPP_STRING_VIEW_HPP__
+#define __JSCPP_STRING_VIEW_HPP__
+
+#include "String.hpp"
+
+namespace js {
+
+/**
+ * Read-only, non-owning range of String code units. Sub-range methods
+ * return views into the same buffer, so the viewed String must outlive
+ * every view taken from it.
+ */
+class JSCPP_API StringView {
+public:
+  typedef String::value_type value_type;
+  typedef const value_type* const_iterator;
+
+  static const size_t npos = static_cast<size_t>(-1);
+
+private:
+  const value_type* _data;
+  size_t _size;
+
+public:
+  constexpr StringView() noexcept: _data(nullptr), _size(0) {}
+  StringView(const String& str) noexcept: _data(str.data()), _size(str.length()) {}
+  constexpr StringView(const value_type* data, size_t length) noexcept: _data(data), _size(length) {}
+  explicit StringView(const value_type* str) noexcept;
+
+  const_iterator begin() const noexcept { return _data; }
+  const_iterator end() const noexcept { return _data + _size; }
+
+  size_t length() const noexcept { return _size; }
+  const value_type* data() const noexcept { return _data; }
+  const value_type& operator[](size_t index) const noexcept { return _data[index]; }
+
+  String toString() const;
+  std::string str() const;
+  std::wstring wstr() const;
+
+  StringView charAt(size_t index) const noexcept;
+  uint16_t charCodeAt(size_t index = 0) const noexcept;
+
+  bool startsWith(StringView searchString, size_t position = 0) const noexcept;
+  bool endsWith(StringView search) const noexcept;
+  bool endsWith(StringView search, size_t length) const noexcept;
+
+  bool includes(StringView searchString, size_t position = 0U) const noexcept;
+
+  size_t indexOf(StringView searchValue, size_t fromIndex = 0U) const noexcept;
+  size_t lastIndexOf(StringView searchValue, size_t fromIndex = npos) const noexcept;
+
+  StringView substring(size_t indexStart) const noexcept;
+  StringView substring(size_t indexStart, size_t indexEnd) const noexcept;
+
+  StringView slice(int beginIndex = 0) const noexcept;
+  StringView slice(int beginIndex, int endIndex) const noexcept;
+
+  std::vector<StringView> split(StringView separator, int limit = -1) const;
+
+  StringView trim() const noexcept;
+  StringView trimEnd() const noexcept;
+  StringView trimStart() const noexcept;
+
+  int compare(StringView s) const noexcept;
+};
+
+JSCPP_API bool operator==(StringView l, StringView r) noexcept;
+JSCPP_API bool operator!=(StringView l, StringView r) noexcept;
+JSCPP_API bool operator<(StringView l, StringView r) noexcept;
+
+JSCPP_API std::ostream& operator<<(std::ostream& out, StringView view);
+
+}
+
+#endif
@@ -35,4 +35,40 @@
   #endif
 #endif
 
+#ifndef JSCPP_STRING_UTF8
+  #define JSCPP_STRING_UTF8 0
+#endif
+
+#ifndef JSCPP_STRING_UTF16
+  #define JSCPP_STRING_UTF16 0
+#endif
+
+#ifndef JSCPP_REGEXP_CACHE_SIZE
+  #define JSCPP_REGEXP_CACHE_SIZE 64
+#endif
+
+// Threads of the pool behind the asynchronous fs calls, unless the
+// JSCPP_THREADPOOL_SIZE environment variable says otherwise
+#ifndef JSCPP_FS_THREADPOOL_SIZE
+  #define JSCPP_FS_THREADPOOL_SIZE 4
+#endif
+
+// Calls that may wait for a pool thread before submitting more blocks
+#ifndef JSCPP_FS_THREADPOOL_QUEUE
+  #define JSCPP_FS_THREADPOOL_QUEUE 1024
+#endif
+
+// Default highWaterMark of fs::ReadStream and fs::WriteStream, in bytes
+#ifndef JSCPP_FS_STREAM_HIGH_WATER_MARK
+  #define JSCPP_FS_STREAM_HIGH_WATER_MARK (64 * 1024)
+#endif
+
+#if JSCPP_STRING_UTF8 && defined(_WIN32)
+  #error "JSCPP_STRING_UTF8 is not supported on Windows, whose file APIs take UTF-16."
+#endif
+
+#if JSCPP_STRING_UTF8 && JSCPP_STRING_UTF16
+  #error "JSCPP_STRING_UTF8 and JSCPP_STRING_UTF16 are mutually exclusive."
+#endif
+
 #endif
@@ -2,8 +2,16 @@
 #define __JSCPP_FS_HPP__
 
 #include "String.hpp"
+#include "StringView.hpp"
 
+#include <atomic>
 #include <ctime>
+#include <functional>
+#include <iterator>
+#include <future>
+#include <memory>
+#include <system_error>
+#include <utility>
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -36,24 +44,79 @@ enum SymlinkType {
   ST_JUNCTION
 };
 
+// Type of a directory entry as reported by the directory listing itself.
+enum FileType {
+  FT_UNKNOWN,
+  FT_FILE,
+  FT_DIRECTORY,
+  FT_SYMLINK,
+  FT_FIFO,
+  FT_SOCKET,
+  FT_CHARACTER_DEVICE,
+  FT_BLOCK_DEVICE
+};
+
+// Fields fs::stat can be limited to. The values are Linux's statx mask
+// bits; other systems fill in everything they have regardless.
+enum StatField {
+  SF_TYPE = 0x1,
+  SF_MODE = 0x2,
+  SF_NLINK = 0x4,
+  SF_UID = 0x8,
+  SF_GID = 0x10,
+  SF_ATIME = 0x20,
+  SF_MTIME = 0x40,
+  SF_CTIME = 0x80,
+  SF_INO = 0x100,
+  SF_SIZE = 0x200,
+  SF_BLOCKS = 0x400,
+  SF_BASIC = 0x7ff,
+  SF_BIRTHTIME = 0x800,
+  SF_ALL = 0xfff
+};
+
+class DirHandle;
+class FileHandle;
+class Stats;
+struct StatManyOptions;
+JSCPP_API std::vector<std::pair<int, Stats>> statMany(const std::vector<String>&, const StatManyOptions&);
+
 class JSCPP_API Stats {
 private:
+  friend class DirHandle;
+  friend class FileHandle;
+  friend std::vector<std::pair<int, Stats>> statMany(const std::vector<String>&, const StatManyOptions&);
   bool _isLink;
+#ifndef _WIN32
+  static int statAt(int dirfd, const char* name, bool followLink, unsigned int fields, Stats& r) noexcept;
+#endif
+  static int statFd(int fd, unsigned int fields, Stats& r) noexcept;
 public:
-  static Stats create(const String&, bool followLink = false);
-  static int createNoThrow(Stats& out, const String& p, bool followLink = false);
-
-  unsigned int dev;
-  unsigned short ino;
-  unsigned short mode;
-  short nlink;
-  short gid;
-  short uid;
-  unsigned int rdev;
-  long size;
+  Stats() noexcept;
+  static Stats create(const String&, bool followLink = false, unsigned int fields = SF_ALL);
+  static int createNoThrow(Stats& out, const String& p, bool followLink = false, unsigned int fields = SF_ALL);
+
+  // SF_ bits of the fields that were filled in; the others are 0.
+  unsigned int mask;
+  uint64_t dev;
+  uint64_t ino;
+  uint32_t mode;
+  uint64_t nlink;
+  uint32_t gid;
+  uint32_t uid;
+  uint64_t rdev;
+  int64_t size;
+  int64_t blksize;
+  int64_t blocks;
   time_t atime;
   time_t mtime;
   time_t ctime;
+  time_t birthtime;
+  // Nanoseconds since the epoch
+  int64_t atimeNs;
+  int64_t mtimeNs;
+  int64_t ctimeNs;
+  int64_t birthtimeNs;
 
   bool isFile() const noexcept;
   bool isDirectory() const noexcept;
@@ -64,12 +127,83 @@ public:
   bool isSocket() const noexcept;
 };
 
-JSCPP_API Stats stat(const String&);
-JSCPP_API Stats lstat(const String&);
+JSCPP_API Stats stat(const String&, unsigned int fields = SF_ALL);
+JSCPP_API Stats lstat(const String&, unsigned int fields = SF_ALL);
+JSCPP_API Stats stat(const String&, std::error_code& ec, unsigned int fields = SF_ALL);
+JSCPP_API Stats lstat(const String&, std::error_code& ec, unsigned int fields = SF_ALL);
+
+struct JSCPP_API StatManyOptions {
+  // Stats in flight at once: the io_uring queue depth, or the number of
+  // threads when falling back to a pool. 0 picks one per core for threads.
+  unsigned concurrency;
+  bool followLink;
+  unsigned int fields;
+  // Batch the calls through io_uring where the kernel supports statx there
+  bool ioUring;
+
+  StatManyOptions() noexcept: concurrency(0), followLink(true), fields(SF_ALL), ioUring(true) {}
+};
+
+/**
+ * Stats every path, in parallel. Each result holds 0 or the errno value
+ * of its path together with the Stats, so misses do not throw.
+ */
+JSCPP_API std::vector<std::pair<int, Stats>> statMany(const std::vector<String>& paths,
+                                                      const StatManyOptions& options = StatManyOptions());
 
 class Dirent;
 class Dir;
 
+/**
+ * Entry produced by iterating a Dir. The name points into the listing's
+ * own buffer and stays valid only until the iterator moves on; name()
+ * copies it into a String.
+ */
+class JSCPP_API DirentView {
+public:
+#ifdef _WIN32
+  typedef wchar_t char_type;
+#else
+  typedef char char_type;
+#endif
+
+  DirentView() noexcept: name_(nullptr), length_(0), type_(FT_UNKNOWN) {}
+  DirentView(const char_type* name, size_t length, FileType type) noexcept:
+    name_(name), length_(length), type_(type) {}
+
+  const char_type* nameData() const noexcept { return name_; }
+  size_t nameLength() const noexcept { return length_; }
+  String name() const;
+  FileType type() const noexcept { return type_; }
+
+  bool isFile() const noexcept { return type_ == FT_FILE; }
+  bool isDirectory() const noexcept { return type_ == FT_DIRECTORY; }
+  bool isSymbolicLink() const noexcept { return type_ == FT_SYMLINK; }
+
+private:
+  const char_type* name_;
+  size_t length_;
+  FileType type_;
+};
+
+// Input iterator over a Dir, skipping "." and "..".
+class JSCPP_API DirIterator {
+public:
+  DirIterator() noexcept: dir_(nullptr) {}
+  explicit DirIterator(Dir* dir);
+
+  const DirentView& operator*() const noexcept { return entry_; }
+  const DirentView* operator->() const noexcept { return &entry_; }
+  DirIterator& operator++();
+
+  bool operator==(const DirIterator& other) const noexcept { return dir_ == other.dir_; }
+  bool operator!=(const DirIterator& other) const noexcept { return dir_ != other.dir_; }
+
+private:
+  Dir* dir_;
+  DirentView entry_;
+};
+
 #ifdef _WIN32
 class JSCPP_API Dirent {
 private:
@@ -102,9 +236,12 @@ public:
 
 class JSCPP_API Dir {
 private:
+  friend class DirIterator;
   intptr_t dir_;
   String path_;
   struct _wfinddata_t* first_data_;
+  bool iterating_;
+  bool next(DirentView& entry);
 public:
   ~Dir() noexcept;
   Dir() noexcept;
@@ -114,9 +251,13 @@ public:
   Dir& operator=(Dir&&);
 
   static Dir create(const String&);
+  static Dir create(const String&, std::error_code& ec);
   void close();
   String path() const noexcept;
   fs::Dirent read();
+  // Continues from where read() left off
+  DirIterator begin();
+  DirIterator end() noexcept;
 };
 #else
 
@@ -151,8 +292,10 @@ public:
 
 class JSCPP_API Dir {
 private:
+  friend class DirIterator;
   DIR* dir_;
   String path_;
+  bool next(DirentView& entry);
 public:
   ~Dir();
   Dir() noexcept;
@@ -162,14 +305,556 @@ public:
   Dir& operator=(Dir&& d);
 
   static Dir create(const String& p);
+  static Dir create(const String& p, std::error_code& ec);
   void close();
   String path() const noexcept;
   fs::Dirent read() const noexcept;
+  // Continues from where read() left off
+  DirIterator begin();
+  DirIterator end() noexcept;
+};
+#endif
+
+class JSCPP_API DirentInfo {
+public:
+  StringView name;
+  FileType type;
+
+  bool isFile() const noexcept { return type == FT_FILE; }
+  bool isDirectory() const noexcept { return type == FT_DIRECTORY; }
+  bool isSymbolicLink() const noexcept { return type == FT_SYMLINK; }
+};
+
+class DirentList;
+JSCPP_API DirentList readdirWithFileTypes(const String&);
+JSCPP_API DirentList readdirWithFileTypes(const String&, std::error_code& ec);
+
+/**
+ * Result of readdirWithFileTypes. All names are stored back to back in one
+ * buffer owned by the list, which is why it can be moved but not copied.
+ */
+class JSCPP_API DirentList {
+public:
+  typedef std::vector<DirentInfo>::const_iterator const_iterator;
+
+  DirentList() noexcept {}
+  DirentList(const DirentList&) = delete;
+  DirentList& operator=(const DirentList&) = delete;
+  DirentList(DirentList&&) = default;
+  DirentList& operator=(DirentList&&) = default;
+
+  const_iterator begin() const noexcept { return entries_.begin(); }
+  const_iterator end() const noexcept { return entries_.end(); }
+  size_t size() const noexcept { return entries_.size(); }
+  bool empty() const noexcept { return entries_.empty(); }
+  const DirentInfo& operator[](size_t index) const noexcept { return entries_[index]; }
+
+private:
+  friend DirentList readdirWithFileTypes(const String&);
+  friend DirentList readdirWithFileTypes(const String&, std::error_code& ec);
+  std::vector<String::value_type> names_;
+  std::vector<DirentInfo> entries_;
 };
+
+/**
+ * An open directory that names are resolved against, so walking a tree
+ * looks up one component per call instead of a whole path, and entries
+ * cannot be swapped out by renaming a parent midway. On Windows it keeps
+ * the path and joins it instead.
+ *
+ * Names are single components. path() is only used in error messages.
+ */
+class JSCPP_API DirHandle {
+private:
+#ifndef _WIN32
+  int fd_;
 #endif
+  String path_;
+public:
+  ~DirHandle();
+  DirHandle() noexcept;
+  DirHandle(const DirHandle&) = delete;
+  DirHandle& operator=(const DirHandle&) = delete;
+  DirHandle(DirHandle&&) noexcept;
+  DirHandle& operator=(DirHandle&&) noexcept;
+
+  static DirHandle open(const String& p);
+  static DirHandle open(const String& p, std::error_code& ec);
+  // Opens a subdirectory; a symbolic link is only followed when asked to.
+  DirHandle openAt(const String& name, bool followLink = false) const;
+  DirHandle openAt(const String& name, std::error_code& ec, bool followLink = false) const;
+  void close() noexcept;
+  bool isOpen() const noexcept;
+  const String& path() const noexcept;
+#ifndef _WIN32
+  int fd() const noexcept;
+#endif
+
+  Stats stat(const String& name, bool followLink = false, unsigned int fields = SF_ALL) const;
+  Stats stat(const String& name, std::error_code& ec, bool followLink = false, unsigned int fields = SF_ALL) const;
+  // Returns 0 or the errno value.
+  int statNoThrow(Stats& out, const String& name, bool followLink = false, unsigned int fields = SF_ALL) const;
+  std::vector<String> readdir() const;
+  std::vector<String> readdir(std::error_code& ec) const;
+  void mkdir(const String& name, int mode = 0777) const;
+  void mkdir(const String& name, std::error_code& ec, int mode = 0777) const;
+  void unlink(const String& name) const;
+  void unlink(const String& name, std::error_code& ec) const;
+  void rmdir(const String& name) const;
+  void rmdir(const String& name, std::error_code& ec) const;
+  String readlink(const String& name) const;
+  String readlink(const String& name, std::error_code& ec) const;
+  void symlink(const String& target, const String& name) const;
+  void symlink(const String& target, const String& name, std::error_code& ec) const;
+};
+
+enum CopyFileStrategy {
+  // Source and destination are the same file, nothing was copied
+  CF_NONE,
+  // Reflink sharing the source's extents (btrfs, xfs)
+  CF_CLONE,
+  CF_COPY_FILE_RANGE,
+  CF_SENDFILE,
+  CF_READ_WRITE,
+  // CopyFileW on Windows
+  CF_SYSTEM
+};
+
+struct JSCPP_API CopyFileOptions {
+  bool failIfExists;
+  // Also copy access and modification times; the mode is always copied
+  bool preserveTimestamps;
+
+  CopyFileOptions() noexcept: failIfExists(false), preserveTimestamps(false) {}
+};
+
+struct JSCPP_API CopyOptions {
+  // Threads copying at once, 0 for one per core
+  unsigned concurrency;
+  // Copy what symbolic links point to instead of recreating the links
+  bool dereference;
+  bool errorOnExist;
+  bool preserveTimestamps;
+  // Called with the source and destination of every entry, the root
+  // included. Returning false skips it and, for a directory, its contents.
+  // Unless concurrency is 1 it runs concurrently on pool threads, so it
+  // has to be thread-safe.
+  std::function<bool(const String&, const String&)> filter;
+
+  CopyOptions() noexcept:
+    concurrency(0), dereference(false), errorOnExist(false), preserveTimestamps(false) {}
+};
+
+struct JSCPP_API RemoveOptions {
+  // Threads removing at once, 0 for one per core
+  unsigned concurrency;
 
+  RemoveOptions() noexcept: concurrency(0) {}
+};
+
+struct JSCPP_API MoveOptions {
+  // Fail with EEXIST rather than replace the destination
+  bool noReplace;
+  // Atomically swap source and destination, which must both exist
+  bool exchange;
+  // Threads copying at once when the move has to cross devices, 0 for
+  // one per core
+  unsigned concurrency;
+
+  MoveOptions() noexcept: noReplace(false), exchange(false), concurrency(0) {}
+};
+
+struct JSCPP_API WalkEntry {
+  // The root joined with the entry's name and those of its parents
+  String path;
+  String name;
+  // FT_SYMLINK for links, even those followed into
+  FileType type;
+  // 0 for entries directly in the root
+  size_t depth;
+};
+
+struct JSCPP_API WalkOptions {
+  // Deepest entries reported, 0 for only the root's own entries
+  size_t maxDepth;
+  // Threads walking at once, 0 for one per core. With more than one the
+  // callbacks run concurrently and in no particular order.
+  unsigned concurrency;
+  // Descend into symbolic links to directories, each directory only once
+  bool followSymlinks;
+  // Called for each directory before descending; returning false prunes it.
+  std::function<bool(const WalkEntry&)> descend;
+
+  WalkOptions() noexcept: maxDepth(static_cast<size_t>(-1)), concurrency(1), followSymlinks(false) {}
+};
+
+enum WriteFlag {
+  // Create or truncate
+  WF_WRITE,
+  // Create or append
+  WF_APPEND,
+  // Create, failing with EEXIST if the file is there
+  WF_EXCLUSIVE
+};
+
+struct JSCPP_API WriteFileOptions {
+  // Write a temporary file next to the target, flush it and rename it over
+  // the target, so a crash leaves either the old or the new contents.
+  // Symbolic links at the path are followed, up to 40 of them, and the file
+  // they point to is replaced. With WF_EXCLUSIVE any existing path fails,
+  // links included. Not available with WF_APPEND.
+  bool atomic;
+  // Flush the data to disk before returning, always done when atomic
+  bool fsync;
+  // Permissions of a new file, before the umask. An atomic write keeps
+  // those of the file it replaces.
+  int mode;
+  WriteFlag flag;
+
+  WriteFileOptions() noexcept: atomic(false), fsync(false), mode(0666), flag(WF_WRITE) {}
+};
+
+enum MapAdvice {
+  MA_NORMAL,
+  MA_SEQUENTIAL,
+  MA_RANDOM,
+  MA_WILLNEED
+};
+
+class JSCPP_API ByteView {
+private:
+  const uint8_t* data_;
+  size_t size_;
+public:
+  static const size_t npos = static_cast<size_t>(-1);
+
+  ByteView() noexcept: data_(nullptr), size_(0) {}
+  ByteView(const uint8_t* data, size_t size) noexcept: data_(data), size_(size) {}
+
+  const uint8_t* data() const noexcept { return data_; }
+  size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+  const uint8_t* begin() const noexcept { return data_; }
+  const uint8_t* end() const noexcept { return data_ + size_; }
+  const uint8_t& operator[](size_t index) const noexcept { return data_[index]; }
+
+  ByteView slice(size_t offset, size_t length = npos) const noexcept;
+};
+
+/**
+ * Read-only contents of a file. Regular files are memory mapped, so loading
+ * costs page faults instead of copies. Small files, pipes, devices and files
+ * whose stat size is 0 (procfs) are read into a heap buffer instead.
+ */
+class JSCPP_API MappedBuffer {
+private:
+  uint8_t* data_;
+  size_t size_;
+  bool mapped_;
+  // On failure syscall names the step that failed
+  static MappedBuffer load(const String& p, MapAdvice advice, std::error_code& ec, const char*& syscall);
+public:
+  ~MappedBuffer();
+  MappedBuffer() noexcept;
+  MappedBuffer(const MappedBuffer&) = delete;
+  MappedBuffer& operator=(const MappedBuffer&) = delete;
+  MappedBuffer(MappedBuffer&&) noexcept;
+  MappedBuffer& operator=(MappedBuffer&&) noexcept;
+
+  static MappedBuffer create(const String& p, MapAdvice advice = MA_NORMAL);
+  static MappedBuffer create(const String& p, std::error_code& ec, MapAdvice advice = MA_NORMAL);
+
+  const uint8_t* data() const noexcept;
+  size_t size() const noexcept;
+  bool empty() const noexcept;
+  bool isMapped() const noexcept;
+  ByteView view(size_t offset = 0, size_t length = ByteView::npos) const noexcept;
+
+  // Access pattern hint for the mapped pages; ignored for heap buffers.
+  void advise(MapAdvice advice) const noexcept;
+  void close() noexcept;
+};
+
+enum OpenFlag {
+  OF_READ = 0x1,
+  OF_WRITE = 0x2,
+  OF_READ_WRITE = 0x3,
+  OF_CREATE = 0x4,
+  OF_TRUNCATE = 0x8,
+  OF_APPEND = 0x10,
+  // With OF_CREATE, fail with EEXIST if the file is there
+  OF_EXCLUSIVE = 0x20,
+  // Bypass the page cache (O_DIRECT, F_NOCACHE on macOS, no buffering on
+  // Windows). Buffers, offsets and sizes must then be multiples of the
+  // device's block size.
+  OF_DIRECT = 0x40,
+  // Leave the access time alone (O_NOATIME on Linux). Dropped for files
+  // the caller does not own, which the kernel refuses it for.
+  OF_NOATIME = 0x80,
+  // Writes return once their data is on disk (O_DSYNC)
+  OF_DSYNC = 0x100,
+  // Let child processes inherit the descriptor, which is close-on-exec
+  // otherwise
+  OF_INHERIT = 0x200
+};
+
+enum FileAdvice {
+  FA_NORMAL,
+  FA_SEQUENTIAL,
+  FA_RANDOM,
+  FA_WILLNEED,
+  FA_DONTNEED,
+  FA_NOREUSE
+};
+
+// One buffer of a vectored read
+struct JSCPP_API IoBuffer {
+  uint8_t* data;
+  size_t size;
+
+  IoBuffer(uint8_t* data, size_t size) noexcept: data(data), size(size) {}
+};
+
+/**
+ * An open file, closed on destruction. Reads stop short of size only at
+ * the end of the file, writes retry until everything is written. The
+ * positional forms leave the file offset alone.
+ *
+ * fd() is a C runtime descriptor on Windows, see _get_osfhandle().
+ */
+class JSCPP_API FileHandle {
+private:
+  int fd_;
+  String path_;
+public:
+  ~FileHandle();
+  FileHandle() noexcept;
+  FileHandle(const FileHandle&) = delete;
+  FileHandle& operator=(const FileHandle&) = delete;
+  FileHandle(FileHandle&&) noexcept;
+  FileHandle& operator=(FileHandle&&) noexcept;
+
+  // OF_ bits; mode only applies to a file that gets created
+  static FileHandle open(const String& p, int flags = OF_READ, int mode = 0666);
+  static FileHandle open(const String& p, std::error_code& ec, int flags = OF_READ, int mode = 0666);
+  // Takes ownership of fd; the path is only used in error messages
+  static FileHandle adopt(int fd, const String& p = String()) noexcept;
+  // Gives up the descriptor without closing it
+  int release() noexcept;
+  void close();
+  void close(std::error_code& ec) noexcept;
+  bool isOpen() const noexcept;
+  int fd() const noexcept;
+  const String& path() const noexcept;
+
+  size_t read(void* buf, size_t size) const;
+  size_t read(void* buf, size_t size, std::error_code& ec) const;
+  size_t pread(void* buf, size_t size, uint64_t offset) const;
+  size_t pread(void* buf, size_t size, uint64_t offset, std::error_code& ec) const;
+  void write(const void* buf, size_t size) const;
+  void write(const void* buf, size_t size, std::error_code& ec) const;
+  void pwrite(const void* buf, size_t size, uint64_t offset) const;
+  void pwrite(const void* buf, size_t size, uint64_t offset, std::error_code& ec) const;
+  // A negative position uses and advances the file offset
+  size_t readv(const std::vector<IoBuffer>& buffers, int64_t position = -1) const;
+  size_t readv(const std::vector<IoBuffer>& buffers, std::error_code& ec, int64_t position = -1) const;
+  void writev(const std::vector<ByteView>& buffers, int64_t position = -1) const;
+  void writev(const std::vector<ByteView>& buffers, std::error_code& ec, int64_t position = -1) const;
+
+  void truncate(uint64_t size = 0) const;
+  void truncate(std::error_code& ec, uint64_t size = 0) const;
+  // Reserves the range on disk, growing the file if it ends before it,
+  // so later writes there cannot run out of space
+  void allocate(uint64_t offset, uint64_t length) const;
+  void allocate(uint64_t offset, uint64_t length, std::error_code& ec) const;
+  void sync() const;
+  void sync(std::error_code& ec) const;
+  // Like sync(), skipping metadata that is not needed to read the data back
+  void datasync() const;
+  void datasync(std::error_code& ec) const;
+  Stats stat(unsigned int fields = SF_ALL) const;
+  Stats stat(std::error_code& ec, unsigned int fields = SF_ALL) const;
+  // Access pattern hint for a range, 0 length meaning up to the end.
+  // Ignored where posix_fadvise() is missing.
+  void advise(FileAdvice advice, uint64_t offset = 0, uint64_t length = 0) const;
+  void advise(FileAdvice advice, std::error_code& ec, uint64_t offset = 0, uint64_t length = 0) const;
+};
+
+struct JSCPP_API ReadManyOptions {
+  // Files in flight at once: twice this is the io_uring queue depth, or
+  // the number of threads when falling back to a pool. 0 picks one per
+  // core for threads.
+  unsigned concurrency;
+  // Batch opens, stats, reads and closes through io_uring where the kernel
+  // supports them
+  bool ioUring;
+
+  ReadManyOptions() noexcept: concurrency(0), ioUring(true) {}
+};
+
+struct JSCPP_API WriteManyOptions {
+  // As in ReadManyOptions
+  unsigned concurrency;
+  bool ioUring;
+  // For files that get created
+  int mode;
+  // Flush each file's data before closing it
+  bool fsync;
+
+  WriteManyOptions() noexcept: concurrency(0), ioUring(true), mode(0666), fsync(false) {}
+};
+
+/**
+ * Reads every file, in parallel. Each result holds 0 or the errno value
+ * of its path together with the content, so misses do not throw.
+ */
+JSCPP_API std::vector<std::pair<int, std::vector<uint8_t>>> readMany(const std::vector<String>& paths,
+                                                                     const ReadManyOptions& options = ReadManyOptions());
+// Creates or truncates every file and writes its content, in parallel.
+// Returns 0 or the errno value for each file.
+JSCPP_API std::vector<int> writeMany(const std::vector<std::pair<String, ByteView>>& files,
+                                     const WriteManyOptions& options = WriteManyOptions());
+
+struct JSCPP_API ReadStreamOptions {
+  // First byte to read. Pipes, sockets and character devices are read as
+  // they come and fail with ESPIPE for anything but 0.
+  uint64_t start;
+  // Last byte to read, inclusive as in Node; -1 reads to the end
+  int64_t end;
+  // Largest chunk read() returns, which is also the stream's buffer size
+  size_t highWaterMark;
+
+  ReadStreamOptions() noexcept: start(0), end(-1), highWaterMark(JSCPP_FS_STREAM_HIGH_WATER_MARK) {}
+};
+
+struct JSCPP_API WriteStreamOptions {
+  WriteFlag flag;
+  // For a file that gets created
+  int mode;
+  // Bytes buffered before they are written out. Larger writes skip the
+  // buffer.
+  size_t highWaterMark;
+
+  WriteStreamOptions() noexcept: flag(WF_WRITE), mode(0666), highWaterMark(JSCPP_FS_STREAM_HIGH_WATER_MARK) {}
+};
+
+class WriteStream;
+
+/**
+ * Reads a file, or a range of it, in chunks of up to highWaterMark bytes
+ * that all land in the same buffer. Buffers of closed streams are kept for
+ * the next ones, so streaming file after file allocates nothing once
+ * warm. The file is closed as soon as the end is reached.
+ *
+ *   for (fs::ByteView chunk : stream) { ... }
+ */
+class JSCPP_API ReadStream {
+public:
+  class JSCPP_API Iterator {
+  public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef ByteView value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const ByteView* pointer;
+    typedef const ByteView& reference;
+
+    Iterator() noexcept: stream_(nullptr), chunk_() {}
+    explicit Iterator(ReadStream* stream);
+    const ByteView& operator*() const noexcept { return chunk_; }
+    const ByteView* operator->() const noexcept { return &chunk_; }
+    Iterator& operator++();
+    bool operator==(const Iterator& other) const noexcept { return stream_ == other.stream_; }
+    bool operator!=(const Iterator& other) const noexcept { return stream_ != other.stream_; }
+  private:
+    ReadStream* stream_;
+    ByteView chunk_;
+  };
+
+  ~ReadStream();
+  ReadStream() noexcept;
+  ReadStream(const ReadStream&) = delete;
+  ReadStream& operator=(const ReadStream&) = delete;
+  ReadStream(ReadStream&&) noexcept;
+  ReadStream& operator=(ReadStream&&) noexcept;
+
+  static ReadStream open(const String& p, const ReadStreamOptions& options = ReadStreamOptions());
+  static ReadStream open(const String& p, std::error_code& ec, const ReadStreamOptions& options = ReadStreamOptions());
+
+  // Next chunk, empty once the range is done. Valid until the next call.
+  ByteView read();
+  ByteView read(std::error_code& ec);
+  // Chunks from the current position on, through the throwing read()
+  Iterator begin();
+  Iterator end() noexcept;
+  // Writes the rest of the stream to dest and flushes it, pulling the next
+  // chunk only once dest has taken the last one, so no more than the two
+  // buffers are ever held. Returns the bytes piped.
+  uint64_t pipe(WriteStream& dest);
+  uint64_t pipe(WriteStream& dest, std::error_code& ec);
+
+  bool ended() const noexcept;
+  uint64_t bytesRead() const noexcept;
+  const String& path() const noexcept;
+  void close() noexcept;
+
+private:
+  FileHandle file_;
+  std::vector<uint8_t> buffer_;
+  uint64_t position_;
+  int64_t end_;
+  uint64_t bytesRead_;
+  // Pipes, sockets and character devices cannot read at an offset
+  bool sequential_;
+  bool ended_;
+};
+
+/**
+ * Writes a file through a buffer of highWaterMark bytes. The buffered data
+ * is dropped when writing it out fails. Closing flushes, and so does
+ * destruction, which ignores errors.
+ */
+class JSCPP_API WriteStream {
+public:
+  ~WriteStream();
+  WriteStream() noexcept;
+  WriteStream(const WriteStream&) = delete;
+  WriteStream& operator=(const WriteStream&) = delete;
+  WriteStream(WriteStream&&) noexcept;
+  WriteStream& operator=(WriteStream&&) noexcept;
+
+  static WriteStream open(const String& p, const WriteStreamOptions& options = WriteStreamOptions());
+  static WriteStream open(const String& p, std::error_code& ec,
+                          const WriteStreamOptions& options = WriteStreamOptions());
+
+  void write(const void* data, size_t size);
+  void write(const void* data, size_t size, std::error_code& ec);
+  void write(const ByteView& data);
+  void write(const ByteView& data, std::error_code& ec);
+  // Hands the buffered bytes to the system, without fsync()
+  void flush();
+  void flush(std::error_code& ec);
+  void close();
+  void close(std::error_code& ec);
+
+  bool isOpen() const noexcept;
+  // Bytes waiting in the buffer
+  size_t buffered() const noexcept;
+  uint64_t bytesWritten() const noexcept;
+  const String& path() const noexcept;
+
+private:
+  FileHandle file_;
+  std::vector<uint8_t> buffer_;
+  size_t buffered_;
+  uint64_t bytesWritten_;
+};
+
+JSCPP_API FileHandle open(const String&, int flags = OF_READ, int mode = 0666);
 JSCPP_API fs::Dir opendir(const String&);
 JSCPP_API std::vector<String> readdir(const String&);
+JSCPP_API DirentList readdirWithFileTypes(const String&);
+JSCPP_API ReadStream createReadStream(const String&, const ReadStreamOptions& options = ReadStreamOptions());
+JSCPP_API WriteStream createWriteStream(const String&, const WriteStreamOptions& options = WriteStreamOptions());
 
 JSCPP_API void access(const String&, int mode = 0);
 JSCPP_API void chmod(const String&, int mode);
@@ -181,20 +866,181 @@ JSCPP_API void unlink(const String&);
 JSCPP_API void rmdir(const String&);
 JSCPP_API void rename(const String&, const String&);
 JSCPP_API void remove(const String&);
+JSCPP_API void remove(const String&, const RemoveOptions& options);
 
 JSCPP_API void symlink(const String&, const String&);
 JSCPP_API void symlink(const String&, const String&, SymlinkType);
 JSCPP_API String realpath(const String&);
+JSCPP_API String readlink(const String&);
 JSCPP_API void copyFile(const String&, const String&, bool failIfExists = false);
+JSCPP_API CopyFileStrategy copyFile(const String&, const String&, const CopyFileOptions& options);
 JSCPP_API void copy(const String&, const String&, bool failIfExists = false);
+JSCPP_API void copy(const String&, const String&, const CopyOptions& options);
 JSCPP_API void move(const String&, const String&);
+JSCPP_API void move(const String&, const String&, const MoveOptions& options);
+JSCPP_API void walk(const String& root, const std::function<void(const WalkEntry&)>& callback,
+                    const WalkOptions& options = WalkOptions());
 JSCPP_API std::vector<uint8_t> readFile(const String&);
+JSCPP_API MappedBuffer mapFile(const String&, MapAdvice advice = MA_NORMAL);
 JSCPP_API String readFileAsString(const String&);
 JSCPP_API void writeFile(const String&, const std::vector<uint8_t>&);
 JSCPP_API void writeFile(const String&, const String&);
+JSCPP_API void writeFile(const String&, const std::vector<uint8_t>&, const WriteFileOptions& options);
+JSCPP_API void writeFile(const String&, const String&, const WriteFileOptions& options);
 JSCPP_API void appendFile(const String&, const std::vector<uint8_t>&);
 JSCPP_API void appendFile(const String&, const String&);
 
+// Non-throwing forms: failures are reported through ec, which is cleared
+// on success, and no message is built unless ec.message() is called. Tree
+// operations report their first failure; exceptions thrown by callbacks
+// still propagate.
+JSCPP_API FileHandle open(const String&, std::error_code& ec, int flags = OF_READ, int mode = 0666);
+JSCPP_API fs::Dir opendir(const String&, std::error_code& ec);
+JSCPP_API std::vector<String> readdir(const String&, std::error_code& ec);
+JSCPP_API DirentList readdirWithFileTypes(const String&, std::error_code& ec);
+JSCPP_API ReadStream createReadStream(const String&, std::error_code& ec,
+                                      const ReadStreamOptions& options = ReadStreamOptions());
+JSCPP_API WriteStream createWriteStream(const String&, std::error_code& ec,
+                                        const WriteStreamOptions& options = WriteStreamOptions());
+
+JSCPP_API void access(const String&, std::error_code& ec, int mode = 0);
+JSCPP_API void chmod(const String&, int mode, std::error_code& ec);
+
+JSCPP_API void mkdir(const String&, std::error_code& ec, int mode = 0777);
+JSCPP_API void mkdirs(const String&, std::error_code& ec, int mode = 0777);
+JSCPP_API void unlink(const String&, std::error_code& ec);
+JSCPP_API void rmdir(const String&, std::error_code& ec);
+JSCPP_API void rename(const String&, const String&, std::error_code& ec);
+JSCPP_API void remove(const String&, std::error_code& ec);
+JSCPP_API void remove(const String&, const RemoveOptions& options, std::error_code& ec);
+
+JSCPP_API void symlink(const String&, const String&, std::error_code& ec);
+JSCPP_API void symlink(const String&, const String&, SymlinkType, std::error_code& ec);
+JSCPP_API String realpath(const String&, std::error_code& ec);
+JSCPP_API String readlink(const String&, std::error_code& ec);
+JSCPP_API void copyFile(const String&, const String&, std::error_code& ec, bool failIfExists = false);
+JSCPP_API CopyFileStrategy copyFile(const String&, const String&, const CopyFileOptions& options, std::error_code& ec);
+JSCPP_API void copy(const String&, const String&, std::error_code& ec, bool failIfExists = false);
+JSCPP_API void copy(const String&, const String&, const CopyOptions& options, std::error_code& ec);
+JSCPP_API void move(const String&, const String&, std::error_code& ec);
+JSCPP_API void move(const String&, const String&, const MoveOptions& options, std::error_code& ec);
+JSCPP_API void walk(const String& root, const std::function<void(const WalkEntry&)>& callback, std::error_code& ec,
+                    const WalkOptions& options = WalkOptions());
+JSCPP_API std::vector<uint8_t> readFile(const String&, std::error_code& ec);
+JSCPP_API MappedBuffer mapFile(const String&, std::error_code& ec, MapAdvice advice = MA_NORMAL);
+JSCPP_API String readFileAsString(const String&, std::error_code& ec);
+JSCPP_API void writeFile(const String&, const std::vector<uint8_t>&, std::error_code& ec);
+JSCPP_API void writeFile(const String&, const String&, std::error_code& ec);
+JSCPP_API void writeFile(const String&, const std::vector<uint8_t>&, const WriteFileOptions& options,
+                         std::error_code& ec);
+JSCPP_API void writeFile(const String&, const String&, const WriteFileOptions& options, std::error_code& ec);
+JSCPP_API void appendFile(const String&, const std::vector<uint8_t>&, std::error_code& ec);
+JSCPP_API void appendFile(const String&, const String&, std::error_code& ec);
+
+struct JSCPP_API ThreadPoolOptions {
+  // 0 reads JSCPP_THREADPOOL_SIZE from the environment, falling back to
+  // JSCPP_FS_THREADPOOL_SIZE. At most 1024.
+  unsigned threads;
+  // Calls waiting for a thread before submitting more blocks, 0 for no limit
+  size_t maxQueued;
+
+  ThreadPoolOptions() noexcept: threads(0), maxQueued(JSCPP_FS_THREADPOOL_QUEUE) {}
+};
+
+// Sets up the pool behind the asynchronous calls. Only works before the
+// first of them, returns false once the pool is running.
+JSCPP_API bool configureThreadPool(const ThreadPoolOptions& options);
+// Threads of the pool, starting it if needed
+JSCPP_API unsigned threadPoolSize();
+
+/**
+ * Cancels asynchronous calls that have not started yet, which then
+ * complete with ECANCELED, like uv_cancel(). Calls already running finish
+ * normally. One token may be shared by any number of calls.
+ */
+class JSCPP_API CancelToken {
+public:
+  CancelToken();
+  void cancel() noexcept;
+  bool cancelled() const noexcept;
+private:
+  std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+template <typename T>
+using Callback = std::function<void(const std::error_code&, T)>;
+typedef std::function<void(const std::error_code&)> DoneCallback;
+
+// Runs work on the pool, with ECANCELED instead if the token was cancelled
+// before it started. Exceptions thrown by work are dropped.
+JSCPP_API void queueWork(const DoneCallback& work, const CancelToken& token = CancelToken());
+
+// Asynchronous forms, run on the pool. The futures rethrow what the
+// synchronous call would have thrown. Callbacks run on a pool thread with
+// the error the std::error_code form reports, or ECANCELED when the call
+// threw something without an error code, such as a CopyOptions::filter.
+// Exceptions thrown by callbacks are dropped. Calls made from callbacks
+// never block on a full queue.
+JSCPP_API std::future<std::vector<uint8_t>> readFileAsync(const String&, const CancelToken& token = CancelToken());
+JSCPP_API std::future<String> readFileAsStringAsync(const String&, const CancelToken& token = CancelToken());
+JSCPP_API std::future<void> writeFileAsync(const String&, const std::vector<uint8_t>&,
+                                           const WriteFileOptions& options = WriteFileOptions(),
+                                           const CancelToken& token = CancelToken());
+JSCPP_API std::future<void> writeFileAsync(const String&, const String&,
+                                           const WriteFileOptions& options = WriteFileOptions(),
+                                           const CancelToken& token = CancelToken());
+JSCPP_API std::future<void> appendFileAsync(const String&, const std::vector<uint8_t>&,
+                                            const CancelToken& token = CancelToken());
+JSCPP_API std::future<void> appendFileAsync(const String&, const String&, const CancelToken& token = CancelToken());
+JSCPP_API std::future<Stats> statAsync(const String&, unsigned int fields = SF_ALL,
+                                       const CancelToken& token = CancelToken());
+JSCPP_API std::future<Stats> lstatAsync(const String&, unsigned int fields = SF_ALL,
+                                        const CancelToken& token = CancelToken());
+JSCPP_API std::future<bool> existsAsync(const String&, const CancelToken& token = CancelToken());
+JSCPP_API std::future<std::vector<String>> readdirAsync(const String&, const CancelToken& token = CancelToken());
+JSCPP_API std::future<void> mkdirsAsync(const String&, int mode = 0777, const CancelToken& token = CancelToken());
+JSCPP_API std::future<void> unlinkAsync(const String&, const CancelToken& token = CancelToken());
+JSCPP_API std::future<void> renameAsync(const String&, const String&, const CancelToken& token = CancelToken());
+JSCPP_API std::future<void> copyAsync(const String&, const String&, const CopyOptions& options = CopyOptions(),
+                                      const CancelToken& token = CancelToken());
+JSCPP_API std::future<void> moveAsync(const String&, const String&, const MoveOptions& options = MoveOptions(),
+                                      const CancelToken& token = CancelToken());
+JSCPP_API std::future<void> removeAsync(const String&, const RemoveOptions& options = RemoveOptions(),
+                                        const CancelToken& token = CancelToken());
+
+JSCPP_API void readFileAsync(const String&, const Callback<std::vector<uint8_t>>& callback,
+                             const CancelToken& token = CancelToken());
+JSCPP_API void readFileAsStringAsync(const String&, const Callback<String>& callback,
+                                     const CancelToken& token = CancelToken());
+JSCPP_API void writeFileAsync(const String&, const std::vector<uint8_t>&, const DoneCallback& callback,
+                              const WriteFileOptions& options = WriteFileOptions(),
+                              const CancelToken& token = CancelToken());
+JSCPP_API void writeFileAsync(const String&, const String&, const DoneCallback& callback,
+                              const WriteFileOptions& options = WriteFileOptions(),
+                              const CancelToken& token = CancelToken());
+JSCPP_API void appendFileAsync(const String&, const std::vector<uint8_t>&, const DoneCallback& callback,
+                               const CancelToken& token = CancelToken());
+JSCPP_API void appendFileAsync(const String&, const String&, const DoneCallback& callback,
+                               const CancelToken& token = CancelToken());
+JSCPP_API void statAsync(const String&, const Callback<Stats>& callback, unsigned int fields = SF_ALL,
+                         const CancelToken& token = CancelToken());
+JSCPP_API void lstatAsync(const String&, const Callback<Stats>& callback, unsigned int fields = SF_ALL,
+                          const CancelToken& token = CancelToken());
+JSCPP_API void existsAsync(const String&, const Callback<bool>& callback, const CancelToken& token = CancelToken());
+JSCPP_API void readdirAsync(const String&, const Callback<std::vector<String>>& callback,
+                            const CancelToken& token = CancelToken());
+JSCPP_API void mkdirsAsync(const String&, const DoneCallback& callback, int mode = 0777,
+                           const CancelToken& token = CancelToken());
+JSCPP_API void unlinkAsync(const String&, const DoneCallback& callback, const CancelToken& token = CancelToken());
+JSCPP_API void renameAsync(const String&, const String&, const DoneCallback& callback,
+                           const CancelToken& token = CancelToken());
+JSCPP_API void copyAsync(const String&, const String&, const DoneCallback& callback,
+                         const CopyOptions& options = CopyOptions(), const CancelToken& token = CancelToken());
+JSCPP_API void moveAsync(const String&, const String&, const DoneCallback& callback,
+                         const MoveOptions& options = MoveOptions(), const CancelToken& token = CancelToken());
+JSCPP_API void removeAsync(const String&, const DoneCallback& callback, const RemoveOptions& options = RemoveOptions(),
+                           const CancelToken& token = CancelToken());
+
 }
 }
 
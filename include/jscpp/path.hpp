@@ -1,7 +1,7 @@
 #ifndef __JSCPP_PATH_HPP__
 #define __JSCPP_PATH_HPP__
 
-#include "String.hpp"
+#include "StringView.hpp"
 
 namespace js {
 
@@ -16,8 +16,19 @@ public:
   String name;
 };
 
+// Same fields as ParsedPath, viewing sub-ranges of the parsed string.
+class JSCPP_API ParsedPathView {
+public:
+  StringView root;
+  StringView dir;
+  StringView base;
+  StringView ext;
+  StringView name;
+};
+
 namespace win32 {
   JSCPP_API bool isAbsolute(const String& path);
+  JSCPP_API bool isAbsolute(StringView path);
   JSCPP_API String resolve(const String& arg1 = L"", const String& arg2 = L"");
 
   template <typename... Args>
@@ -40,16 +51,21 @@ namespace win32 {
   JSCPP_API String relative(const String& from, const String& to);
   JSCPP_API String toNamespacedPath(const String& path);
   JSCPP_API String dirname(const String& path);
+  JSCPP_API StringView dirname(StringView path);
   JSCPP_API String basename(const String& path, const String& ext = L"");
+  JSCPP_API StringView basename(StringView path, StringView ext = StringView());
   JSCPP_API String extname(const String& path);
+  JSCPP_API StringView extname(StringView path);
   JSCPP_API String format(const ParsedPath& pathObject);
   JSCPP_API ParsedPath parse(const String& path);
+  JSCPP_API ParsedPathView parse(StringView path);
   extern JSCPP_API const String sep;
   extern JSCPP_API const String delimiter;
 }
 
 namespace posix {
   JSCPP_API bool isAbsolute(const String& path);
+  JSCPP_API bool isAbsolute(StringView path);
   JSCPP_API String resolve(const String& arg1 = L"", const String& arg2 = L"");
 
   template <typename... Args>
@@ -72,10 +88,14 @@ namespace posix {
   JSCPP_API String relative(const String& from, const String& to);
   JSCPP_API String toNamespacedPath(const String& path);
   JSCPP_API String dirname(const String& path);
+  JSCPP_API StringView dirname(StringView path);
   JSCPP_API String basename(const String& path, const String& ext = L"");
+  JSCPP_API StringView basename(StringView path, StringView ext = StringView());
   JSCPP_API String extname(const String& path);
+  JSCPP_API StringView extname(StringView path);
   JSCPP_API String format(const ParsedPath& pathObject);
   JSCPP_API ParsedPath parse(const String& path);
+  JSCPP_API ParsedPathView parse(StringView path);
   extern JSCPP_API const String sep;
   extern JSCPP_API const String delimiter;
 }
@@ -83,6 +103,7 @@ namespace posix {
 #ifdef _WIN32
 
 inline bool isAbsolute(const String& path) { return win32::isAbsolute(path); }
+inline bool isAbsolute(StringView path) { return win32::isAbsolute(path); }
 
 template <typename... Args>
 inline String resolve(const Args&... args) {
@@ -99,14 +120,19 @@ inline String join(const Args&... args) {
 inline String relative(const String& from, const String& to) { return win32::relative(from, to); }
 inline String toNamespacedPath(const String& path) { return win32::toNamespacedPath(path); }
 inline String dirname(const String& path) { return win32::dirname(path); }
+inline StringView dirname(StringView path) { return win32::dirname(path); }
 inline String basename(const String& path, const String& ext = L"") { return win32::basename(path, ext); }
+inline StringView basename(StringView path, StringView ext = StringView()) { return win32::basename(path, ext); }
 inline String extname(const String& path) { return win32::extname(path); }
+inline StringView extname(StringView path) { return win32::extname(path); }
 inline String format(const ParsedPath& pathObject) { return win32::format(pathObject); }
 inline ParsedPath parse(const String& path) { return win32::parse(path); }
+inline ParsedPathView parse(StringView path) { return win32::parse(path); }
 
 #else
 
 inline bool isAbsolute(const String& path) { return posix::isAbsolute(path); }
+inline bool isAbsolute(StringView path) { return posix::isAbsolute(path); }
 
 template <typename... Args>
 inline String resolve(const Args&... args) {
@@ -123,10 +149,14 @@ inline String join(const Args&... args) {
 inline String relative(const String& from, const String& to) { return posix::relative(from, to); }
 inline String toNamespacedPath(const String& path) { return posix::toNamespacedPath(path); }
 inline String dirname(const String& path) { return posix::dirname(path); }
+inline StringView dirname(StringView path) { return posix::dirname(path); }
 inline String basename(const String& path, const String& ext = L"") { return posix::basename(path, ext); }
+inline StringView basename(StringView path, StringView ext = StringView()) { return posix::basename(path, ext); }
 inline String extname(const String& path) { return posix::extname(path); }
+inline StringView extname(StringView path) { return posix::extname(path); }
 inline String format(const ParsedPath& pathObject) { return posix::format(pathObject); }
 inline ParsedPath parse(const String& path) { return posix::parse(path); }
+inline ParsedPathView parse(StringView path) { return posix::parse(path); }
 
 #endif
 
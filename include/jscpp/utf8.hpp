@@ -6,6 +6,7 @@
 
 namespace js {
 
+// Ill-formed input is replaced by U+FFFD instead of failing the conversion.
 JSCPP_API std::wstring fromUtf8(const std::string& str);
 JSCPP_API std::string toUtf8(const std::wstring& wstr);
 
@@ -1,7 +1,12 @@
 #include "./internal/throw.hpp"
+#include "./internal/fserror.hpp"
 #include "jscpp/Error.hpp"
 #include "jscpp/String.hpp"
 
+#if JSCPP_USE_ERROR
+#include <mutex>
+#endif
+
 #if !JSCPP_USE_ERROR
 #include <iostream>
 #include <cstdlib>
@@ -12,7 +17,56 @@ namespace js {
 #if JSCPP_USE_ERROR
 Error::Error(const String& msg): _msg(msg.str()) {}
 
+Error::Error() noexcept: _msg() {}
+
 char const* Error::what() const noexcept { return _msg.c_str(); }
+
+struct SystemError::Detail {
+  std::error_code code;
+  const char* syscall;
+  String path;
+  String dest;
+  std::once_flag rendered;
+  std::string message;
+};
+
+SystemError::SystemError(const std::error_code& code, const char* syscall, const String& path, const String& dest):
+  Error(), detail_(std::make_shared<Detail>()) {
+  detail_->code = code;
+  detail_->syscall = syscall;
+  detail_->path = path;
+  detail_->dest = dest;
+}
+
+char const* SystemError::what() const noexcept {
+  Detail& d = *detail_;
+  try {
+    std::call_once(d.rendered, [&d]() {
+      d.message = internal::formatFsError(d.code, d.syscall, d.path, d.dest).str();
+    });
+  } catch (...) {
+    return "SystemError";
+  }
+  return d.message.c_str();
+}
+
+int SystemError::code() const noexcept {
+  std::error_condition condition = detail_->code.default_error_condition();
+  return condition.category() == std::generic_category() ? condition.value() : detail_->code.value();
+}
+
+const char* SystemError::codeName() const noexcept {
+  std::error_condition condition = detail_->code.default_error_condition();
+  return condition.category() == std::generic_category() ? internal::errnoName(condition.value()) : "UNKNOWN";
+}
+
+const std::error_code& SystemError::errorCode() const noexcept { return detail_->code; }
+
+const char* SystemError::syscall() const noexcept { return detail_->syscall; }
+
+const String& SystemError::path() const noexcept { return detail_->path; }
+
+const String& SystemError::dest() const noexcept { return detail_->dest; }
 #endif
 
 namespace internal {
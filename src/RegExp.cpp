@@ -0,0 +1,65 @@
+#include "jscpp/RegExp.hpp"
+#include "./internal/regexp.hpp"
+
+namespace js {
+
+RegExp::RegExp(const String& pattern, const String& flags):
+  lastIndex(0), _pattern(internal::compileRegExp(pattern, flags)) {}
+
+const String& RegExp::source() const noexcept {
+  return _pattern->source;
+}
+
+const String& RegExp::flags() const noexcept {
+  return _pattern->flags;
+}
+
+bool RegExp::global() const noexcept {
+  return _pattern->global;
+}
+
+bool RegExp::ignoreCase() const noexcept {
+  return _pattern->ignoreCase;
+}
+
+bool RegExp::multiline() const noexcept {
+  return _pattern->multiline;
+}
+
+bool RegExp::dotAll() const noexcept {
+  return _pattern->dotAll;
+}
+
+bool RegExp::sticky() const noexcept {
+  return _pattern->sticky;
+}
+
+bool RegExp::linear() const noexcept {
+  return _pattern->linear();
+}
+
+bool RegExp::test(const String& str) {
+  bool useLastIndex = _pattern->global || _pattern->sticky;
+  internal::RegExpSubject subject(str);
+  std::vector<size_t> caps;
+  if (!_pattern->exec(subject, useLastIndex ? lastIndex : 0, caps)) {
+    if (useLastIndex) lastIndex = 0;
+    return false;
+  }
+  if (useLastIndex) lastIndex = caps[1];
+  return true;
+}
+
+RegExpMatch RegExp::exec(const String& str) {
+  bool useLastIndex = _pattern->global || _pattern->sticky;
+  internal::RegExpSubject subject(str);
+  std::vector<size_t> caps;
+  if (!_pattern->exec(subject, useLastIndex ? lastIndex : 0, caps)) {
+    if (useLastIndex) lastIndex = 0;
+    return RegExpMatch();
+  }
+  if (useLastIndex) lastIndex = caps[1];
+  return internal::toRegExpMatch(str, caps);
+}
+
+}
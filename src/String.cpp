@@ -1,11 +1,148 @@
 #include "jscpp/utf8.hpp"
 #include "jscpp/String.hpp"
 #include "./internal/throw.hpp"
+#include "./internal/transcode.hpp"
+#include "./internal/regexp.hpp"
+#include "./internal/unicode.hpp"
 
+#include <cstring>
+#include <cwchar>
 #include <utility>
 
 namespace js {
 
+namespace {
+
+template <typename T>
+String::string_type toDecimal(T n) {
+#if JSCPP_STRING_UTF8
+  return std::to_string(n);
+#elif JSCPP_STRING_UTF16
+  std::string digits = std::to_string(n);
+  String::string_type res;
+  res.resize(digits.size());
+  for (size_t i = 0; i < digits.size(); i++) res[i] = (String::value_type)digits[i];
+  return res;
+#else
+  return std::to_wstring(n);
+#endif
+}
+
+#if JSCPP_STRING_UTF16
+String::string_type fromNarrow(const char* s, size_t n) {
+  String::string_type res;
+#ifdef _WIN32
+  std::wstring w = ::js::wstr(std::string(s, n));
+  res.resize(w.size());
+  res.resize(internal::wideToUtf16(w.data(), w.size(), &res[0]));
+#else
+  res.resize(n);
+  res.resize(internal::decodeUtf8(s, n, &res[0]));
+#endif
+  return res;
+}
+
+String::string_type fromWide(const wchar_t* s, size_t n) {
+  String::string_type res;
+  res.resize(sizeof(wchar_t) > 2 ? 2 * n : n);
+  res.resize(internal::wideToUtf16(s, n, &res[0]));
+  return res;
+}
+
+String::string_type fromUtf16(const char16_t* s, size_t n) {
+  String::string_type res;
+  res.resize(n);
+  for (size_t i = 0; i < n; i++) res[i] = (String::value_type)s[i];
+  return res;
+}
+#endif
+
+// Index after the character at index, keeping UTF-8 sequences whole.
+size_t nextCharIndex(const String& str, size_t index) noexcept {
+  index++;
+#if JSCPP_STRING_UTF8
+  while (index < str.length() && (str[index] & 0xC0) == 0x80) index++;
+#else
+  (void)str;
+#endif
+  return index;
+}
+
+// Calls fn with the captures of every match, or only the first unless all.
+// An empty match moves on one character so the loop always ends.
+template <typename Fn>
+void eachMatch(const internal::RegExpPattern& pattern, const String& str, bool all, Fn fn) {
+  internal::RegExpSubject subject(str);
+  std::vector<size_t> caps;
+  size_t pos = 0;
+  while (pos <= str.length() && pattern.exec(subject, pos, caps)) {
+    fn(caps);
+    if (!all) return;
+    pos = caps[1] == caps[0] ? nextCharIndex(str, caps[1]) : caps[1];
+  }
+}
+
+// Appends newSubStr to out, expanding $$, $&, $`, $' and $n / $nn.
+void appendReplacement(String::string_type& out, const String& str, const String& newSubStr,
+    const std::vector<size_t>& caps) {
+  const String::value_type* r = newSubStr.data();
+  const size_t rlen = newSubStr.length();
+  const size_t groups = caps.size() / 2 - 1;
+  for (size_t i = 0; i < rlen; i++) {
+    if (r[i] != '$' || i + 1 == rlen) {
+      out.push_back(r[i]);
+      continue;
+    }
+    String::value_type c = r[i + 1];
+    size_t from = 0;
+    size_t to = 0;
+    if (c == '$') {
+      out.push_back(c);
+      i++;
+      continue;
+    } else if (c == '&') {
+      from = caps[0]; to = caps[1];
+    } else if (c == '`') {
+      from = 0; to = caps[0];
+    } else if (c == '\'') {
+      from = caps[1]; to = str.length();
+    } else if (c >= '0' && c <= '9') {
+      size_t n = (size_t)(c - '0');
+      size_t digits = 1;
+      if (i + 2 < rlen && r[i + 2] >= '0' && r[i + 2] <= '9' && n * 10 + (size_t)(r[i + 2] - '0') <= groups) {
+        n = n * 10 + (size_t)(r[i + 2] - '0');
+        digits = 2;
+      }
+      if (n == 0 || n > groups) {
+        out.push_back(r[i]);
+        continue;
+      }
+      i += digits;
+      if (caps[2 * n] != internal::RegExpPattern::npos) out.append(str.data() + caps[2 * n], caps[2 * n + 1] - caps[2 * n]);
+      continue;
+    } else {
+      out.push_back(r[i]);
+      continue;
+    }
+    i++;
+    out.append(str.data() + from, to - from);
+  }
+}
+
+String replaceMatches(const internal::RegExpPattern& pattern, const String& str, const String& newSubStr) {
+  String::string_type out;
+  size_t last = 0;
+  eachMatch(pattern, str, pattern.global, [&](const std::vector<size_t>& caps) {
+    out.append(str.data() + last, caps[0] - last);
+    appendReplacement(out, str, newSubStr, caps);
+    last = caps[1];
+  });
+  out.append(str.data() + last, str.length() - last);
+  return out;
+}
+
+}
+
 String String::fromCharCode() noexcept {
   return "";
 }
@@ -15,7 +152,8 @@ String String::fromCharCode(uint32_t code) noexcept {
 }
 
 String String::fromCharCode(const std::vector<uint32_t>& codes) {
-  String tmp;
+  std::wstring tmp;
+  tmp.reserve(codes.size());
   for (const uint32_t c : codes) {
     tmp += (wchar_t)(uint16_t)c;
   }
@@ -59,11 +197,81 @@ void String::_trimZero() {
   size_t c = 0;
   size_t len = _str.length();
   for (size_t i = len - 1; i >= 0; i--) {
-    if (_str[i] == L'0') c++; else break;
+    if (_str[i] == '0') c++; else break;
   }
   _str.resize(len - c);
 }
 
+#if JSCPP_STRING_UTF8
+String& String::_append(const char* str) {
+  _str.append(str);
+  return *this;
+}
+
+String& String::_append(const wchar_t* wstr) {
+  size_t n = wcslen(wstr);
+  size_t old = _str.size();
+  _str.resize(old + internal::utf8Length(wstr, n));
+  internal::encodeUtf8(wstr, n, &_str[old]);
+  return *this;
+}
+#elif JSCPP_STRING_UTF16
+String& String::_append(const char* str) {
+  string_type units = fromNarrow(str, strlen(str));
+  _str.append(units.data(), units.size());
+  return *this;
+}
+
+String& String::_append(const wchar_t* wstr) {
+  size_t n = wcslen(wstr);
+  size_t old = _str.size();
+  _str.resize(old + (sizeof(wchar_t) > 2 ? 2 * n : n));
+  _str.resize(old + internal::wideToUtf16(wstr, n, &_str[old]));
+  return *this;
+}
+#else
+String& String::_append(const char* str) {
+  _str += ::js::wstr(str);
+  return *this;
+}
+
+String& String::_append(const wchar_t* wstr) {
+  _str.append(wstr);
+  return *this;
+}
+#endif
+
+String String::_concat(std::initializer_list<const String*> parts) {
+  size_t len = 0;
+  for (const String* p : parts) len += p->_str.size();
+  String res;
+  res._str.reserve(len);
+  for (const String* p : parts) res._str.append(p->_str.data(), p->_str.size());
+  return res;
+}
+
+#if JSCPP_STRING_UTF8
+String::String(char c) noexcept: _str(1, c) {}
+String::String(wchar_t c) noexcept: _str(::js::toUtf8({ c })) {}
+String::String(const char* str) noexcept : _str(str) {}
+String::String(const std::string& str) noexcept : _str(str) {}
+String::String(const wchar_t* wstr) noexcept : _str(::js::toUtf8(wstr)) {}
+String::String(const std::wstring& wstr) noexcept : _str(::js::toUtf8(wstr)) {}
+String::String(bool b): _str(b ? "true" : "false") {}
+#elif JSCPP_STRING_UTF16
+String::String(char c) noexcept: _str(fromNarrow(&c, 1)) {}
+String::String(wchar_t c) noexcept: _str(fromWide(&c, 1)) {}
+String::String(const char* str) noexcept : _str(fromNarrow(str, strlen(str))) {}
+String::String(const std::string& str) noexcept : _str(fromNarrow(str.data(), str.size())) {}
+String::String(const wchar_t* wstr) noexcept : _str(fromWide(wstr, wcslen(wstr))) {}
+String::String(const std::wstring& wstr) noexcept : _str(fromWide(wstr.data(), wstr.size())) {}
+String::String(char16_t c) noexcept: _str(fromUtf16(&c, 1)) {}
+String::String(const char16_t* u16str) noexcept : _str(fromUtf16(u16str, std::char_traits<char16_t>::length(u16str))) {}
+String::String(const std::u16string& u16str) noexcept : _str(fromUtf16(u16str.data(), u16str.size())) {}
+String::String(const string_type& units) noexcept : _str(units) {}
+String::String(string_type&& units) noexcept : _str(std::move(units)) {}
+String::String(bool b): _str(fromNarrow(b ? "true" : "false", b ? 4 : 5)) {}
+#else
 String::String(char c) noexcept: _str(::js::wstr({ c })) {}
 String::String(wchar_t c) noexcept: _str({ c }) {}
 String::String(const char* str) noexcept : _str(::js::wstr(str)) {}
@@ -71,15 +279,17 @@ String::String(const std::string& str) noexcept : _str(::js::wstr(str)) {}
 String::String(const wchar_t* wstr) noexcept : _str(wstr) {}
 String::String(const std::wstring& wstr) noexcept : _str(wstr) {}
 String::String(bool b): _str(b ? L"true" : L"false") {}
-String::String(int n): _str(std::to_wstring(n)) {}
-String::String(unsigned int n): _str(std::to_wstring(n)) {}
-String::String(long n): _str(std::to_wstring(n)) {}
-String::String(unsigned long n): _str(std::to_wstring(n)) {}
-String::String(long long n): _str(std::to_wstring(n)) {}
-String::String(unsigned long long n): _str(std::to_wstring(n)) {}
-String::String(float n): _str(std::to_wstring(n)) { _trimZero(); }
-String::String(double n): _str(std::to_wstring(n)) { _trimZero(); }
-String::String(long double n): _str(std::to_wstring(n)) { _trimZero(); }
+#endif
+String::String(StringView view): _str(view.data(), view.length()) {}
+String::String(int n): _str(toDecimal(n)) {}
+String::String(unsigned int n): _str(toDecimal(n)) {}
+String::String(long n): _str(toDecimal(n)) {}
+String::String(unsigned long n): _str(toDecimal(n)) {}
+String::String(long long n): _str(toDecimal(n)) {}
+String::String(unsigned long long n): _str(toDecimal(n)) {}
+String::String(float n): _str(toDecimal(n)) { _trimZero(); }
+String::String(double n): _str(toDecimal(n)) { _trimZero(); }
+String::String(long double n): _str(toDecimal(n)) { _trimZero(); }
 
 String::iterator String::begin() noexcept { return _str.begin(); }
 String::const_iterator String::cbegin() const noexcept { return _str.cbegin(); }
@@ -94,10 +304,43 @@ size_t String::length() const noexcept {
   return _str.length();
 }
 
-const std::wstring& String::ref() const noexcept {
+const String::string_type& String::ref() const noexcept {
   return _str;
 }
 
+#if JSCPP_STRING_UTF8
+std::wstring String::wstr() const noexcept {
+  return ::js::fromUtf8(_str);
+}
+
+const std::string& String::str() const noexcept {
+  return _str;
+}
+std::string String::toString() const noexcept {
+  return _str;
+}
+#elif JSCPP_STRING_UTF16
+std::wstring String::wstr() const noexcept {
+  std::wstring res;
+  res.resize(_str.size());
+  res.resize(internal::utf16ToWide(_str.data(), _str.size(), &res[0]));
+  return res;
+}
+
+std::string String::str() const noexcept {
+#ifdef _WIN32
+  return ::js::str(wstr());
+#else
+  std::string res;
+  res.resize(internal::utf8Length(_str.data(), _str.size()));
+  internal::encodeUtf8(_str.data(), _str.size(), &res[0]);
+  return res;
+#endif
+}
+std::string String::toString() const noexcept {
+  return str();
+}
+#else
 std::wstring String::wstr() const noexcept {
   return _str;
 }
@@ -108,15 +351,16 @@ std::string String::str() const noexcept {
 std::string String::toString() const noexcept {
   return ::js::str(_str);
 }
+#endif
 
-const wchar_t* String::data() const noexcept {
+const String::value_type* String::data() const noexcept {
   return _str.data();
 }
 
-const wchar_t& String::operator[](size_t index) const noexcept {
+const String::value_type& String::operator[](size_t index) const noexcept {
   return _str[index];
 }
-wchar_t& String::operator[](size_t index) noexcept {
+String::value_type& String::operator[](size_t index) noexcept {
   return _str[index];
 }
 
@@ -126,7 +370,7 @@ String& String::operator+=(const String& str) {
 }
 
 std::ostream& operator<<(std::ostream& out, const String& str) {
-  out << ::js::str(str._str);
+  out << str.str();
   return out;
 }
 
@@ -144,7 +388,7 @@ String String::charAt(size_t index) const noexcept {
 
 uint16_t String::charCodeAt(size_t index) const noexcept {
   if (index >= _str.length()) return (uint16_t)0U;
-  uint32_t c = _str[index];
+  uint32_t c = internal::codeUnit(_str[index]);
   if (c > 65535) {
     return (uint16_t)(c & 0x0000FFFFU);
   }
@@ -152,24 +396,29 @@ uint16_t String::charCodeAt(size_t index) const noexcept {
 }
 
 uint32_t String::codePointAt(size_t position) const noexcept {
-  String string = *this;
-  size_t size = string.length();
+  size_t size = _str.length();
   size_t index = position;
   if (index >= size) {
     return 0U;
   }
-  uint16_t first = string.charCodeAt(index);
+#if JSCPP_STRING_UTF8
+  uint32_t units[4];
+  internal::decodeUtf8(_str.data() + index, size - index < 4 ? size - index : 4, units);
+  return units[0];
+#else
+  uint16_t first = charCodeAt(index);
   uint16_t second;
   if (
     first >= 0xD800 && first <= 0xDBFF &&
     size > index + 1
   ) {
-    second = string.charCodeAt(index + 1);
+    second = charCodeAt(index + 1);
     if (second >= 0xDC00 && second <= 0xDFFF) {
       return ((uint32_t)first - 0xD800) * 0x400 + (uint32_t)second - 0xDC00 + 0x10000;
     }
   }
   return first;
+#endif
 }
 
 String String::concat() const noexcept {
@@ -177,55 +426,56 @@ String String::concat() const noexcept {
 }
 
 String String::concat(const String& s) const {
-  return _str + s._str;
+  return _concat({ this, &s });
 }
 
 bool String::startsWith(const String& searchString, size_t position) const {
-  return this->substring(position, position + searchString.length()) == searchString;
+  return StringView(*this).startsWith(searchString, position);
+}
+bool String::startsWith(StringView searchString, size_t position) const noexcept {
+  return StringView(*this).startsWith(searchString, position);
 }
 
 bool String::endsWith(const String& search) const {
-  size_t length = _str.length();
-  return this->substring(length - search.length(), length) == search;
+  return StringView(*this).endsWith(search);
+}
+bool String::endsWith(StringView search) const noexcept {
+  return StringView(*this).endsWith(search);
 }
 bool String::endsWith(const String& search, size_t length) const {
-  size_t len = _str.length();
-  if (length > len) {
-    length = len;
-  }
-  return this->substring(length - search.length(), length) == search;
+  return StringView(*this).endsWith(search, length);
+}
+bool String::endsWith(StringView search, size_t length) const noexcept {
+  return StringView(*this).endsWith(search, length);
 }
 
 bool String::includes(const String& searchString, size_t position) const noexcept {
-  if (position + searchString.length() > this->length()) {
-    return false;
-  } else {
-    return this->indexOf(searchString, position) != std::wstring::npos;
-  }
+  return StringView(*this).includes(searchString, position);
+}
+bool String::includes(StringView searchString, size_t position) const noexcept {
+  return StringView(*this).includes(searchString, position);
 }
 
 size_t String::indexOf(const String& searchValue, size_t fromIndex) const noexcept {
-  return _str.find(searchValue._str, fromIndex);
+  return StringView(*this).indexOf(searchValue, fromIndex);
+}
+size_t String::indexOf(StringView searchValue, size_t fromIndex) const noexcept {
+  return StringView(*this).indexOf(searchValue, fromIndex);
 }
 
 size_t String::lastIndexOf(const String& searchValue, size_t fromIndex) const noexcept {
-  return _str.rfind(searchValue._str, fromIndex);
+  return StringView(*this).lastIndexOf(searchValue, fromIndex);
+}
+size_t String::lastIndexOf(StringView searchValue, size_t fromIndex) const noexcept {
+  return StringView(*this).lastIndexOf(searchValue, fromIndex);
 }
 
 String String::substring(size_t indexStart) const {
-  size_t len = _str.length();
-  if (indexStart > len) indexStart = len;
-  return _str.substr(indexStart);
+  return String(StringView(*this).substring(indexStart));
 }
 
 String String::substring(size_t indexStart, size_t indexEnd) const {
-  size_t len = _str.length();
-  if (indexStart > len) indexStart = len;
-  if (indexEnd > len) indexEnd = len;
-  if (indexStart == indexEnd) return String();
-  if (indexStart > indexEnd) std::swap(indexStart, indexEnd);
-
-  return _str.substr(indexStart, indexEnd - indexStart);
+  return String(StringView(*this).substring(indexStart, indexEnd));
 }
 
 String String::padEnd(size_t targetLength, const String& str) const {
@@ -256,13 +506,10 @@ String String::padStart(size_t targetLength, const String& str) const {
 }
 
 String String::slice(int beginIndex) const {
-  if (beginIndex < 0) beginIndex = (int)length() + beginIndex;
-  return this->substring(beginIndex);
+  return String(StringView(*this).slice(beginIndex));
 }
 String String::slice(int beginIndex, int endIndex) const {
-  if (beginIndex < 0) beginIndex = (int)length() + beginIndex;
-  if (endIndex < 0) endIndex = (int)length() + endIndex;
-  return this->substring(beginIndex, endIndex);
+  return String(StringView(*this).slice(beginIndex, endIndex));
 }
 
 String String::repeat(size_t count) const {
@@ -296,8 +543,90 @@ String String::replace(const String& substr, const String& newSubStr) const {
   return res;
 }
 
+String String::replaceAll(const String& substr, const String& newSubStr) const {
+  StringView source = *this;
+  size_t len = source.length();
+  size_t patlen = substr.length();
+  String res;
+  if (patlen == 0) {
+    // An empty pattern matches before every code unit and at the end
+    res._str.reserve(len + (len + 1) * newSubStr.length());
+    for (size_t i = 0; i < len;) {
+      size_t e = i + 1;
+#if JSCPP_STRING_UTF8
+      while (e < len && (_str[e] & 0xC0) == 0x80) e++;
+#endif
+      res._str.append(newSubStr._str.data(), newSubStr._str.size());
+      res._str.append(_str.data() + i, e - i);
+      i = e;
+    }
+    res._str.append(newSubStr._str.data(), newSubStr._str.size());
+    return res;
+  }
+
+  size_t start = 0;
+  size_t index = source.indexOf(substr);
+  if (index == StringView::npos) return *this;
+  res._str.reserve(len);
+  do {
+    res._str.append(_str.data() + start, index - start);
+    res._str.append(newSubStr._str.data(), newSubStr._str.size());
+    start = index + patlen;
+  } while ((index = source.indexOf(substr, start)) != StringView::npos);
+  res._str.append(_str.data() + start, len - start);
+  return res;
+}
+
 String String::replace(const std::wregex& regexp, const String& newSubStr) const {
+#if JSCPP_STRING_UTF8 || JSCPP_STRING_UTF16
+  return std::regex_replace(wstr(), regexp, newSubStr.wstr());
+#else
   return std::regex_replace(_str, regexp, newSubStr._str);
+#endif
+}
+
+String String::replace(const RegExp& regexp, const String& newSubStr) const {
+  return replaceMatches(*regexp._pattern, *this, newSubStr);
+}
+
+String String::replaceAll(const RegExp& regexp, const String& newSubStr) const {
+  if (!regexp.global()) {
+    internal::throwError(L"replaceAll must be called with a global RegExp");
+  }
+  return replaceMatches(*regexp._pattern, *this, newSubStr);
+}
+
+std::vector<String> String::match(const RegExp& regexp) const {
+  std::vector<String> res;
+  if (!regexp.global()) {
+    eachMatch(*regexp._pattern, *this, false, [&](const std::vector<size_t>& caps) {
+      res = internal::toRegExpMatch(*this, caps).captures;
+    });
+    return res;
+  }
+  eachMatch(*regexp._pattern, *this, true, [&](const std::vector<size_t>& caps) {
+    res.emplace_back(StringView(*this).substring(caps[0], caps[1]));
+  });
+  return res;
+}
+
+std::vector<RegExpMatch> String::matchAll(const RegExp& regexp) const {
+  if (!regexp.global()) {
+    internal::throwError(L"String.prototype.matchAll called with a non-global RegExp argument");
+  }
+  std::vector<RegExpMatch> res;
+  eachMatch(*regexp._pattern, *this, true, [&](const std::vector<size_t>& caps) {
+    res.push_back(internal::toRegExpMatch(*this, caps));
+  });
+  return res;
+}
+
+size_t String::search(const RegExp& regexp) const {
+  size_t index = StringView::npos;
+  eachMatch(*regexp._pattern, *this, false, [&](const std::vector<size_t>& caps) {
+    index = caps[0];
+  });
+  return index;
 }
 
 std::vector<String> String::split() const noexcept {
@@ -305,72 +634,84 @@ std::vector<String> String::split() const noexcept {
 }
 
 std::vector<String> String::split(const String& seprator, int limit) const {
-  size_t seplen = seprator.length();
+  return split(StringView(seprator), limit);
+}
+
+std::vector<String> String::split(StringView seprator, int limit) const {
+  std::vector<StringView> parts = StringView(*this).split(seprator, limit);
   std::vector<String> res;
-  if (seplen == 0) {
-    size_t len = _str.length();
-    size_t cap = limit >= 0 ? ((size_t)limit < len ? limit : len) : len;
-    res.reserve(cap);
-    for (size_t s = 0; s < len; s++) {
-      if (limit >= 0 && res.size() == limit) {
-        return res;
-      }
-      res.emplace_back(_str[s]);
-    }
+  res.reserve(parts.size());
+  for (const StringView& part : parts) {
+    res.emplace_back(part);
+  }
+  return res;
+}
+
+std::vector<String> String::split(const RegExp& separator, int limit) const {
+  const internal::RegExpPattern& pattern = *separator._pattern;
+  const size_t size = length();
+  std::vector<String> res;
+  if (limit == 0) return res;
+  internal::RegExpSubject subject(*this);
+  std::vector<size_t> caps;
+  if (size == 0) {
+    if (!pattern.exec(subject, 0, caps)) res.push_back(*this);
     return res;
   }
-  String sub = *this;
-  size_t rnindex;
-  String left;
-  String right;
-  size_t rightStart = 0;
-  while ((rnindex = sub.indexOf(seprator)) != std::wstring::npos) {
-    left = this->substring(rightStart, rightStart + rnindex);
-    rightStart = rightStart + rnindex + seplen;
-    if (limit >= 0 && res.size() == limit) {
-      return res;
+  // Captures are spliced into the result, and an empty match only splits
+  // between characters, never at either end.
+  StringView view = *this;
+  size_t p = 0;
+  size_t q = 0;
+  while (q < size && pattern.exec(subject, q, caps) && caps[0] < size) {
+    if (caps[1] == p) {
+      q = nextCharIndex(*this, caps[0]);
+      continue;
     }
-    res.emplace_back(left);
-    right = this->substring(rightStart);
-    sub = right;
-  }
-  if (limit >= 0 && res.size() == limit) {
-    return res;
+    res.emplace_back(view.substring(p, caps[0]));
+    if ((size_t)limit == res.size()) return res;
+    for (size_t g = 2; g < caps.size(); g += 2) {
+      res.push_back(caps[g] == internal::RegExpPattern::npos ? String() : String(view.substring(caps[g], caps[g + 1])));
+      if ((size_t)limit == res.size()) return res;
+    }
+    p = caps[1];
+    q = p;
   }
-  res.emplace_back(sub);
+  res.emplace_back(view.substring(p));
   return res;
 }
 
 String String::toLowerCase() const noexcept {
-  String res = *this;
-  size_t len = res.length();
-  for (size_t i = 0; i < len; i++) {
-    if (res[i] >= 65 && res[i] <= 90) {
-      res[i] += 32;
-    }
-  }
-  return res;
+  return internal::unicode::toLowerCase(_str.data(), _str.size());
 }
 
 String String::toUpperCase() const noexcept {
-  String res = *this;
-  size_t len = res.length();
-  for (size_t i = 0; i < len; i++) {
-    if (res[i] >= 97 && res[i] <= 122) {
-      res[i] -= 32;
-    }
-  }
-  return res;
+  return internal::unicode::toUpperCase(_str.data(), _str.size());
+}
+
+String String::normalize(const String& form) const {
+  internal::unicode::Form f;
+  if (form == L"NFC") f = internal::unicode::NFC;
+  else if (form == L"NFD") f = internal::unicode::NFD;
+  else if (form == L"NFKC") f = internal::unicode::NFKC;
+  else if (form == L"NFKD") f = internal::unicode::NFKD;
+  else internal::throwError(L"The normalization form should be one of NFC, NFD, NFKC, NFKD.");
+  if (internal::unicode::isNormalized(_str.data(), _str.size(), f)) return *this;
+  return internal::unicode::normalize(_str.data(), _str.size(), f);
+}
+
+int String::localeCompare(const String& compareString) const {
+  return internal::unicode::compare(_str.data(), _str.size(), compareString._str.data(), compareString._str.size());
 }
 
 String String::trim() const {
-  return this->replace(std::wregex(L"[\\s\\uFEFF\\xA0]+|[\\s\\uFEFF\\xA0]+$"), "");
+  return String(StringView(*this).trim());
 }
 String String::trimEnd() const {
-  return this->replace(std::wregex(L"[\\s\\uFEFF\\xA0]+$"), "");
+  return String(StringView(*this).trimEnd());
 }
 String String::trimStart() const {
-  return this->replace(std::wregex(L"^[\\s\\uFEFF\\xA0]+"), "");
+  return String(StringView(*this).trimStart());
 }
 String String::trimRight() const {
   return this->trimEnd();
@@ -427,6 +768,46 @@ String operator+(const String& l, wchar_t r) {
   return l.concat(r);
 }
 
+String operator+(String&& l, const String& r) {
+  l += r;
+  return std::move(l);
+}
+
+String operator+(String&& l, const char* r) {
+  l._append(r);
+  return std::move(l);
+}
+
+String operator+(String&& l, char r) {
+  l += r;
+  return std::move(l);
+}
+
+String operator+(String&& l, const wchar_t* r) {
+  l._append(r);
+  return std::move(l);
+}
+
+String operator+(String&& l, wchar_t r) {
+  l += r;
+  return std::move(l);
+}
+
+#if JSCPP_STRING_UTF16
+String operator+(char16_t l, const String& r) {
+  return String(l).concat(r);
+}
+
+String operator+(const String& l, char16_t r) {
+  return l.concat(r);
+}
+
+String operator+(String&& l, char16_t r) {
+  l += r;
+  return std::move(l);
+}
+#endif
+
 String operator+(const String& l, bool r) { return l.concat(r); }
 String operator+(const String& l, int r) { return l.concat(r); }
 String operator+(const String& l, unsigned int r) { return l.concat(r); }
@@ -438,6 +819,17 @@ String operator+(const String& l, float r) { return l.concat(r); }
 String operator+(const String& l, double r) { return l.concat(r); }
 String operator+(const String& l, long double r) { return l.concat(r); }
 
+String operator+(String&& l, bool r) { return std::move(l += String(r)); }
+String operator+(String&& l, int r) { return std::move(l += String(r)); }
+String operator+(String&& l, unsigned int r) { return std::move(l += String(r)); }
+String operator+(String&& l, long r) { return std::move(l += String(r)); }
+String operator+(String&& l, unsigned long r) { return std::move(l += String(r)); }
+String operator+(String&& l, long long r) { return std::move(l += String(r)); }
+String operator+(String&& l, unsigned long long r) { return std::move(l += String(r)); }
+String operator+(String&& l, float r) { return std::move(l += String(r)); }
+String operator+(String&& l, double r) { return std::move(l += String(r)); }
+String operator+(String&& l, long double r) { return std::move(l += String(r)); }
+
 String operator+(bool l, const String& r) { return String(l).concat(r); }
 String operator+(int l, const String& r) { return String(l).concat(r); }
 String operator+(unsigned int l, const String& r) { return String(l).concat(r); }
@@ -0,0 +1,179 @@
+#include "jscpp/StringView.hpp"
+#include "./internal/transcode.hpp"
+#include "./internal/search.hpp"
+#include "./internal/whitespace.hpp"
+
+#include <string>
+#include <utility>
+
+namespace js {
+
+namespace {
+
+typedef std::char_traits<StringView::value_type> traits;
+
+}
+
+const size_t StringView::npos;
+
+StringView::StringView(const value_type* str) noexcept: _data(str), _size(traits::length(str)) {}
+
+String StringView::toString() const {
+  return String(*this);
+}
+
+std::string StringView::str() const {
+  return toString().str();
+}
+
+std::wstring StringView::wstr() const {
+  return toString().wstr();
+}
+
+StringView StringView::charAt(size_t index) const noexcept {
+  if (index >= _size) return StringView();
+  return StringView(_data + index, 1);
+}
+
+uint16_t StringView::charCodeAt(size_t index) const noexcept {
+  if (index >= _size) return (uint16_t)0U;
+  return (uint16_t)(internal::codeUnit(_data[index]) & 0x0000FFFFU);
+}
+
+bool StringView::startsWith(StringView searchString, size_t position) const noexcept {
+  if (position > _size) position = _size;
+  size_t n = searchString._size;
+  return n <= _size - position && traits::compare(_data + position, searchString._data, n) == 0;
+}
+
+bool StringView::endsWith(StringView search) const noexcept {
+  return endsWith(search, _size);
+}
+
+bool StringView::endsWith(StringView search, size_t length) const noexcept {
+  if (length > _size) length = _size;
+  size_t n = search._size;
+  return n <= length && traits::compare(_data + length - n, search._data, n) == 0;
+}
+
+bool StringView::includes(StringView searchString, size_t position) const noexcept {
+  if (position + searchString._size > _size) {
+    return false;
+  }
+  return indexOf(searchString, position) != npos;
+}
+
+size_t StringView::indexOf(StringView searchValue, size_t fromIndex) const noexcept {
+  if (fromIndex > _size) return npos;
+  size_t index = internal::search::find(_data + fromIndex, _size - fromIndex, searchValue._data, searchValue._size);
+  return index == internal::search::npos ? npos : fromIndex + index;
+}
+
+size_t StringView::lastIndexOf(StringView searchValue, size_t fromIndex) const noexcept {
+  return internal::search::rfind(_data, _size, searchValue._data, searchValue._size, fromIndex);
+}
+
+StringView StringView::substring(size_t indexStart) const noexcept {
+  if (indexStart > _size) indexStart = _size;
+  return StringView(_data + indexStart, _size - indexStart);
+}
+
+StringView StringView::substring(size_t indexStart, size_t indexEnd) const noexcept {
+  if (indexStart > _size) indexStart = _size;
+  if (indexEnd > _size) indexEnd = _size;
+  if (indexStart > indexEnd) std::swap(indexStart, indexEnd);
+  return StringView(_data + indexStart, indexEnd - indexStart);
+}
+
+StringView StringView::slice(int beginIndex) const noexcept {
+  if (beginIndex < 0) beginIndex = (int)_size + beginIndex;
+  return substring(beginIndex < 0 ? 0 : beginIndex);
+}
+
+StringView StringView::slice(int beginIndex, int endIndex) const noexcept {
+  if (beginIndex < 0) beginIndex = (int)_size + beginIndex;
+  if (endIndex < 0) endIndex = (int)_size + endIndex;
+  if (beginIndex < 0) beginIndex = 0;
+  // Unlike substring, a reversed range is empty rather than swapped
+  if (endIndex <= beginIndex) return substring(beginIndex, beginIndex);
+  return substring(beginIndex, endIndex);
+}
+
+std::vector<StringView> StringView::split(StringView separator, int limit) const {
+  size_t seplen = separator._size;
+  std::vector<StringView> res;
+  if (seplen == 0) {
+    size_t cap = limit >= 0 ? ((size_t)limit < _size ? limit : _size) : _size;
+    res.reserve(cap);
+    for (size_t s = 0; s < _size; s++) {
+      if (limit >= 0 && res.size() == (size_t)limit) {
+        return res;
+      }
+#if JSCPP_STRING_UTF8
+      // Keep multi-byte sequences whole instead of splitting them into bytes
+      size_t e = s + 1;
+      while (e < _size && (_data[e] & 0xC0) == 0x80) e++;
+      res.emplace_back(_data + s, e - s);
+      s = e - 1;
+#else
+      res.emplace_back(_data + s, 1);
+#endif
+    }
+    return res;
+  }
+  size_t start = 0;
+  size_t index;
+  while ((index = indexOf(separator, start)) != npos) {
+    if (limit >= 0 && res.size() == (size_t)limit) {
+      return res;
+    }
+    res.emplace_back(_data + start, index - start);
+    start = index + seplen;
+  }
+  if (limit >= 0 && res.size() == (size_t)limit) {
+    return res;
+  }
+  res.emplace_back(_data + start, _size - start);
+  return res;
+}
+
+StringView StringView::trim() const noexcept {
+  size_t start = internal::trimStartIndex(_data, _size);
+  if (start == _size) return StringView(_data + _size, 0);
+  return StringView(_data + start, internal::trimEndIndex(_data, _size) - start);
+}
+
+StringView StringView::trimEnd() const noexcept {
+  return StringView(_data, internal::trimEndIndex(_data, _size));
+}
+
+StringView StringView::trimStart() const noexcept {
+  size_t start = internal::trimStartIndex(_data, _size);
+  return StringView(_data + start, _size - start);
+}
+
+int StringView::compare(StringView s) const noexcept {
+  size_t n = _size < s._size ? _size : s._size;
+  int r = traits::compare(_data, s._data, n);
+  if (r != 0) return r;
+  return _size < s._size ? -1 : (_size > s._size ? 1 : 0);
+}
+
+bool operator==(StringView l, StringView r) noexcept {
+  return l.length() == r.length() && l.compare(r) == 0;
+}
+
+bool operator!=(StringView l, StringView r) noexcept {
+  return !(l == r);
+}
+
+bool operator<(StringView l, StringView r) noexcept {
+  return l.compare(r) < 0;
+}
+
+std::ostream& operator<<(std::ostream& out, StringView view) {
+  out << view.str();
+  return out;
+}
+
+}
@@ -9,7 +9,9 @@
 
 #include "jscpp/fs.hpp"
 #include "jscpp/path.hpp"
-#include "../internal/throw.hpp"
+#include "../internal/fserror.hpp"
+#include "../internal/dirreader.hpp"
+#include "../internal/transcode.hpp"
 #include <cerrno>
 #include <cstring>
 
@@ -107,7 +109,7 @@ Dir::~Dir() noexcept {
   }
 }
 
-Dir::Dir() noexcept: dir_(-1), path_(), first_data_(nullptr) {}
+Dir::Dir() noexcept: dir_(-1), path_(), first_data_(nullptr), iterating_(false) {}
 
 Dir::Dir(Dir&& d) noexcept {
   dir_ = d.dir_;
@@ -115,6 +117,7 @@ Dir::Dir(Dir&& d) noexcept {
   path_ = std::move(d.path_);
   first_data_ = d.first_data_;
   d.first_data_ = nullptr;
+  iterating_ = d.iterating_;
 }
 
 Dir& Dir::operator=(Dir&& d) {
@@ -125,11 +128,12 @@ Dir& Dir::operator=(Dir&& d) {
     d.dir_ = -1;
     first_data_ = d.first_data_;
     d.first_data_ = nullptr;
+    iterating_ = d.iterating_;
   }
   return *this;
 }
 
-Dir Dir::create(const String& p) {
+Dir Dir::create(const String& p, std::error_code& ec) {
   Dir dir;
   dir.path_ = p;
   
@@ -139,8 +143,10 @@ Dir Dir::create(const String& p) {
   if (dir.dir_ == -1) {
     delete dir.first_data_;
     dir.first_data_ = nullptr;
-    internal::throwError(String(strerror(errno)) + L", opendir" + L" \"" + p + L"\"");
+    ec = internal::errnoCode(errno);
+    return dir;
   }
+  ec.clear();
   return dir;
 }
 
@@ -153,14 +159,14 @@ void Dir::close() {
   }
   if (dir_ != -1) {
     if (0 != _findclose(dir_)) {
-      internal::throwError(String(strerror(errno)) + L", closedir" + L" \"" + path_ + L"\"");
+      internal::throwFsError(internal::errnoCode(errno), "closedir", path_);
     };
     dir_ = -1;
   }
 }
 
 fs::Dirent Dir::read() {
-  if (first_data_) {
+  if (first_data_ && !iterating_) {
     fs::Dirent tmp(first_data_);
     delete first_data_;
     first_data_ = nullptr;
@@ -178,6 +184,35 @@ fs::Dirent Dir::read() {
   }
 }
 
+bool Dir::next(DirentView& entry) {
+  if (dir_ == -1) {
+    return false;
+  }
+  for (;;) {
+    // The first entry came with _wfindfirst; after it first_data_ is reused
+    if (first_data_ == nullptr || iterating_) {
+      if (first_data_ == nullptr) first_data_ = new struct _wfinddata_t;
+      if (_wfindnext(dir_, first_data_) != 0) {
+        if (errno == ENOENT) return false;
+        internal::throwFsError(internal::errnoCode(errno), "scandir", path_);
+      }
+    }
+    iterating_ = true;
+    const wchar_t* name = first_data_->name;
+    if (name[0] == L'.' && (name[1] == L'\0' || (name[1] == L'.' && name[2] == L'\0'))) {
+      continue;
+    }
+    FileType type = FT_FILE;
+    if (first_data_->attrib & FILE_ATTRIBUTE_REPARSE_POINT) {
+      type = FT_SYMLINK;
+    } else if (first_data_->attrib & FILE_ATTRIBUTE_DIRECTORY) {
+      type = FT_DIRECTORY;
+    }
+    entry = DirentView(name, wcslen(name), type);
+    return true;
+  }
+}
+
 #else
 Dirent::~Dirent() { dirent_ = nullptr; }
 Dirent::Dirent() noexcept: dirent_(nullptr) {}
@@ -261,13 +296,15 @@ bool Dirent::isSocket() const noexcept {
   }
 }
 
-Dir Dir::create(const String& p) {
+Dir Dir::create(const String& p, std::error_code& ec) {
   Dir dir;
   dir.path_ = p;
   String path = path::normalize(p);
   if ((dir.dir_ = ::opendir(path.str().c_str())) == nullptr) {
-    internal::throwError(String(strerror(errno)) + L", opendir" + L" \"" + p + L"\"");
+    ec = internal::errnoCode(errno);
+    return dir;
   }
+  ec.clear();
   return dir;
 }
 
@@ -301,7 +338,7 @@ String Dir::path() const noexcept { return path_; }
 void Dir::close() {
   if (dir_) {
     if (0 != closedir(dir_)) {
-      internal::throwError(String(strerror(errno)) + L", closedir" + L" \"" + path_ + L"\"");
+      internal::throwFsError(internal::errnoCode(errno), "closedir", path_);
     }
     dir_ = nullptr;
   }
@@ -311,31 +348,134 @@ fs::Dirent Dir::read() const noexcept {
   struct ::dirent *direntp = ::readdir(dir_);
   return direntp;
 }
+
+bool Dir::next(DirentView& entry) {
+  if (dir_ == nullptr) {
+    return false;
+  }
+  for (;;) {
+    errno = 0;
+    struct ::dirent* direntp = ::readdir(dir_);
+    if (direntp == nullptr) {
+      if (errno != 0) {
+        internal::throwFsError(internal::errnoCode(errno), "scandir", path_);
+      }
+      return false;
+    }
+    const char* name = direntp->d_name;
+    if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+      continue;
+    }
+    entry = DirentView(name, strlen(name), internal::fileTypeOf(direntp->d_type));
+    return true;
+  }
+}
 #endif
 
-fs::Dir opendir(const String& p) {
-  return fs::Dir::create(p);
+String DirentView::name() const {
+  return String(std::basic_string<char_type>(name_, length_));
 }
 
-std::vector<String> readdir(const String& p) {
-  String newPath = path::normalize(p);
-  fs::Dir dir = fs::opendir(newPath);
+DirIterator::DirIterator(Dir* dir): dir_(dir) {
+  ++*this;
+}
 
-  std::vector<String> res;
-  String item;
+DirIterator& DirIterator::operator++() {
+  if (dir_ && !dir_->next(entry_)) {
+    dir_ = nullptr;
+  }
+  return *this;
+}
 
-  fs::Dirent dirent;
+DirIterator Dir::begin() {
+  return DirIterator(this);
+}
 
-  while (!((dirent = dir.read()).isEmpty())) {
-    item = dirent.name();
-    if (!(item == L".") && !(item == L"..")) {
-      res.emplace_back(item);
-    }
+DirIterator Dir::end() noexcept {
+  return DirIterator();
+}
+
+Dir Dir::create(const String& p) {
+  std::error_code ec;
+  Dir dir = create(p, ec);
+  if (ec) internal::throwFsError(ec, "opendir", p);
+  return dir;
+}
+
+fs::Dir opendir(const String& p) {
+  return fs::Dir::create(p);
+}
+
+fs::Dir opendir(const String& p, std::error_code& ec) {
+  return fs::Dir::create(p, ec);
+}
+
+namespace {
+
+// Fills in a DirentList's buffers. On failure syscall names the step.
+void listWithFileTypes(const String& p, std::vector<String::value_type>& names, std::vector<DirentInfo>& entries,
+                       std::error_code& ec, const char*& syscall) {
+  syscall = "opendir";
+  DirHandle dir = DirHandle::open(p, ec);
+  if (ec) return;
+  syscall = "scandir";
+  internal::DirReader reader(dir, ec);
+  if (ec) return;
+  internal::DirReader::Entry entry;
+  // Names are appended to one buffer that may move while growing, so the
+  // views are only made once everything has been read.
+  std::vector<size_t> offsets;
+  while (reader.next(entry, ec)) {
+    size_t offset = names.size();
+#if JSCPP_STRING_UTF8 || defined(_WIN32)
+    names.insert(names.end(), entry.name, entry.name + entry.length);
+#else
+    names.resize(offset + entry.length);
+    names.resize(offset + internal::decodeUtf8(entry.name, entry.length, &names[offset]));
+#endif
+    offsets.push_back(offset);
+    DirentInfo info;
+    info.type = entry.type;
+    entries.push_back(info);
   }
+  if (ec) {
+    names.clear();
+    entries.clear();
+    return;
+  }
+  for (size_t i = 0; i < offsets.size(); i++) {
+    size_t end = i + 1 < offsets.size() ? offsets[i + 1] : names.size();
+    entries[i].name = StringView(names.data() + offsets[i], end - offsets[i]);
+  }
+}
 
-  dir.close();
+}
+
+DirentList readdirWithFileTypes(const String& p, std::error_code& ec) {
+  DirentList res;
+  const char* syscall;
+  listWithFileTypes(p, res.names_, res.entries_, ec, syscall);
   return res;
 }
 
+DirentList readdirWithFileTypes(const String& p) {
+  DirentList res;
+  std::error_code ec;
+  const char* syscall;
+  listWithFileTypes(p, res.names_, res.entries_, ec, syscall);
+  if (ec) internal::throwFsError(ec, syscall, p);
+  return res;
+}
+
+std::vector<String> readdir(const String& p) {
+  return DirHandle::open(p).readdir();
+}
+
+std::vector<String> readdir(const String& p, std::error_code& ec) {
+  DirHandle dir = DirHandle::open(p, ec);
+  if (ec) return std::vector<String>();
+  return dir.readdir(ec);
+}
+
 }
 }
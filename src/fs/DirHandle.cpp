@@ -0,0 +1,294 @@
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#endif
+
+#include "jscpp/fs.hpp"
+#include "jscpp/path.hpp"
+#include "../internal/fserror.hpp"
+#include "../internal/dirreader.hpp"
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+namespace js {
+namespace fs {
+
+#ifdef _WIN32
+
+DirHandle::~DirHandle() {}
+
+DirHandle::DirHandle() noexcept: path_() {}
+
+DirHandle::DirHandle(DirHandle&& d) noexcept: path_(std::move(d.path_)) {}
+
+DirHandle& DirHandle::operator=(DirHandle&& d) noexcept {
+  path_ = std::move(d.path_);
+  return *this;
+}
+
+DirHandle DirHandle::open(const String& p, std::error_code& ec) {
+  DirHandle res;
+  Stats stats;
+  int r = Stats::createNoThrow(stats, p, true, SF_TYPE);
+  if (r == 0 && !stats.isDirectory()) r = ENOTDIR;
+  if (r != 0) {
+    ec = internal::errnoCode(r);
+    return res;
+  }
+  ec.clear();
+  res.path_ = p;
+  return res;
+}
+
+DirHandle DirHandle::openAt(const String& name, std::error_code& ec, bool followLink) const {
+  String p = path::join(path_, name);
+  DirHandle res;
+  Stats stats;
+  int r = Stats::createNoThrow(stats, p, followLink, SF_TYPE);
+  if (r == 0 && !stats.isDirectory()) r = ENOTDIR;
+  if (r != 0) {
+    ec = internal::errnoCode(r);
+    return res;
+  }
+  ec.clear();
+  res.path_ = p;
+  return res;
+}
+
+void DirHandle::close() noexcept {
+  path_ = String();
+}
+
+bool DirHandle::isOpen() const noexcept {
+  return path_.length() != 0;
+}
+
+int DirHandle::statNoThrow(Stats& out, const String& name, bool followLink, unsigned int fields) const {
+  return Stats::createNoThrow(out, path::join(path_, name), followLink, fields);
+}
+
+void DirHandle::mkdir(const String& name, std::error_code& ec, int mode) const {
+  fs::mkdir(path::join(path_, name), ec, mode);
+}
+
+void DirHandle::unlink(const String& name, std::error_code& ec) const {
+  fs::unlink(path::join(path_, name), ec);
+}
+
+void DirHandle::rmdir(const String& name, std::error_code& ec) const {
+  fs::rmdir(path::join(path_, name), ec);
+}
+
+String DirHandle::readlink(const String& name, std::error_code& ec) const {
+  return fs::readlink(path::join(path_, name), ec);
+}
+
+void DirHandle::symlink(const String& target, const String& name, std::error_code& ec) const {
+  fs::symlink(target, path::join(path_, name), ec);
+}
+
+#else
+
+DirHandle::~DirHandle() {
+  close();
+}
+
+DirHandle::DirHandle() noexcept: fd_(-1), path_() {}
+
+DirHandle::DirHandle(DirHandle&& d) noexcept: fd_(d.fd_), path_(std::move(d.path_)) {
+  d.fd_ = -1;
+}
+
+DirHandle& DirHandle::operator=(DirHandle&& d) noexcept {
+  if (this != &d) {
+    close();
+    fd_ = d.fd_;
+    path_ = std::move(d.path_);
+    d.fd_ = -1;
+  }
+  return *this;
+}
+
+DirHandle DirHandle::open(const String& p, std::error_code& ec) {
+  DirHandle res;
+  res.fd_ = ::open(path::normalize(p).str().c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (res.fd_ == -1) {
+    ec = internal::errnoCode(errno);
+    return res;
+  }
+  ec.clear();
+  res.path_ = p;
+  return res;
+}
+
+DirHandle DirHandle::openAt(const String& name, std::error_code& ec, bool followLink) const {
+  DirHandle res;
+  int flags = O_RDONLY | O_DIRECTORY | O_CLOEXEC | (followLink ? 0 : O_NOFOLLOW);
+  res.fd_ = ::openat(fd_, name.str().c_str(), flags);
+  if (res.fd_ == -1) {
+    ec = internal::errnoCode(errno);
+    return res;
+  }
+  ec.clear();
+  res.path_ = path::join(path_, name);
+  return res;
+}
+
+void DirHandle::close() noexcept {
+  if (fd_ != -1) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+}
+
+bool DirHandle::isOpen() const noexcept {
+  return fd_ != -1;
+}
+
+int DirHandle::fd() const noexcept {
+  return fd_;
+}
+
+int DirHandle::statNoThrow(Stats& out, const String& name, bool followLink, unsigned int fields) const {
+  return Stats::statAt(fd_, name.str().c_str(), followLink, fields, out);
+}
+
+void DirHandle::mkdir(const String& name, std::error_code& ec, int mode) const {
+  if (::mkdirat(fd_, name.str().c_str(), mode) != 0) {
+    ec = internal::errnoCode(errno);
+    return;
+  }
+  ec.clear();
+}
+
+void DirHandle::unlink(const String& name, std::error_code& ec) const {
+  if (::unlinkat(fd_, name.str().c_str(), 0) != 0) {
+    ec = internal::errnoCode(errno);
+    return;
+  }
+  ec.clear();
+}
+
+void DirHandle::rmdir(const String& name, std::error_code& ec) const {
+  if (::unlinkat(fd_, name.str().c_str(), AT_REMOVEDIR) != 0) {
+    ec = internal::errnoCode(errno);
+    return;
+  }
+  ec.clear();
+}
+
+String DirHandle::readlink(const String& name, std::error_code& ec) const {
+  std::string buf(256, '\0');
+  std::string cname = name.str();
+  for (;;) {
+    ssize_t n = ::readlinkat(fd_, cname.c_str(), &buf[0], buf.size());
+    if (n < 0) {
+      ec = internal::errnoCode(errno);
+      return String();
+    }
+    if ((size_t)n < buf.size()) {
+      buf.resize((size_t)n);
+      ec.clear();
+      return buf;
+    }
+    buf.resize(buf.size() * 2);
+  }
+}
+
+void DirHandle::symlink(const String& target, const String& name, std::error_code& ec) const {
+  if (::symlinkat(target.str().c_str(), fd_, name.str().c_str()) != 0) {
+    ec = internal::errnoCode(errno);
+    return;
+  }
+  ec.clear();
+}
+
+#endif
+
+DirHandle DirHandle::open(const String& p) {
+  std::error_code ec;
+  DirHandle res = open(p, ec);
+  if (ec) internal::throwFsError(ec, "opendir", p);
+  return res;
+}
+
+DirHandle DirHandle::openAt(const String& name, bool followLink) const {
+  std::error_code ec;
+  DirHandle res = openAt(name, ec, followLink);
+  if (ec) internal::throwFsError(ec, "opendir", path::join(path_, name));
+  return res;
+}
+
+std::vector<String> DirHandle::readdir(std::error_code& ec) const {
+  std::vector<String> res;
+  internal::DirReader reader(*this, ec);
+  internal::DirReader::Entry entry;
+  while (!ec && reader.next(entry, ec)) {
+    res.emplace_back(entry.name);
+  }
+  return res;
+}
+
+std::vector<String> DirHandle::readdir() const {
+  std::error_code ec;
+  std::vector<String> res = readdir(ec);
+  if (ec) internal::throwFsError(ec, "scandir", path_);
+  return res;
+}
+
+Stats DirHandle::stat(const String& name, std::error_code& ec, bool followLink, unsigned int fields) const {
+  Stats out;
+  int r = statNoThrow(out, name, followLink, fields);
+  ec = r != 0 ? internal::errnoCode(r) : std::error_code();
+  return out;
+}
+
+Stats DirHandle::stat(const String& name, bool followLink, unsigned int fields) const {
+  std::error_code ec;
+  Stats out = stat(name, ec, followLink, fields);
+  if (ec) internal::throwFsError(ec, followLink ? "stat" : "lstat", path::join(path_, name));
+  return out;
+}
+
+void DirHandle::mkdir(const String& name, int mode) const {
+  std::error_code ec;
+  mkdir(name, ec, mode);
+  if (ec) internal::throwFsError(ec, "mkdir", path::join(path_, name));
+}
+
+void DirHandle::unlink(const String& name) const {
+  std::error_code ec;
+  unlink(name, ec);
+  if (ec) internal::throwFsError(ec, "unlink", path::join(path_, name));
+}
+
+void DirHandle::rmdir(const String& name) const {
+  std::error_code ec;
+  rmdir(name, ec);
+  if (ec) internal::throwFsError(ec, "rmdir", path::join(path_, name));
+}
+
+String DirHandle::readlink(const String& name) const {
+  std::error_code ec;
+  String res = readlink(name, ec);
+  if (ec) internal::throwFsError(ec, "readlink", path::join(path_, name));
+  return res;
+}
+
+void DirHandle::symlink(const String& target, const String& name) const {
+  std::error_code ec;
+  symlink(target, name, ec);
+  if (ec) internal::throwFsError(ec, "symlink", target, path::join(path_, name));
+}
+
+const String& DirHandle::path() const noexcept {
+  return path_;
+}
+
+}
+}
@@ -0,0 +1,611 @@
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/uio.h>
+#endif
+
+#include "jscpp/fs.hpp"
+#include "jscpp/path.hpp"
+#include "../internal/fserror.hpp"
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#if !defined(_WIN32) && !defined(IOV_MAX)
+#define IOV_MAX 1024
+#endif
+
+namespace js {
+namespace fs {
+
+#ifdef _WIN32
+
+namespace {
+
+// Reads stop at the end of the file, or of a pipe
+bool isEof(DWORD err) noexcept {
+  return err == ERROR_HANDLE_EOF || err == ERROR_BROKEN_PIPE;
+}
+
+// Returns 0 or the GetLastError() value. A negative position uses and
+// advances the file pointer.
+DWORD transfer(int fd, uint8_t* buf, size_t size, int64_t position, bool writing, size_t& done) noexcept {
+  HANDLE handle = (HANDLE)_get_osfhandle(fd);
+  done = 0;
+  if (handle == INVALID_HANDLE_VALUE) return ERROR_INVALID_HANDLE;
+
+  // Positional transfers on synchronous handles still move the pointer
+  LARGE_INTEGER zero, saved;
+  zero.QuadPart = 0;
+  if (position >= 0 && !SetFilePointerEx(handle, zero, &saved, FILE_CURRENT)) return GetLastError();
+
+  DWORD err = 0;
+  while (done < size) {
+    DWORD chunk = (DWORD)(size - done < 0x40000000 ? size - done : 0x40000000);
+    DWORD n = 0;
+    OVERLAPPED overlapped;
+    OVERLAPPED* at = NULL;
+    if (position >= 0) {
+      uint64_t offset = (uint64_t)position + done;
+      memset(&overlapped, 0, sizeof(overlapped));
+      overlapped.Offset = (DWORD)offset;
+      overlapped.OffsetHigh = (DWORD)(offset >> 32);
+      at = &overlapped;
+    }
+    BOOL ok = writing ? WriteFile(handle, buf + done, chunk, &n, at) : ReadFile(handle, buf + done, chunk, &n, at);
+    if (!ok) {
+      err = GetLastError();
+      if (!writing && isEof(err)) err = 0;
+      break;
+    }
+    if (n == 0) break;
+    done += n;
+  }
+
+  if (position >= 0) SetFilePointerEx(handle, saved, NULL, FILE_BEGIN);
+  return err;
+}
+
+std::error_code openFile(const String& p, int flags, int mode, int& fd) {
+  DWORD access = 0;
+  if (flags & OF_READ) access |= FILE_GENERIC_READ;
+  if (flags & OF_WRITE) access |= FILE_GENERIC_WRITE;
+  if (flags & OF_APPEND) {
+    // Writes then always go to the end
+    access &= ~FILE_WRITE_DATA;
+    access |= FILE_APPEND_DATA;
+  }
+
+  DWORD disposition = OPEN_EXISTING;
+  if (flags & OF_CREATE) {
+    if (flags & OF_EXCLUSIVE) disposition = CREATE_NEW;
+    else if (flags & OF_TRUNCATE) disposition = CREATE_ALWAYS;
+    else disposition = OPEN_ALWAYS;
+  } else if (flags & OF_TRUNCATE) {
+    disposition = TRUNCATE_EXISTING;
+  }
+
+  DWORD attributes = (mode & 0200) ? FILE_ATTRIBUTE_NORMAL : FILE_ATTRIBUTE_READONLY;
+  attributes |= FILE_FLAG_BACKUP_SEMANTICS;
+  if (flags & OF_DIRECT) attributes |= FILE_FLAG_NO_BUFFERING;
+  if (flags & OF_DSYNC) attributes |= FILE_FLAG_WRITE_THROUGH;
+
+  SECURITY_ATTRIBUTES security;
+  security.nLength = sizeof(security);
+  security.lpSecurityDescriptor = NULL;
+  security.bInheritHandle = (flags & OF_INHERIT) ? TRUE : FALSE;
+
+  HANDLE handle = CreateFileW(p.data(), access, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              &security, disposition, attributes, NULL);
+  if (handle == INVALID_HANDLE_VALUE) {
+    return internal::winCode(GetLastError());
+  }
+  fd = _open_osfhandle((intptr_t)handle, (flags & OF_WRITE) ? ((flags & OF_APPEND) ? _O_APPEND : 0) : _O_RDONLY);
+  if (fd == -1) {
+    int err = errno;
+    CloseHandle(handle);
+    return internal::errnoCode(err);
+  }
+  return std::error_code();
+}
+
+}
+
+void FileHandle::close(std::error_code& ec) noexcept {
+  ec.clear();
+  if (fd_ != -1) {
+    if (::_close(fd_) != 0) ec = internal::errnoCode(errno);
+    fd_ = -1;
+  }
+}
+
+size_t FileHandle::read(void* buf, size_t size, std::error_code& ec) const {
+  size_t done;
+  DWORD err = transfer(fd_, static_cast<uint8_t*>(buf), size, -1, false, done);
+  ec = err != 0 ? internal::winCode(err) : std::error_code();
+  return done;
+}
+
+size_t FileHandle::pread(void* buf, size_t size, uint64_t offset, std::error_code& ec) const {
+  size_t done;
+  DWORD err = transfer(fd_, static_cast<uint8_t*>(buf), size, (int64_t)offset, false, done);
+  ec = err != 0 ? internal::winCode(err) : std::error_code();
+  return done;
+}
+
+void FileHandle::write(const void* buf, size_t size, std::error_code& ec) const {
+  size_t done;
+  DWORD err = transfer(fd_, (uint8_t*)buf, size, -1, true, done);
+  ec = err != 0 ? internal::winCode(err) : std::error_code();
+}
+
+void FileHandle::pwrite(const void* buf, size_t size, uint64_t offset, std::error_code& ec) const {
+  size_t done;
+  DWORD err = transfer(fd_, (uint8_t*)buf, size, (int64_t)offset, true, done);
+  ec = err != 0 ? internal::winCode(err) : std::error_code();
+}
+
+// Windows has no vectored I/O on regular handles, one transfer per buffer
+size_t FileHandle::readv(const std::vector<IoBuffer>& buffers, std::error_code& ec, int64_t position) const {
+  size_t total = 0;
+  ec.clear();
+  for (size_t i = 0; i < buffers.size(); i++) {
+    size_t done;
+    DWORD err = transfer(fd_, buffers[i].data, buffers[i].size, position < 0 ? -1 : position + (int64_t)total,
+                         false, done);
+    total += done;
+    if (err != 0) {
+      ec = internal::winCode(err);
+      break;
+    }
+    if (done < buffers[i].size) break;
+  }
+  return total;
+}
+
+void FileHandle::writev(const std::vector<ByteView>& buffers, std::error_code& ec, int64_t position) const {
+  size_t total = 0;
+  ec.clear();
+  for (size_t i = 0; i < buffers.size(); i++) {
+    size_t done;
+    DWORD err = transfer(fd_, (uint8_t*)buffers[i].data(), buffers[i].size(),
+                         position < 0 ? -1 : position + (int64_t)total, true, done);
+    total += done;
+    if (err != 0) {
+      ec = internal::winCode(err);
+      break;
+    }
+  }
+}
+
+void FileHandle::truncate(std::error_code& ec, uint64_t size) const {
+  int err = ::_chsize_s(fd_, (int64_t)size);
+  ec = err != 0 ? internal::errnoCode(err) : std::error_code();
+}
+
+void FileHandle::allocate(uint64_t offset, uint64_t length, std::error_code& ec) const {
+  HANDLE handle = (HANDLE)_get_osfhandle(fd_);
+  FILE_ALLOCATION_INFO info;
+  info.AllocationSize.QuadPart = (LONGLONG)(offset + length);
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(handle, &size) ||
+      !SetFileInformationByHandle(handle, FileAllocationInfo, &info, sizeof(info))) {
+    ec = internal::winCode(GetLastError());
+    return;
+  }
+  // The allocation alone leaves the end of the file where it was
+  if ((uint64_t)size.QuadPart < offset + length) {
+    truncate(ec, offset + length);
+    return;
+  }
+  ec.clear();
+}
+
+void FileHandle::sync(std::error_code& ec) const {
+  ec = FlushFileBuffers((HANDLE)_get_osfhandle(fd_)) ? std::error_code() : internal::winCode(GetLastError());
+}
+
+void FileHandle::datasync(std::error_code& ec) const {
+  sync(ec);
+}
+
+void FileHandle::advise(FileAdvice advice, std::error_code& ec, uint64_t offset, uint64_t length) const {
+  (void)advice;
+  (void)offset;
+  (void)length;
+  ec.clear();
+}
+
+#else
+
+namespace {
+
+int toOpenFlags(int flags) noexcept {
+  int res = (flags & OF_READ_WRITE) == OF_READ_WRITE ? O_RDWR : (flags & OF_WRITE) ? O_WRONLY : O_RDONLY;
+  if (flags & OF_CREATE) res |= O_CREAT;
+  if (flags & OF_TRUNCATE) res |= O_TRUNC;
+  if (flags & OF_APPEND) res |= O_APPEND;
+  if (flags & OF_EXCLUSIVE) res |= O_EXCL;
+  if (flags & OF_DSYNC) res |= O_DSYNC;
+  if (!(flags & OF_INHERIT)) res |= O_CLOEXEC;
+#ifdef O_DIRECT
+  if (flags & OF_DIRECT) res |= O_DIRECT;
+#endif
+#ifdef O_NOATIME
+  if (flags & OF_NOATIME) res |= O_NOATIME;
+#endif
+  return res;
+}
+
+// Repeats op, which returns what it transferred this time, over the
+// buffers until all are done or a read reaches the end of the file
+template <typename Op>
+size_t vectored(struct iovec* iov, size_t size, bool writing, std::error_code& ec, const Op& op) {
+  size_t total = 0;
+  size_t first = 0;
+  ec.clear();
+  while (first < size && iov[first].iov_len == 0) first++;
+  while (first < size) {
+    size_t count = size - first;
+    ssize_t n = op(&iov[first], (int)(count < IOV_MAX ? count : IOV_MAX), total);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      ec = internal::errnoCode(errno);
+      break;
+    }
+    if (n == 0) {
+      if (writing) ec = internal::errnoCode(EIO);
+      break;
+    }
+    total += (size_t)n;
+    size_t left = (size_t)n;
+    while (first < size && left >= iov[first].iov_len) {
+      left -= iov[first].iov_len;
+      first++;
+    }
+    if (left > 0) {
+      iov[first].iov_base = static_cast<uint8_t*>(iov[first].iov_base) + left;
+      iov[first].iov_len -= left;
+    }
+    while (first < size && iov[first].iov_len == 0) first++;
+  }
+  return total;
+}
+
+size_t transfer(int fd, uint8_t* buf, size_t size, int64_t position, bool writing, std::error_code& ec) {
+  struct iovec iov;
+  iov.iov_base = buf;
+  iov.iov_len = size;
+  return vectored(&iov, 1, writing, ec, [&](struct iovec* v, int, size_t done) -> ssize_t {
+    if (position < 0) {
+      return writing ? ::write(fd, v->iov_base, v->iov_len) : ::read(fd, v->iov_base, v->iov_len);
+    }
+    off_t at = (off_t)(position + (int64_t)done);
+    return writing ? ::pwrite(fd, v->iov_base, v->iov_len, at) : ::pread(fd, v->iov_base, v->iov_len, at);
+  });
+}
+
+size_t transferv(int fd, std::vector<struct iovec>& iov, int64_t position, bool writing, std::error_code& ec) {
+  return vectored(iov.data(), iov.size(), writing, ec, [&](struct iovec* v, int count, size_t done) -> ssize_t {
+    if (position < 0) {
+      return writing ? ::writev(fd, v, count) : ::readv(fd, v, count);
+    }
+    off_t at = (off_t)(position + (int64_t)done);
+#if defined(__linux__) || defined(__FreeBSD__)
+    return writing ? ::pwritev(fd, v, count, at) : ::preadv(fd, v, count, at);
+#else
+    return writing ? ::pwrite(fd, v->iov_base, v->iov_len, at) : ::pread(fd, v->iov_base, v->iov_len, at);
+#endif
+  });
+}
+
+std::error_code openFile(const String& p, int flags, int mode, int& fd) {
+  std::string path = p.str();
+  int openFlags = toOpenFlags(flags);
+  fd = ::open(path.c_str(), openFlags, mode);
+#ifdef O_NOATIME
+  // Only the owner may ask for O_NOATIME, everyone else just gets atime
+  if (fd == -1 && errno == EPERM && (openFlags & O_NOATIME)) {
+    fd = ::open(path.c_str(), openFlags & ~O_NOATIME, mode);
+  }
+#endif
+  if (fd == -1) {
+    return internal::errnoCode(errno);
+  }
+#if defined(__APPLE__) && defined(F_NOCACHE)
+  if ((flags & OF_DIRECT) && ::fcntl(fd, F_NOCACHE, 1) == -1) {
+    int err = errno;
+    ::close(fd);
+    fd = -1;
+    return internal::errnoCode(err);
+  }
+#endif
+  return std::error_code();
+}
+
+}
+
+void FileHandle::close(std::error_code& ec) noexcept {
+  ec.clear();
+  if (fd_ != -1) {
+    // The descriptor is released even when close() is interrupted
+    if (::close(fd_) != 0 && errno != EINTR) ec = internal::errnoCode(errno);
+    fd_ = -1;
+  }
+}
+
+size_t FileHandle::read(void* buf, size_t size, std::error_code& ec) const {
+  return transfer(fd_, static_cast<uint8_t*>(buf), size, -1, false, ec);
+}
+
+size_t FileHandle::pread(void* buf, size_t size, uint64_t offset, std::error_code& ec) const {
+  return transfer(fd_, static_cast<uint8_t*>(buf), size, (int64_t)offset, false, ec);
+}
+
+void FileHandle::write(const void* buf, size_t size, std::error_code& ec) const {
+  transfer(fd_, (uint8_t*)buf, size, -1, true, ec);
+}
+
+void FileHandle::pwrite(const void* buf, size_t size, uint64_t offset, std::error_code& ec) const {
+  transfer(fd_, (uint8_t*)buf, size, (int64_t)offset, true, ec);
+}
+
+size_t FileHandle::readv(const std::vector<IoBuffer>& buffers, std::error_code& ec, int64_t position) const {
+  std::vector<struct iovec> iov(buffers.size());
+  for (size_t i = 0; i < buffers.size(); i++) {
+    iov[i].iov_base = buffers[i].data;
+    iov[i].iov_len = buffers[i].size;
+  }
+  return transferv(fd_, iov, position, false, ec);
+}
+
+void FileHandle::writev(const std::vector<ByteView>& buffers, std::error_code& ec, int64_t position) const {
+  std::vector<struct iovec> iov(buffers.size());
+  for (size_t i = 0; i < buffers.size(); i++) {
+    iov[i].iov_base = (void*)buffers[i].data();
+    iov[i].iov_len = buffers[i].size();
+  }
+  transferv(fd_, iov, position, true, ec);
+}
+
+void FileHandle::truncate(std::error_code& ec, uint64_t size) const {
+  int r;
+  do {
+    r = ::ftruncate(fd_, (off_t)size);
+  } while (r != 0 && errno == EINTR);
+  ec = r != 0 ? internal::errnoCode(errno) : std::error_code();
+}
+
+void FileHandle::allocate(uint64_t offset, uint64_t length, std::error_code& ec) const {
+#ifdef __APPLE__
+  struct stat info;
+  if (::fstat(fd_, &info) != 0) {
+    ec = internal::errnoCode(errno);
+    return;
+  }
+  uint64_t end = offset + length;
+  if (end <= (uint64_t)info.st_size) {
+    ec.clear();
+    return;
+  }
+  // Contiguous if possible, then anywhere
+  fstore_t store = {F_ALLOCATECONTIG | F_ALLOCATEALL, F_PEOFPOSMODE, 0, (off_t)(end - info.st_size), 0};
+  if (::fcntl(fd_, F_PREALLOCATE, &store) == -1) {
+    store.fst_flags = F_ALLOCATEALL;
+    if (::fcntl(fd_, F_PREALLOCATE, &store) == -1) {
+      ec = internal::errnoCode(errno);
+      return;
+    }
+  }
+  truncate(ec, end);
+#else
+  int err;
+  do {
+    err = ::posix_fallocate(fd_, (off_t)offset, (off_t)length);
+  } while (err == EINTR);
+  ec = err != 0 ? internal::errnoCode(err) : std::error_code();
+#endif
+}
+
+void FileHandle::sync(std::error_code& ec) const {
+  ec = ::fsync(fd_) != 0 ? internal::errnoCode(errno) : std::error_code();
+}
+
+void FileHandle::datasync(std::error_code& ec) const {
+#ifdef __APPLE__
+  sync(ec);
+#else
+  ec = ::fdatasync(fd_) != 0 ? internal::errnoCode(errno) : std::error_code();
+#endif
+}
+
+void FileHandle::advise(FileAdvice advice, std::error_code& ec, uint64_t offset, uint64_t length) const {
+  ec.clear();
+#ifdef POSIX_FADV_NORMAL
+  int hint;
+  switch (advice) {
+    case FA_SEQUENTIAL: hint = POSIX_FADV_SEQUENTIAL; break;
+    case FA_RANDOM: hint = POSIX_FADV_RANDOM; break;
+    case FA_WILLNEED: hint = POSIX_FADV_WILLNEED; break;
+    case FA_DONTNEED: hint = POSIX_FADV_DONTNEED; break;
+    case FA_NOREUSE: hint = POSIX_FADV_NOREUSE; break;
+    default: hint = POSIX_FADV_NORMAL; break;
+  }
+  int err = ::posix_fadvise(fd_, (off_t)offset, (off_t)length, hint);
+  if (err != 0) ec = internal::errnoCode(err);
+#else
+  (void)advice;
+  (void)offset;
+  (void)length;
+#endif
+}
+
+#endif
+
+FileHandle::~FileHandle() {
+  std::error_code ec;
+  close(ec);
+}
+
+FileHandle::FileHandle() noexcept: fd_(-1), path_() {}
+
+FileHandle::FileHandle(FileHandle&& f) noexcept: fd_(f.fd_), path_(std::move(f.path_)) {
+  f.fd_ = -1;
+}
+
+FileHandle& FileHandle::operator=(FileHandle&& f) noexcept {
+  if (this != &f) {
+    std::error_code ec;
+    close(ec);
+    fd_ = f.fd_;
+    path_ = std::move(f.path_);
+    f.fd_ = -1;
+  }
+  return *this;
+}
+
+FileHandle FileHandle::open(const String& p, std::error_code& ec, int flags, int mode) {
+  FileHandle res;
+  ec = openFile(path::normalize(p), flags, mode, res.fd_);
+  if (!ec) res.path_ = p;
+  return res;
+}
+
+FileHandle FileHandle::open(const String& p, int flags, int mode) {
+  std::error_code ec;
+  FileHandle res = open(p, ec, flags, mode);
+  if (ec) internal::throwFsError(ec, "open", p);
+  return res;
+}
+
+FileHandle FileHandle::adopt(int fd, const String& p) noexcept {
+  FileHandle res;
+  res.fd_ = fd;
+  res.path_ = p;
+  return res;
+}
+
+int FileHandle::release() noexcept {
+  int fd = fd_;
+  fd_ = -1;
+  return fd;
+}
+
+void FileHandle::close() {
+  std::error_code ec;
+  close(ec);
+  if (ec) internal::throwFsError(ec, "close", path_);
+}
+
+bool FileHandle::isOpen() const noexcept {
+  return fd_ != -1;
+}
+
+int FileHandle::fd() const noexcept {
+  return fd_;
+}
+
+const String& FileHandle::path() const noexcept {
+  return path_;
+}
+
+size_t FileHandle::read(void* buf, size_t size) const {
+  std::error_code ec;
+  size_t res = read(buf, size, ec);
+  if (ec) internal::throwFsError(ec, "read", path_);
+  return res;
+}
+
+size_t FileHandle::pread(void* buf, size_t size, uint64_t offset) const {
+  std::error_code ec;
+  size_t res = pread(buf, size, offset, ec);
+  if (ec) internal::throwFsError(ec, "read", path_);
+  return res;
+}
+
+void FileHandle::write(const void* buf, size_t size) const {
+  std::error_code ec;
+  write(buf, size, ec);
+  if (ec) internal::throwFsError(ec, "write", path_);
+}
+
+void FileHandle::pwrite(const void* buf, size_t size, uint64_t offset) const {
+  std::error_code ec;
+  pwrite(buf, size, offset, ec);
+  if (ec) internal::throwFsError(ec, "write", path_);
+}
+
+size_t FileHandle::readv(const std::vector<IoBuffer>& buffers, int64_t position) const {
+  std::error_code ec;
+  size_t res = readv(buffers, ec, position);
+  if (ec) internal::throwFsError(ec, "read", path_);
+  return res;
+}
+
+void FileHandle::writev(const std::vector<ByteView>& buffers, int64_t position) const {
+  std::error_code ec;
+  writev(buffers, ec, position);
+  if (ec) internal::throwFsError(ec, "write", path_);
+}
+
+void FileHandle::truncate(uint64_t size) const {
+  std::error_code ec;
+  truncate(ec, size);
+  if (ec) internal::throwFsError(ec, "ftruncate", path_);
+}
+
+void FileHandle::allocate(uint64_t offset, uint64_t length) const {
+  std::error_code ec;
+  allocate(offset, length, ec);
+  if (ec) internal::throwFsError(ec, "fallocate", path_);
+}
+
+void FileHandle::sync() const {
+  std::error_code ec;
+  sync(ec);
+  if (ec) internal::throwFsError(ec, "fsync", path_);
+}
+
+void FileHandle::datasync() const {
+  std::error_code ec;
+  datasync(ec);
+  if (ec) internal::throwFsError(ec, "fdatasync", path_);
+}
+
+Stats FileHandle::stat(std::error_code& ec, unsigned int fields) const {
+  Stats out;
+  int r = Stats::statFd(fd_, fields, out);
+  ec = r != 0 ? internal::errnoCode(r) : std::error_code();
+  return out;
+}
+
+Stats FileHandle::stat(unsigned int fields) const {
+  std::error_code ec;
+  Stats out = stat(ec, fields);
+  if (ec) internal::throwFsError(ec, "fstat", path_);
+  return out;
+}
+
+void FileHandle::advise(FileAdvice advice, uint64_t offset, uint64_t length) const {
+  std::error_code ec;
+  advise(advice, ec, offset, length);
+  if (ec) internal::throwFsError(ec, "fadvise", path_);
+}
+
+FileHandle open(const String& p, int flags, int mode) {
+  return FileHandle::open(p, flags, mode);
+}
+
+FileHandle open(const String& p, std::error_code& ec, int flags, int mode) {
+  return FileHandle::open(p, ec, flags, mode);
+}
+
+}
+}
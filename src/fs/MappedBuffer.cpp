@@ -0,0 +1,268 @@
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+
+#include "jscpp/fs.hpp"
+#include "jscpp/path.hpp"
+#include "../internal/fserror.hpp"
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+
+#define JSCPP_FS_READ_CHUNK 64 * 1024
+
+// Below this a read is cheaper than setting up and tearing down a mapping
+#define JSCPP_FS_MAP_THRESHOLD 16 * 1024
+
+namespace js {
+namespace fs {
+
+const size_t ByteView::npos;
+
+ByteView ByteView::slice(size_t offset, size_t length) const noexcept {
+  if (offset > size_) offset = size_;
+  if (length > size_ - offset) length = size_ - offset;
+  return ByteView(data_ + offset, length);
+}
+
+namespace {
+
+#ifndef _WIN32
+int toMadvise(MapAdvice advice) {
+  switch (advice) {
+    case MA_SEQUENTIAL: return MADV_SEQUENTIAL;
+    case MA_RANDOM: return MADV_RANDOM;
+    case MA_WILLNEED: return MADV_WILLNEED;
+    default: return MADV_NORMAL;
+  }
+}
+#endif
+
+// Reads into a malloc'd buffer until end of file, starting with room for
+// expected bytes (plus one to see the end) and doubling when that runs out.
+template <typename Read>
+bool readAll(Read read, size_t expected, uint8_t*& data, size_t& size) {
+  size_t capacity = 0;
+  data = nullptr;
+  size = 0;
+  for (;;) {
+    if (size == capacity) {
+      capacity = capacity == 0 ? (expected > 0 ? expected + 1 : JSCPP_FS_READ_CHUNK) : capacity * 2;
+      uint8_t* grown = (uint8_t*)std::realloc(data, capacity);
+      if (grown == nullptr) {
+        std::free(data);
+        data = nullptr;
+        errno = ENOMEM;
+        return false;
+      }
+      data = grown;
+    }
+    long n = read(data + size, capacity - size);
+    if (n < 0) {
+      std::free(data);
+      data = nullptr;
+      return false;
+    }
+    if (n == 0) {
+      if (size == 0) {
+        std::free(data);
+        data = nullptr;
+      }
+      return true;
+    }
+    size += (size_t)n;
+  }
+}
+
+}
+
+MappedBuffer::~MappedBuffer() {
+  close();
+}
+
+MappedBuffer::MappedBuffer() noexcept: data_(nullptr), size_(0), mapped_(false) {}
+
+MappedBuffer::MappedBuffer(MappedBuffer&& m) noexcept: data_(m.data_), size_(m.size_), mapped_(m.mapped_) {
+  m.data_ = nullptr;
+  m.size_ = 0;
+  m.mapped_ = false;
+}
+
+MappedBuffer& MappedBuffer::operator=(MappedBuffer&& m) noexcept {
+  if (this != &m) {
+    close();
+    data_ = m.data_;
+    size_ = m.size_;
+    mapped_ = m.mapped_;
+    m.data_ = nullptr;
+    m.size_ = 0;
+    m.mapped_ = false;
+  }
+  return *this;
+}
+
+void MappedBuffer::close() noexcept {
+  if (data_) {
+    if (mapped_) {
+#ifdef _WIN32
+      UnmapViewOfFile(data_);
+#else
+      munmap(data_, size_);
+#endif
+    } else {
+      std::free(data_);
+    }
+  }
+  data_ = nullptr;
+  size_ = 0;
+  mapped_ = false;
+}
+
+const uint8_t* MappedBuffer::data() const noexcept { return data_; }
+
+size_t MappedBuffer::size() const noexcept { return size_; }
+
+bool MappedBuffer::empty() const noexcept { return size_ == 0; }
+
+bool MappedBuffer::isMapped() const noexcept { return mapped_; }
+
+ByteView MappedBuffer::view(size_t offset, size_t length) const noexcept {
+  return ByteView(data_, size_).slice(offset, length);
+}
+
+void MappedBuffer::advise(MapAdvice advice) const noexcept {
+#ifdef _WIN32
+  (void)advice;
+#else
+  if (mapped_ && data_) {
+    ::madvise(data_, size_, toMadvise(advice));
+  }
+#endif
+}
+
+MappedBuffer MappedBuffer::load(const String& p, MapAdvice advice, std::error_code& ec, const char*& syscall) {
+  String path = path::normalize(p);
+  MappedBuffer res;
+  ec.clear();
+  syscall = "open";
+#ifdef _WIN32
+  HANDLE file = CreateFileW(path.data(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            NULL,
+                            OPEN_EXISTING,
+                            advice == MA_SEQUENTIAL ? FILE_FLAG_SEQUENTIAL_SCAN :
+                              (advice == MA_RANDOM ? FILE_FLAG_RANDOM_ACCESS : FILE_ATTRIBUTE_NORMAL),
+                            NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    ec = internal::winCode(GetLastError());
+    return res;
+  }
+
+  LARGE_INTEGER size;
+  bool sized = GetFileType(file) == FILE_TYPE_DISK && GetFileSizeEx(file, &size);
+  if (sized && size.QuadPart >= JSCPP_FS_MAP_THRESHOLD) {
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping != NULL) {
+      void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      CloseHandle(mapping);
+      if (view != NULL) {
+        CloseHandle(file);
+        res.data_ = (uint8_t*)view;
+        res.size_ = (size_t)size.QuadPart;
+        res.mapped_ = true;
+        return res;
+      }
+    }
+  }
+
+  bool ok = readAll([file](uint8_t* buf, size_t n) -> long {
+    DWORD read = 0;
+    if (!ReadFile(file, buf, (DWORD)(n > 0x40000000 ? 0x40000000 : n), &read, NULL)) {
+      return GetLastError() == ERROR_BROKEN_PIPE ? 0 : -1;
+    }
+    return (long)read;
+  }, sized ? (size_t)size.QuadPart : 0, res.data_, res.size_);
+  DWORD err = GetLastError();
+  CloseHandle(file);
+  if (!ok) {
+    syscall = "read";
+    ec = internal::winCode(err);
+  }
+#else
+  int fd = ::open(path.str().c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1) {
+    ec = internal::errnoCode(errno);
+    return res;
+  }
+
+  struct stat info;
+  if (::fstat(fd, &info) != 0) {
+    ec = internal::errnoCode(errno);
+    ::close(fd);
+    return res;
+  }
+  syscall = "read";
+  if (S_ISDIR(info.st_mode)) {
+    ::close(fd);
+    ec = internal::errnoCode(EISDIR);
+    return res;
+  }
+
+  if (S_ISREG(info.st_mode) && info.st_size >= JSCPP_FS_MAP_THRESHOLD) {
+    void* addr = ::mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED) {
+      ::close(fd);
+      res.data_ = (uint8_t*)addr;
+      res.size_ = (size_t)info.st_size;
+      res.mapped_ = true;
+      if (advice != MA_NORMAL) res.advise(advice);
+      return res;
+    }
+  }
+
+  bool ok = readAll([fd](uint8_t* buf, size_t n) -> long {
+    ssize_t r;
+    do {
+      r = ::read(fd, buf, n);
+    } while (r == -1 && errno == EINTR);
+    return (long)r;
+  }, S_ISREG(info.st_mode) ? (size_t)info.st_size : 0, res.data_, res.size_);
+  int err = errno;
+  ::close(fd);
+  if (!ok) {
+    ec = internal::errnoCode(err);
+  }
+#endif
+  return res;
+}
+
+MappedBuffer MappedBuffer::create(const String& p, std::error_code& ec, MapAdvice advice) {
+  const char* syscall;
+  return load(p, advice, ec, syscall);
+}
+
+MappedBuffer MappedBuffer::create(const String& p, MapAdvice advice) {
+  std::error_code ec;
+  const char* syscall;
+  MappedBuffer res = load(p, advice, ec, syscall);
+  if (ec) internal::throwFsError(ec, syscall, p);
+  return res;
+}
+
+MappedBuffer mapFile(const String& p, MapAdvice advice) {
+  return MappedBuffer::create(p, advice);
+}
+
+MappedBuffer mapFile(const String& p, std::error_code& ec, MapAdvice advice) {
+  return MappedBuffer::create(p, ec, advice);
+}
+
+}
+}
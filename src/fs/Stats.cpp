@@ -3,98 +3,72 @@
 #define WIN32_LEAN_AND_MEAN
 #endif
 #include <Windows.h>
+#else
+#include <fcntl.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <sys/sysmacros.h>
+#endif
 #endif
 
 #include "jscpp/fs.hpp"
 #include "jscpp/path.hpp"
-#include "../internal/throw.hpp"
+#include "../internal/fserror.hpp"
+#include "../internal/pool.hpp"
+#include "../internal/uring.hpp"
 #include <cerrno>
 #include <cstring>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <new>
+#include <string>
+
+#if defined(__linux__) && defined(STATX_BASIC_STATS) && defined(__NR_statx)
+#define JSCPP_FS_HAVE_STATX 1
+#else
+#define JSCPP_FS_HAVE_STATX 0
+#endif
+
+// Paths one pool task stats in a row
+#define JSCPP_FS_STAT_CHUNK 64
+// io_uring queue depth statMany uses by default
+#define JSCPP_FS_STAT_QUEUE_DEPTH 256
 
 namespace js {
 namespace fs {
 
-int Stats::createNoThrow(Stats& r, const String& p, bool followLink) {
-  String path = path::normalize(p);
-#ifdef _WIN32
-  int code = 0;
-  struct _stat info;
+namespace {
 
-  if (followLink) { // stat
-    code = _wstat(path.data(), &info);
-    if (code != 0) {
-      return errno;
-    }
-    r._isLink = false;
-    r.dev = info.st_dev;
-    r.ino = info.st_ino;
-    r.mode = info.st_mode;
-    r.nlink = info.st_nlink;
-    r.gid = info.st_gid;
-    r.uid = info.st_uid;
-    r.rdev = info.st_rdev;
-    r.size = info.st_size;
-    r.atime = info.st_atime;
-    r.mtime = info.st_mtime;
-    r.ctime = info.st_ctime;
-    return 0;
-  }
+inline int64_t toNs(int64_t sec, long nsec) noexcept {
+  return sec * 1000000000 + nsec;
+}
 
-  DWORD attrs = GetFileAttributesW(path.data());
-  if (attrs == INVALID_FILE_ATTRIBUTES) {
-    return ENOENT;
-  }
-  bool isLink = ((attrs & FILE_ATTRIBUTE_REPARSE_POINT) == FILE_ATTRIBUTE_REPARSE_POINT);
-  if (isLink) {
-    r._isLink = true;
-    r.dev = 0;
-    r.ino = 0;
-    r.mode = 0;
-    r.nlink = 0;
-    r.gid = 0;
-    r.uid = 0;
-    r.rdev = 0;
-    r.size = 0;
-    r.atime = 0;
-    r.mtime = 0;
-    r.ctime = 0;
-  } else {
-    code = _wstat(path.data(), &info);
-    if (code != 0) {
-      return errno;
-    }
-    r._isLink = false;
-    r.dev = info.st_dev;
-    r.ino = info.st_ino;
-    r.mode = info.st_mode;
-    r.nlink = info.st_nlink;
-    r.gid = info.st_gid;
-    r.uid = info.st_uid;
-    r.rdev = info.st_rdev;
-    r.size = info.st_size;
-    r.atime = info.st_atime;
-    r.mtime = info.st_mtime;
-    r.ctime = info.st_ctime;
-  }
-  return 0;
+#ifdef _WIN32
+void fromStat(Stats& r, const struct _stat64& info) noexcept {
+  r.mask = SF_BASIC & ~SF_BLOCKS;
+  r.dev = info.st_dev;
+  r.ino = info.st_ino;
+  r.mode = info.st_mode;
+  r.nlink = info.st_nlink;
+  r.gid = info.st_gid;
+  r.uid = info.st_uid;
+  r.rdev = info.st_rdev;
+  r.size = info.st_size;
+  r.atime = (time_t)info.st_atime;
+  r.mtime = (time_t)info.st_mtime;
+  r.ctime = (time_t)info.st_ctime;
+  r.atimeNs = toNs(info.st_atime, 0);
+  r.mtimeNs = toNs(info.st_mtime, 0);
+  r.ctimeNs = toNs(info.st_ctime, 0);
+  // st_ctime is the creation time on Windows
+  r.birthtime = r.ctime;
+  r.birthtimeNs = r.ctimeNs;
+  r.mask |= SF_BIRTHTIME;
+}
 #else
-  int code = 0;
-  struct stat info;
-  std::string pathstr = path.str();
-  if (followLink) {
-    code = ::stat(pathstr.c_str(), &info);
-    if (code != 0) {
-      return errno;
-    }
-  } else {
-    code = ::lstat(pathstr.c_str(), &info);
-    if (code != 0) {
-      return errno;
-    }
-  }
-
-  // r.path_ = path;
-  r._isLink = S_ISLNK(info.st_mode);
+void fromStat(Stats& r, const struct stat& info) noexcept {
+  r.mask = SF_BASIC;
   r.dev = info.st_dev;
   r.ino = info.st_ino;
   r.mode = info.st_mode;
@@ -103,22 +77,233 @@ int Stats::createNoThrow(Stats& r, const String& p, bool followLink) {
   r.uid = info.st_uid;
   r.rdev = info.st_rdev;
   r.size = info.st_size;
+  r.blksize = info.st_blksize;
+  r.blocks = info.st_blocks;
   r.atime = info.st_atime;
   r.mtime = info.st_mtime;
   r.ctime = info.st_ctime;
+#ifdef __APPLE__
+  r.atimeNs = toNs(info.st_atimespec.tv_sec, info.st_atimespec.tv_nsec);
+  r.mtimeNs = toNs(info.st_mtimespec.tv_sec, info.st_mtimespec.tv_nsec);
+  r.ctimeNs = toNs(info.st_ctimespec.tv_sec, info.st_ctimespec.tv_nsec);
+  r.birthtime = info.st_birthtimespec.tv_sec;
+  r.birthtimeNs = toNs(info.st_birthtimespec.tv_sec, info.st_birthtimespec.tv_nsec);
+  r.mask |= SF_BIRTHTIME;
+#else
+  r.atimeNs = toNs(info.st_atim.tv_sec, info.st_atim.tv_nsec);
+  r.mtimeNs = toNs(info.st_mtim.tv_sec, info.st_mtim.tv_nsec);
+  r.ctimeNs = toNs(info.st_ctim.tv_sec, info.st_ctim.tv_nsec);
+#endif
+}
+#endif
+
+#if JSCPP_FS_HAVE_STATX
+// Set once the kernel turns out to predate statx
+std::atomic<bool> statxMissing(false);
+
+void fromStatx(Stats& r, const struct statx& stx) noexcept {
+  r.mask = stx.stx_mask & SF_ALL;
+  r.dev = makedev(stx.stx_dev_major, stx.stx_dev_minor);
+  r.ino = stx.stx_ino;
+  r.mode = stx.stx_mode;
+  r.nlink = stx.stx_nlink;
+  r.gid = stx.stx_gid;
+  r.uid = stx.stx_uid;
+  r.rdev = makedev(stx.stx_rdev_major, stx.stx_rdev_minor);
+  r.size = (int64_t)stx.stx_size;
+  r.blksize = stx.stx_blksize;
+  r.blocks = (int64_t)stx.stx_blocks;
+  r.atime = (time_t)stx.stx_atime.tv_sec;
+  r.mtime = (time_t)stx.stx_mtime.tv_sec;
+  r.ctime = (time_t)stx.stx_ctime.tv_sec;
+  r.atimeNs = toNs(stx.stx_atime.tv_sec, stx.stx_atime.tv_nsec);
+  r.mtimeNs = toNs(stx.stx_mtime.tv_sec, stx.stx_mtime.tv_nsec);
+  r.ctimeNs = toNs(stx.stx_ctime.tv_sec, stx.stx_ctime.tv_nsec);
+  if (r.mask & SF_BIRTHTIME) {
+    r.birthtime = (time_t)stx.stx_btime.tv_sec;
+    r.birthtimeNs = toNs(stx.stx_btime.tv_sec, stx.stx_btime.tv_nsec);
+  }
+}
+#endif
+
+#ifndef _WIN32
+// statx() where the kernel has it, fstatat() otherwise. Returns 0 or errno.
+int statWithFlags(int dirfd, const char* name, int flags, unsigned int fields, Stats& r) noexcept {
+#if JSCPP_FS_HAVE_STATX
+  if (!statxMissing.load(std::memory_order_relaxed)) {
+    struct statx stx;
+    if (::syscall(__NR_statx, dirfd, name, flags, (fields | SF_TYPE) & SF_ALL, &stx) == 0) {
+      fromStatx(r, stx);
+      return 0;
+    }
+    if (errno != ENOSYS) {
+      return errno;
+    }
+    statxMissing.store(true, std::memory_order_relaxed);
+  }
+#else
+  (void)fields;
+#endif
+  struct stat info;
+  if (::fstatat(dirfd, name, &info, flags) != 0) {
+    return errno;
+  }
+  fromStat(r, info);
+  return 0;
+}
+#endif
+
+#if JSCPP_FS_HAVE_STATX && JSCPP_HAVE_IO_URING
+// Returns false, having done nothing, when no ring can be set up or it
+// takes no entries. Once some are in flight a failing submit ends up in res
+// for every path not done yet.
+bool statManyUring(const std::vector<String>& paths, const StatManyOptions& options,
+                   std::vector<std::pair<int, Stats>>& res) {
+  std::unique_ptr<internal::Uring> ring;
+  try {
+    ring.reset(new internal::Uring(options.concurrency == 0 ? JSCPP_FS_STAT_QUEUE_DEPTH : options.concurrency));
+  } catch (const std::exception&) {
+    return false;
+  }
+
+  // Every ring slot owns a name and a statx buffer until its completion
+  unsigned depth = ring->entries();
+  std::vector<std::string> names(depth);
+  std::vector<struct statx> buffers(depth);
+  std::vector<size_t> owners(depth);
+  std::vector<unsigned> freeSlots;
+  for (unsigned i = depth; i > 0; i--) freeSlots.push_back(i - 1);
+
+  int flags = options.followLink ? 0 : AT_SYMLINK_NOFOLLOW;
+  unsigned fields = (options.fields | SF_TYPE) & SF_ALL;
+  size_t next = 0;
+  size_t inFlight = 0;
+  size_t completed = 0;
+  int failed = 0;
+  while ((failed == 0 && next < paths.size()) || inFlight > 0) {
+    while (failed == 0 && next < paths.size() && !freeSlots.empty()) {
+      struct io_uring_sqe* sqe = ring->sqe();
+      if (sqe == NULL) break;
+      unsigned slot = freeSlots.back();
+      freeSlots.pop_back();
+      names[slot] = path::normalize(paths[next]).str();
+      owners[slot] = next++;
+      inFlight++;
+      sqe->opcode = IORING_OP_STATX;
+      sqe->fd = AT_FDCWD;
+      sqe->addr = (uintptr_t)names[slot].c_str();
+      sqe->len = fields;
+      sqe->off = (uintptr_t)&buffers[slot];
+      sqe->statx_flags = flags;
+      sqe->user_data = slot;
+    }
+
+    int err = failed == 0 ? ring->submit(1) : 0;
+    if (err != 0 && err != EAGAIN && err != EBUSY) {
+      // The kernel still writes into names and buffers for whatever it took,
+      // so those are waited for and only the rest is given up on
+      failed = err;
+      ring->discard([&](const struct io_uring_sqe& sqe) {
+        unsigned slot = (unsigned)sqe.user_data;
+        res[owners[slot]].first = failed;
+        freeSlots.push_back(slot);
+        inFlight--;
+      });
+      if (completed == 0 && inFlight == 0) return false;
+    }
+    // A failed wait is retried, nothing may go while statx calls are pending
+    if (failed != 0 && inFlight > 0) ring->wait(1);
+    ring->reap([&](const struct io_uring_cqe& cqe) {
+      unsigned slot = (unsigned)cqe.user_data;
+      std::pair<int, Stats>& out = res[owners[slot]];
+      if (cqe.res < 0) {
+        out.first = -cqe.res;
+      } else {
+        fromStatx(out.second, buffers[slot]);
+      }
+      freeSlots.push_back(slot);
+      inFlight--;
+      completed++;
+    });
+  }
+  for (; next < paths.size(); next++) res[next].first = failed;
+  return true;
+}
+#endif
+
+}
+
+Stats::Stats() noexcept:
+  _isLink(false), mask(0), dev(0), ino(0), mode(0), nlink(0), gid(0), uid(0), rdev(0), size(0),
+  blksize(0), blocks(0), atime(0), mtime(0), ctime(0), birthtime(0),
+  atimeNs(0), mtimeNs(0), ctimeNs(0), birthtimeNs(0) {}
+
+int Stats::createNoThrow(Stats& r, const String& p, bool followLink, unsigned int fields) {
+  String path = path::normalize(p);
+#ifdef _WIN32
+  (void)fields;
+  struct _stat64 info;
+  r = Stats();
+
+  if (!followLink) {
+    DWORD attrs = GetFileAttributesW(path.data());
+    if (attrs == INVALID_FILE_ATTRIBUTES) {
+      return ENOENT;
+    }
+    if ((attrs & FILE_ATTRIBUTE_REPARSE_POINT) == FILE_ATTRIBUTE_REPARSE_POINT) {
+      r._isLink = true;
+      r.mask = SF_TYPE;
+      return 0;
+    }
+  }
+
+  if (_wstat64(path.data(), &info) != 0) {
+    return errno;
+  }
+  fromStat(r, info);
   return 0;
+#else
+  return statAt(AT_FDCWD, path.str().c_str(), followLink, fields, r);
 #endif
 }
 
-Stats Stats::create(const String& p, bool followLink) {
+#ifndef _WIN32
+int Stats::statAt(int dirfd, const char* name, bool followLink, unsigned int fields, Stats& r) noexcept {
+  r = Stats();
+  int err = statWithFlags(dirfd, name, followLink ? 0 : AT_SYMLINK_NOFOLLOW, fields, r);
+  r._isLink = err == 0 && S_ISLNK(r.mode);
+  return err;
+}
+#endif
+
+int Stats::statFd(int fd, unsigned int fields, Stats& r) noexcept {
+  r = Stats();
+#ifdef _WIN32
+  (void)fields;
+  struct _stat64 info;
+  if (_fstat64(fd, &info) != 0) {
+    return errno;
+  }
+  fromStat(r, info);
+  return 0;
+#elif defined(AT_EMPTY_PATH)
+  return statWithFlags(fd, "", AT_EMPTY_PATH, fields, r);
+#else
+  (void)fields;
+  struct stat info;
+  if (::fstat(fd, &info) != 0) {
+    return errno;
+  }
+  fromStat(r, info);
+  return 0;
+#endif
+}
+
+Stats Stats::create(const String& p, bool followLink, unsigned int fields) {
   Stats out;
-  int r = createNoThrow(out, p, followLink);
+  int r = createNoThrow(out, p, followLink, fields);
   if (r != 0) {
-    if (followLink) {
-      internal::throwError(String(strerror(r)) + L", stat" + L" \"" + p + L"\"");
-    } else {
-      internal::throwError(String(strerror(r)) + L", lstat" + L" \"" + p + L"\"");
-    }
+    internal::throwFsError(internal::errnoCode(r), followLink ? "stat" : "lstat", p);
   }
   return out;
 }
@@ -175,8 +360,53 @@ bool Stats::isSocket() const noexcept {
 #endif
 }
 
-Stats stat(const String& path) { return Stats::create(path, true); }
-Stats lstat(const String& path) { return Stats::create(path, false); }
+Stats stat(const String& path, unsigned int fields) { return Stats::create(path, true, fields); }
+Stats lstat(const String& path, unsigned int fields) { return Stats::create(path, false, fields); }
+
+Stats stat(const String& path, std::error_code& ec, unsigned int fields) {
+  Stats out;
+  int r = Stats::createNoThrow(out, path, true, fields);
+  ec = r != 0 ? internal::errnoCode(r) : std::error_code();
+  return out;
+}
+
+Stats lstat(const String& path, std::error_code& ec, unsigned int fields) {
+  Stats out;
+  int r = Stats::createNoThrow(out, path, false, fields);
+  ec = r != 0 ? internal::errnoCode(r) : std::error_code();
+  return out;
+}
+std::vector<std::pair<int, Stats>> statMany(const std::vector<String>& paths, const StatManyOptions& options) {
+  std::vector<std::pair<int, Stats>> res(paths.size(), std::make_pair(0, Stats()));
+#if JSCPP_FS_HAVE_STATX && JSCPP_HAVE_IO_URING
+  if (options.ioUring && paths.size() > 1 && internal::Uring::supports(IORING_OP_STATX) &&
+      statManyUring(paths, options, res)) {
+    for (size_t i = 0; i < res.size(); i++) {
+      res[i].second._isLink = S_ISLNK(res[i].second.mode);
+    }
+    return res;
+  }
+#endif
+
+  size_t chunks = (paths.size() + JSCPP_FS_STAT_CHUNK - 1) / JSCPP_FS_STAT_CHUNK;
+  unsigned threads = internal::WorkStealingPool::threadsFor(options.concurrency);
+  if (chunks <= threads) threads = chunks == 0 ? 0 : (unsigned)(chunks - 1);
+  internal::WorkStealingPool pool(threads);
+  for (size_t begin = 0; begin < paths.size(); begin += JSCPP_FS_STAT_CHUNK) {
+    pool.submit([&paths, &options, &res, begin]() {
+      size_t end = begin + JSCPP_FS_STAT_CHUNK < paths.size() ? begin + JSCPP_FS_STAT_CHUNK : paths.size();
+      for (size_t i = begin; i < end; i++) {
+        try {
+          res[i].first = Stats::createNoThrow(res[i].second, paths[i], options.followLink, options.fields);
+        } catch (const std::bad_alloc&) {
+          res[i].first = ENOMEM;
+        }
+      }
+    });
+  }
+  pool.wait();
+  return res;
+}
 
 }
 }
@@ -0,0 +1,304 @@
+#include "jscpp/fs.hpp"
+#include "jscpp/Error.hpp"
+#include "../internal/fserror.hpp"
+#include "../internal/pool.hpp"
+#include <cerrno>
+#include <cstdlib>
+#include <new>
+#include <system_error>
+
+// Largest pool JSCPP_THREADPOOL_SIZE may ask for, as in libuv
+#define JSCPP_FS_THREADPOOL_MAX 1024
+
+namespace js {
+namespace fs {
+
+namespace {
+
+std::mutex poolMutex;
+std::atomic<internal::WorkQueue*> sharedPool(nullptr);
+ThreadPoolOptions poolOptions;
+
+unsigned threadsFromEnvironment() {
+  const char* value = std::getenv("JSCPP_THREADPOOL_SIZE");
+  if (value != nullptr && *value != '\0') {
+    char* end;
+    unsigned long threads = std::strtoul(value, &end, 10);
+    if (*end == '\0' && threads > 0) {
+      return threads < JSCPP_FS_THREADPOOL_MAX ? (unsigned)threads : JSCPP_FS_THREADPOOL_MAX;
+    }
+  }
+  return JSCPP_FS_THREADPOOL_SIZE;
+}
+
+// Started on first use and never torn down: pending callbacks may still
+// run while static objects are destroyed at exit, so the threads are left
+// to end with the process
+internal::WorkQueue& pool() {
+  internal::WorkQueue* res = sharedPool.load(std::memory_order_acquire);
+  if (res != nullptr) return *res;
+  std::lock_guard<std::mutex> lock(poolMutex);
+  res = sharedPool.load(std::memory_order_relaxed);
+  if (res == nullptr) {
+    unsigned threads = poolOptions.threads != 0 ? poolOptions.threads : threadsFromEnvironment();
+    if (threads > JSCPP_FS_THREADPOOL_MAX) threads = JSCPP_FS_THREADPOOL_MAX;
+    res = new internal::WorkQueue(threads, poolOptions.maxQueued);
+    sharedPool.store(res, std::memory_order_release);
+  }
+  return *res;
+}
+
+std::exception_ptr cancelled(const char* syscall, const String& p) {
+#if JSCPP_USE_ERROR
+  return std::make_exception_ptr(SystemError(internal::errnoCode(ECANCELED), syscall, p));
+#else
+  (void)p;
+  return std::make_exception_ptr(std::system_error(internal::errnoCode(ECANCELED), syscall));
+#endif
+}
+
+template <typename T, typename Op>
+void settle(std::promise<T>& promise, const Op& op) {
+  promise.set_value(op());
+}
+
+template <typename Op>
+void settle(std::promise<void>& promise, const Op& op) {
+  op();
+  promise.set_value();
+}
+
+// Runs the throwing form of a call; syscall and p only describe a cancellation
+template <typename T, typename Op>
+std::future<T> toFuture(const char* syscall, const String& p, const CancelToken& token, Op op) {
+  std::shared_ptr<std::promise<T>> promise = std::make_shared<std::promise<T>>();
+  std::future<T> res = promise->get_future();
+  queueWork([promise, op, syscall, p](const std::error_code& ec) {
+    if (ec) {
+      promise->set_exception(cancelled(syscall, p));
+      return;
+    }
+    try {
+      settle(*promise, op);
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+  }, token);
+  return res;
+}
+
+// Runs fn, turning what it throws into ec: the code of a system error,
+// ENOMEM for bad_alloc and ECANCELED for anything else, such as a
+// CopyOptions::filter that gave up
+template <typename Fn>
+void attempt(std::error_code& ec, const Fn& fn) {
+  try {
+    fn();
+#if JSCPP_USE_ERROR
+  } catch (const SystemError& e) {
+    ec = e.errorCode();
+#endif
+  } catch (const std::system_error& e) {
+    ec = e.code();
+  } catch (const std::bad_alloc&) {
+    ec = internal::errnoCode(ENOMEM);
+  } catch (...) {
+    ec = internal::errnoCode(ECANCELED);
+  }
+}
+
+// Runs the std::error_code form of a call
+template <typename T, typename Op>
+void toCallback(const Callback<T>& callback, const CancelToken& token, Op op) {
+  queueWork([callback, op](const std::error_code& cancelled) {
+    std::error_code ec = cancelled;
+    T res = T();
+    if (!ec) attempt(ec, [&]() { res = op(ec); });
+    if (ec) res = T();
+    callback(ec, std::move(res));
+  }, token);
+}
+
+template <typename Op>
+void toCallback(const DoneCallback& callback, const CancelToken& token, Op op) {
+  queueWork([callback, op](const std::error_code& cancelled) {
+    std::error_code ec = cancelled;
+    if (!ec) attempt(ec, [&]() { op(ec); });
+    callback(ec);
+  }, token);
+}
+
+}
+
+bool configureThreadPool(const ThreadPoolOptions& options) {
+  std::lock_guard<std::mutex> lock(poolMutex);
+  if (sharedPool.load(std::memory_order_relaxed) != nullptr) return false;
+  poolOptions = options;
+  return true;
+}
+
+unsigned threadPoolSize() {
+  return pool().size();
+}
+
+CancelToken::CancelToken(): cancelled_(std::make_shared<std::atomic<bool>>(false)) {}
+
+void CancelToken::cancel() noexcept {
+  cancelled_->store(true);
+}
+
+bool CancelToken::cancelled() const noexcept {
+  return cancelled_->load();
+}
+
+void queueWork(const DoneCallback& work, const CancelToken& token) {
+  pool().submit([work, token]() {
+    // Nothing is left to report an exception to, and letting it out of a
+    // pool thread would end the process
+    try {
+      work(token.cancelled() ? internal::errnoCode(ECANCELED) : std::error_code());
+    } catch (...) {}
+  });
+}
+
+std::future<std::vector<uint8_t>> readFileAsync(const String& p, const CancelToken& token) {
+  return toFuture<std::vector<uint8_t>>("open", p, token, [p]() { return fs::readFile(p); });
+}
+
+std::future<String> readFileAsStringAsync(const String& p, const CancelToken& token) {
+  return toFuture<String>("open", p, token, [p]() { return fs::readFileAsString(p); });
+}
+
+std::future<void> writeFileAsync(const String& p, const std::vector<uint8_t>& buf, const WriteFileOptions& options,
+                                 const CancelToken& token) {
+  return toFuture<void>("open", p, token, [p, buf, options]() { fs::writeFile(p, buf, options); });
+}
+
+std::future<void> writeFileAsync(const String& p, const String& str, const WriteFileOptions& options,
+                                 const CancelToken& token) {
+  return toFuture<void>("open", p, token, [p, str, options]() { fs::writeFile(p, str, options); });
+}
+
+std::future<void> appendFileAsync(const String& p, const std::vector<uint8_t>& buf, const CancelToken& token) {
+  return toFuture<void>("open", p, token, [p, buf]() { fs::appendFile(p, buf); });
+}
+
+std::future<void> appendFileAsync(const String& p, const String& str, const CancelToken& token) {
+  return toFuture<void>("open", p, token, [p, str]() { fs::appendFile(p, str); });
+}
+
+std::future<Stats> statAsync(const String& p, unsigned int fields, const CancelToken& token) {
+  return toFuture<Stats>("stat", p, token, [p, fields]() { return fs::stat(p, fields); });
+}
+
+std::future<Stats> lstatAsync(const String& p, unsigned int fields, const CancelToken& token) {
+  return toFuture<Stats>("lstat", p, token, [p, fields]() { return fs::lstat(p, fields); });
+}
+
+std::future<bool> existsAsync(const String& p, const CancelToken& token) {
+  return toFuture<bool>("access", p, token, [p]() { return fs::exists(p); });
+}
+
+std::future<std::vector<String>> readdirAsync(const String& p, const CancelToken& token) {
+  return toFuture<std::vector<String>>("scandir", p, token, [p]() { return fs::readdir(p); });
+}
+
+std::future<void> mkdirsAsync(const String& p, int mode, const CancelToken& token) {
+  return toFuture<void>("mkdir", p, token, [p, mode]() { fs::mkdirs(p, mode); });
+}
+
+std::future<void> unlinkAsync(const String& p, const CancelToken& token) {
+  return toFuture<void>("unlink", p, token, [p]() { fs::unlink(p); });
+}
+
+std::future<void> renameAsync(const String& s, const String& d, const CancelToken& token) {
+  return toFuture<void>("rename", s, token, [s, d]() { fs::rename(s, d); });
+}
+
+std::future<void> copyAsync(const String& s, const String& d, const CopyOptions& options, const CancelToken& token) {
+  return toFuture<void>("copy", s, token, [s, d, options]() { fs::copy(s, d, options); });
+}
+
+std::future<void> moveAsync(const String& s, const String& d, const MoveOptions& options, const CancelToken& token) {
+  return toFuture<void>("rename", s, token, [s, d, options]() { fs::move(s, d, options); });
+}
+
+std::future<void> removeAsync(const String& p, const RemoveOptions& options, const CancelToken& token) {
+  return toFuture<void>("rm", p, token, [p, options]() { fs::remove(p, options); });
+}
+
+void readFileAsync(const String& p, const Callback<std::vector<uint8_t>>& callback, const CancelToken& token) {
+  toCallback(callback, token, [p](std::error_code& ec) { return fs::readFile(p, ec); });
+}
+
+void readFileAsStringAsync(const String& p, const Callback<String>& callback, const CancelToken& token) {
+  toCallback(callback, token, [p](std::error_code& ec) { return fs::readFileAsString(p, ec); });
+}
+
+void writeFileAsync(const String& p, const std::vector<uint8_t>& buf, const DoneCallback& callback,
+                    const WriteFileOptions& options, const CancelToken& token) {
+  toCallback(callback, token, [p, buf, options](std::error_code& ec) { fs::writeFile(p, buf, options, ec); });
+}
+
+void writeFileAsync(const String& p, const String& str, const DoneCallback& callback,
+                    const WriteFileOptions& options, const CancelToken& token) {
+  toCallback(callback, token, [p, str, options](std::error_code& ec) { fs::writeFile(p, str, options, ec); });
+}
+
+void appendFileAsync(const String& p, const std::vector<uint8_t>& buf, const DoneCallback& callback,
+                     const CancelToken& token) {
+  toCallback(callback, token, [p, buf](std::error_code& ec) { fs::appendFile(p, buf, ec); });
+}
+
+void appendFileAsync(const String& p, const String& str, const DoneCallback& callback, const CancelToken& token) {
+  toCallback(callback, token, [p, str](std::error_code& ec) { fs::appendFile(p, str, ec); });
+}
+
+void statAsync(const String& p, const Callback<Stats>& callback, unsigned int fields, const CancelToken& token) {
+  toCallback(callback, token, [p, fields](std::error_code& ec) { return fs::stat(p, ec, fields); });
+}
+
+void lstatAsync(const String& p, const Callback<Stats>& callback, unsigned int fields, const CancelToken& token) {
+  toCallback(callback, token, [p, fields](std::error_code& ec) { return fs::lstat(p, ec, fields); });
+}
+
+void existsAsync(const String& p, const Callback<bool>& callback, const CancelToken& token) {
+  toCallback(callback, token, [p](std::error_code& ec) {
+    ec.clear();
+    return fs::exists(p);
+  });
+}
+
+void readdirAsync(const String& p, const Callback<std::vector<String>>& callback, const CancelToken& token) {
+  toCallback(callback, token, [p](std::error_code& ec) { return fs::readdir(p, ec); });
+}
+
+void mkdirsAsync(const String& p, const DoneCallback& callback, int mode, const CancelToken& token) {
+  toCallback(callback, token, [p, mode](std::error_code& ec) { fs::mkdirs(p, ec, mode); });
+}
+
+void unlinkAsync(const String& p, const DoneCallback& callback, const CancelToken& token) {
+  toCallback(callback, token, [p](std::error_code& ec) { fs::unlink(p, ec); });
+}
+
+void renameAsync(const String& s, const String& d, const DoneCallback& callback, const CancelToken& token) {
+  toCallback(callback, token, [s, d](std::error_code& ec) { fs::rename(s, d, ec); });
+}
+
+void copyAsync(const String& s, const String& d, const DoneCallback& callback, const CopyOptions& options,
+               const CancelToken& token) {
+  toCallback(callback, token, [s, d, options](std::error_code& ec) { fs::copy(s, d, options, ec); });
+}
+
+void moveAsync(const String& s, const String& d, const DoneCallback& callback, const MoveOptions& options,
+               const CancelToken& token) {
+  toCallback(callback, token, [s, d, options](std::error_code& ec) { fs::move(s, d, options, ec); });
+}
+
+void removeAsync(const String& p, const DoneCallback& callback, const RemoveOptions& options,
+                 const CancelToken& token) {
+  toCallback(callback, token, [p, options](std::error_code& ec) { fs::remove(p, options, ec); });
+}
+
+}
+}
@@ -0,0 +1,532 @@
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "jscpp/fs.hpp"
+#include "jscpp/path.hpp"
+#include "../internal/fserror.hpp"
+#include "../internal/pool.hpp"
+#include "../internal/uring.hpp"
+#include <cerrno>
+#include <deque>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <string>
+
+#if JSCPP_HAVE_IO_URING && defined(STATX_BASIC_STATS)
+#define JSCPP_FS_BULK_URING 1
+#else
+#define JSCPP_FS_BULK_URING 0
+#endif
+
+// Files one pool task handles in a row
+#define JSCPP_FS_BULK_CHUNK 16
+// Files readMany and writeMany keep in flight on io_uring by default
+#define JSCPP_FS_BULK_DEPTH 128
+// First read for files whose size is not known up front, such as procfs
+#define JSCPP_FS_BULK_READ_CHUNK 64 * 1024
+
+namespace js {
+namespace fs {
+
+namespace {
+
+int toErrno(const std::error_code& ec) noexcept {
+  return ec ? ec.default_error_condition().value() : 0;
+}
+
+int readOne(const String& p, std::vector<uint8_t>& out) {
+  std::error_code ec;
+  out = fs::readFile(p, ec);
+  return toErrno(ec);
+}
+
+int writeOne(const String& p, const ByteView& content, const WriteManyOptions& options) {
+  std::error_code ec;
+  FileHandle file = FileHandle::open(p, ec, OF_WRITE | OF_CREATE | OF_TRUNCATE, options.mode);
+  if (!ec) file.write(content.data(), content.size(), ec);
+  if (!ec && options.fsync) file.datasync(ec);
+  if (!ec) file.close(ec);
+  return toErrno(ec);
+}
+
+// Runs fn(i) for every index on a pool, JSCPP_FS_BULK_CHUNK at a time
+template <typename Fn>
+void forEachOnPool(size_t count, unsigned concurrency, const Fn& fn) {
+  size_t chunks = (count + JSCPP_FS_BULK_CHUNK - 1) / JSCPP_FS_BULK_CHUNK;
+  unsigned threads = internal::WorkStealingPool::threadsFor(concurrency);
+  if (chunks <= threads) threads = chunks == 0 ? 0 : (unsigned)(chunks - 1);
+  internal::WorkStealingPool pool(threads);
+  for (size_t begin = 0; begin < count; begin += JSCPP_FS_BULK_CHUNK) {
+    pool.submit([count, &fn, begin]() {
+      size_t end = begin + JSCPP_FS_BULK_CHUNK < count ? begin + JSCPP_FS_BULK_CHUNK : count;
+      for (size_t i = begin; i < end; i++) fn(i);
+    });
+  }
+  pool.wait();
+}
+
+#if JSCPP_FS_BULK_URING
+
+enum BulkOp {
+  BO_OPEN,
+  BO_STATX,
+  BO_TRANSFER,
+  BO_FSYNC,
+  BO_CLOSE
+};
+
+/**
+ * Moves files through their open, transfer and close steps on one ring,
+ * a window of them at a time. Every step of every file in the window goes
+ * out with the same io_uring_enter, so each round trip to the kernel
+ * advances up to the whole window.
+ *
+ * The engine fills in the submission entries and handles the completions:
+ * start(pipeline, slot, index), fill(sqe, slot, op) and
+ * complete(pipeline, slot, op, res). Every step it starts goes through
+ * queue(), and a file is done once the engine calls finish().
+ *
+ * Should submitting fail for good, nothing new goes out and the steps in
+ * flight are waited for, since they point into the engine's slots and
+ * buffers. Then abandon(pipeline, slot, err) has to close and finish each
+ * file left over, and fail(index, err) records the files never started.
+ */
+class Pipeline {
+public:
+  Pipeline(internal::Uring& ring, unsigned slots): ring_(ring), slots_(slots), active_(0) {
+    for (unsigned i = slots; i > 0; i--) free_.push_back(i - 1);
+  }
+
+  void queue(unsigned slot, BulkOp op) {
+    queued_.push_back(std::make_pair(slot, op));
+  }
+
+  void finish(unsigned slot) {
+    free_.push_back(slot);
+    active_--;
+  }
+
+  // Returns false, having done nothing, when the ring takes no entries at
+  // all, so the caller can go on without it
+  template <typename Engine>
+  bool run(size_t count, Engine& engine) {
+    size_t next = 0;
+    size_t inFlight = 0;
+    size_t completed = 0;
+    int failed = 0;
+    while ((failed == 0 && (next < count || active_ > 0)) || inFlight > 0) {
+      while (failed == 0 && next < count && !free_.empty()) {
+        unsigned slot = free_.back();
+        free_.pop_back();
+        active_++;
+        engine.start(*this, slot, next++);
+      }
+      // What does not fit goes out once the kernel has taken some entries
+      while (failed == 0 && !queued_.empty()) {
+        struct io_uring_sqe* sqe = ring_.sqe();
+        if (sqe == NULL) break;
+        engine.fill(sqe, queued_.front().first, queued_.front().second);
+        sqe->user_data = (uint64_t)queued_.front().first * 8 + queued_.front().second;
+        queued_.pop_front();
+        inFlight++;
+      }
+
+      int err = failed == 0 ? ring_.submit(1) : 0;
+      if (err != 0 && err != EAGAIN && err != EBUSY) {
+        failed = err;
+        ring_.discard([&](const struct io_uring_sqe&) { inFlight--; });
+        if (completed == 0 && inFlight == 0) return false;
+      }
+      // A failed wait is retried, nothing may go while steps are pending
+      if (failed != 0 && inFlight > 0) ring_.wait(1);
+      ring_.reap([&](const struct io_uring_cqe& cqe) {
+        inFlight--;
+        completed++;
+        engine.complete(*this, (unsigned)(cqe.user_data / 8), (BulkOp)(cqe.user_data % 8), cqe.res);
+      });
+    }
+
+    if (failed != 0) {
+      queued_.clear();
+      std::vector<bool> idle(slots_, false);
+      for (unsigned slot : free_) idle[slot] = true;
+      for (unsigned slot = 0; slot < slots_; slot++) {
+        if (!idle[slot]) engine.abandon(*this, slot, failed);
+      }
+      for (; next < count; next++) engine.fail(next, failed);
+    }
+    return true;
+  }
+
+private:
+  internal::Uring& ring_;
+  unsigned slots_;
+  std::vector<unsigned> free_;
+  std::deque<std::pair<unsigned, BulkOp>> queued_;
+  size_t active_;
+};
+
+// Opens and stats each file at once, then reads it straight into its result
+class ReadEngine {
+public:
+  ReadEngine(const std::vector<String>& paths, std::vector<std::pair<int, std::vector<uint8_t>>>& res,
+             unsigned slots):
+    paths_(paths), res_(res), slots_(slots) {}
+
+  void start(Pipeline& pipeline, unsigned s, size_t index) {
+    Slot& slot = slots_[s];
+    slot.index = index;
+    slot.name = path::normalize(paths_[index]).str();
+    slot.fd = -1;
+    slot.err = 0;
+    slot.sized = false;
+    slot.done = 0;
+    slot.waiting = 2;
+    pipeline.queue(s, BO_OPEN);
+    pipeline.queue(s, BO_STATX);
+  }
+
+  void fill(struct io_uring_sqe* sqe, unsigned s, BulkOp op) {
+    Slot& slot = slots_[s];
+    std::vector<uint8_t>& buf = res_[slot.index].second;
+    switch (op) {
+      case BO_OPEN:
+        sqe->opcode = IORING_OP_OPENAT;
+        sqe->fd = AT_FDCWD;
+        sqe->addr = (uintptr_t)slot.name.c_str();
+        sqe->open_flags = O_RDONLY | O_CLOEXEC;
+        break;
+      case BO_STATX:
+        sqe->opcode = IORING_OP_STATX;
+        sqe->fd = AT_FDCWD;
+        sqe->addr = (uintptr_t)slot.name.c_str();
+        sqe->len = STATX_TYPE | STATX_SIZE;
+        sqe->off = (uintptr_t)&slot.stx;
+        break;
+      case BO_TRANSFER:
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = slot.fd;
+        sqe->addr = (uintptr_t)(buf.data() + slot.done);
+        sqe->len = (unsigned)(buf.size() - slot.done < 0x40000000 ? buf.size() - slot.done : 0x40000000);
+        sqe->off = slot.done;
+        break;
+      default:
+        sqe->opcode = IORING_OP_CLOSE;
+        sqe->fd = slot.fd;
+        break;
+    }
+  }
+
+  void complete(Pipeline& pipeline, unsigned s, BulkOp op, int res) {
+    Slot& slot = slots_[s];
+    switch (op) {
+      case BO_OPEN:
+        if (res < 0) slot.err = -res;
+        else slot.fd = res;
+        if (--slot.waiting == 0) opened(pipeline, s);
+        break;
+      case BO_STATX:
+        // Without a size the file is read in growing chunks
+        slot.sized = res == 0;
+        if (--slot.waiting == 0) opened(pipeline, s);
+        break;
+      case BO_TRANSFER:
+        if (res == -EAGAIN || res == -EINTR) {
+          pipeline.queue(s, BO_TRANSFER);
+        } else if (res < 0) {
+          slot.err = -res;
+          pipeline.queue(s, BO_CLOSE);
+        } else {
+          read(pipeline, s, (size_t)res);
+        }
+        break;
+      default:
+        done(pipeline, s);
+        break;
+    }
+  }
+
+  void abandon(Pipeline& pipeline, unsigned s, int err) {
+    Slot& slot = slots_[s];
+    if (slot.err == 0) slot.err = err;
+    if (slot.fd >= 0) ::close(slot.fd);
+    done(pipeline, s);
+  }
+
+  void fail(size_t index, int err) {
+    res_[index].first = err;
+  }
+
+private:
+  struct Slot {
+    size_t index;
+    std::string name;
+    int fd;
+    int err;
+    bool sized;
+    struct statx stx;
+    size_t done;
+    unsigned waiting;
+  };
+
+  void opened(Pipeline& pipeline, unsigned s) {
+    Slot& slot = slots_[s];
+    if (slot.fd < 0) {
+      done(pipeline, s);
+      return;
+    }
+    if (slot.sized && S_ISDIR(slot.stx.stx_mode)) {
+      slot.err = EISDIR;
+      pipeline.queue(s, BO_CLOSE);
+      return;
+    }
+    // One byte more than the size, so a short read tells the end apart
+    // from a file that grew
+    size_t size = slot.sized && slot.stx.stx_size > 0 ? (size_t)slot.stx.stx_size + 1 : JSCPP_FS_BULK_READ_CHUNK;
+    try {
+      res_[slot.index].second.resize(size);
+    } catch (const std::bad_alloc&) {
+      slot.err = ENOMEM;
+      pipeline.queue(s, BO_CLOSE);
+      return;
+    }
+    pipeline.queue(s, BO_TRANSFER);
+  }
+
+  void read(Pipeline& pipeline, unsigned s, size_t n) {
+    Slot& slot = slots_[s];
+    std::vector<uint8_t>& buf = res_[slot.index].second;
+    slot.done += n;
+    bool atEnd = n == 0 || (slot.sized && slot.stx.stx_size > 0 && slot.done > 0 &&
+                            slot.done >= slot.stx.stx_size && slot.done < buf.size());
+    if (atEnd) {
+      pipeline.queue(s, BO_CLOSE);
+      return;
+    }
+    if (slot.done == buf.size()) {
+      try {
+        buf.resize(buf.size() * 2);
+      } catch (const std::bad_alloc&) {
+        slot.err = ENOMEM;
+        pipeline.queue(s, BO_CLOSE);
+        return;
+      }
+    }
+    pipeline.queue(s, BO_TRANSFER);
+  }
+
+  void done(Pipeline& pipeline, unsigned s) {
+    Slot& slot = slots_[s];
+    std::pair<int, std::vector<uint8_t>>& out = res_[slot.index];
+    out.first = slot.err;
+    if (slot.err != 0) {
+      std::vector<uint8_t>().swap(out.second);
+    } else {
+      out.second.resize(slot.done);
+    }
+    pipeline.finish(s);
+  }
+
+  const std::vector<String>& paths_;
+  std::vector<std::pair<int, std::vector<uint8_t>>>& res_;
+  std::vector<Slot> slots_;
+};
+
+// Opens each file, writes it straight from the caller's buffer, then
+// optionally flushes and closes it
+class WriteEngine {
+public:
+  WriteEngine(const std::vector<std::pair<String, ByteView>>& files, const WriteManyOptions& options,
+              std::vector<int>& res, unsigned slots):
+    files_(files), options_(options), res_(res), slots_(slots) {}
+
+  void start(Pipeline& pipeline, unsigned s, size_t index) {
+    Slot& slot = slots_[s];
+    slot.index = index;
+    slot.name = path::normalize(files_[index].first).str();
+    slot.fd = -1;
+    slot.err = 0;
+    slot.done = 0;
+    pipeline.queue(s, BO_OPEN);
+  }
+
+  void fill(struct io_uring_sqe* sqe, unsigned s, BulkOp op) {
+    Slot& slot = slots_[s];
+    const ByteView& content = files_[slot.index].second;
+    switch (op) {
+      case BO_OPEN:
+        sqe->opcode = IORING_OP_OPENAT;
+        sqe->fd = AT_FDCWD;
+        sqe->addr = (uintptr_t)slot.name.c_str();
+        sqe->open_flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+        sqe->len = (unsigned)options_.mode;
+        break;
+      case BO_TRANSFER:
+        sqe->opcode = IORING_OP_WRITE;
+        sqe->fd = slot.fd;
+        sqe->addr = (uintptr_t)(content.data() + slot.done);
+        sqe->len = (unsigned)(content.size() - slot.done < 0x40000000 ? content.size() - slot.done : 0x40000000);
+        sqe->off = slot.done;
+        break;
+      case BO_FSYNC:
+        sqe->opcode = IORING_OP_FSYNC;
+        sqe->fd = slot.fd;
+        sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+        break;
+      default:
+        sqe->opcode = IORING_OP_CLOSE;
+        sqe->fd = slot.fd;
+        break;
+    }
+  }
+
+  void complete(Pipeline& pipeline, unsigned s, BulkOp op, int res) {
+    Slot& slot = slots_[s];
+    size_t size = files_[slot.index].second.size();
+    if (op == BO_CLOSE) {
+      if (res < 0 && slot.err == 0) slot.err = -res;
+      res_[slot.index] = slot.err;
+      pipeline.finish(s);
+      return;
+    }
+    if (res == -EAGAIN || res == -EINTR) {
+      pipeline.queue(s, op);
+      return;
+    }
+    if (res < 0) {
+      slot.err = -res;
+      if (op == BO_OPEN) {
+        res_[slot.index] = slot.err;
+        pipeline.finish(s);
+      } else {
+        pipeline.queue(s, BO_CLOSE);
+      }
+      return;
+    }
+
+    if (op == BO_OPEN) {
+      slot.fd = res;
+    } else if (op == BO_TRANSFER) {
+      if (res == 0) {
+        slot.err = EIO;
+        pipeline.queue(s, BO_CLOSE);
+        return;
+      }
+      slot.done += (size_t)res;
+    }
+    if (op != BO_FSYNC && slot.done < size) {
+      pipeline.queue(s, BO_TRANSFER);
+    } else if (op != BO_FSYNC && options_.fsync) {
+      pipeline.queue(s, BO_FSYNC);
+    } else {
+      pipeline.queue(s, BO_CLOSE);
+    }
+  }
+
+  void abandon(Pipeline& pipeline, unsigned s, int err) {
+    Slot& slot = slots_[s];
+    if (slot.err == 0) slot.err = err;
+    if (slot.fd >= 0) ::close(slot.fd);
+    res_[slot.index] = slot.err;
+    pipeline.finish(s);
+  }
+
+  void fail(size_t index, int err) {
+    res_[index] = err;
+  }
+
+private:
+  struct Slot {
+    size_t index;
+    std::string name;
+    int fd;
+    int err;
+    size_t done;
+  };
+
+  const std::vector<std::pair<String, ByteView>>& files_;
+  const WriteManyOptions& options_;
+  std::vector<int>& res_;
+  std::vector<Slot> slots_;
+};
+
+// Returns NULL, having done nothing, when no ring can be set up
+std::unique_ptr<internal::Uring> bulkRing(unsigned concurrency, unsigned& slots) {
+  slots = concurrency == 0 ? JSCPP_FS_BULK_DEPTH : concurrency;
+  std::unique_ptr<internal::Uring> ring;
+  try {
+    // A file has at most two steps in flight
+    ring.reset(new internal::Uring(slots * 2));
+  } catch (const std::exception&) {
+    return ring;
+  }
+  if (ring->entries() < slots * 2) slots = ring->entries() / 2;
+  return ring;
+}
+
+bool supportsAll(std::initializer_list<unsigned char> ops) noexcept {
+  for (unsigned char op : ops) {
+    if (!internal::Uring::supports(op)) return false;
+  }
+  return true;
+}
+
+#endif
+
+}
+
+std::vector<std::pair<int, std::vector<uint8_t>>> readMany(const std::vector<String>& paths,
+                                                           const ReadManyOptions& options) {
+  std::vector<std::pair<int, std::vector<uint8_t>>> res(paths.size());
+#if JSCPP_FS_BULK_URING
+  if (options.ioUring && paths.size() > 1 &&
+      supportsAll({IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ, IORING_OP_CLOSE})) {
+    unsigned slots;
+    std::unique_ptr<internal::Uring> ring = bulkRing(options.concurrency, slots);
+    if (ring) {
+      ReadEngine engine(paths, res, slots);
+      if (Pipeline(*ring, slots).run(paths.size(), engine)) return res;
+    }
+  }
+#endif
+
+  forEachOnPool(paths.size(), options.concurrency, [&paths, &res](size_t i) {
+    try {
+      res[i].first = readOne(paths[i], res[i].second);
+    } catch (const std::bad_alloc&) {
+      res[i].first = ENOMEM;
+    }
+  });
+  return res;
+}
+
+std::vector<int> writeMany(const std::vector<std::pair<String, ByteView>>& files, const WriteManyOptions& options) {
+  std::vector<int> res(files.size(), 0);
+#if JSCPP_FS_BULK_URING
+  if (options.ioUring && files.size() > 1 &&
+      supportsAll({IORING_OP_OPENAT, IORING_OP_WRITE, IORING_OP_FSYNC, IORING_OP_CLOSE})) {
+    unsigned slots;
+    std::unique_ptr<internal::Uring> ring = bulkRing(options.concurrency, slots);
+    if (ring) {
+      WriteEngine engine(files, options, res, slots);
+      if (Pipeline(*ring, slots).run(files.size(), engine)) return res;
+    }
+  }
+#endif
+
+  forEachOnPool(files.size(), options.concurrency, [&files, &options, &res](size_t i) {
+    try {
+      res[i] = writeOne(files[i].first, files[i].second, options);
+    } catch (const std::bad_alloc&) {
+      res[i] = ENOMEM;
+    }
+  });
+  return res;
+}
+
+}
+}
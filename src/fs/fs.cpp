@@ -7,18 +7,35 @@
 // #include <io.h>
 #include <winioctl.h>
 #include <bcrypt.h>
+#else
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
+#endif
 #endif
 
 #include "jscpp/fs.hpp"
 #include "jscpp/path.hpp"
 #include "../internal/winerr.hpp"
-#include "../internal/throw.hpp"
+#include "../internal/fserror.hpp"
+#include "../internal/pool.hpp"
 #include "jscpp/Error.hpp"
 #include <cerrno>
 #include <cstring>
 #include <cstdlib>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+
+#define JSCPP_FS_BUFFER_SIZE 1024 * 1024
+// First read for files whose size is not known up front
+#define JSCPP_FS_READ_CHUNK 64 * 1024
 
-#define JSCPP_FS_BUFFER_SIZE 128 * 1024
 
 #ifndef _WIN32
 #define JSCPP__PATH_MAX 8192
@@ -321,7 +338,8 @@ static int fs_readlink_handle(HANDLE handle, char** target_ptr,
   return fs_wide_to_utf8(w_target, w_target_len, target_ptr, target_len_ptr);
 }
 
-static void fs_create_junction(const WCHAR* path, const WCHAR* new_path) {
+// Returns 0 or the GetLastError() value
+static DWORD fs_create_junction(const WCHAR* path, const WCHAR* new_path) {
   HANDLE handle = INVALID_HANDLE_VALUE;
   REPARSE_DATA_BUFFER *buffer = NULL;
   int created = 0;
@@ -345,7 +363,7 @@ static void fs_create_junction(const WCHAR* path, const WCHAR* new_path) {
 
   if (!is_absolute) {
     /* Not supporting relative paths */
-    internal::throwError(L"Not supporting relative paths.");
+    return ERROR_NOT_SUPPORTED;
   }
 
   /* Do a pessimistic calculation of the required buffer size */
@@ -357,7 +375,7 @@ static void fs_create_junction(const WCHAR* path, const WCHAR* new_path) {
   /* Allocate the buffer */
   buffer = (REPARSE_DATA_BUFFER*)malloc(needed_buf_size);
   if (!buffer) {
-    internal::throwError(L"Out of memory.");
+    return ERROR_OUTOFMEMORY;
   }
 
   /* Grab a pointer to the part of the buffer where filenames go */
@@ -470,9 +488,10 @@ static void fs_create_junction(const WCHAR* path, const WCHAR* new_path) {
   CloseHandle(handle);
   free(buffer);
 
-  return;
+  return 0;
 
 error:
+  DWORD err = GetLastError();
   free(buffer);
 
   if (handle != INVALID_HANDLE_VALUE) {
@@ -483,21 +502,21 @@ error:
     RemoveDirectoryW(new_path);
   }
 
-  internal::throwError(internal::getWinErrorMessage(GetLastError()));
+  return err;
 }
 #endif
 
 }
 
 namespace {
-  int internalAccess(const String& p, int mode) {
+  std::error_code internalAccess(const String& p, int mode) {
     String path = path::normalize(p);
 #ifdef _WIN32
 
     DWORD attr = GetFileAttributesW(path.data());
 
     if (attr == INVALID_FILE_ATTRIBUTES) {
-      return GetLastError();
+      return internal::winCode(GetLastError());
     }
 
     /*
@@ -510,43 +529,42 @@ namespace {
     if (!(mode & fs::AccessType::AT_WOK) ||
         !(attr & FILE_ATTRIBUTE_READONLY) ||
         (attr & FILE_ATTRIBUTE_DIRECTORY)) {
-      return 0;
+      return std::error_code();
     } else {
-      return EPERM;
+      return internal::errnoCode(EPERM);
     }
 #else
     if (::access(path.str().c_str(), mode) != 0) {
-      return errno;
+      return internal::errnoCode(errno);
     }
 #endif
-    return 0;
+    return std::error_code();
   }
 }
 
+void access(const String& p, std::error_code& ec, int mode) {
+  ec = internalAccess(p, mode);
+}
+
 void access(const String& p, int mode) {
-  int r = internalAccess(p, mode);
-#ifdef _WIN32
-  if (r != 0) {
-    internal::throwError(internal::getWinErrorMessage(r) + L", access \"" + p + L"\"");
-  }
-#else
-  if (r != 0) {
-    internal::throwError(String(strerror(r)) + L", access \"" + p + L"\"");
-  }
-#endif
+  std::error_code ec = internalAccess(p, mode);
+  if (ec) internal::throwFsError(ec, "access", p);
 }
 
-void chmod(const String& p, int mode) {
+void chmod(const String& p, int mode, std::error_code& ec) {
   String path = path::normalize(p);
 #ifdef _WIN32
-  if (::_wchmod(path.data(), mode) != 0) {
-    internal::throwError(String(strerror(errno)) + L", chmod \"" + p + L"\"");
-  }
+  int code = ::_wchmod(path.data(), mode);
 #else
-  if (::chmod(path.str().c_str(), mode) != 0) {
-    internal::throwError(String(strerror(errno)) + L", chmod \"" + p + L"\"");
-  }
+  int code = ::chmod(path.str().c_str(), mode);
 #endif
+  ec = code != 0 ? internal::errnoCode(errno) : std::error_code();
+}
+
+void chmod(const String& p, int mode) {
+  std::error_code ec;
+  fs::chmod(p, mode, ec);
+  if (ec) internal::throwFsError(ec, "chmod", p);
 }
 
 bool exists(const String& p) {
@@ -563,7 +581,7 @@ bool exists(const String& p) {
 //     }
 //   }
 // #else
-  if (internalAccess(p, fs::AccessType::AT_FOK) == 0) {
+  if (!internalAccess(p, fs::AccessType::AT_FOK)) {
     return true;
   }
   fs::Stats stats;
@@ -574,7 +592,7 @@ bool exists(const String& p) {
 // #endif
 }
 
-void mkdir(const String& p, int mode) {
+void mkdir(const String& p, std::error_code& ec, int mode) {
   int code = 0;
   String path = path::normalize(p);
 #ifdef _WIN32
@@ -582,34 +600,92 @@ void mkdir(const String& p, int mode) {
 #else
   code = ::mkdir(path.str().c_str(), mode);
 #endif
-  if (code != 0) {
-    internal::throwError(String(strerror(errno)) + L", mkdir \"" + p + L"\"");
-  }
+  ec = code != 0 ? internal::errnoCode(errno) : std::error_code();
+}
+
+void mkdir(const String& p, int mode) {
+  std::error_code ec;
+  fs::mkdir(p, ec, mode);
+  if (ec) internal::throwFsError(ec, "mkdir", p);
 }
 
 void mkdirs(const String& p, int mode) {
-  if (fs::exists(p)) {
-    if (fs::lstat(p).isDirectory()) {
-      return;
-    } else {
-      internal::throwError(String(strerror(EEXIST)) + L", mkdir \"" + p + L"\"");
+  std::error_code ec;
+  fs::mkdirs(p, ec, mode);
+  if (ec) internal::throwFsError(ec, "mkdir", p);
+}
+
+void mkdirs(const String& p, std::error_code& ec, int mode) {
+  ec.clear();
+#ifdef _WIN32
+  Stats stat;
+  if (Stats::createNoThrow(stat, p, false, SF_TYPE) == 0) {
+    if (!stat.isDirectory()) {
+      ec = internal::errnoCode(EEXIST);
     }
+    return;
   }
 
   String dir = path::dirname(p);
 
   if (!fs::exists(dir)) {
-    fs::mkdirs(dir);
+    fs::mkdirs(dir, ec);
+    if (ec) return;
   }
 
-  if (fs::lstat(dir).isDirectory()) {
-    fs::mkdir(p, mode);
+  if (Stats::createNoThrow(stat, dir, false, SF_TYPE) == 0 && stat.isDirectory()) {
+    fs::mkdir(p, ec, mode);
   } else {
-    internal::throwError(String(strerror(ENOENT)) + L", mkdir \"" + p + L"\"");
+    ec = internal::errnoCode(ENOENT);
+  }
+#else
+  // Try the leaf first. Only when its parent is missing walk up to the
+  // deepest existing ancestor, then come back down one component at a time.
+  std::vector<String> missing;
+  String dir = path::resolve(p);
+  for (;;) {
+    if (::mkdir(dir.str().c_str(), missing.empty() ? mode : 0777) == 0) {
+      break;
+    }
+    int err = errno;
+    if (err == EEXIST) {
+      if (missing.empty()) {
+        fs::Stats stat;
+        if (fs::Stats::createNoThrow(stat, dir, false, SF_TYPE) != 0 || !stat.isDirectory()) {
+          ec = internal::errnoCode(EEXIST);
+        }
+        return;
+      }
+      break;
+    }
+    String parent = path::dirname(dir);
+    if (err != ENOENT || parent == dir) {
+      // A file in the way reports ENOENT, as on Windows
+      ec = internal::errnoCode(err == ENOTDIR ? ENOENT : err);
+      return;
+    }
+    missing.push_back(path::basename(dir));
+    dir = parent;
   }
+  if (missing.empty()) {
+    return;
+  }
+
+  DirHandle handle = DirHandle::open(dir, ec);
+  for (size_t i = missing.size(); !ec && i-- > 0;) {
+    // Someone else creating the same directory meanwhile is fine
+    if (::mkdirat(handle.fd(), missing[i].str().c_str(), i == 0 ? mode : 0777) != 0 && errno != EEXIST) {
+      ec = internal::errnoCode(errno);
+      return;
+    }
+    if (i > 0) {
+      handle = handle.openAt(missing[i], ec, true);
+    }
+  }
+#endif
 }
 
-void unlink(const String& p) {
+void unlink(const String& p, std::error_code& ec) {
   int code = 0;
   String path = path::normalize(p);
 #ifdef _WIN32
@@ -631,12 +707,14 @@ void unlink(const String& p) {
                        NULL);
 
   if (handle == INVALID_HANDLE_VALUE) {
-    internal::throwError(internal::getWinErrorMessage(GetLastError()) + L", unlink \"" + p + L"\"" );
+    ec = internal::winCode(GetLastError());
+    return;
   }
 
   if (!GetFileInformationByHandle(handle, &info)) {
+    ec = internal::winCode(GetLastError());
     CloseHandle(handle);
-    internal::throwError(internal::getWinErrorMessage(GetLastError()) + L", unlink \"" + p + L"\"" );
+    return;
   }
 
   if (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
@@ -646,9 +724,9 @@ void unlink(const String& p) {
 
     /* Check if it is a reparse point. If it's not, it's a normal directory. */
     if (!(info.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)) {
-      SetLastError(ERROR_ACCESS_DENIED);
       CloseHandle(handle);
-      internal::throwError(internal::getWinErrorMessage(GetLastError()) + L", unlink \"" + p + L"\"" );
+      ec = internal::winCode(ERROR_ACCESS_DENIED);
+      return;
     }
 
     /* Read the reparse point and check if it is a valid symlink. If not, don't
@@ -657,9 +735,9 @@ void unlink(const String& p) {
       DWORD error = GetLastError();
       if (error == ERROR_SYMLINK_NOT_SUPPORTED)
         error = ERROR_ACCESS_DENIED;
-      SetLastError(error);
       CloseHandle(handle);
-      internal::throwError(internal::getWinErrorMessage(GetLastError()) + L", unlink \"" + p + L"\"" );
+      ec = internal::winCode(error);
+      return;
     }
   }
 
@@ -676,9 +754,9 @@ void unlink(const String& p) {
                                    sizeof basic,
                                    FileBasicInformation);
     if (!NT_SUCCESS(status)) {
-      SetLastError(RtlNtStatusToDosError(status));
       CloseHandle(handle);
-      internal::throwError(internal::getWinErrorMessage(GetLastError()) + L", unlink \"" + p + L"\"" );
+      ec = internal::winCode(RtlNtStatusToDosError(status));
+      return;
     }
   }
 
@@ -689,23 +767,22 @@ void unlink(const String& p) {
                                  &disposition,
                                  sizeof disposition,
                                  FileDispositionInformation);
-  if (NT_SUCCESS(status)) {
-    CloseHandle(handle);
-    return;
-  } else {
-    CloseHandle(handle);
-    SetLastError(RtlNtStatusToDosError(status));
-    internal::throwError(internal::getWinErrorMessage(GetLastError()) + L", unlink \"" + p + L"\"" );
-  }
+  CloseHandle(handle);
+  ec = NT_SUCCESS(status) ? std::error_code() : internal::winCode(RtlNtStatusToDosError(status));
+  return;
 #else
   code = ::unlink(path.str().c_str());
 #endif
-  if (code != 0) {
-    internal::throwError(String(strerror(errno)) + L", unlink \"" + p + L"\"");
-  }
+  ec = code != 0 ? internal::errnoCode(errno) : std::error_code();
 }
 
-void rmdir(const String& p) {
+void unlink(const String& p) {
+  std::error_code ec;
+  fs::unlink(p, ec);
+  if (ec) internal::throwFsError(ec, "unlink", p);
+}
+
+void rmdir(const String& p, std::error_code& ec) {
   int code = 0;
   String path = path::normalize(p);
 #ifdef _WIN32
@@ -713,12 +790,16 @@ void rmdir(const String& p) {
 #else
   code = ::rmdir(path.str().c_str());
 #endif
-  if (code != 0) {
-    internal::throwError(String(strerror(errno)) + L", rmdir \"" + p + L"\"");
-  }
+  ec = code != 0 ? internal::errnoCode(errno) : std::error_code();
 }
 
-void rename(const String& s, const String& d) {
+void rmdir(const String& p) {
+  std::error_code ec;
+  fs::rmdir(p, ec);
+  if (ec) internal::throwFsError(ec, "rmdir", p);
+}
+
+void rename(const String& s, const String& d, std::error_code& ec) {
   int code = 0;
   String source = path::normalize(s);
   String dest = path::normalize(d);
@@ -727,94 +808,218 @@ void rename(const String& s, const String& d) {
 #else
   code = ::rename(source.str().c_str(), dest.str().c_str());
 #endif
-  if (code != 0) {
-    internal::throwError(String(strerror(errno)) + L", rename \"" + s + L"\" -> \"" + d + L"\"");
-  }
+  ec = code != 0 ? internal::errnoCode(errno) : std::error_code();
 }
 
-void remove(const String& p) {
-  if (!fs::exists(p)) {
-    return;
+void rename(const String& s, const String& d) {
+  std::error_code ec;
+  fs::rename(s, d, ec);
+  if (ec) internal::throwFsError(ec, "rename", s, d);
+}
+
+namespace {
+
+// A directory being removed. It is rmdir'ed through its parent's handle by
+// whichever task finishes its last child; pending starts one higher so
+// that children finishing early cannot remove it while it is still listed.
+struct RemoveNode {
+  DirHandle handle;
+  String name;
+  std::shared_ptr<RemoveNode> parent;
+  std::atomic<size_t> pending;
+  std::atomic<bool> failed;
+
+  RemoveNode(DirHandle&& handle, const String& name, const std::shared_ptr<RemoveNode>& parent):
+    handle(std::move(handle)), name(name), parent(parent), pending(1), failed(false) {}
+};
+
+struct RemoveContext {
+  internal::WorkStealingPool pool;
+  internal::ErrorList& errors;
+
+  RemoveContext(unsigned threads, internal::ErrorList& errors): pool(threads), errors(errors) {}
+};
+
+// A failed child keeps every ancestor, which can no longer be empty.
+void failRemove(std::shared_ptr<RemoveNode> node) {
+  for (; node; node = node->parent) {
+    if (node->failed.exchange(true)) break;
   }
+}
 
-  fs::Stats stat = fs::lstat(p);
-  if (stat.isDirectory()) {
-    std::vector<String> items = fs::readdir(p);
-    if (items.size() != 0) {
-      for (size_t i = 0; i < items.size(); i++) {
-        const String& item = items[i];
-        fs::remove(path::join(p, item));
+void finishRemove(RemoveContext& ctx, std::shared_ptr<RemoveNode> node) {
+  while (node && --node->pending == 0) {
+    node->handle.close();
+    if (!node->failed) {
+      std::error_code ec;
+      if (node->parent) {
+        node->parent->handle.rmdir(node->name, ec);
+      } else {
+        fs::rmdir(node->name, ec);
+      }
+      if (ec) {
+        ctx.errors.add(ec, "rmdir", node->parent ? path::join(node->parent->handle.path(), node->name) : node->name);
+        failRemove(node->parent);
       }
-      fs::rmdir(p);
-    } else {
-      fs::rmdir(p);
     }
+    node = node->parent;
+  }
+}
+
+void removeChildren(RemoveContext& ctx, const std::shared_ptr<RemoveNode>& node);
+
+void removeEntry(RemoveContext& ctx, const std::shared_ptr<RemoveNode>& parent, const String& name) {
+  fs::Stats stat;
+  std::error_code ec;
+  const char* syscall = "lstat";
+  int r = parent->handle.statNoThrow(stat, name, false, SF_TYPE);
+  if (r != 0) {
+    if (r != ENOENT) ec = internal::errnoCode(r);
+  } else if (stat.isDirectory()) {
+    DirHandle handle = parent->handle.openAt(name, ec);
+    if (!ec) {
+      // The parent hears from node once it is rmdir'ed
+      removeChildren(ctx, std::make_shared<RemoveNode>(std::move(handle), name, parent));
+      return;
+    }
+    syscall = "opendir";
   } else {
-    fs::unlink(p);
+    parent->handle.unlink(name, ec);
+    syscall = "unlink";
   }
+  if (ec) {
+    ctx.errors.add(ec, syscall, path::join(parent->handle.path(), name));
+    failRemove(parent);
+  }
+  finishRemove(ctx, parent);
 }
 
-void symlink(const String& o, const String& n) {
+void removeChildren(RemoveContext& ctx, const std::shared_ptr<RemoveNode>& node) {
+  std::error_code ec;
+  std::vector<String> items = node->handle.readdir(ec);
+  if (ec) {
+    ctx.errors.add(ec, "scandir", node->handle.path());
+    failRemove(node);
+  }
+  node->pending += items.size();
+  for (size_t i = 0; i < items.size(); i++) {
+    String name = items[i];
+    std::shared_ptr<RemoveNode> parent = node;
+    ctx.pool.submit([&ctx, parent, name]() {
+      removeEntry(ctx, parent, name);
+    });
+  }
+  finishRemove(ctx, node);
+}
+
+void removeTree(const String& p, const RemoveOptions& options, internal::ErrorList& errors) {
+  Stats stat;
+  int r = Stats::createNoThrow(stat, p, false, SF_TYPE);
+  if (r != 0) {
+    // Nothing to remove
+    if (r != ENOENT && r != ENOTDIR) errors.add(internal::errnoCode(r), "lstat", p);
+    return;
+  }
+
+  std::error_code ec;
+  if (!stat.isDirectory()) {
+    fs::unlink(p, ec);
+    if (ec) errors.add(ec, "unlink", p);
+    return;
+  }
+
+  DirHandle handle = DirHandle::open(p, ec);
+  if (ec) {
+    errors.add(ec, "opendir", p);
+    return;
+  }
+  RemoveContext ctx(internal::WorkStealingPool::threadsFor(options.concurrency), errors);
+  removeChildren(ctx, std::make_shared<RemoveNode>(std::move(handle), p, nullptr));
+  ctx.pool.wait();
+}
+
+}
+
+void remove(const String& p) {
+  fs::remove(p, RemoveOptions());
+}
+
+void remove(const String& p, const RemoveOptions& options) {
+  internal::ErrorList errors;
+  removeTree(p, options, errors);
+  errors.throwIfAny();
+}
+
+void remove(const String& p, std::error_code& ec) {
+  fs::remove(p, RemoveOptions(), ec);
+}
+
+void remove(const String& p, const RemoveOptions& options, std::error_code& ec) {
+  internal::ErrorList errors;
+  removeTree(p, options, errors);
+  errors.report(ec);
+}
+
+void symlink(const String& o, const String& n, std::error_code& ec) {
   String oldpath = path::normalize(o);
   String newpath = path::normalize(n);
 #ifdef _WIN32
-  if (!fs::exists(oldpath)) {
-    fs::symlink(o, n, ST_FILE);
-  } else if (fs::lstat(oldpath).isDirectory()) {
-    fs::symlink(o, n, ST_DIRECTORY);
+  Stats stat;
+  if (Stats::createNoThrow(stat, oldpath, false, SF_TYPE) == 0 && stat.isDirectory()) {
+    fs::symlink(o, n, ST_DIRECTORY, ec);
   } else {
-    fs::symlink(o, n, ST_FILE);
+    fs::symlink(o, n, ST_FILE, ec);
   }
 #else
   int code = ::symlink(oldpath.str().c_str(), newpath.str().c_str());
-  if (code != 0) {
-    internal::throwError(String(strerror(errno)) + L", symlink \"" + o + L"\" -> \"" + n + L"\"");
-  }
+  ec = code != 0 ? internal::errnoCode(errno) : std::error_code();
 #endif
 }
 
-void symlink(const String& o, const String& n, SymlinkType type) {
+void symlink(const String& o, const String& n) {
+  std::error_code ec;
+  fs::symlink(o, n, ec);
+  if (ec) internal::throwFsError(ec, "symlink", o, n);
+}
+
+void symlink(const String& o, const String& n, SymlinkType type, std::error_code& ec) {
   String oldpath = path::normalize(o);
   String newpath = path::normalize(n);
+  ec.clear();
 #ifdef _WIN32
   int flags = 0;
-  if (type == ST_DIRECTORY) {
-    flags = file_symlink_usermode_flag | SYMBOLIC_LINK_FLAG_DIRECTORY;
+  if (type == ST_DIRECTORY || type == ST_FILE) {
+    flags = file_symlink_usermode_flag | (type == ST_DIRECTORY ? SYMBOLIC_LINK_FLAG_DIRECTORY : 0);
     if (!CreateSymbolicLinkW(newpath.data(), oldpath.data(), flags)) {
-      int err = GetLastError();
+      DWORD err = GetLastError();
       if (err == ERROR_INVALID_PARAMETER && (flags & SYMBOLIC_LINK_FLAG_ALLOW_UNPRIVILEGED_CREATE))  {
         file_symlink_usermode_flag = 0;
-        fs::symlink(o, n, type);
+        fs::symlink(o, n, type, ec);
       } else {
-        internal::throwError(String(internal::getWinErrorMessage(GetLastError())) + L", symlink \"" + o + L"\" -> \"" + n + L"\"");
-      }
-    }
-  } else if (type == ST_FILE) {
-    flags = file_symlink_usermode_flag;
-    if (!CreateSymbolicLinkW(newpath.data(), oldpath.data(), flags)) {
-      int err = GetLastError();
-      if (err == ERROR_INVALID_PARAMETER && (flags & SYMBOLIC_LINK_FLAG_ALLOW_UNPRIVILEGED_CREATE))  {
-        file_symlink_usermode_flag = 0;
-        fs::symlink(o, n, type);
-      } else {
-        internal::throwError(String(internal::getWinErrorMessage(GetLastError())) + L", symlink \"" + o + L"\" -> \"" + n + L"\"");
+        ec = internal::winCode(err);
       }
     }
   } else if (type == ST_JUNCTION) {
     oldpath = path::resolve(oldpath);
-    fs_create_junction(oldpath.data(), newpath.data());
+    DWORD err = fs_create_junction(oldpath.data(), newpath.data());
+    if (err != 0) ec = internal::winCode(err);
   } else {
-    internal::throwError(String(L"Error symlink_type,") + L", symlink \"" + o + L"\" -> \"" + n + L"\"");
+    ec = std::make_error_code(std::errc::invalid_argument);
   }
 #else
+  (void)type;
   int code = ::symlink(oldpath.str().c_str(), newpath.str().c_str());
-  if (code != 0) {
-    internal::throwError(String(strerror(errno)) + L", symlink \"" + o + L"\" -> \"" + n + L"\"");
-  }
+  if (code != 0) ec = internal::errnoCode(errno);
 #endif
 }
 
-String realpath(const String& p) {
+void symlink(const String& o, const String& n, SymlinkType type) {
+  std::error_code ec;
+  fs::symlink(o, n, type, ec);
+  if (ec) internal::throwFsError(ec, "symlink", o, n);
+}
+
+String realpath(const String& p, std::error_code& ec) {
   String path = path::normalize(p);
 #ifdef _WIN32
   HANDLE handle;
@@ -827,7 +1032,8 @@ String realpath(const String& p) {
                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_BACKUP_SEMANTICS,
                        NULL);
   if (handle == INVALID_HANDLE_VALUE) {
-    internal::throwError(String(internal::getWinErrorMessage(GetLastError())) + L", realpath \"" + p + L"\"");
+    ec = internal::winCode(GetLastError());
+    return String();
   }
 
   DWORD w_realpath_len;
@@ -836,21 +1042,25 @@ String realpath(const String& p) {
 
   w_realpath_len = GetFinalPathNameByHandleW(handle, NULL, 0, VOLUME_NAME_DOS);
   if (w_realpath_len == 0) {
-    internal::throwError(String(internal::getWinErrorMessage(GetLastError())) + L", realpath \"" + p + L"\"");
+    ec = internal::winCode(GetLastError());
+    CloseHandle(handle);
+    return String();
   }
 
   w_realpath_buf = (WCHAR*)malloc((w_realpath_len + 1) * sizeof(WCHAR));
   if (w_realpath_buf == NULL) {
-    SetLastError(ERROR_OUTOFMEMORY);
-    internal::throwError(String(internal::getWinErrorMessage(GetLastError())) + L", realpath \"" + p + L"\"");
+    ec = internal::winCode(ERROR_OUTOFMEMORY);
+    CloseHandle(handle);
+    return String();
   }
   w_realpath_ptr = w_realpath_buf;
 
   if (GetFinalPathNameByHandleW(
           handle, w_realpath_ptr, w_realpath_len, VOLUME_NAME_DOS) == 0) {
     free(w_realpath_buf);
-    SetLastError(ERROR_INVALID_HANDLE);
-    internal::throwError(String(internal::getWinErrorMessage(GetLastError())) + L", realpath \"" + p + L"\"");
+    CloseHandle(handle);
+    ec = internal::winCode(ERROR_INVALID_HANDLE);
+    return String();
   }
 
   /* convert UNC path to long path */
@@ -867,22 +1077,29 @@ String realpath(const String& p) {
     w_realpath_len -= 4;
   } else {
     free(w_realpath_buf);
-    SetLastError(ERROR_INVALID_HANDLE);
-    internal::throwError(String(internal::getWinErrorMessage(GetLastError())) + L", realpath \"" + p + L"\"");
+    CloseHandle(handle);
+    ec = internal::winCode(ERROR_INVALID_HANDLE);
+    return String();
   }
 
   String res(w_realpath_ptr);
   free(w_realpath_buf);
   CloseHandle(handle);
+  ec.clear();
   return res;
 #else
   char* buf = nullptr;
 
 #if defined(_POSIX_VERSION) && _POSIX_VERSION >= 200809L
   buf = ::realpath(path.str().c_str(), nullptr);
-  if (buf == nullptr)
-    internal::throwError(String(strerror(errno)) + L", realpath \"" + p + L"\"");
-  return buf;
+  if (buf == nullptr) {
+    ec = internal::errnoCode(errno);
+    return String();
+  }
+  String res = buf;
+  free(buf);
+  ec.clear();
+  return res;
 #else
   ssize_t len;
 
@@ -898,96 +1115,399 @@ String realpath(const String& p) {
   buf = (char*)malloc(len + 1);
 
   if (buf == nullptr) {
-    errno = ENOMEM;
-    internal::throwError(String(strerror(errno)) + L", realpath \"" + p + L"\"");
+    ec = internal::errnoCode(ENOMEM);
+    return String();
   }
 
   if (::realpath(path.str().c_str(), buf) == NULL) {
+    ec = internal::errnoCode(errno);
     free(buf);
-    internal::throwError(String(strerror(errno)) + L", realpath \"" + p + L"\"");
+    return String();
   }
   String res = buf;
   free(buf);
+  ec.clear();
   return res;
 #endif
 #endif
 }
 
-void copyFile(const String& s, const String& d, bool failIfExists) {
-  String source = path::resolve(s);
-  String dest = path::resolve(d);
-  String errmessage = L"copy \"" + s + L"\" -> \"" + d + L"\"";
+String realpath(const String& p) {
+  std::error_code ec;
+  String res = fs::realpath(p, ec);
+  if (ec) internal::throwFsError(ec, "realpath", p);
+  return res;
+}
 
-  if (source == dest) {
-    return;
+#ifndef _WIN32
+namespace {
+
+bool retryWithFallback(int err) {
+  return err == ENOSYS || err == EXDEV || err == EINVAL || err == EOPNOTSUPP ||
+    err == ENOTSUP || err == EPERM || err == ETXTBSY || err == EBADF;
+}
+
+// Each tier returns 1 when it copied everything, 0 when it is unsupported
+// for this pair of files before touching the destination, -1 with errno
+// set on a real error.
+
+int cloneFile(int sfd, int dfd) {
+#if defined(__linux__) && defined(FICLONE)
+  if (::ioctl(dfd, FICLONE, sfd) == 0) return 1;
+  return retryWithFallback(errno) ? 0 : -1;
+#else
+  (void)sfd;
+  (void)dfd;
+  return 0;
+#endif
+}
+
+int copyFileRange(int sfd, int dfd) {
+#if defined(__linux__) && defined(__NR_copy_file_range)
+  bool copied = false;
+  for (;;) {
+    ssize_t n = ::syscall(__NR_copy_file_range, sfd, NULL, dfd, NULL, (size_t)0x40000000, 0U);
+    if (n > 0) {
+      copied = true;
+      continue;
+    }
+    if (n == 0) {
+      // Some pseudo filesystems report size 0 and yield nothing here,
+      // let a plain read find out whether the file is really empty.
+      return copied ? 1 : 0;
+    }
+    if (errno == EINTR) continue;
+    return !copied && retryWithFallback(errno) ? 0 : -1;
   }
+#else
+  (void)sfd;
+  (void)dfd;
+  return 0;
+#endif
+}
 
-#ifdef _WIN32
-  if (!CopyFileW(source.data(), dest.data(), failIfExists)) {
-    internal::throwError(String(internal::getWinErrorMessage(GetLastError())) + L", copy \"" + s + L"\" -> \"" + d + L"\"");
+int sendFile(int sfd, int dfd) {
+#ifdef __linux__
+  bool copied = false;
+  for (;;) {
+    ssize_t n = ::sendfile(dfd, sfd, NULL, (size_t)0x40000000);
+    if (n > 0) {
+      copied = true;
+      continue;
+    }
+    if (n == 0) return copied ? 1 : 0;
+    if (errno == EINTR) continue;
+    return !copied && retryWithFallback(errno) ? 0 : -1;
   }
 #else
+  (void)sfd;
+  (void)dfd;
+  return 0;
+#endif
+}
 
-  if (failIfExists && fs::exists(dest)) {
-    internal::throwError(String(strerror(EEXIST)) + L", " + errmessage);
+int readWrite(int sfd, int dfd) {
+  std::unique_ptr<uint8_t[]> buf(new (std::nothrow) uint8_t[JSCPP_FS_BUFFER_SIZE]);
+  if (!buf) {
+    errno = ENOMEM;
+    return -1;
+  }
+  for (;;) {
+    ssize_t n = ::read(sfd, buf.get(), JSCPP_FS_BUFFER_SIZE);
+    if (n == 0) return 1;
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return -1;
+    }
+    ssize_t written = 0;
+    while (written < n) {
+      ssize_t w = ::write(dfd, buf.get() + written, (size_t)(n - written));
+      if (w < 0) {
+        if (errno == EINTR) continue;
+        return -1;
+      }
+      written += w;
+    }
   }
+}
 
-  int mode;
-  fs::Stats stats;
-  int r = fs::Stats::createNoThrow(stats, source, true);
-  if (r != 0) {
-    internal::throwError(String(strerror(r)) + L", " + errmessage);
+// Copies sname relative to sdir onto dname relative to ddir, where either
+// directory may be AT_FDCWD. Returns the strategy used, or sets err.
+CopyFileStrategy copyFileAt(int sdir, const std::string& sname, int ddir, const std::string& dname,
+                            const CopyFileOptions& options, int& err) {
+  err = 0;
+  int sfd = ::openat(sdir, sname.c_str(), O_RDONLY | O_CLOEXEC);
+  if (sfd == -1) {
+    err = errno;
+    return CF_NONE;
+  }
+  struct stat sst;
+  if (::fstat(sfd, &sst) != 0) {
+    err = errno;
+    ::close(sfd);
+    return CF_NONE;
+  }
+  if (S_ISDIR(sst.st_mode)) {
+    err = EISDIR;
+    ::close(sfd);
+    return CF_NONE;
+  }
+
+  // Hard links or symlinks to the source would be truncated by the open below
+  struct stat dst;
+  if (::fstatat(ddir, dname.c_str(), &dst, 0) == 0) {
+    if (options.failIfExists) {
+      err = EEXIST;
+      ::close(sfd);
+      return CF_NONE;
+    }
+    if (dst.st_dev == sst.st_dev && dst.st_ino == sst.st_ino) {
+      ::close(sfd);
+      return CF_NONE;
+    }
   }
-  mode = stats.mode;
 
-  FILE* sf = ::fopen(source.str().c_str(), "rb+");
-  if (!sf) {
-    internal::throwError(String(strerror(errno)) + L", " + errmessage);
+  int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | (options.failIfExists ? O_EXCL : 0);
+  int dfd = ::openat(ddir, dname.c_str(), flags, sst.st_mode & 0777);
+  if (dfd == -1) {
+    err = errno;
+    ::close(sfd);
+    return CF_NONE;
   }
-  FILE* df = ::fopen(dest.str().c_str(), "wb+");
-  if (!df) {
-    ::fclose(sf);
-    internal::throwError(String(strerror(errno)) + L", " + errmessage);
+
+  CopyFileStrategy strategy = CF_CLONE;
+  int r = 0;
+  if (S_ISREG(sst.st_mode)) {
+    r = cloneFile(sfd, dfd);
+    if (r == 0) {
+      strategy = CF_COPY_FILE_RANGE;
+      r = copyFileRange(sfd, dfd);
+    }
+    if (r == 0) {
+      strategy = CF_SENDFILE;
+      r = sendFile(sfd, dfd);
+    }
   }
-  uint8_t buf[JSCPP_FS_BUFFER_SIZE];
-  size_t read;
-  while ((read = ::fread(buf, sizeof(uint8_t), JSCPP_FS_BUFFER_SIZE, sf)) > 0) {
-    ::fwrite(buf, sizeof(uint8_t), read, df);
-    ::fflush(df);
+  if (r == 0) {
+    strategy = CF_READ_WRITE;
+    r = readWrite(sfd, dfd);
   }
-  ::fclose(sf);
-  ::fclose(df);
 
-  fs::chmod(dest, mode);
+  if (r == 1 && ::fchmod(dfd, sst.st_mode & 07777) != 0) r = -1;
+  if (r == 1 && options.preserveTimestamps) {
+    struct timespec times[2];
+#ifdef __APPLE__
+    times[0] = sst.st_atimespec;
+    times[1] = sst.st_mtimespec;
+#else
+    times[0] = sst.st_atim;
+    times[1] = sst.st_mtim;
 #endif
+    if (::futimens(dfd, times) != 0) r = -1;
+  }
+  if (r != 1) err = errno;
+  ::close(sfd);
+  if (::close(dfd) != 0 && r == 1) {
+    err = errno;
+  }
+  return strategy;
+}
 
 }
+#endif
 
-void copy(const String& s, const String& d, bool failIfExists) {
+CopyFileStrategy copyFile(const String& s, const String& d, const CopyFileOptions& options, std::error_code& ec) {
   String source = path::resolve(s);
   String dest = path::resolve(d);
+  ec.clear();
 
   if (source == dest) {
+    return CF_NONE;
+  }
+
+#ifdef _WIN32
+  // CopyFileW always carries over attributes and the modification time
+  if (!CopyFileW(source.data(), dest.data(), options.failIfExists)) {
+    ec = internal::winCode(GetLastError());
+    return CF_NONE;
+  }
+  if (options.preserveTimestamps) {
+    HANDLE sh = CreateFileW(source.data(), FILE_READ_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, NULL);
+    HANDLE dh = CreateFileW(dest.data(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, NULL);
+    FILETIME atime, mtime;
+    bool ok = sh != INVALID_HANDLE_VALUE && dh != INVALID_HANDLE_VALUE &&
+      GetFileTime(sh, NULL, &atime, &mtime) && SetFileTime(dh, NULL, &atime, &mtime);
+    DWORD err = GetLastError();
+    if (sh != INVALID_HANDLE_VALUE) CloseHandle(sh);
+    if (dh != INVALID_HANDLE_VALUE) CloseHandle(dh);
+    if (!ok) {
+      ec = internal::winCode(err);
+    }
+  }
+  return CF_SYSTEM;
+#else
+  int err;
+  CopyFileStrategy strategy = copyFileAt(AT_FDCWD, source.str(), AT_FDCWD, dest.str(), options, err);
+  if (err != 0) {
+    ec = internal::errnoCode(err);
+  }
+  return strategy;
+#endif
+}
+
+CopyFileStrategy copyFile(const String& s, const String& d, const CopyFileOptions& options) {
+  std::error_code ec;
+  CopyFileStrategy strategy = fs::copyFile(s, d, options, ec);
+  if (ec) internal::throwFsError(ec, "copy", s, d);
+  return strategy;
+}
+
+void copyFile(const String& s, const String& d, bool failIfExists) {
+  CopyFileOptions options;
+  options.failIfExists = failIfExists;
+  fs::copyFile(s, d, options);
+}
+
+void copyFile(const String& s, const String& d, std::error_code& ec, bool failIfExists) {
+  CopyFileOptions options;
+  options.failIfExists = failIfExists;
+  fs::copyFile(s, d, options, ec);
+}
+
+namespace {
+
+// DirHandle counterpart of copyFile for the tree walkers
+CopyFileStrategy copyFileAt(const DirHandle& sdir, const String& sname, const DirHandle& ddir, const String& dname,
+                            const CopyFileOptions& options, std::error_code& ec) {
+#ifdef _WIN32
+  return fs::copyFile(path::join(sdir.path(), sname), path::join(ddir.path(), dname), options, ec);
+#else
+  int err;
+  CopyFileStrategy strategy = copyFileAt(sdir.fd(), sname.str(), ddir.fd(), dname.str(), options, err);
+  ec = err != 0 ? internal::errnoCode(err) : std::error_code();
+  return strategy;
+#endif
+}
+
+struct CopyContext {
+  internal::WorkStealingPool pool;
+  internal::ErrorList& errors;
+  const CopyOptions& options;
+  // Unlink each file once copied, for moves across devices
+  bool moving;
+
+  CopyContext(unsigned threads, const CopyOptions& options, internal::ErrorList& errors, bool moving):
+    pool(threads), errors(errors), options(options), moving(moving) {}
+};
+
+void copyChildren(CopyContext& ctx, const std::shared_ptr<DirHandle>& sdir, const std::shared_ptr<DirHandle>& ddir);
+
+// Frees the source's space right away, so a move across devices never
+// needs much more room than the largest files copied at once
+void finishMove(CopyContext& ctx, const DirHandle& sdir, const String& sname) {
+  std::error_code ec;
+  sdir.unlink(sname, ec);
+  if (ec) ctx.errors.add(ec, "unlink", path::join(sdir.path(), sname));
+}
+
+void copyEntry(CopyContext& ctx, const std::shared_ptr<DirHandle>& sdir, const String& sname,
+               const std::shared_ptr<DirHandle>& ddir, const String& dname) {
+  const CopyOptions& options = ctx.options;
+  try {
+    if (options.filter && !options.filter(path::join(sdir->path(), sname), path::join(ddir->path(), dname))) {
+      return;
+    }
+  } catch (...) {
+    ctx.errors.add(std::current_exception());
     return;
   }
 
-  Stats stat = fs::lstat(source);
+  std::error_code ec;
+  Stats stat = sdir->stat(sname, ec, options.dereference, SF_TYPE);
+  if (ec) {
+    ctx.errors.add(ec, options.dereference ? "stat" : "lstat", path::join(sdir->path(), sname));
+    return;
+  }
 
   if (stat.isDirectory()) {
-    if (path::relative(s, d).indexOf(L"..") != 0) {
-      internal::throwError(String(L"Cannot copy a directory into itself.") + L" copy \"" + s + L"\" -> \"" + d + L"\"");
+    Stats existing;
+    if (ddir->statNoThrow(existing, dname, true, SF_TYPE) != 0) {
+      ddir->mkdir(dname, ec);
+      if (ec) {
+        ctx.errors.add(ec, "mkdir", path::join(ddir->path(), dname));
+        return;
+      }
     }
-    fs::mkdirs(dest);
-    std::vector<String> items = fs::readdir(source);
-    for (size_t i = 0; i < items.size(); i++) {
-      fs::copy(path::join(source, items[i]), path::join(dest, items[i]), failIfExists);
+    DirHandle source = sdir->openAt(sname, ec, options.dereference);
+    if (ec) {
+      ctx.errors.add(ec, "opendir", path::join(sdir->path(), sname));
+      return;
+    }
+    DirHandle dest = ddir->openAt(dname, ec, true);
+    if (ec) {
+      ctx.errors.add(ec, "opendir", path::join(ddir->path(), dname));
+      return;
     }
+    copyChildren(ctx, std::make_shared<DirHandle>(std::move(source)), std::make_shared<DirHandle>(std::move(dest)));
+  } else if (stat.isSymbolicLink()) {
+    String target = sdir->readlink(sname, ec);
+    if (ec) {
+      ctx.errors.add(ec, "readlink", path::join(sdir->path(), sname));
+      return;
+    }
+    Stats existing;
+    if (ddir->statNoThrow(existing, dname, false, SF_TYPE) == 0) {
+      if (options.errorOnExist) {
+        ctx.errors.add(internal::errnoCode(EEXIST), "copy", path::join(sdir->path(), sname), path::join(ddir->path(), dname));
+        return;
+      }
+      ddir->unlink(dname, ec);
+      if (ec) {
+        ctx.errors.add(ec, "unlink", path::join(ddir->path(), dname));
+        return;
+      }
+    }
+    ddir->symlink(target, dname, ec);
+    if (ec) {
+      ctx.errors.add(ec, "symlink", target, path::join(ddir->path(), dname));
+      return;
+    }
+    if (ctx.moving) finishMove(ctx, *sdir, sname);
   } else {
-    fs::copyFile(source, dest, failIfExists);
+    CopyFileOptions fileOptions;
+    fileOptions.failIfExists = options.errorOnExist;
+    fileOptions.preserveTimestamps = options.preserveTimestamps;
+    copyFileAt(*sdir, sname, *ddir, dname, fileOptions, ec);
+    if (ec) {
+      ctx.errors.add(ec, "copy", path::join(sdir->path(), sname), path::join(ddir->path(), dname));
+      return;
+    }
+    if (ctx.moving) finishMove(ctx, *sdir, sname);
   }
 }
 
-void move(const String& s, const String& d) {
+// Both handles stay open until the last entry below them is copied.
+void copyChildren(CopyContext& ctx, const std::shared_ptr<DirHandle>& sdir, const std::shared_ptr<DirHandle>& ddir) {
+  std::error_code ec;
+  std::vector<String> items = sdir->readdir(ec);
+  if (ec) {
+    ctx.errors.add(ec, "scandir", sdir->path());
+    return;
+  }
+  for (size_t i = 0; i < items.size(); i++) {
+    String name = items[i];
+    std::shared_ptr<DirHandle> s = sdir;
+    std::shared_ptr<DirHandle> d = ddir;
+    ctx.pool.submit([&ctx, s, d, name]() {
+      copyEntry(ctx, s, name, d, name);
+    });
+  }
+}
+
+void copyTree(const String& s, const String& d, const CopyOptions& options, internal::ErrorList& errors,
+              bool moving = false) {
   String source = path::resolve(s);
   String dest = path::resolve(d);
 
@@ -995,98 +1515,308 @@ void move(const String& s, const String& d) {
     return;
   }
 
-  fs::copy(source, dest);
-  fs::remove(source);
-}
-
-std::vector<uint8_t> readFile(const String& p) {
-  String path = path::normalize(p);
-  // if (!fs::exists(path)) {
-  //   throw cerror(ENOENT, "open \"" + p + "\"");
-  // }
-
-  // fs::Stats stat = fs::statSync(path);
-  // if (stat.isDirectory()) {
-  //   throw std::runtime_error((String("EISDIR: illegal operation on a directory, read \"") + path + "\"").toCString());
-  // }
-
-  fs::Stats stat;
-  int r = fs::Stats::createNoThrow(stat, path, false);
+  Stats stat;
+  int r = Stats::createNoThrow(stat, source, options.dereference, SF_TYPE);
   if (r != 0) {
-    internal::throwError(String(strerror(r)) + L", open \"" + p + L"\"");
+    errors.add(internal::errnoCode(r), options.dereference ? "stat" : "lstat", source);
+    return;
   }
 
+  std::error_code ec;
+  CopyContext ctx(internal::WorkStealingPool::threadsFor(options.concurrency), options, errors, moving);
   if (stat.isDirectory()) {
-    internal::throwError(String(strerror(EISDIR)) + L", read \"" + p + L"\"");
+    if (path::relative(s, d).indexOf(L"..") != 0) {
+      errors.add(internal::errnoCode(EINVAL),
+                 String(L"Cannot copy a directory into itself.") + L" copy \"" + s + L"\" -> \"" + d + L"\"");
+      return;
+    }
+    if (options.filter && !options.filter(source, dest)) {
+      return;
+    }
+    fs::mkdirs(dest, ec);
+    if (ec) {
+      errors.add(ec, "mkdir", dest);
+      return;
+    }
+    DirHandle sdir = DirHandle::open(source, ec);
+    if (ec) {
+      errors.add(ec, "opendir", source);
+      return;
+    }
+    DirHandle ddir = DirHandle::open(dest, ec);
+    if (ec) {
+      errors.add(ec, "opendir", dest);
+      return;
+    }
+    copyChildren(ctx, std::make_shared<DirHandle>(std::move(sdir)), std::make_shared<DirHandle>(std::move(ddir)));
+  } else {
+    DirHandle sdir = DirHandle::open(path::dirname(source), ec);
+    if (ec) {
+      errors.add(ec, "opendir", path::dirname(source));
+      return;
+    }
+    DirHandle ddir = DirHandle::open(path::dirname(dest), ec);
+    if (ec) {
+      errors.add(ec, "opendir", path::dirname(dest));
+      return;
+    }
+    copyEntry(ctx,
+              std::make_shared<DirHandle>(std::move(sdir)), path::basename(source),
+              std::make_shared<DirHandle>(std::move(ddir)), path::basename(dest));
   }
+  ctx.pool.wait();
+}
 
-  long size = stat.size;
+}
 
+String readlink(const String& p, std::error_code& ec) {
 #ifdef _WIN32
-  FILE* fp = ::_wfopen(path.data(), L"rb");
+  HANDLE handle = CreateFileW(path::normalize(p).data(),
+                              0,
+                              0,
+                              NULL,
+                              OPEN_EXISTING,
+                              FILE_FLAG_OPEN_REPARSE_POINT | FILE_FLAG_BACKUP_SEMANTICS,
+                              NULL);
+  if (handle == INVALID_HANDLE_VALUE) {
+    ec = internal::winCode(GetLastError());
+    return String();
+  }
+  char* target = NULL;
+  uint64_t len = 0;
+  if (fs_readlink_handle(handle, &target, &len) < 0) {
+    ec = internal::winCode(GetLastError());
+    CloseHandle(handle);
+    return String();
+  }
+  CloseHandle(handle);
+  String res = target;
+  free(target);
+  ec.clear();
+  return res;
 #else
-  FILE* fp = ::fopen(path.str().c_str(), "rb");
-#endif
-  if (!fp) {
-    internal::throwError(String(strerror(errno)) + L", open \"" + p + L"\"");
+  std::string buf(256, '\0');
+  std::string path = path::normalize(p).str();
+  for (;;) {
+    ssize_t n = ::readlink(path.c_str(), &buf[0], buf.size());
+    if (n < 0) {
+      ec = internal::errnoCode(errno);
+      return String();
+    }
+    if ((size_t)n < buf.size()) {
+      buf.resize((size_t)n);
+      ec.clear();
+      return buf;
+    }
+    buf.resize(buf.size() * 2);
   }
+#endif
+}
 
-  std::vector<uint8_t> buf(size, 0);
-  size_t read = ::fread(&buf[0], sizeof(uint8_t), size, fp);
-  ::fclose(fp);
-  if (read != size) {
-    internal::throwError(String(strerror(errno)) + L", read \"" + p + L"\"");
-  }
-  return buf;
+String readlink(const String& p) {
+  std::error_code ec;
+  String res = fs::readlink(p, ec);
+  if (ec) internal::throwFsError(ec, "readlink", p);
+  return res;
 }
 
-String readFileAsString(const String& p) {
-  std::vector<uint8_t> buf = fs::readFile(p);
-  return std::string(buf.begin(), buf.end());
+void copy(const String& s, const String& d, bool failIfExists) {
+  CopyOptions options;
+  options.dereference = true;
+  options.errorOnExist = failIfExists;
+  fs::copy(s, d, options);
+}
+
+void copy(const String& s, const String& d, const CopyOptions& options) {
+  internal::ErrorList errors;
+  copyTree(s, d, options, errors);
+  errors.throwIfAny();
+}
+
+void copy(const String& s, const String& d, std::error_code& ec, bool failIfExists) {
+  CopyOptions options;
+  options.dereference = true;
+  options.errorOnExist = failIfExists;
+  fs::copy(s, d, options, ec);
+}
+
+void copy(const String& s, const String& d, const CopyOptions& options, std::error_code& ec) {
+  internal::ErrorList errors;
+  copyTree(s, d, options, errors);
+  errors.report(ec);
 }
 
 namespace {
-  void internalWriteFile(const String& p, const uint8_t* buf, size_t size, String mode) {
-    if (fs::exists(p)) {
-      if (fs::lstat(p).isDirectory()) {
-        internal::throwError(String(strerror(errno)) + L", open \"" + p + L"\"");
-      }
-    }
 
-    String path = path::normalize(p);
+#if defined(__linux__) && defined(__NR_renameat2)
+#define JSCPP_FS_RENAME_NOREPLACE (1 << 0)
+#define JSCPP_FS_RENAME_EXCHANGE (1 << 1)
+#endif
+
+// rename(), with the renameat2() flags on Linux and renamex_np() on macOS
+std::error_code renamePath(const String& source, const String& dest, const MoveOptions& options) {
+#ifdef _WIN32
+  if (options.exchange) return std::make_error_code(std::errc::operation_not_supported);
+  DWORD flags = options.noReplace ? 0 : MOVEFILE_REPLACE_EXISTING;
+  if (MoveFileExW(source.data(), dest.data(), flags)) return std::error_code();
+  return internal::winCode(GetLastError());
+#else
+  std::string s = source.str();
+  std::string d = dest.str();
+  int r;
+  if (options.noReplace || options.exchange) {
+#if defined(JSCPP_FS_RENAME_NOREPLACE)
+    unsigned flags = options.exchange ? JSCPP_FS_RENAME_EXCHANGE : JSCPP_FS_RENAME_NOREPLACE;
+    r = (int)::syscall(__NR_renameat2, AT_FDCWD, s.c_str(), AT_FDCWD, d.c_str(), flags);
+#elif defined(__APPLE__) && defined(RENAME_EXCL)
+    r = ::renamex_np(s.c_str(), d.c_str(), options.exchange ? RENAME_SWAP : RENAME_EXCL);
+#else
+    return std::make_error_code(std::errc::operation_not_supported);
+#endif
+  } else {
+    r = ::rename(s.c_str(), d.c_str());
+  }
+  return r == 0 ? std::error_code() : internal::errnoCode(errno);
+#endif
+}
 
-  #ifdef _WIN32
-    FILE* fp = ::_wfopen(path.data(), mode.data());
-  #else
-    FILE* fp = ::fopen(path.str().c_str(), mode.str().c_str());
-  #endif
+void moveTree(const String& s, const String& d, const MoveOptions& options, internal::ErrorList& errors) {
+  String source = path::resolve(s);
+  String dest = path::resolve(d);
 
-    if (!fp) {
-      internal::throwError(String(strerror(errno)) + L", open \"" + p + L"\"");
+  if (source == dest) {
+    return;
+  }
+
+  std::error_code ec = renamePath(source, dest, options);
+  if (ec == std::errc::no_such_file_or_directory && !options.exchange) {
+    // The destination's parent may not be there yet
+    Stats stat;
+    std::error_code mkdirError;
+    if (Stats::createNoThrow(stat, source, false, SF_TYPE) == 0) {
+      fs::mkdirs(path::dirname(dest), mkdirError);
+      if (!mkdirError) ec = renamePath(source, dest, options);
     }
+  }
+  if (!ec) {
+    return;
+  }
+
+  // Only a copy can cross devices, and it merges into an existing
+  // directory as moves always did
+  bool crossDevice = ec == std::errc::cross_device_link;
+  bool merge = !options.noReplace &&
+    (ec == std::errc::directory_not_empty || ec == std::errc::file_exists);
+  if (options.exchange || !(crossDevice || merge)) {
+    errors.add(ec, "rename", s, d);
+    return;
+  }
+  Stats existing;
+  if (options.noReplace && Stats::createNoThrow(existing, dest, false, SF_TYPE) == 0) {
+    errors.add(internal::errnoCode(EEXIST), "rename", s, d);
+    return;
+  }
+
+  CopyOptions copyOptions;
+  copyOptions.concurrency = options.concurrency;
+  copyOptions.errorOnExist = options.noReplace;
+  copyOptions.preserveTimestamps = true;
+  copyTree(source, dest, copyOptions, errors, true);
+  // What is left of the source is its directories, unless something failed
+  if (errors.empty()) {
+    RemoveOptions removeOptions;
+    removeOptions.concurrency = options.concurrency;
+    removeTree(source, removeOptions, errors);
+  }
+}
+
+}
+
+void move(const String& s, const String& d) {
+  fs::move(s, d, MoveOptions());
+}
+
+void move(const String& s, const String& d, const MoveOptions& options) {
+  internal::ErrorList errors;
+  moveTree(s, d, options, errors);
+  errors.throwIfAny();
+}
+
+void move(const String& s, const String& d, std::error_code& ec) {
+  fs::move(s, d, MoveOptions(), ec);
+}
 
-    ::fwrite(buf, sizeof(uint8_t), size, fp);
-    ::fflush(fp);
-    ::fclose(fp);
+void move(const String& s, const String& d, const MoveOptions& options, std::error_code& ec) {
+  internal::ErrorList errors;
+  moveTree(s, d, options, errors);
+  errors.report(ec);
+}
+
+namespace {
+
+// Reads the whole file into res, sized from fstat plus one byte to see the
+// end. Files without a size, such as procfs ones, and files that grow while
+// being read double the buffer until the end turns up. A file truncated
+// meanwhile just comes out shorter.
+template <typename Buffer>
+void readWhole(const String& p, Buffer& res, std::error_code& ec, const char*& syscall) {
+  syscall = "open";
+  FileHandle file = FileHandle::open(p, ec, OF_READ);
+  if (ec) return;
+  Stats stats = file.stat(ec, SF_TYPE | SF_SIZE);
+  if (ec) return;
+  syscall = "read";
+  if (stats.isDirectory()) {
+    ec = internal::errnoCode(EISDIR);
+    return;
   }
+  size_t size = stats.isFile() && stats.size > 0 ? (size_t)stats.size + 1 : JSCPP_FS_READ_CHUNK;
+  size_t done = 0;
+  for (;;) {
+    res.resize(size);
+    done += file.read(&res[done], size - done, ec);
+    if (ec) {
+      res.clear();
+      return;
+    }
+    if (done < size) break;
+    size *= 2;
+  }
+  res.resize(done);
 }
 
-void writeFile(const String& p, const std::vector<uint8_t>& buf) {
-  internalWriteFile(p, buf.data(), buf.size(), L"wb");
 }
 
-void writeFile(const String& p, const String& str) {
-  std::string utf8 = str.str();
-  internalWriteFile(p, (const uint8_t*)(utf8.data()), utf8.size(), L"wb");
+std::vector<uint8_t> readFile(const String& p, std::error_code& ec) {
+  std::vector<uint8_t> res;
+  const char* syscall;
+  readWhole(p, res, ec, syscall);
+  return res;
 }
 
-void appendFile(const String& p, const std::vector<uint8_t>& buf) {
-  internalWriteFile(p, buf.data(), buf.size(), L"ab");
+std::vector<uint8_t> readFile(const String& p) {
+  std::vector<uint8_t> res;
+  std::error_code ec;
+  const char* syscall;
+  readWhole(p, res, ec, syscall);
+  if (ec) internal::throwFsError(ec, syscall, p);
+  return res;
 }
 
-void appendFile(const String& p, const String& str) {
-  std::string utf8 = str.str();
-  internalWriteFile(p, (const uint8_t*)(utf8.data()), utf8.size(), L"ab");
+String readFileAsString(const String& p, std::error_code& ec) {
+  std::string res;
+  const char* syscall;
+  readWhole(p, res, ec, syscall);
+  return res;
+}
+
+String readFileAsString(const String& p) {
+  std::string res;
+  std::error_code ec;
+  const char* syscall;
+  readWhole(p, res, ec, syscall);
+  if (ec) internal::throwFsError(ec, syscall, p);
+  return res;
 }
 
 }
@@ -0,0 +1,385 @@
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "jscpp/fs.hpp"
+#include "../internal/fserror.hpp"
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <mutex>
+
+// Buffers of closed streams kept for later ones
+#define JSCPP_FS_STREAM_CACHED 8
+// Larger buffers go back to the allocator
+#define JSCPP_FS_STREAM_CACHED_MAX_SIZE 4 * 1024 * 1024
+
+namespace js {
+namespace fs {
+
+namespace {
+
+std::mutex cacheMutex;
+std::vector<std::vector<uint8_t>> cachedBuffers;
+
+std::vector<uint8_t> acquireBuffer(size_t size) {
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    for (size_t i = cachedBuffers.size(); i > 0; i--) {
+      if (cachedBuffers[i - 1].size() == size) {
+        std::vector<uint8_t> res = std::move(cachedBuffers[i - 1]);
+        cachedBuffers.erase(cachedBuffers.begin() + (i - 1));
+        return res;
+      }
+    }
+  }
+  return std::vector<uint8_t>(size);
+}
+
+void releaseBuffer(std::vector<uint8_t>& buffer) noexcept {
+  if (buffer.empty()) return;
+  if (buffer.size() <= JSCPP_FS_STREAM_CACHED_MAX_SIZE) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    if (cachedBuffers.size() < JSCPP_FS_STREAM_CACHED) {
+      cachedBuffers.push_back(std::move(buffer));
+    }
+  }
+  std::vector<uint8_t>().swap(buffer);
+}
+
+// A single read, so a pipe hands over what it has instead of the stream
+// waiting for a whole buffer
+size_t readSome(int fd, uint8_t* buf, size_t size, std::error_code& ec) {
+#ifdef _WIN32
+  int n = ::_read(fd, buf, (unsigned int)(size < INT_MAX ? size : INT_MAX));
+#else
+  ssize_t n;
+  do {
+    n = ::read(fd, buf, size);
+  } while (n == -1 && errno == EINTR);
+#endif
+  if (n < 0) {
+    ec = internal::errnoCode(errno);
+    return 0;
+  }
+  return (size_t)n;
+}
+
+int openFlags(WriteFlag flag) noexcept {
+  switch (flag) {
+    case WF_APPEND: return OF_WRITE | OF_CREATE | OF_APPEND;
+    case WF_EXCLUSIVE: return OF_WRITE | OF_CREATE | OF_EXCLUSIVE;
+    default: return OF_WRITE | OF_CREATE | OF_TRUNCATE;
+  }
+}
+
+}
+
+ReadStream::Iterator::Iterator(ReadStream* stream): stream_(stream), chunk_() {
+  ++*this;
+}
+
+ReadStream::Iterator& ReadStream::Iterator::operator++() {
+  chunk_ = stream_->read();
+  if (chunk_.empty()) stream_ = nullptr;
+  return *this;
+}
+
+ReadStream::~ReadStream() {
+  close();
+}
+
+ReadStream::ReadStream() noexcept:
+  file_(), buffer_(), position_(0), end_(-1), bytesRead_(0), sequential_(false), ended_(true) {}
+
+ReadStream::ReadStream(ReadStream&& r) noexcept:
+  file_(std::move(r.file_)), buffer_(std::move(r.buffer_)), position_(r.position_), end_(r.end_),
+  bytesRead_(r.bytesRead_), sequential_(r.sequential_), ended_(r.ended_) {
+  r.ended_ = true;
+}
+
+ReadStream& ReadStream::operator=(ReadStream&& r) noexcept {
+  if (this != &r) {
+    close();
+    file_ = std::move(r.file_);
+    buffer_ = std::move(r.buffer_);
+    position_ = r.position_;
+    end_ = r.end_;
+    bytesRead_ = r.bytesRead_;
+    sequential_ = r.sequential_;
+    ended_ = r.ended_;
+    r.ended_ = true;
+  }
+  return *this;
+}
+
+ReadStream ReadStream::open(const String& p, std::error_code& ec, const ReadStreamOptions& options) {
+  ReadStream res;
+  if (options.highWaterMark == 0 || options.end < -1 || (options.end >= 0 && (uint64_t)options.end < options.start)) {
+    ec = internal::errnoCode(EINVAL);
+    return res;
+  }
+  res.file_ = FileHandle::open(p, ec, OF_READ);
+  if (ec) return res;
+  std::error_code ignored;
+  Stats stats = res.file_.stat(ignored, SF_TYPE);
+  res.sequential_ = !ignored && (stats.isFifo() || stats.isSocket() || stats.isCharacterDevice());
+  if (res.sequential_ && options.start != 0) {
+    res.file_.close(ignored);
+    ec = internal::errnoCode(ESPIPE);
+    return res;
+  }
+  res.file_.advise(FA_SEQUENTIAL, ignored, options.start, 0);
+  res.buffer_ = acquireBuffer(options.highWaterMark);
+  res.position_ = options.start;
+  res.end_ = options.end;
+  res.ended_ = false;
+  return res;
+}
+
+ReadStream ReadStream::open(const String& p, const ReadStreamOptions& options) {
+  std::error_code ec;
+  ReadStream res = open(p, ec, options);
+  if (ec) internal::throwFsError(ec, "open", p);
+  return res;
+}
+
+ByteView ReadStream::read(std::error_code& ec) {
+  ec.clear();
+  if (ended_) return ByteView();
+  size_t size = buffer_.size();
+  if (end_ >= 0) {
+    uint64_t left = (uint64_t)end_ + 1 > position_ ? (uint64_t)end_ + 1 - position_ : 0;
+    if (left < size) size = (size_t)left;
+  }
+  size_t n = 0;
+  if (size > 0) {
+    n = sequential_ ? readSome(file_.fd(), buffer_.data(), size, ec)
+                    : file_.pread(buffer_.data(), size, position_, ec);
+  }
+  if (ec) return ByteView();
+  if (n == 0) {
+    close();
+    return ByteView();
+  }
+  position_ += n;
+  bytesRead_ += n;
+  return ByteView(buffer_.data(), n);
+}
+
+ByteView ReadStream::read() {
+  std::error_code ec;
+  ByteView res = read(ec);
+  if (ec) internal::throwFsError(ec, "read", file_.path());
+  return res;
+}
+
+ReadStream::Iterator ReadStream::begin() {
+  return Iterator(this);
+}
+
+ReadStream::Iterator ReadStream::end() noexcept {
+  return Iterator();
+}
+
+uint64_t ReadStream::pipe(WriteStream& dest, std::error_code& ec) {
+  uint64_t total = 0;
+  for (;;) {
+    ByteView chunk = read(ec);
+    if (ec || chunk.empty()) break;
+    dest.write(chunk, ec);
+    if (ec) return total;
+    total += chunk.size();
+  }
+  if (!ec) dest.flush(ec);
+  return total;
+}
+
+uint64_t ReadStream::pipe(WriteStream& dest) {
+  uint64_t total = 0;
+  for (ByteView chunk = read(); !chunk.empty(); chunk = read()) {
+    dest.write(chunk);
+    total += chunk.size();
+  }
+  dest.flush();
+  return total;
+}
+
+bool ReadStream::ended() const noexcept {
+  return ended_;
+}
+
+uint64_t ReadStream::bytesRead() const noexcept {
+  return bytesRead_;
+}
+
+const String& ReadStream::path() const noexcept {
+  return file_.path();
+}
+
+void ReadStream::close() noexcept {
+  std::error_code ignored;
+  file_.close(ignored);
+  releaseBuffer(buffer_);
+  ended_ = true;
+}
+
+WriteStream::~WriteStream() {
+  std::error_code ignored;
+  close(ignored);
+}
+
+WriteStream::WriteStream() noexcept: file_(), buffer_(), buffered_(0), bytesWritten_(0) {}
+
+WriteStream::WriteStream(WriteStream&& w) noexcept:
+  file_(std::move(w.file_)), buffer_(std::move(w.buffer_)), buffered_(w.buffered_), bytesWritten_(w.bytesWritten_) {
+  w.buffered_ = 0;
+}
+
+WriteStream& WriteStream::operator=(WriteStream&& w) noexcept {
+  if (this != &w) {
+    std::error_code ignored;
+    close(ignored);
+    file_ = std::move(w.file_);
+    buffer_ = std::move(w.buffer_);
+    buffered_ = w.buffered_;
+    bytesWritten_ = w.bytesWritten_;
+    w.buffered_ = 0;
+  }
+  return *this;
+}
+
+WriteStream WriteStream::open(const String& p, std::error_code& ec, const WriteStreamOptions& options) {
+  WriteStream res;
+  if (options.highWaterMark == 0) {
+    ec = internal::errnoCode(EINVAL);
+    return res;
+  }
+  res.file_ = FileHandle::open(p, ec, openFlags(options.flag), options.mode);
+  if (ec) return res;
+  res.buffer_ = acquireBuffer(options.highWaterMark);
+  return res;
+}
+
+WriteStream WriteStream::open(const String& p, const WriteStreamOptions& options) {
+  std::error_code ec;
+  WriteStream res = open(p, ec, options);
+  if (ec) internal::throwFsError(ec, "open", p);
+  return res;
+}
+
+void WriteStream::write(const void* data, size_t size, std::error_code& ec) {
+  ec.clear();
+  if (!file_.isOpen()) {
+    ec = internal::errnoCode(EBADF);
+    return;
+  }
+  if (size == 0) return;
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  if (buffered_ + size < buffer_.size()) {
+    memcpy(buffer_.data() + buffered_, bytes, size);
+    buffered_ += size;
+    return;
+  }
+  // Top the buffer up and write it out, then write whatever fills a whole
+  // buffer straight from the caller's memory
+  if (buffered_ > 0) {
+    size_t fill = buffer_.size() - buffered_;
+    memcpy(buffer_.data() + buffered_, bytes, fill);
+    buffered_ += fill;
+    bytes += fill;
+    size -= fill;
+    flush(ec);
+    if (ec) return;
+  }
+  if (size >= buffer_.size()) {
+    file_.write(bytes, size, ec);
+    if (ec) return;
+    bytesWritten_ += size;
+    return;
+  }
+  memcpy(buffer_.data(), bytes, size);
+  buffered_ = size;
+}
+
+void WriteStream::write(const void* data, size_t size) {
+  std::error_code ec;
+  write(data, size, ec);
+  if (ec) internal::throwFsError(ec, "write", file_.path());
+}
+
+void WriteStream::write(const ByteView& data, std::error_code& ec) {
+  write(data.data(), data.size(), ec);
+}
+
+void WriteStream::write(const ByteView& data) {
+  write(data.data(), data.size());
+}
+
+void WriteStream::flush(std::error_code& ec) {
+  ec.clear();
+  if (buffered_ == 0) return;
+  size_t size = buffered_;
+  buffered_ = 0;
+  file_.write(buffer_.data(), size, ec);
+  if (!ec) bytesWritten_ += size;
+}
+
+void WriteStream::flush() {
+  std::error_code ec;
+  flush(ec);
+  if (ec) internal::throwFsError(ec, "write", file_.path());
+}
+
+void WriteStream::close(std::error_code& ec) {
+  ec.clear();
+  if (!file_.isOpen()) return;
+  flush(ec);
+  std::error_code closeEc;
+  file_.close(closeEc);
+  if (!ec) ec = closeEc;
+  releaseBuffer(buffer_);
+}
+
+void WriteStream::close() {
+  std::error_code ec;
+  close(ec);
+  if (ec) internal::throwFsError(ec, "close", file_.path());
+}
+
+bool WriteStream::isOpen() const noexcept {
+  return file_.isOpen();
+}
+
+size_t WriteStream::buffered() const noexcept {
+  return buffered_;
+}
+
+uint64_t WriteStream::bytesWritten() const noexcept {
+  return bytesWritten_;
+}
+
+const String& WriteStream::path() const noexcept {
+  return file_.path();
+}
+
+ReadStream createReadStream(const String& p, const ReadStreamOptions& options) {
+  return ReadStream::open(p, options);
+}
+
+ReadStream createReadStream(const String& p, std::error_code& ec, const ReadStreamOptions& options) {
+  return ReadStream::open(p, ec, options);
+}
+
+WriteStream createWriteStream(const String& p, const WriteStreamOptions& options) {
+  return WriteStream::open(p, options);
+}
+
+WriteStream createWriteStream(const String& p, std::error_code& ec, const WriteStreamOptions& options) {
+  return WriteStream::open(p, ec, options);
+}
+
+}
+}
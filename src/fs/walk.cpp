@@ -0,0 +1,154 @@
+#include "jscpp/fs.hpp"
+#include "jscpp/path.hpp"
+#include "../internal/dirreader.hpp"
+#include "../internal/pool.hpp"
+#include <exception>
+#include <mutex>
+#include <set>
+#include <utility>
+
+namespace js {
+namespace fs {
+
+namespace {
+
+FileType fromMode(unsigned int mode) noexcept {
+  switch (mode & S_IFMT) {
+    case S_IFREG: return FT_FILE;
+    case S_IFDIR: return FT_DIRECTORY;
+    case S_IFCHR: return FT_CHARACTER_DEVICE;
+#ifndef _WIN32
+    case S_IFLNK: return FT_SYMLINK;
+    case S_IFIFO: return FT_FIFO;
+    case S_IFSOCK: return FT_SOCKET;
+    case S_IFBLK: return FT_BLOCK_DEVICE;
+#endif
+    default: return FT_UNKNOWN;
+  }
+}
+
+struct WalkContext {
+  internal::WorkStealingPool pool;
+  internal::ErrorList& errors;
+  const std::function<void(const WalkEntry&)>& callback;
+  const WalkOptions& options;
+  std::mutex visitedMutex;
+#ifdef _WIN32
+  std::set<std::wstring> visited;
+#else
+  std::set<std::pair<dev_t, ino_t>> visited;
+#endif
+
+  WalkContext(unsigned threads, const std::function<void(const WalkEntry&)>& callback, const WalkOptions& options,
+              internal::ErrorList& errors):
+    pool(threads), errors(errors), callback(callback), options(options) {}
+};
+
+// Only tracked when following links, which is the only way to loop.
+bool firstVisit(WalkContext& ctx, const DirHandle& dir) {
+#ifdef _WIN32
+  std::error_code ec;
+  std::wstring key = fs::realpath(dir.path(), ec).data();
+  if (ec) return true;
+#else
+  struct stat info;
+  if (::fstat(dir.fd(), &info) != 0) return true;
+  std::pair<dev_t, ino_t> key(info.st_dev, info.st_ino);
+#endif
+  std::lock_guard<std::mutex> lock(ctx.visitedMutex);
+  return ctx.visited.insert(key).second;
+}
+
+void walkDir(WalkContext& ctx, const std::shared_ptr<DirHandle>& dir, const String& dirPath, size_t depth) {
+  const WalkOptions& options = ctx.options;
+  // Joining by hand, as the prefix is already normalized
+  String prefix = dirPath;
+  if (!prefix.endsWith(path::sep)) prefix += path::sep;
+
+  std::error_code ec;
+  internal::DirReader reader(*dir, ec);
+  internal::DirReader::Entry item;
+  WalkEntry entry;
+  entry.depth = depth;
+  while (!ec && reader.next(item, ec)) {
+    entry.name = String(item.name);
+    entry.path = prefix + entry.name;
+    entry.type = item.type;
+    if (entry.type == FT_UNKNOWN) {
+      Stats stats;
+      if (dir->statNoThrow(stats, entry.name, false, SF_TYPE) == 0) entry.type = fromMode(stats.mode);
+    }
+
+    bool isDirectory = entry.type == FT_DIRECTORY;
+    if (entry.type == FT_SYMLINK && options.followSymlinks) {
+      Stats stats;
+      isDirectory = dir->statNoThrow(stats, entry.name, true, SF_TYPE) == 0 && stats.isDirectory();
+    }
+
+    ctx.callback(entry);
+
+    if (isDirectory && depth < options.maxDepth && (!options.descend || options.descend(entry))) {
+      std::shared_ptr<DirHandle> parent = dir;
+      String name = entry.name;
+      String childPath = entry.path;
+      bool follow = entry.type == FT_SYMLINK;
+      ctx.pool.submit([&ctx, parent, name, childPath, follow, depth]() mutable {
+        std::error_code ec;
+        std::shared_ptr<DirHandle> child = std::make_shared<DirHandle>(parent->openAt(name, ec, follow));
+        parent.reset();
+        if (ec) {
+          ctx.errors.add(ec, "opendir", childPath);
+          return;
+        }
+        if (ctx.options.followSymlinks && !firstVisit(ctx, *child)) return;
+        try {
+          walkDir(ctx, child, childPath, depth + 1);
+        } catch (...) {
+          ctx.errors.add(std::current_exception());
+        }
+      });
+    }
+  }
+  if (ec) {
+    ctx.errors.add(ec, "scandir", dirPath);
+  }
+}
+
+void walkTree(const String& root, const std::function<void(const WalkEntry&)>& callback, const WalkOptions& options,
+              internal::ErrorList& errors) {
+  String rootPath = path::normalize(root);
+  std::error_code ec;
+  std::shared_ptr<DirHandle> dir = std::make_shared<DirHandle>(DirHandle::open(rootPath, ec));
+  if (ec) {
+    errors.add(ec, "opendir", root);
+    return;
+  }
+
+  WalkContext ctx(internal::WorkStealingPool::threadsFor(options.concurrency), callback, options, errors);
+  if (options.followSymlinks) firstVisit(ctx, *dir);
+  try {
+    walkDir(ctx, dir, rootPath, 0);
+  } catch (...) {
+    errors.add(std::current_exception());
+  }
+  dir.reset();
+  ctx.pool.wait();
+}
+
+}
+
+void walk(const String& root, const std::function<void(const WalkEntry&)>& callback, const WalkOptions& options) {
+  internal::ErrorList errors;
+  walkTree(root, callback, options, errors);
+  errors.throwIfAny();
+}
+
+void walk(const String& root, const std::function<void(const WalkEntry&)>& callback, std::error_code& ec,
+          const WalkOptions& options) {
+  internal::ErrorList errors;
+  walkTree(root, callback, options, errors);
+  errors.report(ec);
+}
+
+}
+}
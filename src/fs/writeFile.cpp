@@ -0,0 +1,350 @@
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <fcntl.h>
+#endif
+
+#include "jscpp/fs.hpp"
+#include "jscpp/path.hpp"
+#include "../internal/fserror.hpp"
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <string>
+
+// Names tried for the temporary file of an atomic write
+#define JSCPP_FS_TEMP_ATTEMPTS 16
+// Symlinks an atomic write follows before giving up on finding the file
+#define JSCPP_FS_SYMLINK_HOPS 40
+
+namespace js {
+namespace fs {
+
+namespace {
+
+// Tells apart the temporary files of one process
+std::atomic<unsigned> tempCounter(0);
+
+String tempPath(const String& target) {
+  char suffix[48];
+#ifdef _WIN32
+  unsigned long pid = GetCurrentProcessId();
+#else
+  unsigned long pid = (unsigned long)::getpid();
+#endif
+  snprintf(suffix, sizeof(suffix), ".%lx.%x.tmp", pid, tempCounter++);
+  return path::join(path::dirname(target), L"." + path::basename(target) + String(suffix));
+}
+
+#ifdef _WIN32
+
+int openFlags(WriteFlag flag) noexcept {
+  switch (flag) {
+    case WF_APPEND: return _O_APPEND;
+    case WF_EXCLUSIVE: return _O_EXCL;
+    default: return _O_TRUNC;
+  }
+}
+
+int permissions(int mode) noexcept {
+  return (mode & 0200) ? (_S_IREAD | _S_IWRITE) : _S_IREAD;
+}
+
+int openFile(const String& p, int flags, int mode) noexcept {
+  return ::_wopen(p.data(), _O_WRONLY | _O_CREAT | _O_BINARY | _O_NOINHERIT | flags, permissions(mode));
+}
+
+// 0 or errno; _write() takes at most INT_MAX bytes at once
+int writeAll(int fd, const uint8_t* buf, size_t size) noexcept {
+  while (size > 0) {
+    int n = ::_write(fd, buf, (unsigned int)(size < INT_MAX ? size : INT_MAX));
+    if (n < 0) return errno;
+    buf += n;
+    size -= (size_t)n;
+  }
+  return 0;
+}
+
+int syncData(int fd) noexcept {
+  return ::_commit(fd) == 0 ? 0 : errno;
+}
+
+int closeFile(int fd) noexcept {
+  return ::_close(fd) == 0 ? 0 : errno;
+}
+
+#else
+
+int openFlags(WriteFlag flag) noexcept {
+  switch (flag) {
+    case WF_APPEND: return O_APPEND;
+    case WF_EXCLUSIVE: return O_EXCL;
+    default: return O_TRUNC;
+  }
+}
+
+int openFile(const String& p, int flags, int mode) noexcept {
+  return ::open(p.str().c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | flags, mode);
+}
+
+// 0 or errno; write() may take only part of the buffer
+int writeAll(int fd, const uint8_t* buf, size_t size) noexcept {
+  while (size > 0) {
+    ssize_t n = ::write(fd, buf, size);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return errno;
+    }
+    buf += n;
+    size -= (size_t)n;
+  }
+  return 0;
+}
+
+int syncData(int fd) noexcept {
+#ifdef __APPLE__
+  return ::fsync(fd) == 0 ? 0 : errno;
+#else
+  return ::fdatasync(fd) == 0 ? 0 : errno;
+#endif
+}
+
+// The descriptor is gone even when close() is interrupted
+int closeFile(int fd) noexcept {
+  return ::close(fd) == 0 || errno == EINTR ? 0 : errno;
+}
+
+#endif
+
+// Writes straight into the target; opening it tells directories apart
+std::error_code writeDirect(const String& target, const uint8_t* buf, size_t size, const WriteFileOptions& options,
+                            const char*& syscall) {
+  syscall = "open";
+  int fd = openFile(target, openFlags(options.flag), options.mode);
+  if (fd == -1) return internal::errnoCode(errno);
+
+  syscall = "write";
+  int err = writeAll(fd, buf, size);
+  if (err == 0 && options.fsync) {
+    syscall = "fsync";
+    err = syncData(fd);
+  }
+  int closeErr = closeFile(fd);
+  if (err == 0 && closeErr != 0) {
+    syscall = "close";
+    err = closeErr;
+  }
+  return err != 0 ? internal::errnoCode(err) : std::error_code();
+}
+
+#ifdef _WIN32
+
+// The file a symlink at p points to, or p itself. Dangling links are
+// left alone, as CreateFileW cannot open what they point to.
+String resolveLinks(const String& p) {
+  DWORD attr = GetFileAttributesW(p.data());
+  if (attr == INVALID_FILE_ATTRIBUTES || !(attr & FILE_ATTRIBUTE_REPARSE_POINT)) return p;
+  HANDLE handle = CreateFileW(p.data(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+                              OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, NULL);
+  if (handle == INVALID_HANDLE_VALUE) return p;
+  std::wstring buf(MAX_PATH, L'\0');
+  DWORD n = GetFinalPathNameByHandleW(handle, &buf[0], (DWORD)buf.size(), FILE_NAME_NORMALIZED);
+  if (n >= buf.size()) {
+    buf.resize(n);
+    n = GetFinalPathNameByHandleW(handle, &buf[0], (DWORD)buf.size(), FILE_NAME_NORMALIZED);
+  }
+  CloseHandle(handle);
+  if (n == 0 || n >= buf.size()) return p;
+  buf.resize(n);
+  return String(buf);
+}
+
+#else
+
+// The file a symlink at p points to, following chains of links and
+// dangling ones, or p itself. Only the last component matters: rename()
+// goes through links in the directories on the way.
+String resolveLinks(const String& p) {
+  String res = p;
+  char buf[PATH_MAX];
+  for (int i = 0; i < JSCPP_FS_SYMLINK_HOPS; i++) {
+    ssize_t n = ::readlink(res.str().c_str(), buf, sizeof(buf));
+    // Not a link, or nothing there yet
+    if (n < 0 || (size_t)n >= sizeof(buf)) return res;
+    String link = std::string(buf, (size_t)n);
+    res = path::isAbsolute(link) ? path::normalize(link) : path::join(path::dirname(res), link);
+  }
+  return res;
+}
+
+#endif
+
+std::error_code writeAtomic(const String& p, const uint8_t* buf, size_t size, const WriteFileOptions& options,
+                            const char*& syscall) {
+  syscall = "open";
+  // Writing through a symlink replaces the file it points to, like a
+  // direct write does, rather than the link. An exclusive write fails on
+  // any link, as O_EXCL does.
+  String target = options.flag == WF_EXCLUSIVE ? p : resolveLinks(p);
+#ifdef _WIN32
+  DWORD attr = GetFileAttributesW(target.data());
+  bool exists = attr != INVALID_FILE_ATTRIBUTES;
+  bool isDirectory = exists && (attr & FILE_ATTRIBUTE_DIRECTORY);
+#else
+  struct stat st;
+  bool exists = ::stat(target.str().c_str(), &st) == 0;
+  bool isDirectory = exists && S_ISDIR(st.st_mode);
+#endif
+  if (isDirectory) return internal::errnoCode(EISDIR);
+  if (exists && options.flag == WF_EXCLUSIVE) return internal::errnoCode(EEXIST);
+
+  String temp;
+  int fd = -1;
+  for (int i = 0; fd == -1 && i < JSCPP_FS_TEMP_ATTEMPTS; i++) {
+    temp = tempPath(target);
+    fd = openFile(temp, openFlags(WF_EXCLUSIVE), options.mode);
+    if (fd == -1 && errno != EEXIST) return internal::errnoCode(errno);
+  }
+  if (fd == -1) return internal::errnoCode(EEXIST);
+
+  int err = 0;
+#ifndef _WIN32
+  if (exists && ::fchmod(fd, st.st_mode & 07777) != 0) {
+    syscall = "chmod";
+    err = errno;
+  }
+#endif
+  if (err == 0) {
+    syscall = "write";
+    err = writeAll(fd, buf, size);
+  }
+  if (err == 0) {
+    syscall = "fsync";
+    err = syncData(fd);
+  }
+  int closeErr = closeFile(fd);
+  if (err == 0 && closeErr != 0) {
+    syscall = "close";
+    err = closeErr;
+  }
+
+#ifdef _WIN32
+  std::error_code ec = internal::errnoCode(err);
+  if (err == 0) {
+    syscall = "rename";
+    DWORD flags = MOVEFILE_WRITE_THROUGH | (options.flag == WF_EXCLUSIVE ? 0 : MOVEFILE_REPLACE_EXISTING);
+    ec = MoveFileExW(temp.data(), target.data(), flags) ? std::error_code() : internal::winCode(GetLastError());
+  }
+  if (ec) ::_wunlink(temp.data());
+  return ec;
+#else
+  std::string tempName = temp.str();
+  if (err == 0) {
+    if (options.flag == WF_EXCLUSIVE) {
+      // Unlike rename(), link() fails if someone created the target meanwhile
+      syscall = "link";
+      if (::link(tempName.c_str(), target.str().c_str()) != 0) err = errno;
+    } else {
+      syscall = "rename";
+      if (::rename(tempName.c_str(), target.str().c_str()) != 0) err = errno;
+    }
+  }
+  if (err != 0 || options.flag == WF_EXCLUSIVE) ::unlink(tempName.c_str());
+  if (err != 0) return internal::errnoCode(err);
+
+  // The new name only survives a crash once the directory is flushed too
+  syscall = "fsync";
+  int dfd = ::open(path::dirname(target).str().c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (dfd == -1) return internal::errnoCode(errno);
+  // Some filesystems cannot flush directories, which is nothing to act on
+  err = ::fsync(dfd) == 0 || errno == EINVAL ? 0 : errno;
+  ::close(dfd);
+  return err != 0 ? internal::errnoCode(err) : std::error_code();
+#endif
+}
+
+std::error_code internalWriteFile(const String& p, const uint8_t* buf, size_t size, const WriteFileOptions& options,
+                                  const char*& syscall) {
+  if (options.atomic && options.flag == WF_APPEND) {
+    syscall = "open";
+    return internal::errnoCode(EINVAL);
+  }
+  String target = path::normalize(p);
+  return options.atomic ? writeAtomic(target, buf, size, options, syscall)
+                        : writeDirect(target, buf, size, options, syscall);
+}
+
+void writeOrThrow(const String& p, const uint8_t* buf, size_t size, const WriteFileOptions& options) {
+  const char* syscall;
+  std::error_code ec = internalWriteFile(p, buf, size, options, syscall);
+  if (ec) internal::throwFsError(ec, syscall, p);
+}
+
+WriteFileOptions appendOptions() noexcept {
+  WriteFileOptions options;
+  options.flag = WF_APPEND;
+  return options;
+}
+
+}
+
+void writeFile(const String& p, const std::vector<uint8_t>& buf, const WriteFileOptions& options) {
+  writeOrThrow(p, buf.data(), buf.size(), options);
+}
+
+void writeFile(const String& p, const String& str, const WriteFileOptions& options) {
+  std::string utf8 = str.str();
+  writeOrThrow(p, (const uint8_t*)(utf8.data()), utf8.size(), options);
+}
+
+void writeFile(const String& p, const std::vector<uint8_t>& buf, const WriteFileOptions& options, std::error_code& ec) {
+  const char* syscall;
+  ec = internalWriteFile(p, buf.data(), buf.size(), options, syscall);
+}
+
+void writeFile(const String& p, const String& str, const WriteFileOptions& options, std::error_code& ec) {
+  const char* syscall;
+  std::string utf8 = str.str();
+  ec = internalWriteFile(p, (const uint8_t*)(utf8.data()), utf8.size(), options, syscall);
+}
+
+void writeFile(const String& p, const std::vector<uint8_t>& buf) {
+  fs::writeFile(p, buf, WriteFileOptions());
+}
+
+void writeFile(const String& p, const String& str) {
+  fs::writeFile(p, str, WriteFileOptions());
+}
+
+void writeFile(const String& p, const std::vector<uint8_t>& buf, std::error_code& ec) {
+  fs::writeFile(p, buf, WriteFileOptions(), ec);
+}
+
+void writeFile(const String& p, const String& str, std::error_code& ec) {
+  fs::writeFile(p, str, WriteFileOptions(), ec);
+}
+
+void appendFile(const String& p, const std::vector<uint8_t>& buf) {
+  fs::writeFile(p, buf, appendOptions());
+}
+
+void appendFile(const String& p, const String& str) {
+  fs::writeFile(p, str, appendOptions());
+}
+
+void appendFile(const String& p, const std::vector<uint8_t>& buf, std::error_code& ec) {
+  fs::writeFile(p, buf, appendOptions(), ec);
+}
+
+void appendFile(const String& p, const String& str, std::error_code& ec) {
+  fs::writeFile(p, str, appendOptions(), ec);
+}
+
+}
+}
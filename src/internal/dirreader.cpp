@@ -0,0 +1,181 @@
+#include "dirreader.hpp"
+#include "jscpp/path.hpp"
+#include "fserror.hpp"
+#include <cerrno>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <dirent.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstddef>
+#endif
+#endif
+
+namespace js {
+namespace internal {
+
+namespace {
+
+template <typename CharT>
+bool isDotOrDotDot(const CharT* name) noexcept {
+  return name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+}
+
+#ifdef __linux__
+// The kernel's record layout; glibc only exposes it from 2.30 on.
+struct LinuxDirent64 {
+  uint64_t d_ino;
+  int64_t d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[1];
+};
+#endif
+
+}
+
+#ifdef _WIN32
+
+DirReader::DirReader(const fs::DirHandle& dir, std::error_code& ec): pending_(false) {
+  ec.clear();
+  String pattern = path::win32::join(path::normalize(dir.path()), L"*");
+  find_ = FindFirstFileExW(pattern.data(), FindExInfoBasic, &data_, FindExSearchNameMatch, NULL,
+                           FIND_FIRST_EX_LARGE_FETCH);
+  if (find_ == INVALID_HANDLE_VALUE) {
+    DWORD err = GetLastError();
+    if (err != ERROR_FILE_NOT_FOUND) {
+      ec = winCode(err);
+    }
+  } else {
+    pending_ = true;
+  }
+}
+
+DirReader::~DirReader() {
+  if (find_ != INVALID_HANDLE_VALUE) {
+    FindClose(find_);
+  }
+}
+
+bool DirReader::next(Entry& entry, std::error_code& ec) {
+  ec.clear();
+  for (;;) {
+    if (!pending_) {
+      if (find_ == INVALID_HANDLE_VALUE) return false;
+      if (!FindNextFileW(find_, &data_)) {
+        DWORD err = GetLastError();
+        FindClose(find_);
+        find_ = INVALID_HANDLE_VALUE;
+        if (err != ERROR_NO_MORE_FILES) ec = winCode(err);
+        return false;
+      }
+    }
+    pending_ = false;
+    if (isDotOrDotDot(data_.cFileName)) continue;
+    entry.name = data_.cFileName;
+    entry.length = wcslen(data_.cFileName);
+    if (data_.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) {
+      entry.type = fs::FT_SYMLINK;
+    } else if (data_.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+      entry.type = fs::FT_DIRECTORY;
+    } else {
+      entry.type = fs::FT_FILE;
+    }
+    return true;
+  }
+}
+
+#elif defined(__linux__)
+
+DirReader::DirReader(const fs::DirHandle& dir, std::error_code& ec):
+  fd_(-1), buffer_(new char[JSCPP_FS_DIRENT_BUFFER_SIZE]), pos_(0), end_(0) {
+  ec.clear();
+  // A descriptor of our own, as reading moves the directory offset
+  fd_ = ::openat(dir.fd(), ".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (fd_ == -1) {
+    ec = errnoCode(errno);
+  }
+}
+
+DirReader::~DirReader() {
+  if (fd_ != -1) {
+    ::close(fd_);
+  }
+}
+
+bool DirReader::next(Entry& entry, std::error_code& ec) {
+  ec.clear();
+  for (;;) {
+    if (pos_ >= end_) {
+      if (fd_ == -1) return false;
+      long n = ::syscall(SYS_getdents64, fd_, buffer_.get(), (unsigned int)(JSCPP_FS_DIRENT_BUFFER_SIZE));
+      if (n <= 0) {
+        int err = errno;
+        ::close(fd_);
+        fd_ = -1;
+        if (n < 0) ec = errnoCode(err);
+        return false;
+      }
+      pos_ = 0;
+      end_ = (size_t)n;
+    }
+    const LinuxDirent64* d = reinterpret_cast<const LinuxDirent64*>(buffer_.get() + pos_);
+    pos_ += d->d_reclen;
+    if (isDotOrDotDot(d->d_name)) continue;
+    entry.name = d->d_name;
+    entry.length = strlen(d->d_name);
+    entry.type = fileTypeOf(d->d_type);
+    return true;
+  }
+}
+
+#else
+
+DirReader::DirReader(const fs::DirHandle& dir, std::error_code& ec): dir_(NULL) {
+  ec.clear();
+  // fdopendir owns the descriptor it is given
+  int fd = ::openat(dir.fd(), ".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (fd != -1) {
+    dir_ = ::fdopendir(fd);
+  }
+  if (dir_ == NULL) {
+    int err = errno;
+    if (fd != -1) ::close(fd);
+    ec = errnoCode(err);
+  }
+}
+
+DirReader::~DirReader() {
+  if (dir_ != NULL) {
+    ::closedir(dir_);
+  }
+}
+
+bool DirReader::next(Entry& entry, std::error_code& ec) {
+  ec.clear();
+  for (;;) {
+    if (dir_ == NULL) return false;
+    errno = 0;
+    struct ::dirent* d = ::readdir(dir_);
+    if (d == NULL) {
+      int err = errno;
+      ::closedir(dir_);
+      dir_ = NULL;
+      if (err != 0) ec = errnoCode(err);
+      return false;
+    }
+    if (isDotOrDotDot(d->d_name)) continue;
+    entry.name = d->d_name;
+    entry.length = strlen(d->d_name);
+    entry.type = fileTypeOf(d->d_type);
+    return true;
+  }
+}
+
+#endif
+
+}
+}
@@ -0,0 +1,85 @@
+#ifndef __JSCPP_DIRREADER_HPP__
+#define __JSCPP_DIRREADER_HPP__
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#endif
+
+#include "jscpp/fs.hpp"
+#include <memory>
+#include <system_error>
+
+// Bytes of directory entries fetched per getdents64 call
+#define JSCPP_FS_DIRENT_BUFFER_SIZE 64 * 1024
+
+namespace js {
+namespace internal {
+
+#ifndef _WIN32
+inline fs::FileType fileTypeOf(unsigned char type) noexcept {
+  switch (type) {
+    case DT_REG: return fs::FT_FILE;
+    case DT_DIR: return fs::FT_DIRECTORY;
+    case DT_LNK: return fs::FT_SYMLINK;
+    case DT_FIFO: return fs::FT_FIFO;
+    case DT_SOCK: return fs::FT_SOCKET;
+    case DT_CHR: return fs::FT_CHARACTER_DEVICE;
+    case DT_BLK: return fs::FT_BLOCK_DEVICE;
+    default: return fs::FT_UNKNOWN;
+  }
+}
+#endif
+
+/**
+ * Lists a directory in large batches: getdents64 on Linux, readdir on
+ * other POSIX systems and FindFirstFileExW with large fetches on Windows.
+ * The type comes from the listing and is FT_UNKNOWN where the filesystem
+ * does not record it. "." and ".." are skipped. Failures are reported
+ * through ec, the callers name the operation.
+ */
+class DirReader {
+public:
+#ifdef _WIN32
+  typedef wchar_t char_type;
+#else
+  typedef char char_type;
+#endif
+
+  // name points into the reader's buffer and is valid until the next call.
+  struct Entry {
+    const char_type* name;
+    size_t length;
+    fs::FileType type;
+  };
+
+  DirReader(const fs::DirHandle& dir, std::error_code& ec);
+  ~DirReader();
+
+  DirReader(const DirReader&) = delete;
+  DirReader& operator=(const DirReader&) = delete;
+
+  // Returns false at the end of the directory or on failure.
+  bool next(Entry& entry, std::error_code& ec);
+
+private:
+#ifdef _WIN32
+  HANDLE find_;
+  WIN32_FIND_DATAW data_;
+  bool pending_;
+#elif defined(__linux__)
+  int fd_;
+  std::unique_ptr<char[]> buffer_;
+  size_t pos_;
+  size_t end_;
+#else
+  DIR* dir_;
+#endif
+};
+
+}
+}
+
+#endif
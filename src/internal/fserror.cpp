@@ -0,0 +1,117 @@
+#include "fserror.hpp"
+#include "winerr.hpp"
+#include "jscpp/Error.hpp"
+#include <cerrno>
+#include <cstring>
+
+namespace js {
+namespace internal {
+
+String describe(const std::error_code& ec) {
+#ifdef _WIN32
+  if (ec.category() == std::system_category()) {
+    return getWinErrorMessage((unsigned long)ec.value());
+  }
+#endif
+  return String(strerror(ec.value()));
+}
+
+#define JSCPP_ERRNO_NAME(e) case e: return #e;
+
+const char* errnoName(int err) noexcept {
+  switch (err) {
+    JSCPP_ERRNO_NAME(E2BIG)
+    JSCPP_ERRNO_NAME(EACCES)
+    JSCPP_ERRNO_NAME(EADDRINUSE)
+    JSCPP_ERRNO_NAME(EADDRNOTAVAIL)
+    JSCPP_ERRNO_NAME(EAFNOSUPPORT)
+    JSCPP_ERRNO_NAME(EAGAIN)
+    JSCPP_ERRNO_NAME(EALREADY)
+    JSCPP_ERRNO_NAME(EBADF)
+    JSCPP_ERRNO_NAME(EBUSY)
+    JSCPP_ERRNO_NAME(ECANCELED)
+    JSCPP_ERRNO_NAME(ECHILD)
+    JSCPP_ERRNO_NAME(ECONNABORTED)
+    JSCPP_ERRNO_NAME(ECONNREFUSED)
+    JSCPP_ERRNO_NAME(ECONNRESET)
+    JSCPP_ERRNO_NAME(EDEADLK)
+    JSCPP_ERRNO_NAME(EDOM)
+    JSCPP_ERRNO_NAME(EEXIST)
+    JSCPP_ERRNO_NAME(EFAULT)
+    JSCPP_ERRNO_NAME(EFBIG)
+    JSCPP_ERRNO_NAME(EHOSTUNREACH)
+    JSCPP_ERRNO_NAME(EINPROGRESS)
+    JSCPP_ERRNO_NAME(EINTR)
+    JSCPP_ERRNO_NAME(EINVAL)
+    JSCPP_ERRNO_NAME(EIO)
+    JSCPP_ERRNO_NAME(EISCONN)
+    JSCPP_ERRNO_NAME(EISDIR)
+    JSCPP_ERRNO_NAME(ELOOP)
+    JSCPP_ERRNO_NAME(EMFILE)
+    JSCPP_ERRNO_NAME(EMLINK)
+    JSCPP_ERRNO_NAME(EMSGSIZE)
+    JSCPP_ERRNO_NAME(ENAMETOOLONG)
+    JSCPP_ERRNO_NAME(ENETDOWN)
+    JSCPP_ERRNO_NAME(ENETUNREACH)
+    JSCPP_ERRNO_NAME(ENFILE)
+    JSCPP_ERRNO_NAME(ENOBUFS)
+    JSCPP_ERRNO_NAME(ENODEV)
+    JSCPP_ERRNO_NAME(ENOENT)
+    JSCPP_ERRNO_NAME(ENOEXEC)
+    JSCPP_ERRNO_NAME(ENOMEM)
+    JSCPP_ERRNO_NAME(ENOSPC)
+    JSCPP_ERRNO_NAME(ENOSYS)
+    JSCPP_ERRNO_NAME(ENOTCONN)
+    JSCPP_ERRNO_NAME(ENOTDIR)
+    JSCPP_ERRNO_NAME(ENOTEMPTY)
+    JSCPP_ERRNO_NAME(ENOTSOCK)
+    JSCPP_ERRNO_NAME(ENOTSUP)
+    JSCPP_ERRNO_NAME(ENOTTY)
+    JSCPP_ERRNO_NAME(ENXIO)
+    JSCPP_ERRNO_NAME(EPERM)
+    JSCPP_ERRNO_NAME(EPIPE)
+    JSCPP_ERRNO_NAME(ERANGE)
+    JSCPP_ERRNO_NAME(EROFS)
+    JSCPP_ERRNO_NAME(ESPIPE)
+    JSCPP_ERRNO_NAME(ESRCH)
+    JSCPP_ERRNO_NAME(ETIMEDOUT)
+    JSCPP_ERRNO_NAME(ETXTBSY)
+    JSCPP_ERRNO_NAME(EXDEV)
+#ifdef EDQUOT
+    JSCPP_ERRNO_NAME(EDQUOT)
+#endif
+#ifdef ESTALE
+    JSCPP_ERRNO_NAME(ESTALE)
+#endif
+    default: return "UNKNOWN";
+  }
+}
+
+#undef JSCPP_ERRNO_NAME
+
+String formatFsError(const std::error_code& ec, const char* syscall, const String& path, const String& dest) {
+  String message = describe(ec) + L", " + String(syscall);
+  if (path.length() != 0) {
+    message += L" \"" + path + L"\"";
+  }
+  if (dest.length() != 0) {
+    message += L" -> \"" + dest + L"\"";
+  }
+  return message;
+}
+
+JSCPP_NORETURN void throwFsError(const std::error_code& ec, const char* syscall, const String& path) {
+  throwFsError(ec, syscall, path, String());
+}
+
+JSCPP_NORETURN void throwFsError(const std::error_code& ec, const char* syscall, const String& path,
+                                 const String& dest) {
+#if JSCPP_USE_ERROR
+  throw SystemError(ec, syscall, path, dest);
+#else
+  throwError(formatFsError(ec, syscall, path, dest));
+#endif
+}
+
+}
+}
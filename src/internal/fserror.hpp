@@ -0,0 +1,41 @@
+#ifndef __JSCPP_FSERROR_HPP__
+#define __JSCPP_FSERROR_HPP__
+
+#include "jscpp/String.hpp"
+#include "throw.hpp"
+#include <system_error>
+
+namespace js {
+namespace internal {
+
+inline std::error_code errnoCode(int err) noexcept {
+  return std::error_code(err, std::generic_category());
+}
+
+#ifdef _WIN32
+// GetLastError() values
+inline std::error_code winCode(unsigned long err) noexcept {
+  return std::error_code((int)err, std::system_category());
+}
+#endif
+
+// strerror() text, or FormatMessage() text for Windows error codes
+String describe(const std::error_code& ec);
+
+// "ENOENT" and so on, "UNKNOWN" for anything else
+const char* errnoName(int err) noexcept;
+
+// The message every fs error carries:
+// <description>, <syscall>[ "<path>"][ -> "<dest>"]
+String formatFsError(const std::error_code& ec, const char* syscall, const String& path,
+                     const String& dest = String());
+
+// Throws a SystemError, or prints the message and aborts without exceptions
+JSCPP_NORETURN void throwFsError(const std::error_code& ec, const char* syscall, const String& path);
+JSCPP_NORETURN void throwFsError(const std::error_code& ec, const char* syscall, const String& path,
+                                 const String& dest);
+
+}
+}
+
+#endif
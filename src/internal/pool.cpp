@@ -0,0 +1,254 @@
+#include "pool.hpp"
+
+namespace js {
+namespace internal {
+
+namespace {
+
+thread_local WorkStealingPool* currentPool = nullptr;
+thread_local size_t currentIndex = 0;
+thread_local WorkQueue* currentQueue = nullptr;
+
+}
+
+WorkStealingPool::WorkStealingPool(unsigned threads): queued_(0), pending_(0), stop_(false) {
+  // The last queue belongs to whichever thread calls wait()
+  for (unsigned i = 0; i <= threads; i++) {
+    queues_.emplace_back(new Queue());
+  }
+  for (unsigned i = 0; i < threads; i++) {
+    threads_.emplace_back(&WorkStealingPool::run, this, (size_t)i);
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  for (size_t i = 0; i < threads_.size(); i++) {
+    threads_[i].join();
+  }
+}
+
+unsigned WorkStealingPool::threadsFor(unsigned concurrency) noexcept {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  (void)concurrency;
+  return 0;
+#else
+  if (concurrency == 0) {
+    concurrency = std::thread::hardware_concurrency();
+    if (concurrency == 0) concurrency = 1;
+  }
+  return concurrency - 1;
+#endif
+}
+
+void WorkStealingPool::submit(Task task) {
+  size_t index = currentPool == this ? currentIndex : queues_.size() - 1;
+  pending_++;
+  queued_++;
+  {
+    Queue& queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(std::move(task));
+  }
+  // Taking the lock orders this against a worker about to sleep
+  { std::lock_guard<std::mutex> lock(mutex_); }
+  cv_.notify_one();
+}
+
+bool WorkStealingPool::pop(size_t self, Task& task) {
+  {
+    Queue& own = *queues_[self];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      queued_--;
+      return true;
+    }
+  }
+  for (size_t i = 1; i < queues_.size(); i++) {
+    Queue& victim = *queues_[(self + i) % queues_.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      queued_--;
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingPool::run(size_t self) {
+  work(self, false);
+}
+
+void WorkStealingPool::wait() {
+  work(queues_.size() - 1, true);
+}
+
+void WorkStealingPool::work(size_t self, bool caller) {
+  WorkStealingPool* previousPool = currentPool;
+  size_t previousIndex = currentIndex;
+  currentPool = this;
+  currentIndex = self;
+  for (;;) {
+    Task task;
+    if (pop(self, task)) {
+      task();
+      task = nullptr;
+      if (--pending_ == 0) {
+        { std::lock_guard<std::mutex> lock(mutex_); }
+        cv_.notify_all();
+      }
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (caller ? pending_ == 0 : stop_) break;
+    cv_.wait(lock, [&]() {
+      return queued_ > 0 || (caller ? pending_ == 0 : stop_);
+    });
+  }
+  currentPool = previousPool;
+  currentIndex = previousIndex;
+}
+
+WorkQueue::WorkQueue(unsigned threads, size_t maxQueued): maxQueued_(maxQueued), stop_(false) {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  threads = 0;
+#endif
+  for (unsigned i = 0; i < threads; i++) {
+    threads_.emplace_back(&WorkQueue::run, this);
+  }
+}
+
+WorkQueue::~WorkQueue() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  notEmpty_.notify_all();
+  notFull_.notify_all();
+  for (size_t i = 0; i < threads_.size(); i++) {
+    threads_[i].join();
+  }
+}
+
+unsigned WorkQueue::size() const noexcept {
+  return (unsigned)threads_.size();
+}
+
+void WorkQueue::submit(Task task) {
+  if (threads_.empty()) {
+    task();
+    return;
+  }
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (maxQueued_ != 0 && currentQueue != this) {
+      notFull_.wait(lock, [&]() { return tasks_.size() < maxQueued_ || stop_; });
+    }
+    tasks_.push_back(std::move(task));
+  }
+  notEmpty_.notify_one();
+}
+
+void WorkQueue::run() {
+  currentQueue = this;
+  for (;;) {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      notEmpty_.wait(lock, [&]() { return !tasks_.empty() || stop_; });
+      if (tasks_.empty()) break;
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    notFull_.notify_one();
+    task();
+  }
+  currentQueue = nullptr;
+}
+
+void ErrorList::add(const std::error_code& ec, const char* syscall, const String& path, const String& dest) {
+  Failure failure;
+  failure.code = ec;
+  failure.syscall = syscall;
+  failure.path = path;
+  failure.dest = dest;
+  std::lock_guard<std::mutex> lock(mutex_);
+  failures_.push_back(std::move(failure));
+}
+
+void ErrorList::add(const std::error_code& ec, const String& message) {
+  add(ec, nullptr, message);
+}
+
+void ErrorList::add(std::exception_ptr e) {
+  Failure failure;
+  failure.syscall = nullptr;
+  failure.exception = e;
+  std::lock_guard<std::mutex> lock(mutex_);
+  failures_.push_back(std::move(failure));
+}
+
+bool ErrorList::empty() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return failures_.empty();
+}
+
+String ErrorList::describe(const Failure& failure) const {
+  if (failure.exception) {
+    try {
+      std::rethrow_exception(failure.exception);
+    } catch (const std::exception& e) {
+      return e.what();
+    } catch (...) {
+      return L"Unknown error";
+    }
+  }
+  if (failure.syscall == nullptr) {
+    return failure.path;
+  }
+  return formatFsError(failure.code, failure.syscall, failure.path, failure.dest);
+}
+
+void ErrorList::throwIfAny() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (failures_.empty()) return;
+  if (failures_.size() == 1) {
+    const Failure& failure = failures_[0];
+    if (failure.exception) std::rethrow_exception(failure.exception);
+    if (failure.syscall == nullptr) throwError(failure.path);
+    throwFsError(failure.code, failure.syscall, failure.path, failure.dest);
+  }
+  String message = describe(failures_[0]);
+  size_t shown = failures_.size() < JSCPP_POOL_ERRORS_SHOWN ? failures_.size() : JSCPP_POOL_ERRORS_SHOWN;
+  for (size_t i = 1; i < shown; i++) {
+    message += L"\n" + describe(failures_[i]);
+  }
+  if (shown < failures_.size()) {
+    message += L"\n... and " + String((unsigned long)(failures_.size() - shown)) + L" more errors";
+  }
+  throwError(message);
+}
+
+void ErrorList::report(std::error_code& ec) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ec.clear();
+  for (size_t i = 0; i < failures_.size(); i++) {
+    if (failures_[i].exception) {
+      std::rethrow_exception(failures_[i].exception);
+    }
+  }
+  if (!failures_.empty()) {
+    ec = failures_[0].code;
+  }
+}
+
+}
+}
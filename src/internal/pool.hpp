@@ -0,0 +1,140 @@
+#ifndef __JSCPP_POOL_HPP__
+#define __JSCPP_POOL_HPP__
+
+#include "jscpp/String.hpp"
+#include "fserror.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Tree operations list at most this many of their collected errors
+#define JSCPP_POOL_ERRORS_SHOWN 8
+
+namespace js {
+namespace internal {
+
+/**
+ * Fixed-size pool where every thread owns a deque. Tasks submitted from a
+ * pool thread go to the back of its own deque and are taken LIFO, so a
+ * directory walk stays depth first per thread; idle threads steal from the
+ * front of the others. The thread calling wait() takes part as one more
+ * worker, so a pool of 0 threads runs everything on the caller.
+ *
+ * Tasks must not throw.
+ */
+class WorkStealingPool {
+public:
+  typedef std::function<void()> Task;
+
+  explicit WorkStealingPool(unsigned threads);
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  void submit(Task task);
+  // Runs tasks until every submitted one, including those they submit, is done.
+  void wait();
+
+  // Threads to use for a requested concurrency, 0 meaning one per core.
+  static unsigned threadsFor(unsigned concurrency) noexcept;
+
+private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  bool pop(size_t self, Task& task);
+  void run(size_t self);
+  void work(size_t self, bool caller);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::atomic<long> queued_;
+  std::atomic<long> pending_;
+  bool stop_;
+};
+
+/**
+ * Long-lived pool behind the asynchronous fs calls, like libuv's: a fixed
+ * set of threads taking tasks in order from one queue. submit() blocks
+ * while maxQueued tasks are waiting, except on the pool's own threads,
+ * which could otherwise end up waiting for themselves. A pool of 0
+ * threads runs every task inside submit().
+ *
+ * Tasks must not throw.
+ */
+class WorkQueue {
+public:
+  typedef std::function<void()> Task;
+
+  // maxQueued 0 means unbounded
+  WorkQueue(unsigned threads, size_t maxQueued);
+  // Lets the threads finish what is queued, then joins them
+  ~WorkQueue();
+
+  WorkQueue(const WorkQueue&) = delete;
+  WorkQueue& operator=(const WorkQueue&) = delete;
+
+  void submit(Task task);
+  unsigned size() const noexcept;
+
+private:
+  void run();
+
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable notEmpty_;
+  std::condition_variable notFull_;
+  std::deque<Task> tasks_;
+  size_t maxQueued_;
+  bool stop_;
+};
+
+// Collects failures from pool tasks so a tree operation can finish
+// everything it can and report all problems once at the end. Messages are
+// only put together if the list is thrown. A single failure is thrown as
+// it is, as a SystemError or whatever a callback threw; several are
+// summed up in one Error.
+class ErrorList {
+public:
+  void add(const std::error_code& ec, const char* syscall, const String& path, const String& dest = String());
+  // A failure with a message of its own
+  void add(const std::error_code& ec, const String& message);
+  // Anything else a task threw, such as an exception from a user callback
+  void add(std::exception_ptr e);
+
+  bool empty() const noexcept;
+  void throwIfAny() const;
+  // For the error_code overloads: the first failure's code. Exceptions
+  // that were not filesystem errors are rethrown instead.
+  void report(std::error_code& ec) const;
+
+private:
+  struct Failure {
+    std::error_code code;
+    const char* syscall;
+    String path;
+    String dest;
+    std::exception_ptr exception;
+  };
+
+  String describe(const Failure& failure) const;
+
+  mutable std::mutex mutex_;
+  std::vector<Failure> failures_;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,900 @@
+#include "./regexp.hpp"
+#include "./throw.hpp"
+#include "./transcode.hpp"
+#include "./whitespace.hpp"
+#include "./search.hpp"
+#include "./unicode.hpp"
+
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+// Whether std::wregex needs a transcoded copy of the subject
+#if JSCPP_STRING_UTF8 || (JSCPP_STRING_UTF16 && !defined(_WIN32))
+#define JSCPP_REGEXP_WIDEN 1
+#else
+#define JSCPP_REGEXP_WIDEN 0
+#endif
+
+namespace js {
+namespace internal {
+
+namespace {
+
+// Upper bound on instructions after expanding counted repetition. Larger
+// patterns go to std::wregex instead.
+const size_t MAX_PROGRAM = 20000;
+
+const int INFINITE = -1;
+
+bool isLineTerminator(uint32_t c) noexcept {
+  return c == 0x0A || c == 0x0D || c == 0x2028 || c == 0x2029;
+}
+
+bool isDigit(uint32_t c) noexcept {
+  return c >= '0' && c <= '9';
+}
+
+bool isWordChar(uint32_t c) noexcept {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || isDigit(c) || c == '_';
+}
+
+// Canonicalize() of the ignoreCase semantics: the simple uppercase, except
+// that non-ASCII characters never fold onto ASCII ones.
+uint32_t canonicalize(uint32_t c) noexcept {
+  uint32_t u = unicode::simpleUpper(c);
+  return c >= 0x80 && u < 0x80 ? c : u;
+}
+
+// Code point at s[i] and the number of units it occupies. Only UTF-8
+// storage decodes; otherwise every code unit is a character, as in JS.
+uint32_t charAt(const String::value_type* s, size_t len, size_t i, size_t& n) noexcept {
+#if JSCPP_STRING_UTF8
+  const uint8_t* p = (const uint8_t*)s;
+  uint32_t b = p[i];
+  n = 1;
+  if (b < 0x80) return b;
+  size_t need = (b >= 0xC2 && b <= 0xDF) ? 1 : (b >= 0xE0 && b <= 0xEF) ? 2 : (b >= 0xF0 && b <= 0xF4) ? 3 : 0;
+  if (need == 0 || i + need >= len) return REPLACEMENT_CHARACTER;
+  uint32_t c = b & (0x3F >> need);
+  for (size_t k = 1; k <= need; k++) {
+    if ((p[i + k] & 0xC0) != 0x80) return REPLACEMENT_CHARACTER;
+    c = (c << 6) | (p[i + k] & 0x3F);
+  }
+  n = need + 1;
+  return c;
+#else
+  (void)len;
+  n = 1;
+  return codeUnit(s[i]);
+#endif
+}
+
+bool lineTerminatorBefore(const String::value_type* s, size_t pos) noexcept {
+  uint32_t c = codeUnit(s[pos - 1]);
+#if JSCPP_STRING_UTF8
+  if (c == 0xA8 || c == 0xA9) {
+    return pos >= 3 && (uint8_t)s[pos - 3] == 0xE2 && (uint8_t)s[pos - 2] == 0x80;
+  }
+#endif
+  return isLineTerminator(c);
+}
+
+bool inClass(const RegExpClass& cls, uint32_t c) noexcept {
+  for (const auto& r : cls.ranges) {
+    if (c >= r.first && c <= r.second) return true;
+  }
+  unsigned sets = cls.sets;
+  if (sets == 0) return false;
+  if ((sets & RegExpClass::DIGIT) && isDigit(c)) return true;
+  if ((sets & RegExpClass::NOT_DIGIT) && !isDigit(c)) return true;
+  if ((sets & RegExpClass::WORD) && isWordChar(c)) return true;
+  if ((sets & RegExpClass::NOT_WORD) && !isWordChar(c)) return true;
+  if ((sets & RegExpClass::SPACE) && isWhiteSpace(c)) return true;
+  if ((sets & RegExpClass::NOT_SPACE) && !isWhiteSpace(c)) return true;
+  return false;
+}
+
+bool matchClass(const RegExpClass& cls, uint32_t c, bool ignoreCase) noexcept {
+  bool in = inClass(cls, c) ||
+    (ignoreCase && (inClass(cls, unicode::simpleLower(c)) || inClass(cls, canonicalize(c))));
+  return in != cls.negate;
+}
+
+struct Node {
+  enum Type {
+    EMPTY, CHAR, ANY, CLASS, CAT, ALT, GROUP, REPEAT, BOL, EOL, WORD_BOUNDARY, NOT_WORD_BOUNDARY
+  };
+  Type type;
+  uint32_t c;
+  int index;
+  int min;
+  int max;
+  bool greedy;
+  std::vector<Node> children;
+
+  explicit Node(Type t = EMPTY): type(t), c(0), index(0), min(0), max(0), greedy(true) {}
+};
+
+// Recursive descent over the ECMAScript pattern grammar. Returns false for
+// anything the Pike VM cannot run (backreferences, lookaround, named groups)
+// and for syntax errors, both of which are left to std::wregex.
+class Parser {
+public:
+  Parser(const std::vector<uint32_t>& p, std::vector<RegExpClass>& classes):
+    groups(0), _p(p), _i(0), _classes(classes) {}
+
+  bool parse(Node& out) {
+    if (!_alternative(out, 0)) return false;
+    return _i == _p.size();
+  }
+
+  size_t groups;
+
+private:
+  const std::vector<uint32_t>& _p;
+  size_t _i;
+  std::vector<RegExpClass>& _classes;
+
+  bool _more() const { return _i < _p.size(); }
+  uint32_t _peek(size_t k = 0) const { return _i + k < _p.size() ? _p[_i + k] : 0; }
+  bool _eat(uint32_t c) {
+    if (_more() && _p[_i] == c) { _i++; return true; }
+    return false;
+  }
+
+  bool _alternative(Node& out, int depth) {
+    if (depth > 256) return false;
+    Node alt(Node::ALT);
+    do {
+      Node cat(Node::CAT);
+      while (_more() && _peek() != '|' && _peek() != ')') {
+        Node term;
+        if (!_term(term, depth)) return false;
+        cat.children.push_back(std::move(term));
+      }
+      alt.children.push_back(std::move(cat));
+    } while (_eat('|'));
+    if (alt.children.size() == 1) {
+      out = std::move(alt.children[0]);
+    } else {
+      out = std::move(alt);
+    }
+    return true;
+  }
+
+  bool _term(Node& out, int depth) {
+    Node atom;
+    bool quantifiable = true;
+    if (!_atom(atom, depth, quantifiable)) return false;
+    int min;
+    int max;
+    uint32_t q = _peek();
+    if (q == '*') { _i++; min = 0; max = INFINITE; }
+    else if (q == '+') { _i++; min = 1; max = INFINITE; }
+    else if (q == '?') { _i++; min = 0; max = 1; }
+    else if (q == '{' && _braces(min, max)) {}
+    else {
+      out = std::move(atom);
+      return true;
+    }
+    if (!quantifiable) return false;
+    if (max != INFINITE && min > max) return false;
+    Node rep(Node::REPEAT);
+    rep.min = min;
+    rep.max = max;
+    rep.greedy = !_eat('?');
+    rep.children.push_back(std::move(atom));
+    out = std::move(rep);
+    return true;
+  }
+
+  // {n}, {n,} or {n,m}; leaves the input alone when it is a literal brace
+  bool _braces(int& min, int& max) {
+    size_t save = _i;
+    _i++;
+    long n = 0;
+    size_t digits = 0;
+    while (_more() && isDigit(_peek())) {
+      n = std::min(n * 10 + (long)(_peek() - '0'), 100000L);
+      _i++;
+      digits++;
+    }
+    if (digits == 0) { _i = save; return false; }
+    min = (int)n;
+    max = (int)n;
+    if (_eat(',')) {
+      max = INFINITE;
+      if (_more() && isDigit(_peek())) {
+        n = 0;
+        while (_more() && isDigit(_peek())) {
+          n = std::min(n * 10 + (long)(_peek() - '0'), 100000L);
+          _i++;
+        }
+        max = (int)n;
+      }
+    }
+    if (!_eat('}')) { _i = save; return false; }
+    return true;
+  }
+
+  bool _atom(Node& out, int depth, bool& quantifiable) {
+    uint32_t c = _p[_i++];
+    switch (c) {
+      case '(': {
+        Node group(Node::GROUP);
+        if (_eat('?')) {
+          if (!_eat(':')) return false;
+          group.index = -1;
+        } else {
+          group.index = (int)++groups;
+        }
+        Node sub;
+        if (!_alternative(sub, depth + 1) || !_eat(')')) return false;
+        group.children.push_back(std::move(sub));
+        out = std::move(group);
+        return true;
+      }
+      case ')': case '*': case '+': case '?':
+        return false;
+      case '[':
+        return _class(out);
+      case '.':
+        out = Node(Node::ANY);
+        return true;
+      case '^':
+        out = Node(Node::BOL);
+        quantifiable = false;
+        return true;
+      case '$':
+        out = Node(Node::EOL);
+        quantifiable = false;
+        return true;
+      case '\\': {
+        if (!_more()) return false;
+        uint32_t e = _p[_i];
+        if (e == 'b' || e == 'B') {
+          _i++;
+          out = Node(e == 'b' ? Node::WORD_BOUNDARY : Node::NOT_WORD_BOUNDARY);
+          quantifiable = false;
+          return true;
+        }
+        unsigned sets = 0;
+        uint32_t ch = 0;
+        if (!_escape(sets, ch, false)) return false;
+        if (sets != 0) {
+          out = _setNode(sets);
+        } else {
+          out = Node(Node::CHAR);
+          out.c = ch;
+        }
+        return true;
+      }
+      default:
+        out = Node(Node::CHAR);
+        out.c = c;
+        return true;
+    }
+  }
+
+  Node _setNode(unsigned sets) {
+    RegExpClass cls;
+    cls.sets = sets;
+    cls.negate = false;
+    _classes.push_back(std::move(cls));
+    Node node(Node::CLASS);
+    node.index = (int)_classes.size() - 1;
+    return node;
+  }
+
+  int _hex(size_t count) {
+    int v = 0;
+    for (size_t k = 0; k < count; k++) {
+      uint32_t h = _peek(k);
+      int d;
+      if (h >= '0' && h <= '9') d = (int)(h - '0');
+      else if (h >= 'a' && h <= 'f') d = (int)(h - 'a' + 10);
+      else if (h >= 'A' && h <= 'F') d = (int)(h - 'A' + 10);
+      else return -1;
+      v = v * 16 + d;
+    }
+    _i += count;
+    return v;
+  }
+
+  // After a backslash. Character class escapes come back in sets.
+  bool _escape(unsigned& sets, uint32_t& ch, bool inClass) {
+    uint32_t e = _p[_i++];
+    switch (e) {
+      case 'd': sets = RegExpClass::DIGIT; return true;
+      case 'D': sets = RegExpClass::NOT_DIGIT; return true;
+      case 'w': sets = RegExpClass::WORD; return true;
+      case 'W': sets = RegExpClass::NOT_WORD; return true;
+      case 's': sets = RegExpClass::SPACE; return true;
+      case 'S': sets = RegExpClass::NOT_SPACE; return true;
+      case 'n': ch = 0x0A; return true;
+      case 'r': ch = 0x0D; return true;
+      case 't': ch = 0x09; return true;
+      case 'v': ch = 0x0B; return true;
+      case 'f': ch = 0x0C; return true;
+      case 'b': ch = 0x08; return inClass;
+      case '0':
+        if (isDigit(_peek())) return false;
+        ch = 0;
+        return true;
+      case 'x': {
+        int v = _hex(2);
+        ch = v < 0 ? 'x' : (uint32_t)v;
+        return true;
+      }
+      case 'u': {
+        int v = _hex(4);
+        ch = v < 0 ? 'u' : (uint32_t)v;
+        return true;
+      }
+      case 'c': {
+        uint32_t l = _peek();
+        if ((l >= 'a' && l <= 'z') || (l >= 'A' && l <= 'Z')) {
+          _i++;
+          ch = l % 32;
+        } else {
+          _i--;
+          ch = '\\';
+        }
+        return true;
+      }
+      default:
+        // Backreferences
+        if (e >= '1' && e <= '9') return false;
+        ch = e;
+        return true;
+    }
+  }
+
+  bool _class(Node& out) {
+    RegExpClass cls;
+    cls.sets = 0;
+    cls.negate = _eat('^');
+    while (true) {
+      if (!_more()) return false;
+      if (_eat(']')) break;
+      unsigned sets = 0;
+      uint32_t lo = 0;
+      if (!_classAtom(sets, lo)) return false;
+      if (sets == 0 && _peek() == '-' && _peek(1) != ']' && _i + 1 < _p.size()) {
+        _i++;
+        unsigned hiSets = 0;
+        uint32_t hi = 0;
+        if (!_classAtom(hiSets, hi)) return false;
+        if (hiSets != 0) {
+          // [a-\d] is a literal '-' between the two
+          cls.ranges.push_back(std::make_pair(lo, lo));
+          cls.ranges.push_back(std::make_pair((uint32_t)'-', (uint32_t)'-'));
+          cls.sets |= hiSets;
+          continue;
+        }
+        if (lo > hi) return false;
+        cls.ranges.push_back(std::make_pair(lo, hi));
+        continue;
+      }
+      if (sets != 0) {
+        cls.sets |= sets;
+      } else {
+        cls.ranges.push_back(std::make_pair(lo, lo));
+      }
+    }
+    _classes.push_back(std::move(cls));
+    out = Node(Node::CLASS);
+    out.index = (int)_classes.size() - 1;
+    return true;
+  }
+
+  bool _classAtom(unsigned& sets, uint32_t& ch) {
+    uint32_t c = _p[_i++];
+    if (c != '\\') {
+      ch = c;
+      return true;
+    }
+    if (!_more()) return false;
+    if (_peek() == 'B') return false;
+    return _escape(sets, ch, true);
+  }
+};
+
+class Compiler {
+public:
+  Compiler(std::vector<RegExpInst>& program, bool ignoreCase): _prog(program), _ignoreCase(ignoreCase) {}
+
+  bool compile(const Node& node) {
+    switch (node.type) {
+      case Node::EMPTY:
+        return true;
+      case Node::CHAR:
+        return _char(node.c);
+      case Node::ANY:
+        return _emit(RegExpInst::ANY);
+      case Node::CLASS:
+        return _emit(RegExpInst::CLASS, 0, node.index);
+      case Node::BOL:
+        return _emit(RegExpInst::BOL);
+      case Node::EOL:
+        return _emit(RegExpInst::EOL);
+      case Node::WORD_BOUNDARY:
+        return _emit(RegExpInst::WORD_BOUNDARY);
+      case Node::NOT_WORD_BOUNDARY:
+        return _emit(RegExpInst::NOT_WORD_BOUNDARY);
+      case Node::CAT:
+        for (const Node& child : node.children) {
+          if (!compile(child)) return false;
+        }
+        return true;
+      case Node::ALT: {
+        std::vector<size_t> jumps;
+        for (size_t k = 0; k < node.children.size(); k++) {
+          size_t split = _prog.size();
+          bool last = k + 1 == node.children.size();
+          if (!last && !_emit(RegExpInst::SPLIT)) return false;
+          if (!compile(node.children[k])) return false;
+          if (!last) {
+            jumps.push_back(_prog.size());
+            if (!_emit(RegExpInst::JMP)) return false;
+            _prog[split].x = (int)split + 1;
+            _prog[split].y = (int)_prog.size();
+          }
+        }
+        for (size_t j : jumps) _prog[j].x = (int)_prog.size();
+        return true;
+      }
+      case Node::GROUP:
+        if (node.index < 0) return compile(node.children[0]);
+        return _emit(RegExpInst::SAVE, 0, node.index * 2) &&
+          compile(node.children[0]) &&
+          _emit(RegExpInst::SAVE, 0, node.index * 2 + 1);
+      case Node::REPEAT:
+        return _repeat(node);
+    }
+    return false;
+  }
+
+private:
+  std::vector<RegExpInst>& _prog;
+  bool _ignoreCase;
+
+  bool _emit(RegExpInst::Op op, uint32_t c = 0, int x = 0, int y = 0) {
+    if (_prog.size() >= MAX_PROGRAM) return false;
+    RegExpInst inst = { op, c, x, y };
+    _prog.push_back(inst);
+    return true;
+  }
+
+  bool _char(uint32_t c) {
+    if (_ignoreCase) c = canonicalize(c);
+    if (sizeof(String::value_type) == 2 && c > 0xFFFF) {
+      c -= 0x10000;
+      return _emit(RegExpInst::CHAR, 0xD800 + (c >> 10)) && _emit(RegExpInst::CHAR, 0xDC00 + (c & 0x3FF));
+    }
+    return _emit(RegExpInst::CHAR, c);
+  }
+
+  void _split(size_t at, int body, int out, bool greedy) {
+    _prog[at].x = greedy ? body : out;
+    _prog[at].y = greedy ? out : body;
+  }
+
+  // Widens [first, last] to the capture groups inside node
+  static void _groups(const Node& node, int& first, int& last) {
+    if (node.type == Node::GROUP && node.index >= 0) {
+      if (first < 0 || node.index < first) first = node.index;
+      if (node.index > last) last = node.index;
+    }
+    for (const Node& child : node.children) _groups(child, first, last);
+  }
+
+  // Every iteration starts with the captures inside the body undefined, as
+  // in ECMAScript, so /((a)|b)+/ on "ab" leaves group 2 undefined
+  bool _iteration(const Node& body, int first, int last) {
+    if (first >= 0 && !_emit(RegExpInst::RESET, 0, first * 2, last * 2 + 2)) return false;
+    return compile(body);
+  }
+
+  bool _repeat(const Node& node) {
+    const Node& body = node.children[0];
+    int first = -1, last = -1;
+    _groups(body, first, last);
+    for (int k = 0; k < node.min; k++) {
+      if (!_iteration(body, first, last)) return false;
+    }
+    if (node.max == INFINITE) {
+      size_t split = _prog.size();
+      if (!_emit(RegExpInst::SPLIT) || !_iteration(body, first, last) || !_emit(RegExpInst::JMP, 0, (int)split)) {
+        return false;
+      }
+      _split(split, (int)split + 1, (int)_prog.size(), node.greedy);
+      return true;
+    }
+    std::vector<size_t> splits;
+    for (int k = node.min; k < node.max; k++) {
+      splits.push_back(_prog.size());
+      if (!_emit(RegExpInst::SPLIT) || !_iteration(body, first, last)) return false;
+    }
+    for (size_t s : splits) _split(s, (int)s + 1, (int)_prog.size(), node.greedy);
+    return true;
+  }
+};
+
+struct ThreadList {
+  std::vector<int> dense;
+  std::vector<int> sparse;
+  std::vector<size_t> caps;
+  size_t size;
+  size_t ncap;
+
+  ThreadList(size_t n, size_t ncap): dense(n), sparse(n), caps(n * ncap), size(0), ncap(ncap) {}
+
+  bool contains(int pc) const noexcept {
+    size_t k = (size_t)sparse[pc];
+    return k < size && dense[k] == pc;
+  }
+  void add(int pc) noexcept {
+    sparse[pc] = (int)size;
+    dense[size++] = pc;
+  }
+  size_t* slot(int pc) noexcept { return &caps[(size_t)pc * ncap]; }
+};
+
+struct Frame {
+  int pc;
+  int slot;
+  size_t value;
+};
+
+}
+
+RegExpSubject::RegExpSubject(const String& str) noexcept: _str(str), _widened(false) {}
+
+void RegExpSubject::_widen() {
+  if (_widened) return;
+  _widened = true;
+#if JSCPP_REGEXP_WIDEN
+  const String::value_type* s = data();
+  size_t len = length();
+  _wide.reserve(len);
+  _units.reserve(len + 1);
+  for (size_t i = 0; i < len;) {
+#if JSCPP_STRING_UTF8
+    size_t n;
+    uint32_t c = charAt(s, len, i, n);
+#else
+    size_t n = 1;
+    uint32_t c = codeUnit(s[i]);
+    if (sizeof(wchar_t) > 2 && isHighSurrogate(c) && i + 1 < len && isLowSurrogate(codeUnit(s[i + 1]))) {
+      c = 0x10000 + ((c - 0xD800) << 10) + (codeUnit(s[i + 1]) - 0xDC00);
+      n = 2;
+    }
+#endif
+    if (sizeof(wchar_t) == 2 && c > 0xFFFF) {
+      _units.push_back(i);
+      _units.push_back(i);
+      _wide.push_back((wchar_t)(0xD800 + ((c - 0x10000) >> 10)));
+      _wide.push_back((wchar_t)(0xDC00 + ((c - 0x10000) & 0x3FF)));
+    } else {
+      _units.push_back(i);
+      _wide.push_back((wchar_t)c);
+    }
+    i += n;
+  }
+  _units.push_back(len);
+#endif
+}
+
+size_t RegExpSubject::_toWide(size_t unit) const noexcept {
+#if JSCPP_REGEXP_WIDEN
+  return (size_t)(std::lower_bound(_units.begin(), _units.end(), unit) - _units.begin());
+#else
+  return unit;
+#endif
+}
+
+const size_t RegExpPattern::npos;
+
+RegExpPattern::RegExpPattern(const String& source, const String& flags):
+  source(source), flags(flags), global(false), ignoreCase(false), multiline(false),
+  dotAll(false), sticky(false), groupCount(0), _firstUnit(npos) {
+  bool requireLinear = false;
+  for (size_t i = 0; i < flags.length(); i++) {
+    bool* flag = nullptr;
+    switch (flags.charCodeAt(i)) {
+      case 'g': flag = &global; break;
+      case 'i': flag = &ignoreCase; break;
+      case 'm': flag = &multiline; break;
+      case 's': flag = &dotAll; break;
+      case 'y': flag = &sticky; break;
+      case 'l': flag = &requireLinear; break;
+      default: break;
+    }
+    if (flag == nullptr || *flag) {
+      throwError(L"Invalid flags supplied to RegExp constructor '" + flags + L"'");
+    }
+    *flag = true;
+  }
+
+  std::wstring wide = source.wstr();
+  std::vector<uint32_t> pattern;
+  pattern.reserve(wide.size());
+  for (size_t i = 0; i < wide.size(); i++) {
+    uint32_t c = codeUnit(wide[i]);
+    if (isHighSurrogate(c) && i + 1 < wide.size() && isLowSurrogate(codeUnit(wide[i + 1]))) {
+      c = 0x10000 + ((c - 0xD800) << 10) + (codeUnit(wide[i + 1]) - 0xDC00);
+      i++;
+    }
+    pattern.push_back(c);
+  }
+
+  if (_compile(pattern)) return;
+
+  if (requireLinear) {
+    throwError(L"Invalid regular expression: /" + source + L"/" + flags + L": Cannot be compiled in linear time");
+  }
+  if (multiline || dotAll) {
+    throwError(L"Invalid regular expression: /" + source + L"/" + flags +
+      L": Flags 'm' and 's' are not supported with backreferences or lookaround");
+  }
+  std::regex_constants::syntax_option_type options = std::regex_constants::ECMAScript;
+  if (ignoreCase) options |= std::regex_constants::icase;
+  try {
+    _backtrack.reset(new std::wregex(wide, options));
+  } catch (const std::regex_error& err) {
+    throwError(L"Invalid regular expression: /" + source + L"/: " + err.what());
+  }
+  groupCount = _backtrack->mark_count();
+}
+
+bool RegExpPattern::_compile(const std::vector<uint32_t>& pattern) {
+  Parser parser(pattern, _classes);
+  Node root;
+  if (!parser.parse(root)) return false;
+  groupCount = parser.groups;
+
+  Compiler compiler(_program, ignoreCase);
+  RegExpInst start = { RegExpInst::SAVE, 0, 0, 0 };
+  _program.push_back(start);
+  if (!compiler.compile(root)) {
+    _program.clear();
+    _classes.clear();
+    return false;
+  }
+  RegExpInst end = { RegExpInst::SAVE, 0, 1, 0 };
+  RegExpInst match = { RegExpInst::MATCH, 0, 0, 0 };
+  _program.push_back(end);
+  _program.push_back(match);
+
+  // A pattern that starts with a literal lets the search skip ahead to it
+  if (!ignoreCase && _program[1].op == RegExpInst::CHAR && _program[1].c < 0x80) {
+    _firstUnit = _program[1].c;
+  }
+  return true;
+}
+
+bool RegExpPattern::exec(RegExpSubject& subject, size_t start, std::vector<size_t>& caps) const {
+  if (start > subject.length()) return false;
+  caps.assign(2 * (groupCount + 1), npos);
+  if (_backtrack) return _execBacktrack(subject, start, caps);
+  return _execLinear(subject, start, caps);
+}
+
+bool RegExpPattern::_execLinear(const RegExpSubject& subject, size_t start, std::vector<size_t>& caps) const {
+  const String::value_type* s = subject.data();
+  const size_t len = subject.length();
+  const size_t ncap = caps.size();
+  const size_t n = _program.size();
+  ThreadList clist(n, ncap);
+  ThreadList nlist(n, ncap);
+  std::vector<size_t> cur(ncap);
+  std::vector<Frame> stack;
+  bool matched = false;
+
+  // Follows the empty transitions from pc at pos, appending every thread
+  // that is waiting on a character (or has matched) to list in priority order.
+  auto addThread = [&](ThreadList& list, int pc0, const size_t* caps0, size_t pos) {
+    std::copy(caps0, caps0 + ncap, cur.begin());
+    Frame first = { pc0, -1, 0 };
+    stack.push_back(first);
+    while (!stack.empty()) {
+      Frame f = stack.back();
+      stack.pop_back();
+      if (f.slot >= 0) {
+        cur[f.slot] = f.value;
+        continue;
+      }
+      int pc = f.pc;
+      if (list.contains(pc)) continue;
+      list.add(pc);
+      const RegExpInst& inst = _program[pc];
+      switch (inst.op) {
+        case RegExpInst::JMP: {
+          Frame next = { inst.x, -1, 0 };
+          stack.push_back(next);
+          break;
+        }
+        case RegExpInst::SPLIT: {
+          Frame second = { inst.y, -1, 0 };
+          Frame preferred = { inst.x, -1, 0 };
+          stack.push_back(second);
+          stack.push_back(preferred);
+          break;
+        }
+        case RegExpInst::SAVE: {
+          Frame restore = { 0, inst.x, cur[inst.x] };
+          Frame next = { pc + 1, -1, 0 };
+          stack.push_back(restore);
+          stack.push_back(next);
+          cur[inst.x] = pos;
+          break;
+        }
+        case RegExpInst::RESET: {
+          for (int slot = inst.x; slot < inst.y; slot++) {
+            Frame restore = { 0, slot, cur[slot] };
+            stack.push_back(restore);
+            cur[slot] = npos;
+          }
+          Frame next = { pc + 1, -1, 0 };
+          stack.push_back(next);
+          break;
+        }
+        case RegExpInst::BOL:
+          if (pos == 0 || (multiline && lineTerminatorBefore(s, pos))) {
+            Frame next = { pc + 1, -1, 0 };
+            stack.push_back(next);
+          }
+          break;
+        case RegExpInst::EOL: {
+          size_t k;
+          if (pos == len || (multiline && isLineTerminator(charAt(s, len, pos, k)))) {
+            Frame next = { pc + 1, -1, 0 };
+            stack.push_back(next);
+          }
+          break;
+        }
+        case RegExpInst::WORD_BOUNDARY:
+        case RegExpInst::NOT_WORD_BOUNDARY: {
+          bool a = pos > 0 && isWordChar(codeUnit(s[pos - 1]));
+          bool b = pos < len && isWordChar(codeUnit(s[pos]));
+          if ((a != b) == (inst.op == RegExpInst::WORD_BOUNDARY)) {
+            Frame next = { pc + 1, -1, 0 };
+            stack.push_back(next);
+          }
+          break;
+        }
+        default:
+          std::copy(cur.begin(), cur.end(), list.slot(pc));
+          break;
+      }
+    }
+  };
+
+  std::vector<size_t> none(ncap, npos);
+  size_t pos = start;
+  for (;;) {
+    if (!matched && (!sticky || pos == start)) {
+      if (clist.size == 0 && _firstUnit != npos && !sticky) {
+        size_t skip = search::findUnit(s + pos, len - pos, (String::value_type)_firstUnit);
+        if (skip == search::npos) break;
+        pos += skip;
+      }
+      addThread(clist, 0, none.data(), pos);
+    }
+    if (clist.size == 0) break;
+
+    size_t clen = 0;
+    uint32_t c = pos < len ? charAt(s, len, pos, clen) : 0;
+    uint32_t folded = ignoreCase ? canonicalize(c) : c;
+    nlist.size = 0;
+    for (size_t k = 0; k < clist.size; k++) {
+      int pc = clist.dense[k];
+      const RegExpInst& inst = _program[pc];
+      const size_t* tc = clist.slot(pc);
+      if (inst.op == RegExpInst::MATCH) {
+        std::copy(tc, tc + ncap, caps.begin());
+        matched = true;
+        // Lower priority threads can only produce worse matches
+        break;
+      }
+      if (pos >= len) continue;
+      bool ok = false;
+      switch (inst.op) {
+        case RegExpInst::CHAR: ok = folded == inst.c; break;
+        case RegExpInst::ANY: ok = dotAll || !isLineTerminator(c); break;
+        case RegExpInst::CLASS: ok = matchClass(_classes[inst.x], c, ignoreCase); break;
+        default: break;
+      }
+      if (ok) addThread(nlist, pc + 1, tc, pos + clen);
+    }
+    std::swap(clist, nlist);
+    if (pos >= len) break;
+    pos += clen;
+  }
+  return matched;
+}
+
+bool RegExpPattern::_execBacktrack(RegExpSubject& subject, size_t start, std::vector<size_t>& caps) const {
+  std::regex_constants::match_flag_type flags = std::regex_constants::match_default;
+  if (sticky) flags |= std::regex_constants::match_continuous;
+#if JSCPP_REGEXP_WIDEN
+  subject._widen();
+  const wchar_t* first = subject._wide.data();
+  const wchar_t* last = first + subject._wide.size();
+#else
+  const wchar_t* first = subject.data();
+  const wchar_t* last = first + subject.length();
+#endif
+  size_t wideStart = subject._toWide(start);
+  if (wideStart > 0) flags |= std::regex_constants::match_prev_avail;
+  std::match_results<const wchar_t*> m;
+  bool found;
+  try {
+    found = std::regex_search(first + wideStart, last, m, *_backtrack, flags);
+  } catch (const std::regex_error& err) {
+    throwError(L"RegExp /" + source + L"/ failed: " + err.what());
+  }
+  if (!found) return false;
+  for (size_t g = 0; g <= groupCount && g < m.size(); g++) {
+    if (!m[g].matched) continue;
+    size_t a = (size_t)(m[g].first - first);
+    size_t b = (size_t)(m[g].second - first);
+#if JSCPP_REGEXP_WIDEN
+    caps[2 * g] = subject._units[a];
+    caps[2 * g + 1] = subject._units[b];
+#else
+    caps[2 * g] = a;
+    caps[2 * g + 1] = b;
+#endif
+  }
+  return true;
+}
+
+std::shared_ptr<const RegExpPattern> compileRegExp(const String& source, const String& flags) {
+  typedef std::list<std::pair<String, std::shared_ptr<const RegExpPattern>>> Entries;
+  static std::mutex mutex;
+  static Entries entries;
+  static std::unordered_map<String, Entries::iterator> index;
+
+  String key = flags.concat(L"/", source);
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it != index.end()) {
+      entries.splice(entries.begin(), entries, it->second);
+      return it->second->second;
+    }
+  }
+
+  std::shared_ptr<const RegExpPattern> pattern = std::make_shared<RegExpPattern>(source, flags);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (index.find(key) == index.end()) {
+    entries.emplace_front(key, pattern);
+    index[key] = entries.begin();
+    if (entries.size() > JSCPP_REGEXP_CACHE_SIZE) {
+      index.erase(entries.back().first);
+      entries.pop_back();
+    }
+  }
+  return pattern;
+}
+RegExpMatch toRegExpMatch(const String& str, const std::vector<size_t>& caps) {
+  RegExpMatch match;
+  match.index = caps[0];
+  match.captures.reserve(caps.size() / 2);
+  for (size_t g = 0; g < caps.size(); g += 2) {
+    if (caps[g] == RegExpPattern::npos) {
+      match.captures.emplace_back();
+    } else {
+      match.captures.emplace_back(StringView(str).substring(caps[g], caps[g + 1]));
+    }
+  }
+  return match;
+}
+
+}
+}
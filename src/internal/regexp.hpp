@@ -0,0 +1,102 @@
+#ifndef __JSCPP_INTERNAL_REGEXP_HPP__
+#define __JSCPP_INTERNAL_REGEXP_HPP__
+
+#include "jscpp/RegExp.hpp"
+
+#include <memory>
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace js {
+namespace internal {
+
+// Input of a match. The wide copy std::wregex needs is only built when the
+// storage is not wchar_t and the pattern fell back to the backtracking engine.
+class RegExpSubject {
+public:
+  explicit RegExpSubject(const String& str) noexcept;
+
+  const String::value_type* data() const noexcept { return _str.data(); }
+  size_t length() const noexcept { return _str.length(); }
+
+private:
+  friend class RegExpPattern;
+  void _widen();
+  size_t _toWide(size_t unit) const noexcept;
+
+  const String& _str;
+  bool _widened;
+  std::wstring _wide;
+  // Unit offset of every wide character, plus one past the end
+  std::vector<size_t> _units;
+};
+
+struct RegExpClass {
+  enum Set {
+    DIGIT = 1, NOT_DIGIT = 2, WORD = 4, NOT_WORD = 8, SPACE = 16, NOT_SPACE = 32
+  };
+  std::vector<std::pair<uint32_t, uint32_t>> ranges;
+  unsigned sets;
+  bool negate;
+};
+
+struct RegExpInst {
+  enum Op {
+    CHAR, ANY, CLASS, MATCH, JMP, SPLIT, SAVE, RESET, BOL, EOL, WORD_BOUNDARY, NOT_WORD_BOUNDARY
+  };
+  Op op;
+  uint32_t c;
+  int x;
+  int y;
+};
+
+class RegExpPattern {
+public:
+  static const size_t npos = static_cast<size_t>(-1);
+
+  RegExpPattern(const String& source, const String& flags);
+
+  String source;
+  String flags;
+  bool global;
+  bool ignoreCase;
+  bool multiline;
+  bool dotAll;
+  bool sticky;
+  // Capture groups, not counting the whole match
+  size_t groupCount;
+
+  // True when the pattern runs on the linear-time Pike VM rather than
+  // std::wregex, which is only used for backreferences and lookaround.
+  bool linear() const noexcept { return _backtrack == nullptr; }
+
+  // Finds the first match at or after start, or exactly at start when
+  // sticky. caps receives 2 * (groupCount + 1) code unit offsets, npos for
+  // groups that did not participate.
+  bool exec(RegExpSubject& subject, size_t start, std::vector<size_t>& caps) const;
+
+private:
+  bool _compile(const std::vector<uint32_t>& pattern);
+  bool _execLinear(const RegExpSubject& subject, size_t start, std::vector<size_t>& caps) const;
+  bool _execBacktrack(RegExpSubject& subject, size_t start, std::vector<size_t>& caps) const;
+
+  std::vector<RegExpInst> _program;
+  std::vector<RegExpClass> _classes;
+  // Code unit every match must start with, or npos
+  size_t _firstUnit;
+  std::unique_ptr<std::wregex> _backtrack;
+};
+
+// Compiles through an LRU cache keyed by flags and source, so building the
+// same RegExp repeatedly only parses it once.
+std::shared_ptr<const RegExpPattern> compileRegExp(const String& source, const String& flags);
+
+// Copies the captured substrings out of str.
+RegExpMatch toRegExpMatch(const String& str, const std::vector<size_t>& caps);
+
+}
+}
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef __JSCPP_SEARCH_HPP__
+#define __JSCPP_SEARCH_HPP__
+
+#include "transcode.hpp"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace js {
+namespace internal {
+namespace search {
+
+const size_t npos = static_cast<size_t>(-1);
+
+// Needles longer than this use Horspool skipping instead of the
+// first/last code unit filter.
+const size_t SHORT_NEEDLE = 32;
+
+inline unsigned lowestBit(unsigned mask) noexcept {
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return (unsigned)index;
+#else
+  return (unsigned)__builtin_ctz(mask);
+#endif
+}
+
+inline unsigned highestBit(unsigned mask) noexcept {
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanReverse(&index, mask);
+  return (unsigned)index;
+#else
+  return 31U - (unsigned)__builtin_clz(mask);
+#endif
+}
+
+template <typename CharT>
+inline bool equalUnits(const CharT* a, const CharT* b, size_t n) noexcept {
+  return n == 0 || std::memcmp(a, b, n * sizeof(CharT)) == 0;
+}
+
+#if JSCPP_TRANSCODE_SSE2
+template <typename CharT>
+inline __m128i splat(CharT c) noexcept {
+  if (sizeof(CharT) == 1) return _mm_set1_epi8((char)c);
+  if (sizeof(CharT) == 2) return _mm_set1_epi16((short)c);
+  return _mm_set1_epi32((int)c);
+}
+
+template <typename CharT>
+inline __m128i equalVec(const CharT* p, __m128i v) noexcept {
+  __m128i a = _mm_loadu_si128((const __m128i*)p);
+  if (sizeof(CharT) == 1) return _mm_cmpeq_epi8(a, v);
+  if (sizeof(CharT) == 2) return _mm_cmpeq_epi16(a, v);
+  return _mm_cmpeq_epi32(a, v);
+}
+
+// One movemask bit per byte, so each matching code unit sets sizeof(CharT)
+// adjacent bits.
+template <typename CharT>
+inline unsigned equalMask(const CharT* p, __m128i v) noexcept {
+  return (unsigned)_mm_movemask_epi8(equalVec(p, v));
+}
+
+// Candidate lanes of the first/last filter at p.
+template <typename CharT>
+inline __m128i candidateVec(const CharT* p, size_t m, __m128i vf, __m128i vl) noexcept {
+  return _mm_and_si128(equalVec(p, vf), equalVec(p + m - 1, vl));
+}
+
+template <typename CharT>
+inline unsigned unitBits(unsigned bit) noexcept {
+  return ((1U << sizeof(CharT)) - 1U) << bit;
+}
+#endif
+
+template <typename CharT>
+inline size_t findUnit(const CharT* s, size_t n, CharT c) noexcept {
+  size_t i = 0;
+#if JSCPP_TRANSCODE_SSE2
+  const size_t step = 16 / sizeof(CharT);
+  const __m128i v = splat(c);
+  // Skip four vectors at a time while nothing matches
+  for (; i + 4 * step <= n; i += 4 * step) {
+    __m128i any = _mm_or_si128(_mm_or_si128(equalVec(s + i, v), equalVec(s + i + step, v)),
+      _mm_or_si128(equalVec(s + i + 2 * step, v), equalVec(s + i + 3 * step, v)));
+    if (_mm_movemask_epi8(any) != 0) break;
+  }
+  for (; i + step <= n; i += step) {
+    unsigned mask = equalMask(s + i, v);
+    if (mask != 0) return i + lowestBit(mask) / sizeof(CharT);
+  }
+#endif
+  for (; i < n; i++) {
+    if (s[i] == c) return i;
+  }
+  return npos;
+}
+
+// Compares the first and last code unit of the needle at every candidate
+// position a vector at a time and only verifies positions where both match.
+template <typename CharT>
+inline size_t findShort(const CharT* s, size_t n, const CharT* p, size_t m) noexcept {
+  const size_t candidates = n - m + 1;
+  const CharT first = p[0];
+  const CharT last = p[m - 1];
+  size_t i = 0;
+#if JSCPP_TRANSCODE_SSE2
+  const size_t step = 16 / sizeof(CharT);
+  const __m128i vf = splat(first);
+  const __m128i vl = splat(last);
+  for (;;) {
+    for (; i + 4 * step <= candidates; i += 4 * step) {
+      __m128i any = _mm_or_si128(
+        _mm_or_si128(candidateVec(s + i, m, vf, vl), candidateVec(s + i + step, m, vf, vl)),
+        _mm_or_si128(candidateVec(s + i + 2 * step, m, vf, vl), candidateVec(s + i + 3 * step, m, vf, vl)));
+      if (_mm_movemask_epi8(any) != 0) break;
+    }
+    if (i + step > candidates) break;
+    unsigned mask = (unsigned)_mm_movemask_epi8(candidateVec(s + i, m, vf, vl));
+    while (mask != 0) {
+      unsigned bit = lowestBit(mask);
+      size_t k = i + bit / sizeof(CharT);
+      if (equalUnits(s + k + 1, p + 1, m - 2)) return k;
+      mask &= ~unitBits<CharT>(bit);
+    }
+    i += step;
+  }
+#endif
+  for (; i < candidates; i++) {
+    if (s[i] == first && s[i + m - 1] == last && equalUnits(s + i + 1, p + 1, m - 2)) return i;
+  }
+  return npos;
+}
+
+// Boyer-Moore-Horspool. The skip table is indexed by the low byte of each
+// code unit, keeping the smallest shift among units that share it.
+template <typename CharT>
+inline size_t findLong(const CharT* s, size_t n, const CharT* p, size_t m) noexcept {
+  size_t shift[256];
+  for (size_t k = 0; k < 256; k++) shift[k] = m;
+  for (size_t k = 0; k + 1 < m; k++) shift[codeUnit(p[k]) & 0xFF] = m - 1 - k;
+
+  const CharT last = p[m - 1];
+  for (size_t i = 0; i + m <= n;) {
+    CharT c = s[i + m - 1];
+    if (c == last && equalUnits(s + i, p, m - 1)) return i;
+    i += shift[codeUnit(c) & 0xFF];
+  }
+  return npos;
+}
+
+template <typename CharT>
+inline size_t find(const CharT* s, size_t n, const CharT* p, size_t m) noexcept {
+  if (m == 0) return 0;
+  if (m > n) return npos;
+  if (m == 1) return findUnit(s, n, p[0]);
+  if (m <= SHORT_NEEDLE) return findShort(s, n, p, m);
+  return findLong(s, n, p, m);
+}
+
+// Last match starting at or before from.
+template <typename CharT>
+inline size_t rfind(const CharT* s, size_t n, const CharT* p, size_t m, size_t from) noexcept {
+  if (m > n) return npos;
+  size_t end = (n - m < from ? n - m : from) + 1;
+  if (m == 0) return end - 1;
+  const CharT first = p[0];
+  const CharT last = p[m - 1];
+#if JSCPP_TRANSCODE_SSE2
+  const size_t step = 16 / sizeof(CharT);
+  const __m128i vf = splat(first);
+  const __m128i vl = splat(last);
+  for (; end >= step; end -= step) {
+    size_t base = end - step;
+    unsigned mask = (unsigned)_mm_movemask_epi8(candidateVec(s + base, m, vf, vl));
+    while (mask != 0) {
+      unsigned bit = highestBit(mask) + 1 - sizeof(CharT);
+      size_t k = base + bit / sizeof(CharT);
+      if (m < 2 || equalUnits(s + k + 1, p + 1, m - 2)) return k;
+      mask &= ~unitBits<CharT>(bit);
+    }
+  }
+#endif
+  for (; end > 0; end--) {
+    size_t k = end - 1;
+    if (s[k] == first && s[k + m - 1] == last && (m < 2 || equalUnits(s + k + 1, p + 1, m - 2))) return k;
+  }
+  return npos;
+}
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,344 @@
+#ifndef __JSCPP_TRANSCODE_HPP__
+#define __JSCPP_TRANSCODE_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define JSCPP_TRANSCODE_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define JSCPP_TRANSCODE_SSE2 1
+#endif
+
+namespace js {
+namespace internal {
+
+const uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+template <typename CharT>
+inline uint32_t codeUnit(CharT c) noexcept {
+  return (uint32_t)(typename std::make_unsigned<CharT>::type)c;
+}
+
+inline bool isHighSurrogate(uint32_t c) noexcept { return c >= 0xD800 && c <= 0xDBFF; }
+inline bool isLowSurrogate(uint32_t c) noexcept { return c >= 0xDC00 && c <= 0xDFFF; }
+
+namespace transcode {
+
+// Widens the leading ASCII run of src into dst and returns its length.
+template <typename CharT>
+inline size_t widenAscii(const uint8_t* src, size_t len, CharT* dst) noexcept {
+  size_t i = 0;
+#if JSCPP_TRANSCODE_AVX2
+  for (; i + 32 <= len; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+    if (_mm256_movemask_epi8(v) != 0) break;
+    if (sizeof(CharT) == 1) {
+      _mm256_storeu_si256((__m256i*)(dst + i), v);
+    } else if (sizeof(CharT) == 2) {
+      _mm256_storeu_si256((__m256i*)(dst + i), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+      _mm256_storeu_si256((__m256i*)(dst + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+    } else {
+      for (size_t k = 0; k < 32; k += 8) {
+        __m128i q = _mm_loadl_epi64((const __m128i*)(src + i + k));
+        _mm256_storeu_si256((__m256i*)(dst + i + k), _mm256_cvtepu8_epi32(q));
+      }
+    }
+  }
+#endif
+#if JSCPP_TRANSCODE_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+    if (_mm_movemask_epi8(v) != 0) break;
+    if (sizeof(CharT) == 1) {
+      _mm_storeu_si128((__m128i*)(dst + i), v);
+      continue;
+    }
+    __m128i lo = _mm_unpacklo_epi8(v, zero);
+    __m128i hi = _mm_unpackhi_epi8(v, zero);
+    if (sizeof(CharT) == 2) {
+      _mm_storeu_si128((__m128i*)(dst + i), lo);
+      _mm_storeu_si128((__m128i*)(dst + i + 8), hi);
+    } else {
+      _mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi16(lo, zero));
+      _mm_storeu_si128((__m128i*)(dst + i + 4), _mm_unpackhi_epi16(lo, zero));
+      _mm_storeu_si128((__m128i*)(dst + i + 8), _mm_unpacklo_epi16(hi, zero));
+      _mm_storeu_si128((__m128i*)(dst + i + 12), _mm_unpackhi_epi16(hi, zero));
+    }
+  }
+#else
+  for (; i + 8 <= len; i += 8) {
+    uint64_t word;
+    memcpy(&word, src + i, 8);
+    if ((word & 0x8080808080808080ULL) != 0) break;
+    for (size_t k = 0; k < 8; k++) dst[i + k] = (CharT)src[i + k];
+  }
+#endif
+  for (; i < len && src[i] < 0x80; i++) {
+    dst[i] = (CharT)src[i];
+  }
+  return i;
+}
+
+// Narrows the leading ASCII run of src into dst and returns its length.
+template <typename CharT>
+inline size_t narrowAscii(const CharT* src, size_t len, uint8_t* dst) noexcept {
+  size_t i = 0;
+#if JSCPP_TRANSCODE_AVX2
+  if (sizeof(CharT) == 2) {
+    const __m256i mask = _mm256_set1_epi16((short)0xFF80);
+    for (; i + 32 <= len; i += 32) {
+      __m256i a = _mm256_loadu_si256((const __m256i*)(src + i));
+      __m256i b = _mm256_loadu_si256((const __m256i*)(src + i + 16));
+      if (!_mm256_testz_si256(_mm256_or_si256(a, b), mask)) break;
+      __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+      _mm256_storeu_si256((__m256i*)(dst + i), packed);
+    }
+  } else if (sizeof(CharT) == 4) {
+    const __m256i mask = _mm256_set1_epi32((int)0xFFFFFF80);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    for (; i + 32 <= len; i += 32) {
+      __m256i a = _mm256_loadu_si256((const __m256i*)(src + i));
+      __m256i b = _mm256_loadu_si256((const __m256i*)(src + i + 8));
+      __m256i c = _mm256_loadu_si256((const __m256i*)(src + i + 16));
+      __m256i d = _mm256_loadu_si256((const __m256i*)(src + i + 24));
+      __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+      if (!_mm256_testz_si256(any, mask)) break;
+      __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+      _mm256_storeu_si256((__m256i*)(dst + i), _mm256_permutevar8x32_epi32(packed, order));
+    }
+  }
+#endif
+#if JSCPP_TRANSCODE_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  if (sizeof(CharT) == 2) {
+    const __m128i mask = _mm_set1_epi16((short)0xFF80);
+    for (; i + 16 <= len; i += 16) {
+      __m128i a = _mm_loadu_si128((const __m128i*)(src + i));
+      __m128i b = _mm_loadu_si128((const __m128i*)(src + i + 8));
+      __m128i high = _mm_and_si128(_mm_or_si128(a, b), mask);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(high, zero)) != 0xFFFF) break;
+      _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(a, b));
+    }
+  } else if (sizeof(CharT) == 4) {
+    const __m128i mask = _mm_set1_epi32((int)0xFFFFFF80);
+    for (; i + 16 <= len; i += 16) {
+      __m128i a = _mm_loadu_si128((const __m128i*)(src + i));
+      __m128i b = _mm_loadu_si128((const __m128i*)(src + i + 4));
+      __m128i c = _mm_loadu_si128((const __m128i*)(src + i + 8));
+      __m128i d = _mm_loadu_si128((const __m128i*)(src + i + 12));
+      __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(any, mask), zero)) != 0xFFFF) break;
+      __m128i packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+      _mm_storeu_si128((__m128i*)(dst + i), packed);
+    }
+  }
+#endif
+  for (; i < len && codeUnit(src[i]) < 0x80; i++) {
+    dst[i] = (uint8_t)src[i];
+  }
+  return i;
+}
+
+// Returns the length of the leading run of code units below 0x80.
+template <typename CharT>
+inline size_t asciiLength(const CharT* src, size_t len) noexcept {
+  size_t i = 0;
+#if JSCPP_TRANSCODE_SSE2
+  const size_t step = 16 / sizeof(CharT);
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i mask = sizeof(CharT) == 1 ? _mm_set1_epi8((char)0x80) :
+    (sizeof(CharT) == 2 ? _mm_set1_epi16((short)0xFF80) : _mm_set1_epi32((int)0xFFFFFF80));
+  for (; i + step <= len; i += step) {
+    __m128i v = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src + i)), mask);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)) != 0xFFFF) break;
+  }
+#endif
+  for (; i < len && codeUnit(src[i]) < 0x80; i++) {}
+  return i;
+}
+
+template <typename CharT>
+inline CharT* putCodePoint(CharT* dst, uint32_t cp) noexcept {
+  if (sizeof(CharT) == 2 && cp > 0xFFFF) {
+    cp -= 0x10000;
+    *dst++ = (CharT)(0xD800 + (cp >> 10));
+    *dst++ = (CharT)(0xDC00 + (cp & 0x3FF));
+  } else {
+    *dst++ = (CharT)cp;
+  }
+  return dst;
+}
+
+// Reads one code point from a UTF-16 or UTF-32 sequence, pairing surrogates.
+// Lone surrogates and out of range values decode to U+FFFD.
+template <typename CharT>
+inline uint32_t nextCodePoint(const CharT* src, size_t len, size_t& i) noexcept {
+  uint32_t c = codeUnit(src[i++]);
+  if (c < 0xD800) return c;
+  if (isHighSurrogate(c)) {
+    if (i < len && isLowSurrogate(codeUnit(src[i]))) {
+      return 0x10000 + ((c - 0xD800) << 10) + (codeUnit(src[i++]) - 0xDC00);
+    }
+    return REPLACEMENT_CHARACTER;
+  }
+  if (isLowSurrogate(c) || c > 0x10FFFF) return REPLACEMENT_CHARACTER;
+  return c;
+}
+
+}
+
+/**
+ * Decodes UTF-8 into UTF-16 (2 byte CharT) or UTF-32 (4 byte CharT) code units.
+ * dst must have room for len code units, which is always enough.
+ * Ill-formed sequences are replaced by U+FFFD following the WHATWG
+ * "maximal subpart" rule. Returns the number of code units written.
+ */
+template <typename CharT>
+size_t decodeUtf8(const char* source, size_t len, CharT* dst) noexcept {
+  const uint8_t* src = (const uint8_t*)source;
+  CharT* out = dst;
+  size_t i = 0;
+  while (i < len) {
+    if (src[i] < 0x80) {
+      size_t n = transcode::widenAscii(src + i, len - i, out);
+      i += n;
+      out += n;
+      if (i >= len) break;
+    }
+
+    uint32_t b = src[i++];
+    uint32_t cp;
+    size_t need;
+    uint8_t lower = 0x80;
+    uint8_t upper = 0xBF;
+    if (b >= 0xC2 && b <= 0xDF) {
+      need = 1; cp = b & 0x1F;
+    } else if (b >= 0xE0 && b <= 0xEF) {
+      need = 2; cp = b & 0x0F;
+      if (b == 0xE0) lower = 0xA0;
+      if (b == 0xED) upper = 0x9F;
+    } else if (b >= 0xF0 && b <= 0xF4) {
+      need = 3; cp = b & 0x07;
+      if (b == 0xF0) lower = 0x90;
+      if (b == 0xF4) upper = 0x8F;
+    } else {
+      *out++ = (CharT)REPLACEMENT_CHARACTER;
+      continue;
+    }
+
+    for (; need > 0; need--) {
+      if (i >= len || src[i] < lower || src[i] > upper) break;
+      cp = (cp << 6) | (src[i++] & 0x3F);
+      lower = 0x80;
+      upper = 0xBF;
+    }
+    out = transcode::putCodePoint(out, need == 0 ? cp : REPLACEMENT_CHARACTER);
+  }
+  return (size_t)(out - dst);
+}
+
+/**
+ * Returns the exact number of bytes encodeUtf8() produces for src.
+ */
+template <typename CharT>
+size_t utf8Length(const CharT* src, size_t len) noexcept {
+  size_t bytes = 0;
+  size_t i = 0;
+  while (i < len) {
+    if (codeUnit(src[i]) < 0x80) {
+      size_t n = transcode::asciiLength(src + i, len - i);
+      bytes += n;
+      i += n;
+      if (i >= len) break;
+    }
+    uint32_t c = transcode::nextCodePoint(src, len, i);
+    bytes += c < 0x800 ? 2 : (c < 0x10000 ? 3 : 4);
+  }
+  return bytes;
+}
+
+/**
+ * Encodes UTF-16 or UTF-32 code units as UTF-8. Surrogate pairs are combined,
+ * lone surrogates and values above U+10FFFF become U+FFFD.
+ * dst must have room for utf8Length(src, len) bytes.
+ * Returns the number of bytes written.
+ */
+template <typename CharT>
+size_t encodeUtf8(const CharT* src, size_t len, char* dst) noexcept {
+  uint8_t* out = (uint8_t*)dst;
+  size_t i = 0;
+  while (i < len) {
+    if (codeUnit(src[i]) < 0x80) {
+      size_t n = transcode::narrowAscii(src + i, len - i, out);
+      i += n;
+      out += n;
+      if (i >= len) break;
+    }
+    uint32_t c = transcode::nextCodePoint(src, len, i);
+    if (c < 0x800) {
+      *out++ = (uint8_t)(0xC0 | (c >> 6));
+      *out++ = (uint8_t)(0x80 | (c & 0x3F));
+    } else if (c < 0x10000) {
+      *out++ = (uint8_t)(0xE0 | (c >> 12));
+      *out++ = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+      *out++ = (uint8_t)(0x80 | (c & 0x3F));
+    } else {
+      *out++ = (uint8_t)(0xF0 | (c >> 18));
+      *out++ = (uint8_t)(0x80 | ((c >> 12) & 0x3F));
+      *out++ = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+      *out++ = (uint8_t)(0x80 | (c & 0x3F));
+    }
+  }
+  return (size_t)(out - (uint8_t*)dst);
+}
+
+/**
+ * Converts wide code units to UTF-16. UTF-32 input is split into surrogate
+ * pairs, UTF-16 input is copied. Unpaired surrogates are kept as they are so
+ * the result round-trips through utf16ToWide(). dst must have room for
+ * 2 * len code units. Returns the number of code units written.
+ */
+template <typename U16, typename WideT>
+size_t wideToUtf16(const WideT* src, size_t len, U16* dst) noexcept {
+  U16* out = dst;
+  for (size_t i = 0; i < len; i++) {
+    uint32_t c = codeUnit(src[i]);
+    if (sizeof(WideT) > 2 && c > 0xFFFF) {
+      out = transcode::putCodePoint(out, c > 0x10FFFF ? REPLACEMENT_CHARACTER : c);
+    } else {
+      *out++ = (U16)c;
+    }
+  }
+  return (size_t)(out - dst);
+}
+
+/**
+ * Converts UTF-16 code units to wide code units, combining surrogate pairs
+ * when WideT is 32 bits wide. dst must have room for len code units.
+ * Returns the number of code units written.
+ */
+template <typename WideT, typename U16>
+size_t utf16ToWide(const U16* src, size_t len, WideT* dst) noexcept {
+  WideT* out = dst;
+  for (size_t i = 0; i < len; i++) {
+    uint32_t c = codeUnit(src[i]);
+    if (sizeof(WideT) > 2 && isHighSurrogate(c) && i + 1 < len && isLowSurrogate(codeUnit(src[i + 1]))) {
+      c = 0x10000 + ((c - 0xD800) << 10) + (codeUnit(src[++i]) - 0xDC00);
+    }
+    *out++ = (WideT)c;
+  }
+  return (size_t)(out - dst);
+}
+
+}
+}
+
+#endif
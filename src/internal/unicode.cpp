@@ -0,0 +1,437 @@
+#include "./unicode.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace js {
+namespace internal {
+namespace unicode {
+
+namespace {
+
+typedef String::value_type Unit;
+typedef String::string_type Units;
+
+const uint32_t INVALID = 0xFFFFFFFFU;
+
+const uint32_t HANGUL_S = 0xAC00;
+const uint32_t HANGUL_L = 0x1100;
+const uint32_t HANGUL_V = 0x1161;
+const uint32_t HANGUL_T = 0x11A7;
+const uint32_t HANGUL_V_COUNT = 21;
+const uint32_t HANGUL_T_COUNT = 28;
+const uint32_t HANGUL_N = HANGUL_V_COUNT * HANGUL_T_COUNT;
+const uint32_t HANGUL_COUNT = 19 * HANGUL_N;
+
+// Code point starting at s[i], advancing i past it. Ill-formed UTF-8 yields
+// INVALID and advances one byte so callers can copy that byte through.
+inline uint32_t readCodePoint(const char* s, size_t len, size_t& i) noexcept {
+  const uint8_t* p = (const uint8_t*)s;
+  uint32_t b = p[i];
+  if (b < 0x80) {
+    i++;
+    return b;
+  }
+  size_t need = (b >= 0xC2 && b <= 0xDF) ? 1 : (b >= 0xE0 && b <= 0xEF) ? 2 : (b >= 0xF0 && b <= 0xF4) ? 3 : 0;
+  if (need == 0 || i + need >= len) {
+    i++;
+    return INVALID;
+  }
+  uint32_t c = b & (0x3F >> need);
+  for (size_t k = 1; k <= need; k++) {
+    if ((p[i + k] & 0xC0) != 0x80) {
+      i++;
+      return INVALID;
+    }
+    c = (c << 6) | (p[i + k] & 0x3F);
+  }
+  i += need + 1;
+  return c;
+}
+
+template <typename CharT>
+inline uint32_t readCodePoint(const CharT* s, size_t len, size_t& i) noexcept {
+  uint32_t c = codeUnit(s[i++]);
+  if (isHighSurrogate(c) && i < len && isLowSurrogate(codeUnit(s[i]))) {
+    return 0x10000 + ((c - 0xD800) << 10) + (codeUnit(s[i++]) - 0xDC00);
+  }
+  return c;
+}
+
+// Code point ending at s[i - 1], moving i to its start.
+inline uint32_t readCodePointBefore(const char* s, size_t& i) noexcept {
+  size_t start = i - 1;
+  while (start > 0 && i - start < 4 && ((uint8_t)s[start] & 0xC0) == 0x80) start--;
+  size_t k = start;
+  uint32_t c = readCodePoint(s, i, k);
+  if (k != i) {
+    i--;
+    return INVALID;
+  }
+  i = start;
+  return c;
+}
+
+template <typename CharT>
+inline uint32_t readCodePointBefore(const CharT* s, size_t& i) noexcept {
+  uint32_t c = codeUnit(s[--i]);
+  if (isLowSurrogate(c) && i > 0 && isHighSurrogate(codeUnit(s[i - 1]))) {
+    return 0x10000 + ((codeUnit(s[--i]) - 0xD800) << 10) + (c - 0xDC00);
+  }
+  return c;
+}
+
+// Writes cp at dst and returns the number of code units written.
+inline size_t writeCodePoint(char* dst, uint32_t c) noexcept {
+  uint8_t* out = (uint8_t*)dst;
+  if (c < 0x80) {
+    out[0] = (uint8_t)c;
+    return 1;
+  }
+  if (c < 0x800) {
+    out[0] = (uint8_t)(0xC0 | (c >> 6));
+    out[1] = (uint8_t)(0x80 | (c & 0x3F));
+    return 2;
+  }
+  if (c < 0x10000) {
+    out[0] = (uint8_t)(0xE0 | (c >> 12));
+    out[1] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+    out[2] = (uint8_t)(0x80 | (c & 0x3F));
+    return 3;
+  }
+  out[0] = (uint8_t)(0xF0 | (c >> 18));
+  out[1] = (uint8_t)(0x80 | ((c >> 12) & 0x3F));
+  out[2] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+  out[3] = (uint8_t)(0x80 | (c & 0x3F));
+  return 4;
+}
+
+template <typename CharT>
+inline size_t writeCodePoint(CharT* dst, uint32_t c) noexcept {
+  return (size_t)(transcode::putCodePoint(dst, c) - dst);
+}
+
+#if JSCPP_TRANSCODE_SSE2
+template <typename CharT>
+inline __m128i asciiMask() noexcept {
+  if (sizeof(CharT) == 1) return _mm_set1_epi8((char)0x80);
+  if (sizeof(CharT) == 2) return _mm_set1_epi16((short)0xFF80);
+  return _mm_set1_epi32((int)0xFFFFFF80);
+}
+
+// Lanes holding a letter in [first, first + 26), for ASCII lanes only.
+template <typename CharT>
+inline __m128i letterLanes(__m128i v, char first) noexcept {
+  if (sizeof(CharT) == 1) {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)(first - 1))), _mm_cmplt_epi8(v, _mm_set1_epi8((char)(first + 26))));
+  }
+  if (sizeof(CharT) == 2) {
+    return _mm_and_si128(_mm_cmpgt_epi16(v, _mm_set1_epi16(first - 1)), _mm_cmplt_epi16(v, _mm_set1_epi16(first + 26)));
+  }
+  return _mm_and_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32(first - 1)), _mm_cmplt_epi32(v, _mm_set1_epi32(first + 26)));
+}
+
+template <typename CharT>
+inline __m128i caseBit() noexcept {
+  if (sizeof(CharT) == 1) return _mm_set1_epi8(0x20);
+  if (sizeof(CharT) == 2) return _mm_set1_epi16(0x20);
+  return _mm_set1_epi32(0x20);
+}
+#endif
+
+// Case maps the leading ASCII run of src into dst and returns its length.
+// Letters differ from their other case only in bit 0x20.
+template <typename CharT>
+inline size_t asciiCaseRun(const CharT* src, size_t len, CharT* dst, bool upper) noexcept {
+  const char first = upper ? 'a' : 'A';
+  size_t i = 0;
+#if JSCPP_TRANSCODE_SSE2
+  const size_t step = 16 / sizeof(CharT);
+  const __m128i nonAscii = asciiMask<CharT>();
+  const __m128i bit = caseBit<CharT>();
+  const __m128i zero = _mm_setzero_si128();
+  // Two registers at a time, the wider units only fit a few per register
+  for (; i + 2 * step <= len; i += 2 * step) {
+    __m128i v0 = _mm_loadu_si128((const __m128i*)(src + i));
+    __m128i v1 = _mm_loadu_si128((const __m128i*)(src + i + step));
+    if (sizeof(CharT) == 1) {
+      if (_mm_movemask_epi8(_mm_or_si128(v0, v1)) != 0) break;
+    } else if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(_mm_or_si128(v0, v1), nonAscii), zero)) != 0xFFFF) {
+      break;
+    }
+    v0 = _mm_xor_si128(v0, _mm_and_si128(letterLanes<CharT>(v0, first), bit));
+    v1 = _mm_xor_si128(v1, _mm_and_si128(letterLanes<CharT>(v1, first), bit));
+    _mm_storeu_si128((__m128i*)(dst + i), v0);
+    _mm_storeu_si128((__m128i*)(dst + i + step), v1);
+  }
+  for (; i + step <= len; i += step) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+    if (sizeof(CharT) == 1) {
+      if (_mm_movemask_epi8(v) != 0) break;
+    } else if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, nonAscii), zero)) != 0xFFFF) {
+      break;
+    }
+    v = _mm_xor_si128(v, _mm_and_si128(letterLanes<CharT>(v, first), bit));
+    _mm_storeu_si128((__m128i*)(dst + i), v);
+  }
+#endif
+  for (; i < len; i++) {
+    uint32_t c = codeUnit(src[i]);
+    if (c >= 0x80) break;
+    dst[i] = (CharT)((c - (uint32_t)first) < 26 ? (c ^ 0x20) : c);
+  }
+  return i;
+}
+
+bool isCased(uint32_t cp) noexcept {
+  return cp != INVALID && (caseRecord(cp).flags & CASED) != 0;
+}
+
+bool isCaseIgnorable(uint32_t cp) noexcept {
+  return cp != INVALID && (caseRecord(cp).flags & CASE_IGNORABLE) != 0;
+}
+
+// Final_Sigma: preceded by a cased letter and not followed by one, skipping
+// case-ignorable characters such as apostrophes and combining marks.
+bool isFinalSigma(const Unit* s, size_t len, size_t start, size_t end) noexcept {
+  uint32_t c = INVALID;
+  size_t i = start;
+  while (i > 0) {
+    c = readCodePointBefore(s, i);
+    if (!isCaseIgnorable(c)) break;
+    c = INVALID;
+  }
+  if (!isCased(c)) return false;
+  i = end;
+  while (i < len) {
+    c = readCodePoint(s, len, i);
+    if (!isCaseIgnorable(c)) return !isCased(c);
+  }
+  return true;
+}
+
+Units mapCase(const Unit* s, size_t len, bool upper) {
+  // Starting from a copy spares a zero-filling pass, and ASCII runs are
+  // then case mapped in place while the output keeps pace with the input
+  Units out(s, len);
+  size_t o = 0;
+  size_t i = 0;
+  // Until a mapping changes the length, out still holds the input past o
+  bool inPlace = true;
+  while (i < len) {
+    size_t n = asciiCaseRun(inPlace ? &out[0] + i : s + i, len - i, &out[0] + o, upper);
+    i += n;
+    o += n;
+    if (i >= len) break;
+
+    // Room for the rest of the input plus one mapping of up to three code
+    // points, four units each
+    if (out.size() - o < len - i + 12) out.resize(std::max(out.size() * 2, o + len - i + 12));
+    size_t start = i;
+    uint32_t c = readCodePoint(s, len, i);
+    if (c == INVALID) {
+      out[o++] = s[start];
+      if (o != i) inPlace = false;
+      continue;
+    }
+    const CaseRecord& rec = caseRecord(c);
+    uint16_t full = upper ? rec.upperFull : rec.lowerFull;
+    if (!upper && c == 0x03A3 && isFinalSigma(s, len, start, i)) {
+      o += writeCodePoint(&out[0] + o, 0x03C2);
+    } else if (full != 0) {
+      const uint32_t* seq = caseSequence(full);
+      for (uint32_t k = 1; k <= seq[0]; k++) o += writeCodePoint(&out[0] + o, seq[k]);
+    } else {
+      o += writeCodePoint(&out[0] + o, (uint32_t)((int32_t)c + (upper ? rec.upper : rec.lower)));
+    }
+    if (o != i) inPlace = false;
+  }
+  out.resize(o);
+  return out;
+}
+
+bool isHangulSyllable(uint32_t cp) noexcept {
+  return cp >= HANGUL_S && cp < HANGUL_S + HANGUL_COUNT;
+}
+
+// Appends the full decomposition of cp.
+void decompose(uint32_t cp, bool compat, std::vector<uint32_t>& out) {
+  if (isHangulSyllable(cp)) {
+    uint32_t index = cp - HANGUL_S;
+    out.push_back(HANGUL_L + index / HANGUL_N);
+    out.push_back(HANGUL_V + (index % HANGUL_N) / HANGUL_T_COUNT);
+    if (index % HANGUL_T_COUNT != 0) out.push_back(HANGUL_T + index % HANGUL_T_COUNT);
+    return;
+  }
+  const NormRecord& rec = normRecord(cp);
+  uint16_t offset = compat && rec.compatibility != 0 ? rec.compatibility : rec.canonical;
+  if (offset == 0) {
+    out.push_back(cp);
+    return;
+  }
+  const uint32_t* seq = normSequence(offset);
+  out.insert(out.end(), seq + 1, seq + 1 + seq[0]);
+}
+
+// Decomposes s into code points in canonical order.
+std::vector<uint32_t> decomposeAll(const Unit* s, size_t len, bool compat) {
+  std::vector<uint32_t> cps;
+  cps.reserve(len + len / 2);
+  for (size_t i = 0; i < len;) {
+    uint32_t c = readCodePoint(s, len, i);
+    decompose(c == INVALID ? REPLACEMENT_CHARACTER : c, compat, cps);
+  }
+  // Stable sort each run of non-starters by combining class
+  for (size_t i = 0; i < cps.size(); i++) {
+    if (normRecord(cps[i]).ccc == 0) continue;
+    size_t end = i;
+    while (end < cps.size() && normRecord(cps[end]).ccc != 0) end++;
+    if (end - i > 1) {
+      std::stable_sort(cps.begin() + i, cps.begin() + end, [](uint32_t a, uint32_t b) {
+        return normRecord(a).ccc < normRecord(b).ccc;
+      });
+    }
+    i = end;
+  }
+  return cps;
+}
+
+uint32_t composePair(uint32_t a, uint32_t b) noexcept {
+  if (a >= HANGUL_L && a < HANGUL_L + 19 && b >= HANGUL_V && b < HANGUL_V + HANGUL_V_COUNT) {
+    return HANGUL_S + ((a - HANGUL_L) * HANGUL_V_COUNT + (b - HANGUL_V)) * HANGUL_T_COUNT;
+  }
+  if (isHangulSyllable(a) && (a - HANGUL_S) % HANGUL_T_COUNT == 0 && b > HANGUL_T && b < HANGUL_T + HANGUL_T_COUNT) {
+    return a + (b - HANGUL_T);
+  }
+  if ((normRecord(b).flags & NFC_MAYBE) == 0) return 0;
+  const Composition* first = compositionsBegin();
+  const Composition* last = compositionsEnd();
+  const Composition* it = std::lower_bound(first, last, a, [](const Composition& c, uint32_t v) {
+    return c.first < v;
+  });
+  for (; it != last && it->first == a; ++it) {
+    if (it->second == b) return it->composite;
+  }
+  return 0;
+}
+
+// Canonical composition in place, per UAX #15.
+void composeAll(std::vector<uint32_t>& cps) {
+  if (cps.empty()) return;
+  size_t starter = 0;
+  unsigned lastClass = normRecord(cps[0]).ccc;
+  if (lastClass != 0) lastClass = 256;
+  size_t out = 1;
+  for (size_t i = 1; i < cps.size(); i++) {
+    uint32_t c = cps[i];
+    unsigned cls = normRecord(c).ccc;
+    if (lastClass < cls || lastClass == 0) {
+      uint32_t composite = composePair(cps[starter], c);
+      if (composite != 0) {
+        cps[starter] = composite;
+        continue;
+      }
+    }
+    if (cls == 0) starter = out;
+    lastClass = cls;
+    cps[out++] = c;
+  }
+  cps.resize(out);
+}
+
+Units encode(const std::vector<uint32_t>& cps) {
+  Units out;
+  out.resize(cps.size() * 4);
+  size_t o = 0;
+  for (uint32_t c : cps) o += writeCodePoint(&out[0] + o, c);
+  out.resize(o);
+  return out;
+}
+
+}
+
+Units toLowerCase(const Unit* s, size_t len) {
+  return mapCase(s, len, false);
+}
+
+Units toUpperCase(const Unit* s, size_t len) {
+  return mapCase(s, len, true);
+}
+
+bool isNormalized(const Unit* s, size_t len, Form form) noexcept {
+  const uint8_t reject = form == NFC ? (NFC_NO | NFC_MAYBE) : (form == NFKC ? (NFKC_NO | NFKC_MAYBE) : 0);
+  unsigned lastClass = 0;
+  size_t i = 0;
+  while (i < len) {
+    if (codeUnit(s[i]) < 0x80) {
+      i += transcode::asciiLength(s + i, len - i);
+      lastClass = 0;
+      if (i >= len) break;
+    }
+    uint32_t c = readCodePoint(s, len, i);
+    if (c == INVALID) return false;
+    // Everything below U+0300 is a starter that NFC leaves alone
+    if (c < 0x300 && form == NFC) {
+      lastClass = 0;
+      continue;
+    }
+    if (isHangulSyllable(c)) {
+      if (form == NFD || form == NFKD) return false;
+      lastClass = 0;
+      continue;
+    }
+    const NormRecord& rec = normRecord(c);
+    if (rec.ccc != 0 && lastClass > rec.ccc) return false;
+    if (form == NFD && rec.canonical != 0) return false;
+    if (form == NFKD && (rec.canonical != 0 || rec.compatibility != 0)) return false;
+    if ((rec.flags & reject) != 0) return false;
+    lastClass = rec.ccc;
+  }
+  return true;
+}
+
+Units normalize(const Unit* s, size_t len, Form form) {
+  std::vector<uint32_t> cps = decomposeAll(s, len, form == NFKC || form == NFKD);
+  if (form == NFC || form == NFKC) composeAll(cps);
+  return encode(cps);
+}
+
+int compare(const Unit* a, size_t alen, const Unit* b, size_t blen) {
+  std::vector<uint32_t> x = decomposeAll(a, alen, false);
+  std::vector<uint32_t> y = decomposeAll(b, blen, false);
+
+  // Primary: base letters without accents or case
+  size_t i = 0;
+  size_t j = 0;
+  for (;;) {
+    while (i < x.size() && normRecord(x[i]).ccc != 0) i++;
+    while (j < y.size() && normRecord(y[j]).ccc != 0) j++;
+    if (i == x.size() || j == y.size()) {
+      if (i != x.size()) return 1;
+      if (j != y.size()) return -1;
+      break;
+    }
+    uint32_t l = simpleLower(x[i++]);
+    uint32_t r = simpleLower(y[j++]);
+    if (l != r) return l < r ? -1 : 1;
+  }
+
+  // Secondary: accents
+  size_t n = std::min(x.size(), y.size());
+  for (size_t k = 0; k < n; k++) {
+    uint32_t l = simpleLower(x[k]);
+    uint32_t r = simpleLower(y[k]);
+    if (l != r) return l < r ? -1 : 1;
+  }
+  if (x.size() != y.size()) return x.size() < y.size() ? -1 : 1;
+
+  // Tertiary: lowercase before uppercase
+  for (size_t k = 0; k < n; k++) {
+    if (x[k] != y[k]) return x[k] == simpleLower(x[k]) ? -1 : 1;
+  }
+  return 0;
+}
+
+}
+}
+}
@@ -0,0 +1,87 @@
+#ifndef __JSCPP_UNICODE_HPP__
+#define __JSCPP_UNICODE_HPP__
+
+#include "jscpp/String.hpp"
+#include "transcode.hpp"
+
+namespace js {
+namespace internal {
+namespace unicode {
+
+enum CaseFlag {
+  CASED = 1,
+  CASE_IGNORABLE = 2
+};
+
+// Simple mappings are stored as deltas. lowerFull and upperFull are offsets
+// into caseSequence() for mappings that produce several code points (ß -> SS).
+struct CaseRecord {
+  int32_t lower;
+  int32_t upper;
+  uint16_t lowerFull;
+  uint16_t upperFull;
+  uint8_t flags;
+};
+
+enum NormFlag {
+  NFC_NO = 1,
+  NFC_MAYBE = 2,
+  NFKC_NO = 4,
+  NFKC_MAYBE = 8
+};
+
+// canonical and compatibility are offsets into normSequence() of the fully
+// expanded decomposition, 0 when there is none. compatibility is only set
+// when it differs from the canonical one. Hangul syllables are not in the
+// tables and are decomposed arithmetically.
+struct NormRecord {
+  uint8_t ccc;
+  uint8_t flags;
+  uint16_t canonical;
+  uint16_t compatibility;
+};
+
+struct Composition {
+  uint32_t first;
+  uint32_t second;
+  uint32_t composite;
+};
+
+// Generated by tools/unicode_tables.py into unicode_tables.cpp.
+const CaseRecord& caseRecord(uint32_t cp) noexcept;
+const NormRecord& normRecord(uint32_t cp) noexcept;
+// Sequences are stored as a length followed by that many code points.
+const uint32_t* caseSequence(uint16_t offset) noexcept;
+const uint32_t* normSequence(uint16_t offset) noexcept;
+// Canonical pairs sorted by first then second code point, without
+// composition exclusions.
+const Composition* compositionsBegin() noexcept;
+const Composition* compositionsEnd() noexcept;
+
+inline uint32_t simpleLower(uint32_t cp) noexcept {
+  return (uint32_t)((int32_t)cp + caseRecord(cp).lower);
+}
+
+inline uint32_t simpleUpper(uint32_t cp) noexcept {
+  return (uint32_t)((int32_t)cp + caseRecord(cp).upper);
+}
+
+enum Form { NFC, NFD, NFKC, NFKD };
+
+String::string_type toLowerCase(const String::value_type* s, size_t len);
+String::string_type toUpperCase(const String::value_type* s, size_t len);
+
+// True when normalizing would leave s unchanged, decided without
+// decomposing anything in the common case.
+bool isNormalized(const String::value_type* s, size_t len, Form form) noexcept;
+String::string_type normalize(const String::value_type* s, size_t len, Form form);
+
+// Root-locale style comparison: base letters first, then accents, then case
+// with lowercase first. Canonically equivalent strings compare equal.
+int compare(const String::value_type* a, size_t alen, const String::value_type* b, size_t blen);
+
+}
+}
+}
+
+#endif
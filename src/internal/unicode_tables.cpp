@@ -0,0 +1,9097 @@
+// Generated by tools/unicode_tables.py from Unicode 14.0.0. Do not edit.
+
+#include "./unicode.hpp"
+
+namespace js {
+namespace internal {
+namespace unicode {
+
+const uint32_t CASE_LIMIT = 0xE0200;
+
+const uint16_t caseStage1[7172] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 34, 34, 34, 35, 36, 34, 34, 34, 34, 34, 34, 37, 38,
+  39, 40, 41, 34, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+  54, 55, 56, 57, 34, 34, 34, 34, 34, 58, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 59, 60, 61, 62, 63, 34, 34, 34,
+  64, 65, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  66, 34, 34, 34, 34, 34, 34, 34, 34, 67, 34, 34, 68, 69, 70, 71,
+  72, 73, 74, 75, 76, 77, 78, 79, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 80, 81, 34, 34, 34, 34, 82, 83, 84, 85,
+  34, 34, 34, 86, 34, 87, 88, 34, 89, 90, 91, 92, 34, 34, 34, 93,
+  34, 34, 34, 34, 94, 95, 34, 34, 34, 96, 97, 34, 34, 98, 99, 100,
+  101, 102, 103, 104, 105, 106, 107, 34, 108, 109, 34, 110, 111, 112, 113, 34,
+  114, 115, 116, 117, 118, 119, 34, 34, 120, 121, 122, 123, 34, 124, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 125, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 126, 127, 34, 34, 34, 34, 34, 128, 34, 129, 130,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 131,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 132, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 133, 34,
+  34, 34, 134, 135, 136, 34, 34, 34, 137, 138, 139, 140, 140, 141, 142, 143,
+  34, 34, 34, 34, 144, 145, 34, 34, 34, 34, 34, 34, 34, 34, 146, 34,
+  147, 34, 148, 34, 34, 149, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 150, 151, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 152, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  153, 34, 154, 155,
+};
+
+const uint16_t caseStage2[19968] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 1, 0,
+  1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1,
+  0, 0, 0, 0, 1, 4, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 5,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 6,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  9, 10, 7, 8, 7, 8, 7, 8, 11, 7, 8, 7, 8, 7, 8, 7,
+  8, 7, 8, 7, 8, 7, 8, 7, 8, 12, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 13, 7, 8, 7, 8, 7, 8, 14,
+  15, 16, 7, 8, 7, 8, 17, 7, 8, 18, 18, 7, 8, 11, 19, 20,
+  21, 7, 8, 18, 22, 23, 24, 25, 7, 8, 26, 11, 24, 27, 28, 29,
+  7, 8, 7, 8, 7, 8, 30, 7, 8, 30, 11, 11, 7, 8, 30, 7,
+  8, 31, 31, 7, 8, 7, 8, 32, 7, 8, 11, 0, 7, 8, 11, 33,
+  0, 0, 0, 0, 34, 35, 36, 34, 35, 36, 34, 35, 36, 7, 8, 7,
+  8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 37, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  38, 34, 35, 36, 7, 8, 39, 40, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  41, 11, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 11, 11, 11, 11, 11, 11, 42, 7, 8, 43, 44, 45,
+  45, 7, 8, 46, 47, 48, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  49, 50, 51, 52, 53, 11, 54, 54, 11, 55, 11, 56, 57, 11, 11, 11,
+  54, 58, 11, 59, 11, 60, 61, 11, 62, 63, 61, 64, 65, 11, 11, 63,
+  11, 66, 67, 11, 11, 68, 11, 11, 11, 11, 11, 11, 11, 69, 11, 11,
+  70, 11, 71, 70, 11, 11, 11, 72, 70, 73, 74, 74, 75, 11, 11, 11,
+  11, 11, 76, 11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 77, 78, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 79, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  7, 8, 7, 8, 1, 1, 7, 8, 0, 0, 1, 28, 28, 28, 0, 80,
+  0, 0, 0, 0, 1, 1, 81, 1, 82, 82, 82, 0, 83, 0, 84, 84,
+  85, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 86, 87, 87, 87,
+  88, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 89, 3, 3, 3, 3, 3, 3, 3, 3, 3, 90, 91, 91, 92,
+  93, 94, 11, 11, 11, 95, 96, 97, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  98, 99, 100, 101, 102, 103, 0, 7, 8, 104, 7, 8, 11, 41, 41, 41,
+  105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 0, 1, 1, 1, 1, 1, 1, 1, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  106, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 107,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  0, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+  108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+  108, 108, 108, 108, 108, 108, 108, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+  11, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+  109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+  109, 109, 109, 109, 109, 109, 109, 110, 11, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+  0, 1, 1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+  0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+  0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+  0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 0, 0,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+  0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1,
+  1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+  0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+  1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+  1, 0, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 1, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 0, 111, 0, 0, 0, 0, 0, 111, 0, 0,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 0, 1, 112, 112, 112,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+  113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+  113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+  113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+  113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+  92, 92, 92, 92, 92, 92, 0, 0, 97, 97, 97, 97, 97, 97, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+  1, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0,
+  0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 1, 0, 1,
+  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+  1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+  114, 115, 116, 117, 117, 118, 119, 120, 121, 0, 0, 0, 0, 0, 0, 0,
+  122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+  122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+  122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 0, 0, 122, 122, 122,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 1, 123, 11, 11, 11, 124, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 125, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 126, 127, 128, 129, 130, 131, 11, 11, 132, 11,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  133, 133, 133, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134,
+  133, 133, 133, 133, 133, 133, 0, 0, 134, 134, 134, 134, 134, 134, 0, 0,
+  133, 133, 133, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134,
+  133, 133, 133, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134,
+  133, 133, 133, 133, 133, 133, 0, 0, 134, 134, 134, 134, 134, 134, 0, 0,
+  135, 133, 136, 133, 137, 133, 138, 133, 0, 134, 0, 134, 0, 134, 0, 134,
+  133, 133, 133, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134,
+  139, 139, 140, 140, 140, 140, 141, 141, 142, 142, 143, 143, 144, 144, 0, 0,
+  145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+  161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+  177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192,
+  133, 133, 193, 194, 195, 0, 196, 197, 134, 134, 198, 198, 199, 1, 200, 1,
+  1, 1, 201, 202, 203, 0, 204, 205, 206, 206, 206, 206, 207, 1, 1, 1,
+  133, 133, 208, 85, 0, 0, 209, 210, 134, 134, 211, 211, 0, 1, 1, 1,
+  133, 133, 212, 88, 213, 100, 214, 215, 134, 134, 216, 216, 104, 1, 1, 1,
+  0, 0, 217, 218, 219, 0, 220, 221, 222, 222, 223, 223, 224, 1, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 11, 0, 0, 0, 0, 11, 0, 0, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 0, 11, 0, 0, 0, 11, 11, 11, 11, 11, 0, 0,
+  0, 0, 0, 0, 11, 0, 225, 0, 11, 0, 226, 227, 11, 11, 0, 11,
+  11, 11, 228, 11, 11, 0, 0, 0, 0, 11, 0, 0, 11, 11, 11, 11,
+  0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 0, 0, 0, 0, 229, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+  231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+  0, 0, 0, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+  232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+  233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+  233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+  108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+  108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+  109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+  109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+  109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+  7, 8, 234, 235, 236, 237, 238, 7, 8, 7, 8, 7, 8, 239, 240, 241,
+  242, 11, 7, 8, 11, 7, 8, 11, 11, 11, 11, 11, 1, 1, 243, 243,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 11, 0, 0, 0, 0, 0, 0, 7, 8, 7, 8, 1,
+  1, 1, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+  244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+  244, 244, 244, 244, 244, 244, 0, 244, 0, 0, 0, 0, 0, 244, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+  0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 0, 1,
+  1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  11, 11, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  1, 11, 11, 11, 11, 11, 11, 11, 11, 7, 8, 7, 8, 245, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 1, 1, 1, 7, 8, 246, 11, 0,
+  7, 8, 7, 8, 247, 11, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 248, 249, 250, 251, 248, 11,
+  252, 253, 254, 255, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8,
+  7, 8, 7, 8, 256, 257, 258, 7, 8, 7, 8, 0, 0, 0, 0, 0,
+  7, 8, 0, 11, 0, 11, 7, 8, 7, 8, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 7, 8, 0, 1, 1, 11, 0, 0, 0, 0, 0,
+  0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0,
+  0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+  0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 259, 11, 11, 11, 11, 11, 11, 11, 1, 1, 1, 1, 1,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 1, 1, 1, 0, 0, 0, 0,
+  260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260,
+  260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260,
+  260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260,
+  260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260,
+  260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  261, 262, 263, 264, 265, 266, 266, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 267, 268, 269, 270, 271, 0, 0, 0, 0, 0, 0, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 1, 0,
+  1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272,
+  272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272,
+  272, 272, 272, 272, 272, 272, 272, 272, 273, 273, 273, 273, 273, 273, 273, 273,
+  273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+  273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272,
+  272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272,
+  272, 272, 272, 272, 0, 0, 0, 0, 273, 273, 273, 273, 273, 273, 273, 273,
+  273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+  273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 0, 274, 274, 274, 274,
+  274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 0, 274, 274, 274, 274,
+  274, 274, 274, 0, 274, 274, 0, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+  275, 275, 0, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+  275, 275, 0, 275, 275, 275, 275, 275, 275, 275, 0, 275, 275, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+  83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+  83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+  83, 83, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+  90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+  90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+  90, 90, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0,
+  0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1,
+  1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+  1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 1,
+  1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 1,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+  1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+  0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0,
+  0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+  1, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, 1, 1, 0, 1,
+  1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+  1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 11, 11,
+  0, 0, 11, 0, 0, 11, 11, 0, 0, 11, 11, 11, 11, 0, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 11, 0, 11, 11, 11,
+  11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 0, 0, 11, 11, 11,
+  11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11, 11, 0, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 0,
+  11, 11, 11, 11, 11, 0, 11, 0, 0, 0, 11, 11, 11, 11, 11, 11,
+  11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1,
+  1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+  276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+  276, 276, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+  277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+  277, 277, 277, 277, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const CaseRecord caseRecords[278] = {
+  { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 2 },
+  { 32, 0, 0, 0, 1 },
+  { 0, -32, 0, 0, 1 },
+  { 0, 743, 0, 0, 1 },
+  { 0, 0, 0, 1, 1 },
+  { 0, 121, 0, 0, 1 },
+  { 1, 0, 0, 0, 1 },
+  { 0, -1, 0, 0, 1 },
+  { -199, 0, 4, 0, 1 },
+  { 0, -232, 0, 0, 1 },
+  { 0, 0, 0, 0, 1 },
+  { 0, 0, 0, 7, 1 },
+  { -121, 0, 0, 0, 1 },
+  { 0, -300, 0, 0, 1 },
+  { 0, 195, 0, 0, 1 },
+  { 210, 0, 0, 0, 1 },
+  { 206, 0, 0, 0, 1 },
+  { 205, 0, 0, 0, 1 },
+  { 79, 0, 0, 0, 1 },
+  { 202, 0, 0, 0, 1 },
+  { 203, 0, 0, 0, 1 },
+  { 207, 0, 0, 0, 1 },
+  { 0, 97, 0, 0, 1 },
+  { 211, 0, 0, 0, 1 },
+  { 209, 0, 0, 0, 1 },
+  { 0, 163, 0, 0, 1 },
+  { 213, 0, 0, 0, 1 },
+  { 0, 130, 0, 0, 1 },
+  { 214, 0, 0, 0, 1 },
+  { 218, 0, 0, 0, 1 },
+  { 217, 0, 0, 0, 1 },
+  { 219, 0, 0, 0, 1 },
+  { 0, 56, 0, 0, 1 },
+  { 2, 0, 0, 0, 1 },
+  { 1, -1, 0, 0, 1 },
+  { 0, -2, 0, 0, 1 },
+  { 0, -79, 0, 0, 1 },
+  { 0, 0, 0, 10, 1 },
+  { -97, 0, 0, 0, 1 },
+  { -56, 0, 0, 0, 1 },
+  { -130, 0, 0, 0, 1 },
+  { 10795, 0, 0, 0, 1 },
+  { -163, 0, 0, 0, 1 },
+  { 10792, 0, 0, 0, 1 },
+  { 0, 10815, 0, 0, 1 },
+  { -195, 0, 0, 0, 1 },
+  { 69, 0, 0, 0, 1 },
+  { 71, 0, 0, 0, 1 },
+  { 0, 10783, 0, 0, 1 },
+  { 0, 10780, 0, 0, 1 },
+  { 0, 10782, 0, 0, 1 },
+  { 0, -210, 0, 0, 1 },
+  { 0, -206, 0, 0, 1 },
+  { 0, -205, 0, 0, 1 },
+  { 0, -202, 0, 0, 1 },
+  { 0, -203, 0, 0, 1 },
+  { 0, 42319, 0, 0, 1 },
+  { 0, 42315, 0, 0, 1 },
+  { 0, -207, 0, 0, 1 },
+  { 0, 42280, 0, 0, 1 },
+  { 0, 42308, 0, 0, 1 },
+  { 0, -209, 0, 0, 1 },
+  { 0, -211, 0, 0, 1 },
+  { 0, 10743, 0, 0, 1 },
+  { 0, 42305, 0, 0, 1 },
+  { 0, 10749, 0, 0, 1 },
+  { 0, -213, 0, 0, 1 },
+  { 0, -214, 0, 0, 1 },
+  { 0, 10727, 0, 0, 1 },
+  { 0, -218, 0, 0, 1 },
+  { 0, 42307, 0, 0, 1 },
+  { 0, 42282, 0, 0, 1 },
+  { 0, -69, 0, 0, 1 },
+  { 0, -217, 0, 0, 1 },
+  { 0, -71, 0, 0, 1 },
+  { 0, -219, 0, 0, 1 },
+  { 0, 42261, 0, 0, 1 },
+  { 0, 42258, 0, 0, 1 },
+  { 0, 84, 0, 0, 3 },
+  { 116, 0, 0, 0, 1 },
+  { 38, 0, 0, 0, 1 },
+  { 37, 0, 0, 0, 1 },
+  { 64, 0, 0, 0, 1 },
+  { 63, 0, 0, 0, 1 },
+  { 0, 0, 0, 13, 1 },
+  { 0, -38, 0, 0, 1 },
+  { 0, -37, 0, 0, 1 },
+  { 0, 0, 0, 17, 1 },
+  { 0, -31, 0, 0, 1 },
+  { 0, -64, 0, 0, 1 },
+  { 0, -63, 0, 0, 1 },
+  { 8, 0, 0, 0, 1 },
+  { 0, -62, 0, 0, 1 },
+  { 0, -57, 0, 0, 1 },
+  { 0, -47, 0, 0, 1 },
+  { 0, -54, 0, 0, 1 },
+  { 0, -8, 0, 0, 1 },
+  { 0, -86, 0, 0, 1 },
+  { 0, -80, 0, 0, 1 },
+  { 0, 7, 0, 0, 1 },
+  { 0, -116, 0, 0, 1 },
+  { -60, 0, 0, 0, 1 },
+  { 0, -96, 0, 0, 1 },
+  { -7, 0, 0, 0, 1 },
+  { 80, 0, 0, 0, 1 },
+  { 15, 0, 0, 0, 1 },
+  { 0, -15, 0, 0, 1 },
+  { 48, 0, 0, 0, 1 },
+  { 0, -48, 0, 0, 1 },
+  { 0, 0, 0, 21, 1 },
+  { 7264, 0, 0, 0, 1 },
+  { 0, 3008, 0, 0, 1 },
+  { 38864, 0, 0, 0, 1 },
+  { 0, -6254, 0, 0, 1 },
+  { 0, -6253, 0, 0, 1 },
+  { 0, -6244, 0, 0, 1 },
+  { 0, -6242, 0, 0, 1 },
+  { 0, -6243, 0, 0, 1 },
+  { 0, -6236, 0, 0, 1 },
+  { 0, -6181, 0, 0, 1 },
+  { 0, 35266, 0, 0, 1 },
+  { -3008, 0, 0, 0, 1 },
+  { 0, 35332, 0, 0, 1 },
+  { 0, 3814, 0, 0, 1 },
+  { 0, 35384, 0, 0, 1 },
+  { 0, 0, 0, 24, 1 },
+  { 0, 0, 0, 27, 1 },
+  { 0, 0, 0, 30, 1 },
+  { 0, 0, 0, 33, 1 },
+  { 0, 0, 0, 36, 1 },
+  { 0, -59, 0, 0, 1 },
+  { -7615, 0, 0, 0, 1 },
+  { 0, 8, 0, 0, 1 },
+  { -8, 0, 0, 0, 1 },
+  { 0, 0, 0, 39, 1 },
+  { 0, 0, 0, 42, 1 },
+  { 0, 0, 0, 46, 1 },
+  { 0, 0, 0, 50, 1 },
+  { 0, 74, 0, 0, 1 },
+  { 0, 86, 0, 0, 1 },
+  { 0, 100, 0, 0, 1 },
+  { 0, 128, 0, 0, 1 },
+  { 0, 112, 0, 0, 1 },
+  { 0, 126, 0, 0, 1 },
+  { 0, 8, 0, 54, 1 },
+  { 0, 8, 0, 57, 1 },
+  { 0, 8, 0, 60, 1 },
+  { 0, 8, 0, 63, 1 },
+  { 0, 8, 0, 66, 1 },
+  { 0, 8, 0, 69, 1 },
+  { 0, 8, 0, 72, 1 },
+  { 0, 8, 0, 75, 1 },
+  { -8, 0, 0, 54, 1 },
+  { -8, 0, 0, 57, 1 },
+  { -8, 0, 0, 60, 1 },
+  { -8, 0, 0, 63, 1 },
+  { -8, 0, 0, 66, 1 },
+  { -8, 0, 0, 69, 1 },
+  { -8, 0, 0, 72, 1 },
+  { -8, 0, 0, 75, 1 },
+  { 0, 8, 0, 78, 1 },
+  { 0, 8, 0, 81, 1 },
+  { 0, 8, 0, 84, 1 },
+  { 0, 8, 0, 87, 1 },
+  { 0, 8, 0, 90, 1 },
+  { 0, 8, 0, 93, 1 },
+  { 0, 8, 0, 96, 1 },
+  { 0, 8, 0, 99, 1 },
+  { -8, 0, 0, 78, 1 },
+  { -8, 0, 0, 81, 1 },
+  { -8, 0, 0, 84, 1 },
+  { -8, 0, 0, 87, 1 },
+  { -8, 0, 0, 90, 1 },
+  { -8, 0, 0, 93, 1 },
+  { -8, 0, 0, 96, 1 },
+  { -8, 0, 0, 99, 1 },
+  { 0, 8, 0, 102, 1 },
+  { 0, 8, 0, 105, 1 },
+  { 0, 8, 0, 108, 1 },
+  { 0, 8, 0, 111, 1 },
+  { 0, 8, 0, 114, 1 },
+  { 0, 8, 0, 117, 1 },
+  { 0, 8, 0, 120, 1 },
+  { 0, 8, 0, 123, 1 },
+  { -8, 0, 0, 102, 1 },
+  { -8, 0, 0, 105, 1 },
+  { -8, 0, 0, 108, 1 },
+  { -8, 0, 0, 111, 1 },
+  { -8, 0, 0, 114, 1 },
+  { -8, 0, 0, 117, 1 },
+  { -8, 0, 0, 120, 1 },
+  { -8, 0, 0, 123, 1 },
+  { 0, 0, 0, 126, 1 },
+  { 0, 9, 0, 129, 1 },
+  { 0, 0, 0, 132, 1 },
+  { 0, 0, 0, 135, 1 },
+  { 0, 0, 0, 138, 1 },
+  { -74, 0, 0, 0, 1 },
+  { -9, 0, 0, 129, 1 },
+  { 0, -7205, 0, 0, 1 },
+  { 0, 0, 0, 142, 1 },
+  { 0, 9, 0, 145, 1 },
+  { 0, 0, 0, 148, 1 },
+  { 0, 0, 0, 151, 1 },
+  { 0, 0, 0, 154, 1 },
+  { -86, 0, 0, 0, 1 },
+  { -9, 0, 0, 145, 1 },
+  { 0, 0, 0, 158, 1 },
+  { 0, 0, 0, 162, 1 },
+  { 0, 0, 0, 165, 1 },
+  { -100, 0, 0, 0, 1 },
+  { 0, 0, 0, 169, 1 },
+  { 0, 0, 0, 173, 1 },
+  { 0, 0, 0, 176, 1 },
+  { 0, 0, 0, 179, 1 },
+  { -112, 0, 0, 0, 1 },
+  { 0, 0, 0, 183, 1 },
+  { 0, 9, 0, 186, 1 },
+  { 0, 0, 0, 189, 1 },
+  { 0, 0, 0, 192, 1 },
+  { 0, 0, 0, 195, 1 },
+  { -128, 0, 0, 0, 1 },
+  { -126, 0, 0, 0, 1 },
+  { -9, 0, 0, 186, 1 },
+  { -7517, 0, 0, 0, 1 },
+  { -8383, 0, 0, 0, 1 },
+  { -8262, 0, 0, 0, 1 },
+  { 28, 0, 0, 0, 1 },
+  { 0, -28, 0, 0, 1 },
+  { 16, 0, 0, 0, 1 },
+  { 0, -16, 0, 0, 1 },
+  { 26, 0, 0, 0, 1 },
+  { 0, -26, 0, 0, 1 },
+  { -10743, 0, 0, 0, 1 },
+  { -3814, 0, 0, 0, 1 },
+  { -10727, 0, 0, 0, 1 },
+  { 0, -10795, 0, 0, 1 },
+  { 0, -10792, 0, 0, 1 },
+  { -10780, 0, 0, 0, 1 },
+  { -10749, 0, 0, 0, 1 },
+  { -10783, 0, 0, 0, 1 },
+  { -10782, 0, 0, 0, 1 },
+  { -10815, 0, 0, 0, 1 },
+  { 0, -7264, 0, 0, 1 },
+  { -35332, 0, 0, 0, 1 },
+  { -42280, 0, 0, 0, 1 },
+  { 0, 48, 0, 0, 1 },
+  { -42308, 0, 0, 0, 1 },
+  { -42319, 0, 0, 0, 1 },
+  { -42315, 0, 0, 0, 1 },
+  { -42305, 0, 0, 0, 1 },
+  { -42258, 0, 0, 0, 1 },
+  { -42282, 0, 0, 0, 1 },
+  { -42261, 0, 0, 0, 1 },
+  { 928, 0, 0, 0, 1 },
+  { -48, 0, 0, 0, 1 },
+  { -42307, 0, 0, 0, 1 },
+  { -35384, 0, 0, 0, 1 },
+  { 0, -928, 0, 0, 1 },
+  { 0, -38864, 0, 0, 1 },
+  { 0, 0, 0, 199, 1 },
+  { 0, 0, 0, 202, 1 },
+  { 0, 0, 0, 205, 1 },
+  { 0, 0, 0, 208, 1 },
+  { 0, 0, 0, 212, 1 },
+  { 0, 0, 0, 216, 1 },
+  { 0, 0, 0, 219, 1 },
+  { 0, 0, 0, 222, 1 },
+  { 0, 0, 0, 225, 1 },
+  { 0, 0, 0, 228, 1 },
+  { 0, 0, 0, 231, 1 },
+  { 40, 0, 0, 0, 1 },
+  { 0, -40, 0, 0, 1 },
+  { 39, 0, 0, 0, 1 },
+  { 0, -39, 0, 0, 1 },
+  { 34, 0, 0, 0, 1 },
+  { 0, -34, 0, 0, 1 },
+};
+
+const uint32_t caseSpecial[234] = {
+  0x0, 0x2, 0x53, 0x53, 0x2, 0x69, 0x307, 0x2, 0x2BC, 0x4E, 0x2, 0x4A,
+  0x30C, 0x3, 0x399, 0x308, 0x301, 0x3, 0x3A5, 0x308, 0x301, 0x2, 0x535, 0x552,
+  0x2, 0x48, 0x331, 0x2, 0x54, 0x308, 0x2, 0x57, 0x30A, 0x2, 0x59, 0x30A,
+  0x2, 0x41, 0x2BE, 0x2, 0x3A5, 0x313, 0x3, 0x3A5, 0x313, 0x300, 0x3, 0x3A5,
+  0x313, 0x301, 0x3, 0x3A5, 0x313, 0x342, 0x2, 0x1F08, 0x399, 0x2, 0x1F09, 0x399,
+  0x2, 0x1F0A, 0x399, 0x2, 0x1F0B, 0x399, 0x2, 0x1F0C, 0x399, 0x2, 0x1F0D, 0x399,
+  0x2, 0x1F0E, 0x399, 0x2, 0x1F0F, 0x399, 0x2, 0x1F28, 0x399, 0x2, 0x1F29, 0x399,
+  0x2, 0x1F2A, 0x399, 0x2, 0x1F2B, 0x399, 0x2, 0x1F2C, 0x399, 0x2, 0x1F2D, 0x399,
+  0x2, 0x1F2E, 0x399, 0x2, 0x1F2F, 0x399, 0x2, 0x1F68, 0x399, 0x2, 0x1F69, 0x399,
+  0x2, 0x1F6A, 0x399, 0x2, 0x1F6B, 0x399, 0x2, 0x1F6C, 0x399, 0x2, 0x1F6D, 0x399,
+  0x2, 0x1F6E, 0x399, 0x2, 0x1F6F, 0x399, 0x2, 0x1FBA, 0x399, 0x2, 0x391, 0x399,
+  0x2, 0x386, 0x399, 0x2, 0x391, 0x342, 0x3, 0x391, 0x342, 0x399, 0x2, 0x1FCA,
+  0x399, 0x2, 0x397, 0x399, 0x2, 0x389, 0x399, 0x2, 0x397, 0x342, 0x3, 0x397,
+  0x342, 0x399, 0x3, 0x399, 0x308, 0x300, 0x2, 0x399, 0x342, 0x3, 0x399, 0x308,
+  0x342, 0x3, 0x3A5, 0x308, 0x300, 0x2, 0x3A1, 0x313, 0x2, 0x3A5, 0x342, 0x3,
+  0x3A5, 0x308, 0x342, 0x2, 0x1FFA, 0x399, 0x2, 0x3A9, 0x399, 0x2, 0x38F, 0x399,
+  0x2, 0x3A9, 0x342, 0x3, 0x3A9, 0x342, 0x399, 0x2, 0x46, 0x46, 0x2, 0x46,
+  0x49, 0x2, 0x46, 0x4C, 0x3, 0x46, 0x46, 0x49, 0x3, 0x46, 0x46, 0x4C,
+  0x2, 0x53, 0x54, 0x2, 0x544, 0x546, 0x2, 0x544, 0x535, 0x2, 0x544, 0x53B,
+  0x2, 0x54E, 0x546, 0x2, 0x544, 0x53D,
+};
+
+const uint32_t NORM_LIMIT = 0x2FA80;
+
+const uint16_t normStage1[1525] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 13, 14,
+  15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+  31, 32, 33, 34, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 36, 37,
+  0, 38, 39, 0, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+  52, 53, 54, 55, 56, 57, 58, 0, 59, 60, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 61, 62, 0, 0, 63, 64, 65, 66, 0, 67, 68, 69,
+  70, 71, 72, 73, 74, 75, 76, 77, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 79, 80, 81,
+  82, 83, 84, 85, 0, 86, 87, 88, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+  0, 0, 0, 103, 0, 104, 105, 0, 0, 0, 0, 0, 0, 0, 0, 106,
+  0, 0, 0, 0, 107, 108, 0, 0, 0, 0, 109, 0, 0, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 0, 120, 121, 0, 122, 123, 124, 125, 0,
+  126, 0, 127, 128, 129, 130, 0, 0, 123, 0, 131, 132, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 133, 134, 0, 0, 0, 0, 0, 0, 0, 0, 135,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 137, 138, 139, 0, 0, 0, 140, 141, 142, 143, 144, 145, 146, 147,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  148, 0, 134, 0, 0, 149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 150, 151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 153, 0, 0,
+  0, 0, 154, 155, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 157, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  158, 159, 160, 161, 162,
+};
+
+const uint16_t normStage2[20864] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 0, 0, 0, 4,
+  0, 0, 5, 6, 7, 8, 0, 0, 9, 10, 11, 0, 12, 13, 14, 0,
+  15, 16, 17, 18, 19, 20, 0, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+  0, 30, 31, 32, 33, 34, 35, 0, 0, 36, 37, 38, 39, 40, 0, 0,
+  41, 42, 43, 44, 45, 46, 0, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+  0, 56, 57, 58, 59, 60, 61, 0, 0, 62, 63, 64, 65, 66, 0, 67,
+  68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+  0, 0, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+  98, 99, 100, 101, 102, 103, 0, 0, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 0, 113, 114, 115, 116, 117, 118, 0, 119, 120, 121, 122, 123, 124, 125,
+  126, 0, 0, 127, 128, 129, 130, 131, 132, 133, 0, 0, 134, 135, 136, 137,
+  138, 139, 0, 0, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+  152, 153, 154, 155, 156, 157, 0, 0, 158, 159, 160, 161, 162, 163, 164, 165,
+  166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  182, 183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184,
+  185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197,
+  198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 0, 211, 212,
+  213, 214, 215, 216, 0, 0, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226,
+  227, 228, 229, 230, 231, 232, 0, 0, 233, 234, 235, 236, 237, 238, 239, 240,
+  241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256,
+  257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 0, 0, 269, 270,
+  0, 0, 0, 0, 0, 0, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+  281, 282, 283, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  285, 286, 287, 288, 289, 290, 291, 292, 293, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 294, 295, 296, 297, 298, 299, 0, 0,
+  300, 301, 181, 302, 303, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  304, 304, 304, 304, 304, 305, 304, 304, 304, 304, 304, 304, 304, 305, 305, 304,
+  305, 304, 305, 304, 304, 306, 307, 307, 307, 307, 306, 308, 307, 307, 307, 307,
+  307, 309, 309, 310, 310, 310, 310, 311, 311, 307, 307, 307, 307, 310, 310, 307,
+  310, 310, 307, 307, 312, 312, 312, 312, 313, 307, 307, 307, 307, 305, 305, 305,
+  314, 315, 304, 316, 317, 318, 305, 307, 307, 307, 305, 305, 305, 307, 307, 0,
+  305, 305, 305, 307, 307, 307, 307, 305, 306, 307, 307, 305, 319, 320, 320, 319,
+  320, 320, 319, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+  0, 0, 0, 0, 321, 0, 0, 0, 0, 0, 322, 0, 0, 0, 323, 0,
+  0, 0, 0, 0, 7, 324, 325, 326, 327, 328, 329, 0, 330, 0, 331, 332,
+  333, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 334, 335, 336, 337, 338, 339,
+  340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 342, 343, 344, 345, 0,
+  346, 347, 348, 349, 350, 351, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  353, 354, 355, 0, 356, 357, 0, 0, 0, 358, 0, 0, 0, 0, 0, 0,
+  359, 360, 0, 361, 0, 0, 0, 362, 0, 0, 0, 0, 363, 364, 365, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 366, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  368, 369, 0, 370, 0, 0, 0, 371, 0, 0, 0, 0, 372, 373, 374, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 375, 376, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  379, 380, 381, 382, 0, 0, 383, 384, 0, 0, 385, 386, 387, 388, 389, 390,
+  0, 0, 391, 392, 393, 394, 395, 396, 0, 0, 397, 398, 399, 400, 401, 402,
+  403, 404, 405, 406, 407, 408, 0, 0, 409, 410, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 411, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 307, 305, 305, 305, 305, 307, 305, 305, 305, 412, 307, 305, 305, 305, 305,
+  305, 305, 307, 307, 307, 307, 307, 307, 305, 305, 307, 305, 305, 412, 413, 305,
+  414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 423, 424, 425, 426, 0, 427,
+  0, 428, 429, 0, 305, 307, 0, 422, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 305, 305, 305, 305, 305, 305, 305, 430, 431, 432, 0, 0, 0, 0, 0,
+  0, 0, 433, 434, 435, 436, 437, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 438, 439, 440, 430, 431,
+  432, 441, 442, 304, 304, 310, 307, 305, 305, 305, 305, 305, 307, 305, 305, 307,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  443, 0, 0, 0, 0, 444, 445, 446, 447, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  448, 0, 449, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 450, 0, 0, 305, 305, 305, 305, 305, 305, 305, 0, 0, 305,
+  305, 305, 305, 307, 305, 0, 0, 305, 305, 0, 307, 305, 305, 307, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 307, 305, 305, 307, 305, 305, 307, 307, 307, 305, 307, 307, 305, 307, 305,
+  305, 305, 307, 305, 307, 305, 307, 305, 307, 305, 305, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 305,
+  305, 305, 307, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 0, 305, 305, 305, 305, 305,
+  305, 305, 305, 305, 0, 305, 305, 305, 0, 305, 305, 305, 305, 305, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 307, 307, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 305, 307, 307, 307, 305, 305, 305, 305,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 305, 307,
+  307, 307, 307, 307, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+  305, 305, 0, 307, 305, 305, 307, 305, 305, 307, 305, 305, 305, 307, 307, 307,
+  438, 439, 440, 305, 305, 305, 307, 305, 305, 307, 307, 305, 305, 305, 305, 305,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0,
+  0, 453, 0, 0, 454, 0, 0, 0, 0, 0, 0, 0, 455, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0,
+  0, 305, 307, 305, 305, 0, 0, 0, 457, 458, 459, 460, 461, 462, 463, 464,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 466, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 467, 468, 456, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0, 469, 470, 0, 471,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 472, 0, 0, 473, 0, 0, 0, 0, 0, 465, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 474, 475, 476, 0, 0, 477, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 466, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 478, 0, 0, 479, 480, 456, 0, 0,
+  0, 0, 0, 0, 0, 0, 466, 466, 0, 0, 0, 0, 481, 482, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 484, 485, 486, 456, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 487, 0, 0, 0, 0, 456, 0, 0,
+  0, 0, 0, 0, 0, 488, 489, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 0,
+  490, 0, 466, 0, 0, 0, 0, 491, 492, 0, 493, 494, 0, 456, 0, 0,
+  0, 0, 0, 0, 0, 466, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 456, 0, 466, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 495, 496, 497, 456, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 0, 0, 0, 0, 466,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 499, 0, 500, 501, 502, 466,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 503, 0, 0, 0, 0, 504, 504, 456, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 505, 505, 505, 505, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 506, 0, 0, 0, 0, 507, 507, 456, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 508, 508, 508, 508, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 509, 510, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 307, 307, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 307, 0, 307, 0, 512, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 513, 0, 0, 0, 0, 0, 0, 0, 0, 0, 514, 0, 0,
+  0, 0, 515, 0, 0, 0, 0, 516, 0, 0, 0, 0, 517, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 518, 0, 0, 0, 0, 0, 0,
+  0, 519, 520, 521, 522, 523, 524, 525, 526, 527, 520, 520, 520, 520, 0, 0,
+  520, 528, 305, 305, 456, 0, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 529, 0, 0, 0, 0, 0, 0, 0, 0, 0, 530, 0, 0,
+  0, 0, 531, 0, 0, 0, 0, 532, 0, 0, 0, 0, 533, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 534, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 535, 0, 0, 0, 0, 0, 0, 0, 466, 0,
+  0, 0, 0, 0, 0, 0, 0, 465, 0, 456, 456, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 536, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+  466, 466, 466, 466, 466, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 466, 466, 466, 466, 466, 466, 466, 466,
+  466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+  466, 466, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 456, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 412, 305, 307, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 305, 307, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 305, 305, 0, 0, 307,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 305, 305, 305, 305, 307, 307, 307, 307, 307, 307, 305, 305, 307, 0, 307,
+  307, 305, 305, 307, 307, 305, 305, 305, 305, 305, 307, 305, 305, 305, 305, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 537, 0, 538, 0, 539, 0, 540, 0, 541, 0,
+  0, 0, 542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 465, 466, 0, 0, 0, 0, 0, 543, 0, 544, 0, 0,
+  545, 546, 0, 547, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 307, 305, 305, 305,
+  305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 456, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 456, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 305, 305, 0, 312, 307, 307, 307, 307, 307, 305, 305, 307, 307, 307, 307,
+  305, 0, 312, 312, 312, 312, 312, 312, 312, 0, 0, 0, 0, 307, 0, 0,
+  0, 0, 0, 0, 305, 0, 0, 0, 305, 305, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 548, 549, 550, 0,
+  551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 0, 562, 563, 564, 565,
+  566, 567, 568, 3, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 0, 579,
+  580, 581, 11, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 346, 592, 593,
+  351, 594, 595, 288, 587, 590, 346, 592, 354, 351, 594, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 596, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 597, 598, 599, 600, 577,
+  601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616,
+  617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 347,
+  305, 305, 307, 305, 305, 305, 305, 305, 305, 305, 307, 305, 305, 320, 632, 307,
+  309, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+  305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+  305, 305, 305, 305, 305, 305, 306, 413, 413, 307, 633, 305, 319, 307, 305, 307,
+  634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649,
+  650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665,
+  666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681,
+  682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697,
+  698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713,
+  714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729,
+  730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745,
+  746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761,
+  762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777,
+  778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 0, 0, 0, 0,
+  790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805,
+  806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821,
+  822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837,
+  838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853,
+  854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869,
+  870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 0, 0, 0, 0, 0, 0,
+  880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895,
+  896, 897, 898, 899, 900, 901, 0, 0, 902, 903, 904, 905, 906, 907, 0, 0,
+  908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923,
+  924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939,
+  940, 941, 942, 943, 944, 945, 0, 0, 946, 947, 948, 949, 950, 951, 0, 0,
+  952, 953, 954, 955, 956, 957, 958, 959, 0, 960, 0, 961, 0, 962, 0, 963,
+  964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979,
+  980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 0, 0,
+  994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009,
+  1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025,
+  1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041,
+  1042, 1043, 1044, 1045, 1046, 0, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1054,
+  1056, 1057, 1058, 1059, 1060, 0, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+  1071, 1072, 1073, 1074, 0, 0, 1075, 1076, 1077, 1078, 1079, 1080, 0, 1081, 1082, 1083,
+  1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099,
+  0, 0, 1100, 1101, 1102, 0, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 0,
+  1112, 1113, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 1114, 0, 0, 0, 0, 0, 1115, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1116, 1117, 1118, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 1119, 1120, 0, 1121, 1122, 0, 0, 0, 0, 1123, 0, 1124, 0,
+  0, 0, 0, 0, 0, 0, 0, 1125, 1126, 1127, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1128, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1129, 595, 0, 0, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141,
+  1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 0,
+  3, 574, 11, 302, 575, 285, 579, 301, 580, 1141, 585, 181, 586, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1142, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 305, 312, 312, 305, 305, 305, 305, 312, 312, 312, 305, 305, 0, 0, 0,
+  0, 305, 0, 0, 0, 312, 312, 305, 307, 305, 312, 312, 307, 307, 307, 307,
+  305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1143, 1144, 1145, 1146, 0, 1147, 1148, 1149, 0, 1150, 578, 555, 555, 555, 285, 1151,
+  556, 556, 559, 301, 0, 561, 1152, 0, 0, 564, 1153, 565, 565, 565, 0, 0,
+  1154, 1155, 1156, 0, 1157, 0, 1158, 0, 1157, 0, 1159, 1160, 550, 1145, 0, 574,
+  552, 1161, 0, 560, 11, 1162, 1163, 1164, 1165, 595, 0, 1166, 352, 592, 1167, 1168,
+  1169, 0, 0, 0, 0, 551, 573, 574, 595, 287, 0, 0, 0, 0, 0, 0,
+  1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185,
+  556, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 559, 1145, 551, 560,
+  595, 1197, 1198, 1199, 590, 1200, 1201, 1202, 1203, 302, 1204, 1205, 301, 598, 573, 580,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1206, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1207, 1208, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1209, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1210, 1211, 1212,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1213, 0, 0, 0, 0, 1214, 0, 0, 1215, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1216, 0, 1217, 0, 0, 0, 0, 0, 1218, 1219, 0, 1220,
+  1221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1222, 0, 0, 1223, 0, 0, 1224, 0, 1225, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1226, 0, 1227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1228, 1229, 1230,
+  1231, 1232, 0, 0, 1233, 1234, 0, 0, 1235, 1236, 0, 0, 0, 0, 0, 0,
+  1237, 1238, 0, 0, 1239, 1240, 0, 0, 1241, 1242, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1243, 1244, 1245, 1246,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1247, 1248, 1249, 1250, 0, 0, 0, 0, 0, 0, 1251, 1252, 1253, 1254, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1255, 1256, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+  1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+  1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+  1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+  1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+  1328, 1329, 1330, 1331, 1332, 1333, 548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557,
+  558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157,
+  3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141, 11, 585,
+  1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 1129, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1337, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1338, 1339, 1340, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1341, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 287, 1189, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305,
+  305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1342,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+  305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1343,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1344, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
+  1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376,
+  1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392,
+  1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408,
+  1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+  1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440,
+  1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456,
+  1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472,
+  1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
+  1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
+  1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520,
+  1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536,
+  1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552,
+  1553, 1554, 1555, 1556, 1557, 1558, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 633, 413, 306, 412, 1559, 1559,
+  0, 0, 0, 0, 0, 0, 1560, 0, 1368, 1561, 1562, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1563, 0, 1564, 0,
+  1565, 0, 1566, 0, 1567, 0, 1568, 0, 1569, 0, 1570, 0, 1571, 0, 1572, 0,
+  1573, 0, 1574, 0, 0, 1575, 0, 1576, 0, 1577, 0, 0, 0, 0, 0, 0,
+  1578, 1579, 0, 1580, 1581, 0, 1582, 1583, 0, 1584, 1585, 0, 1586, 1587, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1588, 0, 0, 0, 0, 1589, 1589, 1590, 1591, 0, 1592, 1593,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1594, 0, 1595, 0,
+  1596, 0, 1597, 0, 1598, 0, 1599, 0, 1600, 0, 1601, 0, 1602, 0, 1603, 0,
+  1604, 0, 1605, 0, 0, 1606, 0, 1607, 0, 1608, 0, 0, 0, 0, 0, 0,
+  1609, 1610, 0, 1611, 1612, 0, 1613, 1614, 0, 1615, 1616, 0, 1617, 1618, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1619, 0, 0, 1620, 1621, 1622, 1623, 0, 0, 0, 1624, 1625,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640,
+  1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656,
+  1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672,
+  1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688,
+  1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
+  1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 0,
+  0, 0, 1345, 1351, 1720, 1721, 1722, 1723, 1724, 1725, 1349, 1726, 1727, 1728, 1729, 1353,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745,
+  1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 0,
+  1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776,
+  1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792,
+  1793, 1794, 1795, 1796, 1797, 1798, 1411, 1799, 0, 0, 0, 0, 0, 0, 0, 0,
+  1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815,
+  1626, 1629, 1632, 1634, 1642, 1643, 1646, 1648, 1649, 1651, 1652, 1653, 1654, 1655, 1816, 1817,
+  1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 0,
+  1345, 1351, 1720, 1721, 1833, 1834, 1835, 1356, 1836, 1368, 1418, 1430, 1429, 1419, 1511, 1376,
+  1416, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1382, 1847, 1848, 1849, 1850,
+  1851, 1852, 1853, 1854, 1722, 1723, 1724, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863,
+  1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879,
+  1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895,
+  1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911,
+  1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927,
+  1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943,
+  1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959,
+  1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975,
+  1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991,
+  1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,
+  2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023,
+  2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039,
+  2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055,
+  2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071,
+  2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087,
+  2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103,
+  2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119,
+  2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135,
+  2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151,
+  2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167,
+  2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183,
+  2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305,
+  0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2200, 2201, 305, 305,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1145, 1161, 1153, 0, 0, 0, 2203, 2204, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+  305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 307, 307, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 0, 305, 305, 307, 0, 0, 305, 305, 0, 0, 0, 0, 0, 305, 305,
+  0, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2205, 2206, 2207, 2208,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2209, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224,
+  2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240,
+  2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256,
+  2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272,
+  2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288,
+  2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2229, 2301, 2302, 2303,
+  2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319,
+  2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335,
+  2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351,
+  2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367,
+  2368, 2319, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2303, 2377, 2378, 2379, 2380, 2381,
+  2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2229,
+  2397, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412,
+  2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2305, 2424, 2425, 2426, 2427,
+  2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443,
+  2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459,
+  2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 0, 0,
+  2474, 0, 2475, 0, 0, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 0,
+  2486, 0, 2487, 0, 0, 2488, 2489, 0, 0, 0, 2490, 2491, 2492, 2493, 2494, 2495,
+  2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511,
+  2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527,
+  2528, 2529, 2530, 2531, 2532, 2533, 2534, 2358, 2535, 2536, 2537, 2538, 2539, 2540, 2540, 2541,
+  2542, 2543, 2544, 2545, 2546, 2547, 2548, 2488, 2549, 2550, 2551, 2552, 2553, 2554, 0, 0,
+  2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2502, 2563, 2564, 2565, 2474, 2566, 2567, 2568,
+  2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2511, 2578, 2512, 2579, 2580, 2581, 2582,
+  2583, 2475, 2250, 2584, 2585, 2586, 2320, 2407, 2587, 2588, 2519, 2589, 2520, 2590, 2591, 2592,
+  2477, 2593, 2594, 2595, 2596, 2597, 2478, 2598, 2599, 2600, 2601, 2602, 2603, 2534, 2604, 2605,
+  2358, 2606, 2538, 2607, 2608, 2609, 2610, 2611, 2543, 2612, 2487, 2613, 2544, 2301, 2614, 2545,
+  2615, 2547, 2616, 2617, 2618, 2619, 2620, 2549, 2483, 2621, 2550, 2622, 2551, 2623, 2217, 2624,
+  2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2635, 2636, 2637, 2638, 2639, 2640, 2640, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2641, 2642, 2643, 2644, 2645, 0, 0, 0, 0, 0, 2646, 2647, 2648,
+  2649, 1162, 1165, 2650, 2651, 2652, 2653, 2654, 2655, 1136, 2656, 2657, 2658, 2659, 2660, 2661,
+  2662, 2663, 2664, 2665, 2666, 2667, 2668, 0, 2669, 2670, 2671, 2672, 2673, 0, 2674, 0,
+  2675, 2676, 0, 2677, 2678, 0, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688,
+  2689, 2689, 2690, 2690, 2690, 2690, 2691, 2691, 2691, 2691, 2692, 2692, 2692, 2692, 2693, 2693,
+  2693, 2693, 2694, 2694, 2694, 2694, 2695, 2695, 2695, 2695, 2696, 2696, 2696, 2696, 2697, 2697,
+  2697, 2697, 2698, 2698, 2698, 2698, 2699, 2699, 2699, 2699, 2700, 2700, 2700, 2700, 2701, 2701,
+  2701, 2701, 2702, 2702, 2703, 2703, 2704, 2704, 2705, 2705, 2706, 2706, 2707, 2707, 2708, 2708,
+  2708, 2708, 2709, 2709, 2709, 2709, 2710, 2710, 2710, 2710, 2711, 2711, 2711, 2711, 2712, 2712,
+  2713, 2713, 2713, 2713, 2714, 2714, 2715, 2715, 2715, 2715, 2716, 2716, 2716, 2716, 2717, 2717,
+  2718, 2718, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2719, 2719, 2719, 2719, 2720, 2720, 2721, 2721, 2722, 2722, 446, 2723, 2723,
+  2724, 2724, 2725, 2725, 2726, 2726, 2726, 2726, 2727, 2727, 2728, 2728, 2729, 2729, 2730, 2730,
+  2731, 2731, 2732, 2732, 2733, 2733, 2734, 2734, 2734, 2735, 2735, 2735, 2736, 2736, 2736, 2736,
+  2737, 2738, 2739, 2735, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751,
+  2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767,
+  2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783,
+  2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799,
+  2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815,
+  2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831,
+  2832, 2833, 2834, 2835, 2836, 2837, 2739, 2838, 2735, 2740, 2839, 2840, 2744, 2841, 2745, 2746,
+  2842, 2843, 2750, 2844, 2751, 2752, 2845, 2846, 2754, 2847, 2755, 2756, 2785, 2786, 2789, 2790,
+  2791, 2795, 2796, 2797, 2798, 2802, 2803, 2804, 2848, 2808, 2849, 2850, 2814, 2851, 2815, 2816,
+  2829, 2852, 2853, 2824, 2854, 2825, 2826, 2737, 2738, 2855, 2739, 2856, 2741, 2742, 2743, 2744,
+  2857, 2747, 2748, 2749, 2750, 2858, 2754, 2757, 2758, 2759, 2760, 2761, 2763, 2764, 2765, 2766,
+  2767, 2768, 2859, 2769, 2770, 2771, 2772, 2773, 2774, 2776, 2777, 2778, 2779, 2780, 2781, 2782,
+  2783, 2784, 2787, 2788, 2792, 2793, 2794, 2795, 2796, 2799, 2800, 2801, 2802, 2860, 2805, 2806,
+  2807, 2808, 2811, 2812, 2813, 2814, 2861, 2817, 2818, 2862, 2821, 2822, 2823, 2824, 2863, 2739,
+  2856, 2744, 2857, 2750, 2858, 2754, 2864, 2767, 2865, 2866, 2867, 2795, 2796, 2802, 2814, 2861,
+  2824, 2863, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881,
+  2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2866, 2894, 2895, 2896,
+  2897, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885,
+  2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2866, 2894, 2895, 2896, 2897, 2891, 2892, 2893,
+  2866, 2865, 2867, 2775, 2764, 2765, 2766, 2891, 2892, 2893, 2775, 2776, 2898, 2898, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2899, 2900, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2906, 2907, 2908, 2909, 2910, 2911, 2912,
+  2912, 2913, 2914, 2914, 2915, 2915, 2916, 2917, 2917, 2918, 2919, 2919, 2920, 2920, 2921, 2922,
+  2922, 2923, 2923, 2924, 2925, 2926, 2927, 2927, 2928, 2929, 2930, 2931, 2932, 2932, 2933, 2934,
+  2935, 2936, 2937, 2938, 2938, 2939, 2939, 2940, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947,
+  0, 0, 2948, 2949, 2950, 2951, 2952, 2953, 2953, 2954, 2955, 2956, 2957, 2957, 2958, 2959,
+  2960, 2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975,
+  2976, 2977, 2978, 2979, 2933, 2935, 2980, 2981, 2982, 2983, 2984, 2985, 2984, 2982, 2986, 2987,
+  2988, 2989, 2990, 2985, 2926, 2916, 2991, 2992, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 1118, 0, 0, 0, 0, 0, 0,
+  305, 305, 305, 305, 305, 305, 305, 307, 307, 307, 307, 307, 307, 307, 305, 305,
+  1117, 3015, 3016, 3017, 3017, 1139, 1140, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026,
+  3027, 3028, 3029, 3030, 3031, 0, 0, 3032, 3033, 1124, 1124, 1124, 1124, 3017, 3017, 3017,
+  3006, 3007, 1116, 0, 3010, 3009, 3012, 3011, 3015, 1139, 1140, 3018, 3019, 3020, 3021, 3034,
+  3035, 3036, 1136, 3037, 3038, 3039, 1138, 0, 3040, 3041, 3042, 3043, 0, 0, 0, 0,
+  3044, 3045, 3046, 0, 3047, 0, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057,
+  3058, 3059, 3059, 3060, 3060, 3061, 3061, 3062, 3062, 3063, 3063, 3063, 3063, 3064, 3064, 3065,
+  3065, 3065, 3065, 3066, 3066, 3067, 3067, 3067, 3067, 3068, 3068, 3068, 3068, 3069, 3069, 3069,
+  3069, 3070, 3070, 3070, 3070, 3071, 3071, 3071, 3071, 3072, 3072, 3073, 3073, 3074, 3074, 3075,
+  3075, 3076, 3076, 3076, 3076, 3077, 3077, 3077, 3077, 3078, 3078, 3078, 3078, 3079, 3079, 3079,
+  3079, 3080, 3080, 3080, 3080, 3081, 3081, 3081, 3081, 3082, 3082, 3082, 3082, 3083, 3083, 3083,
+  3083, 3084, 3084, 3084, 3084, 3085, 3085, 3085, 3085, 3086, 3086, 3086, 3086, 3087, 3087, 3087,
+  3087, 3088, 3088, 3088, 3088, 3089, 3089, 3089, 3089, 3090, 3090, 3090, 3090, 3091, 3091, 2727,
+  2727, 3092, 3092, 3092, 3092, 3093, 3093, 3094, 3094, 3095, 3095, 3096, 3096, 0, 0, 0,
+  0, 3011, 3097, 3034, 3041, 3042, 3035, 3098, 1139, 1140, 3036, 1136, 3006, 3037, 1116, 3099,
+  1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 3009, 3010, 3038, 1138, 3039, 3012,
+  3043, 548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562,
+  564, 1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3032, 3040, 3033, 3100, 3017,
+  3101, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141, 11,
+  585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 3018, 3102, 3019, 3103, 3104,
+  3105, 3008, 3028, 3029, 3007, 3106, 1942, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115,
+  3116, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910,
+  1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926,
+  1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 3117, 3118, 3119,
+  1677, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640,
+  1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 0,
+  0, 0, 1656, 1657, 1658, 1659, 1660, 1661, 0, 0, 1662, 1663, 1664, 1665, 1666, 1667,
+  0, 0, 1668, 1669, 1670, 1671, 1672, 1673, 0, 0, 1674, 1675, 1676, 0, 0, 0,
+  3120, 3121, 3122, 4, 3123, 3124, 3125, 0, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0,
+  0, 3133, 3134, 3135, 3136, 3137, 0, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146,
+  3147, 3148, 3149, 3150, 3151, 1151, 3152, 3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161,
+  3162, 3163, 3164, 3165, 3166, 1336, 3167, 3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176,
+  3177, 0, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 305,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 305, 312, 307, 0, 0, 0, 0, 456,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 305, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 307, 307, 305, 305, 305, 307, 305, 307, 307, 307,
+  307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 305, 307, 305, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3187, 0, 3188, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3189, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 455, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0, 0, 0, 3190, 3191,
+  0, 0, 0, 456, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 456, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 456, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 465, 0, 466, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3192, 3193, 456, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 305, 0, 0, 0,
+  305, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 456, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466, 3194, 3195, 466, 3196, 0,
+  0, 0, 456, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3197, 3198, 0, 0, 0, 456,
+  465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 456, 465, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 465, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  466, 0, 0, 0, 0, 0, 0, 0, 3199, 0, 0, 0, 0, 456, 456, 0,
+  0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 465, 0, 456, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  312, 312, 312, 312, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 305, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3200, 3200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 312, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3201, 3202,
+  3203, 3204, 3205, 3206, 3207, 512, 512, 312, 312, 312, 0, 0, 0, 3208, 512, 512,
+  512, 512, 512, 0, 0, 0, 0, 0, 0, 0, 0, 307, 307, 307, 307, 307,
+  307, 307, 307, 0, 0, 305, 305, 305, 305, 305, 307, 307, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3209, 3210, 3211, 3212, 3213,
+  3214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564,
+  1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601,
+  578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590,
+  292, 302, 293, 628, 548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559,
+  560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572,
+  598, 573, 574, 601, 578, 0, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288,
+  181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 1145, 551, 552, 1161, 554, 555,
+  556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194,
+  1335, 1157, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141,
+  11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 548, 0, 1145, 551,
+  0, 0, 554, 0, 0, 557, 558, 0, 0, 561, 562, 564, 1153, 0, 1334, 566,
+  567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 0, 601, 0, 285, 595, 287,
+  579, 301, 580, 1141, 0, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628,
+  548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564,
+  1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601,
+  578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590,
+  292, 302, 293, 628, 548, 550, 0, 551, 552, 1161, 554, 0, 0, 557, 558, 559,
+  560, 561, 562, 564, 1153, 0, 1334, 566, 567, 1189, 568, 1194, 1335, 0, 3, 572,
+  598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288,
+  181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 0, 551, 552, 1161, 554, 0,
+  556, 557, 558, 559, 560, 0, 562, 0, 0, 0, 1334, 566, 567, 1189, 568, 1194,
+  1335, 0, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141,
+  11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 1145, 551,
+  552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566,
+  567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287,
+  579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628,
+  548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564,
+  1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601,
+  578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590,
+  292, 302, 293, 628, 548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559,
+  560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572,
+  598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288,
+  181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 1145, 551, 552, 1161, 554, 555,
+  556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194,
+  1335, 1157, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141,
+  11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 1145, 551,
+  552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566,
+  567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287,
+  579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628,
+  548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564,
+  1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601,
+  578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590,
+  292, 302, 293, 628, 3215, 3216, 0, 0, 3217, 3218, 1167, 3219, 3220, 3221, 3222, 356,
+  3223, 3224, 3225, 3226, 3227, 3228, 3229, 1168, 3230, 356, 358, 3231, 348, 3232, 3233, 3234,
+  3235, 3236, 3237, 346, 592, 593, 357, 3238, 3239, 347, 3240, 353, 3241, 8, 3242, 3243,
+  3244, 352, 354, 355, 3245, 3246, 3247, 351, 594, 3248, 3249, 3250, 357, 347, 353, 351,
+  354, 352, 3217, 3218, 1167, 3219, 3220, 3221, 3222, 356, 3223, 3224, 3225, 3226, 3227, 3228,
+  3229, 1168, 3230, 356, 358, 3231, 348, 3232, 3233, 3234, 3235, 3236, 3237, 346, 592, 593,
+  357, 3238, 3239, 347, 3240, 353, 3241, 8, 3242, 3243, 3244, 352, 354, 355, 3245, 3246,
+  3247, 351, 594, 3248, 3249, 3250, 357, 347, 353, 351, 354, 352, 3217, 3218, 1167, 3219,
+  3220, 3221, 3222, 356, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 1168, 3230, 356, 358, 3231,
+  348, 3232, 3233, 3234, 3235, 3236, 3237, 346, 592, 593, 357, 3238, 3239, 347, 3240, 353,
+  3241, 8, 3242, 3243, 3244, 352, 354, 355, 3245, 3246, 3247, 351, 594, 3248, 3249, 3250,
+  357, 347, 353, 351, 354, 352, 3217, 3218, 1167, 3219, 3220, 3221, 3222, 356, 3223, 3224,
+  3225, 3226, 3227, 3228, 3229, 1168, 3230, 356, 358, 3231, 348, 3232, 3233, 3234, 3235, 3236,
+  3237, 346, 592, 593, 357, 3238, 3239, 347, 3240, 353, 3241, 8, 3242, 3243, 3244, 352,
+  354, 355, 3245, 3246, 3247, 351, 594, 3248, 3249, 3250, 357, 347, 353, 351, 354, 352,
+  3217, 3218, 1167, 3219, 3220, 3221, 3222, 356, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 1168,
+  3230, 356, 358, 3231, 348, 3232, 3233, 3234, 3235, 3236, 3237, 346, 592, 593, 357, 3238,
+  3239, 347, 3240, 353, 3241, 8, 3242, 3243, 3244, 352, 354, 355, 3245, 3246, 3247, 351,
+  594, 3248, 3249, 3250, 357, 347, 353, 351, 354, 352, 3251, 3252, 0, 0, 1129, 10,
+  5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 1129, 10, 5, 6, 1130, 1131, 1132, 1133,
+  1134, 1135, 1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 1129, 10, 5, 6,
+  1130, 1131, 1132, 1133, 1134, 1135, 1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135,
+  305, 305, 305, 305, 305, 305, 305, 0, 305, 305, 305, 305, 305, 305, 305, 305,
+  305, 305, 305, 305, 305, 305, 305, 305, 305, 0, 0, 305, 305, 305, 305, 305,
+  305, 305, 0, 305, 305, 0, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  307, 307, 307, 307, 307, 307, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 465, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3064, 3065, 3069, 3072, 0, 3091, 3075, 3070, 3080, 3092, 3086, 3087, 3088, 3089, 3076, 3082,
+  3084, 3078, 3085, 3074, 3077, 3067, 3068, 3071, 3073, 3079, 3081, 3083, 3253, 2712, 3254, 3255,
+  0, 3065, 3069, 0, 3090, 0, 0, 3070, 0, 3092, 3086, 3087, 3088, 3089, 3076, 3082,
+  3084, 3078, 3085, 0, 3077, 3067, 3068, 3071, 0, 3079, 0, 3083, 0, 0, 0, 0,
+  0, 0, 3069, 0, 0, 0, 0, 3070, 0, 3092, 0, 3087, 0, 3089, 3076, 3082,
+  0, 3078, 3085, 0, 3077, 0, 0, 3071, 0, 3079, 0, 3083, 0, 2712, 0, 3255,
+  0, 3065, 3069, 0, 3090, 0, 0, 3070, 3080, 3092, 3086, 0, 3088, 3089, 3076, 3082,
+  3084, 3078, 3085, 0, 3077, 3067, 3068, 3071, 0, 3079, 3081, 3083, 3253, 0, 3254, 0,
+  3064, 3065, 3069, 3072, 3090, 3091, 3075, 3070, 3080, 3092, 0, 3087, 3088, 3089, 3076, 3082,
+  3084, 3078, 3085, 3074, 3077, 3067, 3068, 3071, 3073, 3079, 3081, 3083, 0, 0, 0, 0,
+  0, 3065, 3069, 3072, 0, 3091, 3075, 3070, 3080, 3092, 0, 3087, 3088, 3089, 3076, 3082,
+  3084, 3078, 3085, 3074, 3077, 3067, 3068, 3071, 3073, 3079, 3081, 3083, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 0, 0, 0, 0, 0,
+  3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3280, 3281, 3282,
+  3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 1145, 565, 3294, 3295, 0,
+  548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564,
+  1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3296, 2129, 3297, 3298, 3299, 3300,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3301, 3302, 3303, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3305, 3306, 1906, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1408, 3307, 3308, 3309, 1351, 3310, 3311, 1728, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319,
+  3320, 3321, 1444, 3322, 3323, 3324, 3325, 3326, 3327, 1345, 1720, 3328, 1855, 1723, 1856, 3329,
+  1500, 3330, 3331, 3332, 3333, 3334, 1838, 1418, 3335, 3336, 3337, 3338, 0, 0, 0, 0,
+  3339, 3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347, 0, 0, 0, 0, 0, 0, 0,
+  3348, 3349, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 0, 0, 0, 0, 0, 0,
+  3350, 3351, 3352, 3353, 3354, 2496, 3355, 3356, 3357, 3358, 2497, 3359, 3360, 3361, 2498, 3362,
+  3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 2556, 3374, 3375, 3376, 3377,
+  3378, 3379, 3380, 3381, 3382, 2561, 2499, 2500, 2562, 3383, 3384, 2307, 3385, 2501, 3386, 3387,
+  3388, 3389, 3389, 3389, 3390, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401,
+  3402, 3403, 3404, 3405, 3406, 3407, 3407, 2564, 3408, 3409, 3410, 3411, 2503, 3412, 3413, 3414,
+  2460, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429,
+  3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439, 3440, 3440, 3441, 3442, 3443, 2303,
+  3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 2508, 3452, 3453, 3454, 3455, 3456, 3457, 3458,
+  3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3470, 3471, 3472, 2249, 3473,
+  3474, 3475, 3475, 3476, 3477, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487,
+  3488, 3489, 3490, 2509, 3491, 3492, 3493, 3494, 2576, 3494, 3495, 2511, 3496, 3497, 3498, 3499,
+  2512, 2222, 3500, 3501, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513,
+  3514, 3515, 3516, 3517, 3518, 3519, 3520, 3521, 2513, 3522, 3523, 3524, 3525, 3526, 3527, 2515,
+  3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 2250, 2584, 3536, 3537, 3538, 3539, 3540, 3541,
+  3542, 3543, 2516, 3544, 3545, 3546, 3547, 2627, 3548, 3549, 3550, 3551, 3552, 3553, 3554, 3555,
+  3556, 3557, 3558, 3559, 3560, 2320, 3561, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570,
+  3571, 2517, 2407, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 2588, 3580, 3581, 3582, 3583,
+  3584, 3585, 3586, 3587, 2589, 3588, 3589, 3590, 3591, 3592, 3593, 3594, 3595, 3596, 3597, 3598,
+  3599, 2591, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3610, 3611, 3612,
+  2593, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 2306, 3620, 3621, 3622, 3623, 3624, 3625, 3626,
+  2599, 3627, 3628, 3629, 3630, 3631, 3632, 3632, 2600, 2629, 3633, 3634, 3635, 3636, 3637, 2268,
+  2602, 3638, 3639, 2528, 3640, 3641, 2482, 3642, 3643, 2532, 3644, 3645, 3646, 3647, 3647, 3648,
+  3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664,
+  3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 2538, 3675, 3676, 3677, 3678, 3679,
+  3680, 3681, 3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3476, 3691, 3692, 3693, 3694,
+  3695, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 2324, 3703, 3704, 3705, 3706, 3707, 3708, 2541,
+  3709, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724,
+  3725, 3726, 3727, 3728, 2263, 3729, 3730, 3731, 3732, 3733, 3734, 2609, 3735, 3736, 3737, 3738,
+  3739, 3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754,
+  2614, 2615, 3755, 3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 2616,
+  3768, 3769, 3770, 3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783,
+  3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796, 3797, 2622, 2622,
+  3798, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 2623, 3808, 3809, 3810, 3811, 3812,
+  3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825, 3826, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const NormRecord normRecords[3827] = {
+  { 0, 0, 0, 0 },
+  { 0, 4, 0, 1 },
+  { 0, 4, 0, 3 },
+  { 0, 4, 0, 6 },
+  { 0, 4, 0, 8 },
+  { 0, 4, 0, 11 },
+  { 0, 4, 0, 13 },
+  { 0, 4, 0, 15 },
+  { 0, 4, 0, 18 },
+  { 0, 4, 0, 20 },
+  { 0, 4, 0, 23 },
+  { 0, 4, 0, 25 },
+  { 0, 4, 0, 27 },
+  { 0, 4, 0, 31 },
+  { 0, 4, 0, 35 },
+  { 0, 0, 39, 0 },
+  { 0, 0, 42, 0 },
+  { 0, 0, 45, 0 },
+  { 0, 0, 48, 0 },
+  { 0, 0, 51, 0 },
+  { 0, 0, 54, 0 },
+  { 0, 0, 57, 0 },
+  { 0, 0, 60, 0 },
+  { 0, 0, 63, 0 },
+  { 0, 0, 66, 0 },
+  { 0, 0, 69, 0 },
+  { 0, 0, 72, 0 },
+  { 0, 0, 75, 0 },
+  { 0, 0, 78, 0 },
+  { 0, 0, 81, 0 },
+  { 0, 0, 84, 0 },
+  { 0, 0, 87, 0 },
+  { 0, 0, 90, 0 },
+  { 0, 0, 93, 0 },
+  { 0, 0, 96, 0 },
+  { 0, 0, 99, 0 },
+  { 0, 0, 102, 0 },
+  { 0, 0, 105, 0 },
+  { 0, 0, 108, 0 },
+  { 0, 0, 111, 0 },
+  { 0, 0, 114, 0 },
+  { 0, 0, 117, 0 },
+  { 0, 0, 120, 0 },
+  { 0, 0, 123, 0 },
+  { 0, 0, 126, 0 },
+  { 0, 0, 129, 0 },
+  { 0, 0, 132, 0 },
+  { 0, 0, 135, 0 },
+  { 0, 0, 138, 0 },
+  { 0, 0, 141, 0 },
+  { 0, 0, 144, 0 },
+  { 0, 0, 147, 0 },
+  { 0, 0, 150, 0 },
+  { 0, 0, 153, 0 },
+  { 0, 0, 156, 0 },
+  { 0, 0, 159, 0 },
+  { 0, 0, 162, 0 },
+  { 0, 0, 165, 0 },
+  { 0, 0, 168, 0 },
+  { 0, 0, 171, 0 },
+  { 0, 0, 174, 0 },
+  { 0, 0, 177, 0 },
+  { 0, 0, 180, 0 },
+  { 0, 0, 183, 0 },
+  { 0, 0, 186, 0 },
+  { 0, 0, 189, 0 },
+  { 0, 0, 192, 0 },
+  { 0, 0, 195, 0 },
+  { 0, 0, 198, 0 },
+  { 0, 0, 201, 0 },
+  { 0, 0, 204, 0 },
+  { 0, 0, 207, 0 },
+  { 0, 0, 210, 0 },
+  { 0, 0, 213, 0 },
+  { 0, 0, 216, 0 },
+  { 0, 0, 219, 0 },
+  { 0, 0, 222, 0 },
+  { 0, 0, 225, 0 },
+  { 0, 0, 228, 0 },
+  { 0, 0, 231, 0 },
+  { 0, 0, 234, 0 },
+  { 0, 0, 237, 0 },
+  { 0, 0, 240, 0 },
+  { 0, 0, 243, 0 },
+  { 0, 0, 246, 0 },
+  { 0, 0, 249, 0 },
+  { 0, 0, 252, 0 },
+  { 0, 0, 255, 0 },
+  { 0, 0, 258, 0 },
+  { 0, 0, 261, 0 },
+  { 0, 0, 264, 0 },
+  { 0, 0, 267, 0 },
+  { 0, 0, 270, 0 },
+  { 0, 0, 273, 0 },
+  { 0, 0, 276, 0 },
+  { 0, 0, 279, 0 },
+  { 0, 0, 282, 0 },
+  { 0, 0, 285, 0 },
+  { 0, 0, 288, 0 },
+  { 0, 0, 291, 0 },
+  { 0, 0, 294, 0 },
+  { 0, 0, 297, 0 },
+  { 0, 0, 300, 0 },
+  { 0, 0, 303, 0 },
+  { 0, 0, 306, 0 },
+  { 0, 0, 309, 0 },
+  { 0, 0, 312, 0 },
+  { 0, 0, 315, 0 },
+  { 0, 0, 318, 0 },
+  { 0, 0, 321, 0 },
+  { 0, 0, 324, 0 },
+  { 0, 0, 327, 0 },
+  { 0, 0, 330, 0 },
+  { 0, 4, 0, 333 },
+  { 0, 4, 0, 336 },
+  { 0, 0, 339, 0 },
+  { 0, 0, 342, 0 },
+  { 0, 0, 345, 0 },
+  { 0, 0, 348, 0 },
+  { 0, 0, 351, 0 },
+  { 0, 0, 354, 0 },
+  { 0, 0, 357, 0 },
+  { 0, 0, 360, 0 },
+  { 0, 0, 363, 0 },
+  { 0, 0, 366, 0 },
+  { 0, 4, 0, 369 },
+  { 0, 4, 0, 372 },
+  { 0, 0, 375, 0 },
+  { 0, 0, 378, 0 },
+  { 0, 0, 381, 0 },
+  { 0, 0, 384, 0 },
+  { 0, 0, 387, 0 },
+  { 0, 0, 390, 0 },
+  { 0, 4, 0, 393 },
+  { 0, 0, 396, 0 },
+  { 0, 0, 399, 0 },
+  { 0, 0, 402, 0 },
+  { 0, 0, 405, 0 },
+  { 0, 0, 408, 0 },
+  { 0, 0, 411, 0 },
+  { 0, 0, 414, 0 },
+  { 0, 0, 417, 0 },
+  { 0, 0, 420, 0 },
+  { 0, 0, 423, 0 },
+  { 0, 0, 426, 0 },
+  { 0, 0, 429, 0 },
+  { 0, 0, 432, 0 },
+  { 0, 0, 435, 0 },
+  { 0, 0, 438, 0 },
+  { 0, 0, 441, 0 },
+  { 0, 0, 444, 0 },
+  { 0, 0, 447, 0 },
+  { 0, 0, 450, 0 },
+  { 0, 0, 453, 0 },
+  { 0, 0, 456, 0 },
+  { 0, 0, 459, 0 },
+  { 0, 0, 462, 0 },
+  { 0, 0, 465, 0 },
+  { 0, 0, 468, 0 },
+  { 0, 0, 471, 0 },
+  { 0, 0, 474, 0 },
+  { 0, 0, 477, 0 },
+  { 0, 0, 480, 0 },
+  { 0, 0, 483, 0 },
+  { 0, 0, 486, 0 },
+  { 0, 0, 489, 0 },
+  { 0, 0, 492, 0 },
+  { 0, 0, 495, 0 },
+  { 0, 0, 498, 0 },
+  { 0, 0, 501, 0 },
+  { 0, 0, 504, 0 },
+  { 0, 0, 507, 0 },
+  { 0, 0, 510, 0 },
+  { 0, 0, 513, 0 },
+  { 0, 0, 516, 0 },
+  { 0, 0, 519, 0 },
+  { 0, 0, 522, 0 },
+  { 0, 0, 525, 0 },
+  { 0, 0, 528, 0 },
+  { 0, 0, 531, 0 },
+  { 0, 0, 534, 0 },
+  { 0, 4, 0, 537 },
+  { 0, 0, 539, 0 },
+  { 0, 0, 542, 0 },
+  { 0, 0, 545, 0 },
+  { 0, 0, 548, 0 },
+  { 0, 4, 0, 551 },
+  { 0, 4, 0, 555 },
+  { 0, 4, 0, 559 },
+  { 0, 4, 0, 563 },
+  { 0, 4, 0, 566 },
+  { 0, 4, 0, 569 },
+  { 0, 4, 0, 572 },
+  { 0, 4, 0, 575 },
+  { 0, 4, 0, 578 },
+  { 0, 0, 581, 0 },
+  { 0, 0, 584, 0 },
+  { 0, 0, 587, 0 },
+  { 0, 0, 590, 0 },
+  { 0, 0, 593, 0 },
+  { 0, 0, 596, 0 },
+  { 0, 0, 599, 0 },
+  { 0, 0, 602, 0 },
+  { 0, 0, 605, 0 },
+  { 0, 0, 609, 0 },
+  { 0, 0, 613, 0 },
+  { 0, 0, 617, 0 },
+  { 0, 0, 621, 0 },
+  { 0, 0, 625, 0 },
+  { 0, 0, 629, 0 },
+  { 0, 0, 633, 0 },
+  { 0, 0, 637, 0 },
+  { 0, 0, 641, 0 },
+  { 0, 0, 645, 0 },
+  { 0, 0, 649, 0 },
+  { 0, 0, 653, 0 },
+  { 0, 0, 656, 0 },
+  { 0, 0, 659, 0 },
+  { 0, 0, 662, 0 },
+  { 0, 0, 665, 0 },
+  { 0, 0, 668, 0 },
+  { 0, 0, 671, 0 },
+  { 0, 0, 674, 0 },
+  { 0, 0, 677, 0 },
+  { 0, 0, 681, 0 },
+  { 0, 0, 685, 0 },
+  { 0, 0, 688, 0 },
+  { 0, 0, 691, 0 },
+  { 0, 4, 0, 694 },
+  { 0, 4, 0, 697 },
+  { 0, 4, 0, 700 },
+  { 0, 0, 703, 0 },
+  { 0, 0, 706, 0 },
+  { 0, 0, 709, 0 },
+  { 0, 0, 712, 0 },
+  { 0, 0, 715, 0 },
+  { 0, 0, 719, 0 },
+  { 0, 0, 723, 0 },
+  { 0, 0, 726, 0 },
+  { 0, 0, 729, 0 },
+  { 0, 0, 732, 0 },
+  { 0, 0, 735, 0 },
+  { 0, 0, 738, 0 },
+  { 0, 0, 741, 0 },
+  { 0, 0, 744, 0 },
+  { 0, 0, 747, 0 },
+  { 0, 0, 750, 0 },
+  { 0, 0, 753, 0 },
+  { 0, 0, 756, 0 },
+  { 0, 0, 759, 0 },
+  { 0, 0, 762, 0 },
+  { 0, 0, 765, 0 },
+  { 0, 0, 768, 0 },
+  { 0, 0, 771, 0 },
+  { 0, 0, 774, 0 },
+  { 0, 0, 777, 0 },
+  { 0, 0, 780, 0 },
+  { 0, 0, 783, 0 },
+  { 0, 0, 786, 0 },
+  { 0, 0, 789, 0 },
+  { 0, 0, 792, 0 },
+  { 0, 0, 795, 0 },
+  { 0, 0, 798, 0 },
+  { 0, 0, 801, 0 },
+  { 0, 0, 804, 0 },
+  { 0, 0, 807, 0 },
+  { 0, 0, 810, 0 },
+  { 0, 0, 813, 0 },
+  { 0, 0, 816, 0 },
+  { 0, 0, 819, 0 },
+  { 0, 0, 822, 0 },
+  { 0, 0, 825, 0 },
+  { 0, 0, 828, 0 },
+  { 0, 0, 831, 0 },
+  { 0, 0, 834, 0 },
+  { 0, 0, 837, 0 },
+  { 0, 0, 841, 0 },
+  { 0, 0, 845, 0 },
+  { 0, 0, 849, 0 },
+  { 0, 0, 853, 0 },
+  { 0, 0, 856, 0 },
+  { 0, 0, 859, 0 },
+  { 0, 0, 863, 0 },
+  { 0, 0, 867, 0 },
+  { 0, 0, 870, 0 },
+  { 0, 4, 0, 873 },
+  { 0, 4, 0, 875 },
+  { 0, 4, 0, 877 },
+  { 0, 4, 0, 879 },
+  { 0, 4, 0, 881 },
+  { 0, 4, 0, 883 },
+  { 0, 4, 0, 885 },
+  { 0, 4, 0, 887 },
+  { 0, 4, 0, 889 },
+  { 0, 4, 0, 891 },
+  { 0, 4, 0, 894 },
+  { 0, 4, 0, 897 },
+  { 0, 4, 0, 900 },
+  { 0, 4, 0, 903 },
+  { 0, 4, 0, 906 },
+  { 0, 4, 0, 909 },
+  { 0, 4, 0, 911 },
+  { 0, 4, 0, 913 },
+  { 0, 4, 0, 915 },
+  { 230, 10, 0, 0 },
+  { 230, 0, 0, 0 },
+  { 232, 0, 0, 0 },
+  { 220, 0, 0, 0 },
+  { 216, 10, 0, 0 },
+  { 202, 0, 0, 0 },
+  { 220, 10, 0, 0 },
+  { 202, 10, 0, 0 },
+  { 1, 0, 0, 0 },
+  { 1, 10, 0, 0 },
+  { 230, 5, 917, 0 },
+  { 230, 5, 919, 0 },
+  { 230, 5, 921, 0 },
+  { 230, 5, 923, 0 },
+  { 240, 10, 0, 0 },
+  { 233, 0, 0, 0 },
+  { 234, 0, 0, 0 },
+  { 0, 5, 926, 0 },
+  { 0, 4, 0, 928 },
+  { 0, 5, 931, 0 },
+  { 0, 4, 933, 936 },
+  { 0, 0, 940, 0 },
+  { 0, 5, 943, 0 },
+  { 0, 0, 945, 0 },
+  { 0, 0, 948, 0 },
+  { 0, 0, 951, 0 },
+  { 0, 0, 954, 0 },
+  { 0, 0, 957, 0 },
+  { 0, 0, 960, 0 },
+  { 0, 0, 963, 0 },
+  { 0, 0, 967, 0 },
+  { 0, 0, 970, 0 },
+  { 0, 0, 973, 0 },
+  { 0, 0, 976, 0 },
+  { 0, 0, 979, 0 },
+  { 0, 0, 982, 0 },
+  { 0, 0, 985, 0 },
+  { 0, 0, 989, 0 },
+  { 0, 0, 992, 0 },
+  { 0, 0, 995, 0 },
+  { 0, 0, 998, 0 },
+  { 0, 0, 1001, 0 },
+  { 0, 4, 0, 1004 },
+  { 0, 4, 0, 1006 },
+  { 0, 4, 0, 1008 },
+  { 0, 4, 1010, 957 },
+  { 0, 4, 1013, 970 },
+  { 0, 4, 0, 1016 },
+  { 0, 4, 0, 1018 },
+  { 0, 4, 0, 1020 },
+  { 0, 4, 0, 1022 },
+  { 0, 4, 0, 1024 },
+  { 0, 4, 0, 1026 },
+  { 0, 4, 0, 1028 },
+  { 0, 4, 0, 1030 },
+  { 0, 0, 1032, 0 },
+  { 0, 0, 1035, 0 },
+  { 0, 0, 1038, 0 },
+  { 0, 0, 1041, 0 },
+  { 0, 0, 1044, 0 },
+  { 0, 0, 1047, 0 },
+  { 0, 0, 1050, 0 },
+  { 0, 0, 1053, 0 },
+  { 0, 0, 1056, 0 },
+  { 0, 0, 1059, 0 },
+  { 0, 0, 1062, 0 },
+  { 0, 0, 1065, 0 },
+  { 0, 0, 1068, 0 },
+  { 0, 0, 1071, 0 },
+  { 0, 0, 1074, 0 },
+  { 0, 0, 1077, 0 },
+  { 0, 0, 1080, 0 },
+  { 0, 0, 1083, 0 },
+  { 0, 0, 1086, 0 },
+  { 0, 0, 1089, 0 },
+  { 0, 0, 1092, 0 },
+  { 0, 0, 1095, 0 },
+  { 0, 0, 1098, 0 },
+  { 0, 0, 1101, 0 },
+  { 0, 0, 1104, 0 },
+  { 0, 0, 1107, 0 },
+  { 0, 0, 1110, 0 },
+  { 0, 0, 1113, 0 },
+  { 0, 0, 1116, 0 },
+  { 0, 0, 1119, 0 },
+  { 0, 0, 1122, 0 },
+  { 0, 0, 1125, 0 },
+  { 0, 0, 1128, 0 },
+  { 0, 0, 1131, 0 },
+  { 0, 0, 1134, 0 },
+  { 0, 0, 1137, 0 },
+  { 0, 0, 1140, 0 },
+  { 0, 0, 1143, 0 },
+  { 0, 0, 1146, 0 },
+  { 0, 0, 1149, 0 },
+  { 0, 0, 1152, 0 },
+  { 0, 0, 1155, 0 },
+  { 0, 0, 1158, 0 },
+  { 0, 0, 1161, 0 },
+  { 0, 0, 1164, 0 },
+  { 0, 0, 1167, 0 },
+  { 0, 0, 1170, 0 },
+  { 0, 0, 1173, 0 },
+  { 0, 0, 1176, 0 },
+  { 0, 0, 1179, 0 },
+  { 0, 0, 1182, 0 },
+  { 0, 0, 1185, 0 },
+  { 0, 4, 0, 1188 },
+  { 222, 0, 0, 0 },
+  { 228, 0, 0, 0 },
+  { 10, 0, 0, 0 },
+  { 11, 0, 0, 0 },
+  { 12, 0, 0, 0 },
+  { 13, 0, 0, 0 },
+  { 14, 0, 0, 0 },
+  { 15, 0, 0, 0 },
+  { 16, 0, 0, 0 },
+  { 17, 0, 0, 0 },
+  { 18, 0, 0, 0 },
+  { 19, 0, 0, 0 },
+  { 20, 0, 0, 0 },
+  { 21, 0, 0, 0 },
+  { 22, 0, 0, 0 },
+  { 23, 0, 0, 0 },
+  { 24, 0, 0, 0 },
+  { 25, 0, 0, 0 },
+  { 30, 0, 0, 0 },
+  { 31, 0, 0, 0 },
+  { 32, 0, 0, 0 },
+  { 0, 0, 1191, 0 },
+  { 0, 0, 1194, 0 },
+  { 0, 0, 1197, 0 },
+  { 0, 0, 1200, 0 },
+  { 0, 0, 1203, 0 },
+  { 27, 0, 0, 0 },
+  { 28, 0, 0, 0 },
+  { 29, 0, 0, 0 },
+  { 33, 0, 0, 0 },
+  { 34, 0, 0, 0 },
+  { 35, 0, 0, 0 },
+  { 0, 4, 0, 1206 },
+  { 0, 4, 0, 1209 },
+  { 0, 4, 0, 1212 },
+  { 0, 4, 0, 1215 },
+  { 0, 0, 1218, 0 },
+  { 0, 0, 1221, 0 },
+  { 0, 0, 1224, 0 },
+  { 36, 0, 0, 0 },
+  { 0, 0, 1227, 0 },
+  { 0, 0, 1230, 0 },
+  { 0, 0, 1233, 0 },
+  { 7, 10, 0, 0 },
+  { 9, 0, 0, 0 },
+  { 0, 5, 1236, 0 },
+  { 0, 5, 1239, 0 },
+  { 0, 5, 1242, 0 },
+  { 0, 5, 1245, 0 },
+  { 0, 5, 1248, 0 },
+  { 0, 5, 1251, 0 },
+  { 0, 5, 1254, 0 },
+  { 0, 5, 1257, 0 },
+  { 7, 0, 0, 0 },
+  { 0, 10, 0, 0 },
+  { 0, 0, 1260, 0 },
+  { 0, 0, 1263, 0 },
+  { 0, 5, 1266, 0 },
+  { 0, 5, 1269, 0 },
+  { 0, 5, 1272, 0 },
+  { 0, 5, 1275, 0 },
+  { 0, 5, 1278, 0 },
+  { 0, 5, 1281, 0 },
+  { 0, 5, 1284, 0 },
+  { 0, 5, 1287, 0 },
+  { 0, 5, 1290, 0 },
+  { 0, 0, 1293, 0 },
+  { 0, 0, 1296, 0 },
+  { 0, 0, 1299, 0 },
+  { 0, 5, 1302, 0 },
+  { 0, 5, 1305, 0 },
+  { 0, 0, 1308, 0 },
+  { 0, 0, 1311, 0 },
+  { 0, 0, 1314, 0 },
+  { 0, 0, 1317, 0 },
+  { 0, 0, 1320, 0 },
+  { 84, 0, 0, 0 },
+  { 91, 10, 0, 0 },
+  { 0, 0, 1323, 0 },
+  { 0, 0, 1326, 0 },
+  { 0, 0, 1329, 0 },
+  { 0, 0, 1332, 0 },
+  { 0, 0, 1335, 0 },
+  { 0, 0, 1339, 0 },
+  { 0, 0, 1342, 0 },
+  { 0, 0, 1345, 0 },
+  { 9, 10, 0, 0 },
+  { 0, 0, 1348, 0 },
+  { 0, 0, 1351, 0 },
+  { 0, 0, 1354, 0 },
+  { 0, 0, 1358, 0 },
+  { 0, 4, 0, 1361 },
+  { 103, 0, 0, 0 },
+  { 107, 0, 0, 0 },
+  { 0, 4, 0, 1364 },
+  { 118, 0, 0, 0 },
+  { 122, 0, 0, 0 },
+  { 0, 4, 0, 1367 },
+  { 0, 4, 0, 1370 },
+  { 0, 4, 0, 1373 },
+  { 216, 0, 0, 0 },
+  { 0, 5, 1375, 0 },
+  { 0, 5, 1378, 0 },
+  { 0, 5, 1381, 0 },
+  { 0, 5, 1384, 0 },
+  { 0, 5, 1387, 0 },
+  { 0, 5, 1390, 0 },
+  { 129, 0, 0, 0 },
+  { 130, 0, 0, 0 },
+  { 0, 5, 1393, 0 },
+  { 132, 0, 0, 0 },
+  { 0, 5, 1396, 0 },
+  { 0, 5, 1399, 0 },
+  { 0, 4, 0, 1402 },
+  { 0, 5, 1406, 0 },
+  { 0, 4, 0, 1409 },
+  { 0, 5, 1413, 0 },
+  { 0, 5, 1416, 0 },
+  { 0, 5, 1419, 0 },
+  { 0, 5, 1422, 0 },
+  { 0, 5, 1425, 0 },
+  { 0, 5, 1428, 0 },
+  { 0, 5, 1431, 0 },
+  { 0, 0, 1434, 0 },
+  { 0, 4, 0, 1437 },
+  { 0, 0, 1439, 0 },
+  { 0, 0, 1442, 0 },
+  { 0, 0, 1445, 0 },
+  { 0, 0, 1448, 0 },
+  { 0, 0, 1451, 0 },
+  { 0, 0, 1454, 0 },
+  { 0, 0, 1457, 0 },
+  { 0, 0, 1460, 0 },
+  { 0, 0, 1463, 0 },
+  { 0, 0, 1466, 0 },
+  { 0, 0, 1469, 0 },
+  { 0, 4, 0, 1472 },
+  { 0, 4, 0, 1474 },
+  { 0, 4, 0, 1476 },
+  { 0, 4, 0, 1478 },
+  { 0, 4, 0, 1480 },
+  { 0, 4, 0, 1482 },
+  { 0, 4, 0, 1484 },
+  { 0, 4, 0, 1486 },
+  { 0, 4, 0, 1488 },
+  { 0, 4, 0, 1490 },
+  { 0, 4, 0, 1492 },
+  { 0, 4, 0, 1494 },
+  { 0, 4, 0, 1496 },
+  { 0, 4, 0, 1498 },
+  { 0, 4, 0, 1500 },
+  { 0, 4, 0, 1502 },
+  { 0, 4, 0, 1504 },
+  { 0, 4, 0, 1506 },
+  { 0, 4, 0, 1508 },
+  { 0, 4, 0, 1510 },
+  { 0, 4, 0, 1512 },
+  { 0, 4, 0, 1514 },
+  { 0, 4, 0, 1516 },
+  { 0, 4, 0, 1518 },
+  { 0, 4, 0, 1520 },
+  { 0, 4, 0, 1522 },
+  { 0, 4, 0, 1524 },
+  { 0, 4, 0, 1526 },
+  { 0, 4, 0, 1528 },
+  { 0, 4, 0, 1530 },
+  { 0, 4, 0, 1532 },
+  { 0, 4, 0, 1534 },
+  { 0, 4, 0, 1536 },
+  { 0, 4, 0, 1538 },
+  { 0, 4, 0, 1540 },
+  { 0, 4, 0, 1542 },
+  { 0, 4, 0, 1544 },
+  { 0, 4, 0, 1546 },
+  { 0, 4, 0, 1548 },
+  { 0, 4, 0, 1550 },
+  { 0, 4, 0, 1552 },
+  { 0, 4, 0, 1554 },
+  { 0, 4, 0, 1556 },
+  { 0, 4, 0, 1558 },
+  { 0, 4, 0, 1560 },
+  { 0, 4, 0, 1562 },
+  { 0, 4, 0, 1564 },
+  { 0, 4, 0, 1566 },
+  { 0, 4, 0, 1568 },
+  { 0, 4, 0, 1570 },
+  { 0, 4, 0, 1572 },
+  { 0, 4, 0, 1574 },
+  { 0, 4, 0, 1576 },
+  { 0, 4, 0, 1578 },
+  { 0, 4, 0, 1580 },
+  { 0, 4, 0, 1582 },
+  { 0, 4, 0, 1584 },
+  { 0, 4, 0, 1586 },
+  { 0, 4, 0, 1588 },
+  { 0, 4, 0, 1590 },
+  { 0, 4, 0, 1592 },
+  { 0, 4, 0, 1594 },
+  { 0, 4, 0, 1596 },
+  { 0, 4, 0, 1598 },
+  { 0, 4, 0, 1600 },
+  { 0, 4, 0, 1602 },
+  { 0, 4, 0, 1604 },
+  { 0, 4, 0, 1606 },
+  { 0, 4, 0, 1608 },
+  { 0, 4, 0, 1610 },
+  { 0, 4, 0, 1612 },
+  { 0, 4, 0, 1614 },
+  { 0, 4, 0, 1616 },
+  { 0, 4, 0, 1618 },
+  { 0, 4, 0, 1620 },
+  { 0, 4, 0, 1622 },
+  { 0, 4, 0, 1624 },
+  { 0, 4, 0, 1626 },
+  { 0, 4, 0, 1628 },
+  { 0, 4, 0, 1630 },
+  { 0, 4, 0, 1632 },
+  { 0, 4, 0, 1634 },
+  { 0, 4, 0, 1636 },
+  { 0, 4, 0, 1638 },
+  { 214, 0, 0, 0 },
+  { 218, 0, 0, 0 },
+  { 0, 0, 1640, 0 },
+  { 0, 0, 1643, 0 },
+  { 0, 0, 1646, 0 },
+  { 0, 0, 1649, 0 },
+  { 0, 0, 1652, 0 },
+  { 0, 0, 1655, 0 },
+  { 0, 0, 1658, 0 },
+  { 0, 0, 1661, 0 },
+  { 0, 0, 1664, 0 },
+  { 0, 0, 1668, 0 },
+  { 0, 0, 1672, 0 },
+  { 0, 0, 1675, 0 },
+  { 0, 0, 1678, 0 },
+  { 0, 0, 1681, 0 },
+  { 0, 0, 1684, 0 },
+  { 0, 0, 1687, 0 },
+  { 0, 0, 1690, 0 },
+  { 0, 0, 1693, 0 },
+  { 0, 0, 1696, 0 },
+  { 0, 0, 1699, 0 },
+  { 0, 0, 1702, 0 },
+  { 0, 0, 1706, 0 },
+  { 0, 0, 1710, 0 },
+  { 0, 0, 1714, 0 },
+  { 0, 0, 1718, 0 },
+  { 0, 0, 1721, 0 },
+  { 0, 0, 1724, 0 },
+  { 0, 0, 1727, 0 },
+  { 0, 0, 1730, 0 },
+  { 0, 0, 1734, 0 },
+  { 0, 0, 1738, 0 },
+  { 0, 0, 1741, 0 },
+  { 0, 0, 1744, 0 },
+  { 0, 0, 1747, 0 },
+  { 0, 0, 1750, 0 },
+  { 0, 0, 1753, 0 },
+  { 0, 0, 1756, 0 },
+  { 0, 0, 1759, 0 },
+  { 0, 0, 1762, 0 },
+  { 0, 0, 1765, 0 },
+  { 0, 0, 1768, 0 },
+  { 0, 0, 1771, 0 },
+  { 0, 0, 1774, 0 },
+  { 0, 0, 1777, 0 },
+  { 0, 0, 1780, 0 },
+  { 0, 0, 1783, 0 },
+  { 0, 0, 1786, 0 },
+  { 0, 0, 1790, 0 },
+  { 0, 0, 1794, 0 },
+  { 0, 0, 1797, 0 },
+  { 0, 0, 1800, 0 },
+  { 0, 0, 1803, 0 },
+  { 0, 0, 1806, 0 },
+  { 0, 0, 1809, 0 },
+  { 0, 0, 1812, 0 },
+  { 0, 0, 1815, 0 },
+  { 0, 0, 1818, 0 },
+  { 0, 0, 1822, 0 },
+  { 0, 0, 1826, 0 },
+  { 0, 0, 1829, 0 },
+  { 0, 0, 1832, 0 },
+  { 0, 0, 1835, 0 },
+  { 0, 0, 1838, 0 },
+  { 0, 0, 1841, 0 },
+  { 0, 0, 1844, 0 },
+  { 0, 0, 1847, 0 },
+  { 0, 0, 1850, 0 },
+  { 0, 0, 1853, 0 },
+  { 0, 0, 1856, 0 },
+  { 0, 0, 1859, 0 },
+  { 0, 0, 1862, 0 },
+  { 0, 0, 1865, 0 },
+  { 0, 0, 1868, 0 },
+  { 0, 0, 1871, 0 },
+  { 0, 0, 1874, 0 },
+  { 0, 0, 1877, 0 },
+  { 0, 0, 1880, 0 },
+  { 0, 0, 1884, 0 },
+  { 0, 0, 1888, 0 },
+  { 0, 0, 1892, 0 },
+  { 0, 0, 1896, 0 },
+  { 0, 0, 1900, 0 },
+  { 0, 0, 1904, 0 },
+  { 0, 0, 1908, 0 },
+  { 0, 0, 1912, 0 },
+  { 0, 0, 1915, 0 },
+  { 0, 0, 1918, 0 },
+  { 0, 0, 1921, 0 },
+  { 0, 0, 1924, 0 },
+  { 0, 0, 1927, 0 },
+  { 0, 0, 1930, 0 },
+  { 0, 0, 1933, 0 },
+  { 0, 0, 1936, 0 },
+  { 0, 0, 1940, 0 },
+  { 0, 0, 1944, 0 },
+  { 0, 0, 1947, 0 },
+  { 0, 0, 1950, 0 },
+  { 0, 0, 1953, 0 },
+  { 0, 0, 1956, 0 },
+  { 0, 0, 1959, 0 },
+  { 0, 0, 1962, 0 },
+  { 0, 0, 1966, 0 },
+  { 0, 0, 1970, 0 },
+  { 0, 0, 1974, 0 },
+  { 0, 0, 1978, 0 },
+  { 0, 0, 1982, 0 },
+  { 0, 0, 1986, 0 },
+  { 0, 0, 1989, 0 },
+  { 0, 0, 1992, 0 },
+  { 0, 0, 1995, 0 },
+  { 0, 0, 1998, 0 },
+  { 0, 0, 2001, 0 },
+  { 0, 0, 2004, 0 },
+  { 0, 0, 2007, 0 },
+  { 0, 0, 2010, 0 },
+  { 0, 0, 2013, 0 },
+  { 0, 0, 2016, 0 },
+  { 0, 0, 2019, 0 },
+  { 0, 0, 2022, 0 },
+  { 0, 0, 2025, 0 },
+  { 0, 0, 2028, 0 },
+  { 0, 0, 2032, 0 },
+  { 0, 0, 2036, 0 },
+  { 0, 0, 2040, 0 },
+  { 0, 0, 2044, 0 },
+  { 0, 0, 2047, 0 },
+  { 0, 0, 2050, 0 },
+  { 0, 0, 2053, 0 },
+  { 0, 0, 2056, 0 },
+  { 0, 0, 2059, 0 },
+  { 0, 0, 2062, 0 },
+  { 0, 0, 2065, 0 },
+  { 0, 0, 2068, 0 },
+  { 0, 0, 2071, 0 },
+  { 0, 0, 2074, 0 },
+  { 0, 0, 2077, 0 },
+  { 0, 0, 2080, 0 },
+  { 0, 0, 2083, 0 },
+  { 0, 0, 2086, 0 },
+  { 0, 0, 2089, 0 },
+  { 0, 0, 2092, 0 },
+  { 0, 0, 2095, 0 },
+  { 0, 0, 2098, 0 },
+  { 0, 0, 2101, 0 },
+  { 0, 0, 2104, 0 },
+  { 0, 0, 2107, 0 },
+  { 0, 0, 2110, 0 },
+  { 0, 0, 2113, 0 },
+  { 0, 0, 2116, 0 },
+  { 0, 0, 2119, 0 },
+  { 0, 0, 2122, 0 },
+  { 0, 0, 2125, 0 },
+  { 0, 0, 2128, 0 },
+  { 0, 0, 2131, 0 },
+  { 0, 4, 0, 2134 },
+  { 0, 4, 2137, 1953 },
+  { 0, 0, 2140, 0 },
+  { 0, 0, 2143, 0 },
+  { 0, 0, 2146, 0 },
+  { 0, 0, 2149, 0 },
+  { 0, 0, 2152, 0 },
+  { 0, 0, 2156, 0 },
+  { 0, 0, 2160, 0 },
+  { 0, 0, 2164, 0 },
+  { 0, 0, 2168, 0 },
+  { 0, 0, 2172, 0 },
+  { 0, 0, 2176, 0 },
+  { 0, 0, 2180, 0 },
+  { 0, 0, 2184, 0 },
+  { 0, 0, 2188, 0 },
+  { 0, 0, 2192, 0 },
+  { 0, 0, 2196, 0 },
+  { 0, 0, 2200, 0 },
+  { 0, 0, 2204, 0 },
+  { 0, 0, 2208, 0 },
+  { 0, 0, 2212, 0 },
+  { 0, 0, 2216, 0 },
+  { 0, 0, 2220, 0 },
+  { 0, 0, 2224, 0 },
+  { 0, 0, 2228, 0 },
+  { 0, 0, 2232, 0 },
+  { 0, 0, 2235, 0 },
+  { 0, 0, 2238, 0 },
+  { 0, 0, 2241, 0 },
+  { 0, 0, 2244, 0 },
+  { 0, 0, 2247, 0 },
+  { 0, 0, 2250, 0 },
+  { 0, 0, 2254, 0 },
+  { 0, 0, 2258, 0 },
+  { 0, 0, 2262, 0 },
+  { 0, 0, 2266, 0 },
+  { 0, 0, 2270, 0 },
+  { 0, 0, 2274, 0 },
+  { 0, 0, 2278, 0 },
+  { 0, 0, 2282, 0 },
+  { 0, 0, 2286, 0 },
+  { 0, 0, 2290, 0 },
+  { 0, 0, 2293, 0 },
+  { 0, 0, 2296, 0 },
+  { 0, 0, 2299, 0 },
+  { 0, 0, 2302, 0 },
+  { 0, 0, 2305, 0 },
+  { 0, 0, 2308, 0 },
+  { 0, 0, 2311, 0 },
+  { 0, 0, 2314, 0 },
+  { 0, 0, 2318, 0 },
+  { 0, 0, 2322, 0 },
+  { 0, 0, 2326, 0 },
+  { 0, 0, 2330, 0 },
+  { 0, 0, 2334, 0 },
+  { 0, 0, 2338, 0 },
+  { 0, 0, 2342, 0 },
+  { 0, 0, 2346, 0 },
+  { 0, 0, 2350, 0 },
+  { 0, 0, 2354, 0 },
+  { 0, 0, 2358, 0 },
+  { 0, 0, 2362, 0 },
+  { 0, 0, 2366, 0 },
+  { 0, 0, 2370, 0 },
+  { 0, 0, 2374, 0 },
+  { 0, 0, 2378, 0 },
+  { 0, 0, 2382, 0 },
+  { 0, 0, 2386, 0 },
+  { 0, 0, 2390, 0 },
+  { 0, 0, 2394, 0 },
+  { 0, 0, 2397, 0 },
+  { 0, 0, 2400, 0 },
+  { 0, 0, 2403, 0 },
+  { 0, 0, 2406, 0 },
+  { 0, 0, 2410, 0 },
+  { 0, 0, 2414, 0 },
+  { 0, 0, 2418, 0 },
+  { 0, 0, 2422, 0 },
+  { 0, 0, 2426, 0 },
+  { 0, 0, 2430, 0 },
+  { 0, 0, 2434, 0 },
+  { 0, 0, 2438, 0 },
+  { 0, 0, 2442, 0 },
+  { 0, 0, 2446, 0 },
+  { 0, 0, 2449, 0 },
+  { 0, 0, 2452, 0 },
+  { 0, 0, 2455, 0 },
+  { 0, 0, 2458, 0 },
+  { 0, 0, 2461, 0 },
+  { 0, 0, 2464, 0 },
+  { 0, 0, 2467, 0 },
+  { 0, 0, 2470, 0 },
+  { 0, 0, 2473, 0 },
+  { 0, 0, 2476, 0 },
+  { 0, 0, 2480, 0 },
+  { 0, 0, 2484, 0 },
+  { 0, 0, 2488, 0 },
+  { 0, 0, 2492, 0 },
+  { 0, 0, 2496, 0 },
+  { 0, 0, 2500, 0 },
+  { 0, 0, 2503, 0 },
+  { 0, 0, 2506, 0 },
+  { 0, 0, 2510, 0 },
+  { 0, 0, 2514, 0 },
+  { 0, 0, 2518, 0 },
+  { 0, 0, 2522, 0 },
+  { 0, 0, 2526, 0 },
+  { 0, 0, 2530, 0 },
+  { 0, 0, 2533, 0 },
+  { 0, 0, 2536, 0 },
+  { 0, 0, 2540, 0 },
+  { 0, 0, 2544, 0 },
+  { 0, 0, 2548, 0 },
+  { 0, 0, 2552, 0 },
+  { 0, 0, 2555, 0 },
+  { 0, 0, 2558, 0 },
+  { 0, 0, 2562, 0 },
+  { 0, 0, 2566, 0 },
+  { 0, 0, 2570, 0 },
+  { 0, 0, 2574, 0 },
+  { 0, 0, 2577, 0 },
+  { 0, 0, 2580, 0 },
+  { 0, 0, 2584, 0 },
+  { 0, 0, 2588, 0 },
+  { 0, 0, 2592, 0 },
+  { 0, 0, 2596, 0 },
+  { 0, 0, 2600, 0 },
+  { 0, 0, 2604, 0 },
+  { 0, 0, 2607, 0 },
+  { 0, 0, 2610, 0 },
+  { 0, 0, 2614, 0 },
+  { 0, 0, 2618, 0 },
+  { 0, 0, 2622, 0 },
+  { 0, 0, 2626, 0 },
+  { 0, 0, 2630, 0 },
+  { 0, 0, 2634, 0 },
+  { 0, 0, 2637, 0 },
+  { 0, 0, 2640, 0 },
+  { 0, 0, 2644, 0 },
+  { 0, 0, 2648, 0 },
+  { 0, 0, 2652, 0 },
+  { 0, 0, 2656, 0 },
+  { 0, 0, 2660, 0 },
+  { 0, 0, 2664, 0 },
+  { 0, 0, 2667, 0 },
+  { 0, 0, 2670, 0 },
+  { 0, 0, 2674, 0 },
+  { 0, 0, 2678, 0 },
+  { 0, 0, 2682, 0 },
+  { 0, 0, 2686, 0 },
+  { 0, 0, 2690, 0 },
+  { 0, 0, 2694, 0 },
+  { 0, 0, 2697, 0 },
+  { 0, 0, 2700, 0 },
+  { 0, 0, 2704, 0 },
+  { 0, 0, 2708, 0 },
+  { 0, 0, 2712, 0 },
+  { 0, 0, 2716, 0 },
+  { 0, 0, 2719, 0 },
+  { 0, 0, 2722, 0 },
+  { 0, 0, 2726, 0 },
+  { 0, 0, 2730, 0 },
+  { 0, 0, 2734, 0 },
+  { 0, 0, 2738, 0 },
+  { 0, 0, 2741, 0 },
+  { 0, 0, 2744, 0 },
+  { 0, 0, 2748, 0 },
+  { 0, 0, 2752, 0 },
+  { 0, 0, 2756, 0 },
+  { 0, 0, 2760, 0 },
+  { 0, 0, 2764, 0 },
+  { 0, 0, 2768, 0 },
+  { 0, 0, 2771, 0 },
+  { 0, 0, 2775, 0 },
+  { 0, 0, 2779, 0 },
+  { 0, 0, 2783, 0 },
+  { 0, 0, 2786, 0 },
+  { 0, 0, 2789, 0 },
+  { 0, 0, 2793, 0 },
+  { 0, 0, 2797, 0 },
+  { 0, 0, 2801, 0 },
+  { 0, 0, 2805, 0 },
+  { 0, 0, 2809, 0 },
+  { 0, 0, 2813, 0 },
+  { 0, 0, 2816, 0 },
+  { 0, 0, 2819, 0 },
+  { 0, 0, 2823, 0 },
+  { 0, 0, 2827, 0 },
+  { 0, 0, 2831, 0 },
+  { 0, 0, 2835, 0 },
+  { 0, 0, 2839, 0 },
+  { 0, 0, 2843, 0 },
+  { 0, 5, 973, 0 },
+  { 0, 0, 2846, 0 },
+  { 0, 5, 976, 0 },
+  { 0, 0, 2849, 0 },
+  { 0, 5, 979, 0 },
+  { 0, 0, 2852, 0 },
+  { 0, 5, 982, 0 },
+  { 0, 0, 2855, 0 },
+  { 0, 5, 995, 0 },
+  { 0, 0, 2858, 0 },
+  { 0, 5, 998, 0 },
+  { 0, 0, 2861, 0 },
+  { 0, 5, 1001, 0 },
+  { 0, 0, 2864, 0 },
+  { 0, 0, 2868, 0 },
+  { 0, 0, 2872, 0 },
+  { 0, 0, 2877, 0 },
+  { 0, 0, 2882, 0 },
+  { 0, 0, 2887, 0 },
+  { 0, 0, 2892, 0 },
+  { 0, 0, 2897, 0 },
+  { 0, 0, 2902, 0 },
+  { 0, 0, 2906, 0 },
+  { 0, 0, 2910, 0 },
+  { 0, 0, 2915, 0 },
+  { 0, 0, 2920, 0 },
+  { 0, 0, 2925, 0 },
+  { 0, 0, 2930, 0 },
+  { 0, 0, 2935, 0 },
+  { 0, 0, 2940, 0 },
+  { 0, 0, 2944, 0 },
+  { 0, 0, 2948, 0 },
+  { 0, 0, 2953, 0 },
+  { 0, 0, 2958, 0 },
+  { 0, 0, 2963, 0 },
+  { 0, 0, 2968, 0 },
+  { 0, 0, 2973, 0 },
+  { 0, 0, 2978, 0 },
+  { 0, 0, 2982, 0 },
+  { 0, 0, 2986, 0 },
+  { 0, 0, 2991, 0 },
+  { 0, 0, 2996, 0 },
+  { 0, 0, 3001, 0 },
+  { 0, 0, 3006, 0 },
+  { 0, 0, 3011, 0 },
+  { 0, 0, 3016, 0 },
+  { 0, 0, 3020, 0 },
+  { 0, 0, 3024, 0 },
+  { 0, 0, 3029, 0 },
+  { 0, 0, 3034, 0 },
+  { 0, 0, 3039, 0 },
+  { 0, 0, 3044, 0 },
+  { 0, 0, 3049, 0 },
+  { 0, 0, 3054, 0 },
+  { 0, 0, 3058, 0 },
+  { 0, 0, 3062, 0 },
+  { 0, 0, 3067, 0 },
+  { 0, 0, 3072, 0 },
+  { 0, 0, 3077, 0 },
+  { 0, 0, 3082, 0 },
+  { 0, 0, 3087, 0 },
+  { 0, 0, 3092, 0 },
+  { 0, 0, 3095, 0 },
+  { 0, 0, 3098, 0 },
+  { 0, 0, 3102, 0 },
+  { 0, 0, 3105, 0 },
+  { 0, 0, 3109, 0 },
+  { 0, 0, 3112, 0 },
+  { 0, 0, 3116, 0 },
+  { 0, 0, 3119, 0 },
+  { 0, 0, 3122, 0 },
+  { 0, 5, 940, 0 },
+  { 0, 0, 3125, 0 },
+  { 0, 4, 0, 3128 },
+  { 0, 5, 3131, 0 },
+  { 0, 4, 0, 3133 },
+  { 0, 4, 3136, 3139 },
+  { 0, 0, 3143, 0 },
+  { 0, 0, 3147, 0 },
+  { 0, 0, 3150, 0 },
+  { 0, 0, 3154, 0 },
+  { 0, 0, 3157, 0 },
+  { 0, 0, 3161, 0 },
+  { 0, 5, 945, 0 },
+  { 0, 0, 3164, 0 },
+  { 0, 5, 948, 0 },
+  { 0, 0, 3167, 0 },
+  { 0, 4, 3170, 3173 },
+  { 0, 4, 3177, 3180 },
+  { 0, 4, 3184, 3187 },
+  { 0, 0, 3191, 0 },
+  { 0, 0, 3194, 0 },
+  { 0, 0, 3197, 0 },
+  { 0, 5, 963, 0 },
+  { 0, 0, 3201, 0 },
+  { 0, 0, 3204, 0 },
+  { 0, 0, 3208, 0 },
+  { 0, 0, 3211, 0 },
+  { 0, 0, 3214, 0 },
+  { 0, 5, 951, 0 },
+  { 0, 4, 3217, 3220 },
+  { 0, 4, 3224, 3227 },
+  { 0, 4, 3231, 3234 },
+  { 0, 0, 3238, 0 },
+  { 0, 0, 3241, 0 },
+  { 0, 0, 3244, 0 },
+  { 0, 5, 985, 0 },
+  { 0, 0, 3248, 0 },
+  { 0, 0, 3251, 0 },
+  { 0, 0, 3254, 0 },
+  { 0, 0, 3257, 0 },
+  { 0, 0, 3261, 0 },
+  { 0, 0, 3264, 0 },
+  { 0, 0, 3267, 0 },
+  { 0, 5, 957, 0 },
+  { 0, 0, 3270, 0 },
+  { 0, 4, 3273, 3276 },
+  { 0, 5, 933, 936 },
+  { 0, 5, 3280, 0 },
+  { 0, 0, 3282, 0 },
+  { 0, 0, 3286, 0 },
+  { 0, 0, 3289, 0 },
+  { 0, 0, 3293, 0 },
+  { 0, 0, 3296, 0 },
+  { 0, 0, 3300, 0 },
+  { 0, 5, 954, 0 },
+  { 0, 0, 3303, 0 },
+  { 0, 5, 960, 0 },
+  { 0, 0, 3306, 0 },
+  { 0, 5, 3309, 15 },
+  { 0, 4, 0, 3311 },
+  { 0, 5, 3314, 1 },
+  { 0, 5, 3316, 1 },
+  { 0, 4, 0, 3318 },
+  { 0, 4, 0, 3320 },
+  { 0, 4, 0, 3323 },
+  { 0, 4, 0, 3325 },
+  { 0, 4, 0, 3328 },
+  { 0, 4, 0, 3332 },
+  { 0, 4, 0, 3335 },
+  { 0, 4, 0, 3339 },
+  { 0, 4, 0, 3342 },
+  { 0, 4, 0, 3346 },
+  { 0, 4, 0, 3349 },
+  { 0, 4, 0, 3352 },
+  { 0, 4, 0, 3355 },
+  { 0, 4, 0, 3358 },
+  { 0, 4, 0, 3361 },
+  { 0, 4, 0, 3366 },
+  { 0, 4, 0, 3368 },
+  { 0, 4, 0, 3370 },
+  { 0, 4, 0, 3372 },
+  { 0, 4, 0, 3374 },
+  { 0, 4, 0, 3376 },
+  { 0, 4, 0, 3378 },
+  { 0, 4, 0, 3380 },
+  { 0, 4, 0, 3382 },
+  { 0, 4, 0, 3384 },
+  { 0, 4, 0, 3386 },
+  { 0, 4, 0, 3388 },
+  { 0, 4, 0, 3390 },
+  { 0, 4, 0, 3392 },
+  { 0, 4, 0, 3395 },
+  { 0, 4, 0, 3399 },
+  { 0, 4, 0, 3403 },
+  { 0, 4, 0, 3405 },
+  { 0, 4, 0, 3408 },
+  { 0, 4, 0, 3412 },
+  { 0, 4, 0, 3416 },
+  { 0, 4, 0, 3418 },
+  { 0, 4, 0, 3421 },
+  { 0, 4, 0, 3423 },
+  { 0, 4, 0, 3426 },
+  { 0, 4, 0, 3428 },
+  { 0, 4, 0, 3431 },
+  { 0, 4, 0, 3435 },
+  { 0, 4, 0, 3438 },
+  { 0, 5, 3440, 0 },
+  { 0, 5, 1492, 0 },
+  { 0, 5, 54, 0 },
+  { 0, 4, 0, 3442 },
+  { 0, 4, 0, 3444 },
+  { 0, 4, 0, 3446 },
+  { 0, 4, 0, 3448 },
+  { 0, 4, 0, 3450 },
+  { 0, 4, 0, 3452 },
+  { 0, 4, 0, 3456 },
+  { 0, 4, 0, 3458 },
+  { 0, 4, 0, 3460 },
+  { 0, 4, 0, 3462 },
+  { 0, 4, 0, 3466 },
+  { 0, 4, 0, 3470 },
+  { 0, 4, 0, 3475 },
+  { 0, 4, 0, 3479 },
+  { 0, 4, 0, 3483 },
+  { 0, 4, 0, 3487 },
+  { 0, 4, 0, 3491 },
+  { 0, 4, 0, 3495 },
+  { 0, 4, 0, 3499 },
+  { 0, 4, 0, 3503 },
+  { 0, 4, 0, 3507 },
+  { 0, 4, 0, 3511 },
+  { 0, 4, 0, 3515 },
+  { 0, 4, 0, 3519 },
+  { 0, 4, 0, 3523 },
+  { 0, 4, 0, 3526 },
+  { 0, 4, 0, 3529 },
+  { 0, 4, 0, 3533 },
+  { 0, 4, 0, 3536 },
+  { 0, 4, 0, 3538 },
+  { 0, 4, 0, 3541 },
+  { 0, 4, 0, 3545 },
+  { 0, 4, 0, 3550 },
+  { 0, 4, 0, 3553 },
+  { 0, 4, 0, 3555 },
+  { 0, 4, 0, 3558 },
+  { 0, 4, 0, 3562 },
+  { 0, 4, 0, 3565 },
+  { 0, 4, 0, 3569 },
+  { 0, 4, 0, 3572 },
+  { 0, 4, 0, 3575 },
+  { 0, 4, 0, 3579 },
+  { 0, 4, 0, 3584 },
+  { 0, 4, 0, 3587 },
+  { 0, 4, 0, 3590 },
+  { 0, 4, 0, 3594 },
+  { 0, 0, 3598, 0 },
+  { 0, 0, 3601, 0 },
+  { 0, 0, 3604, 0 },
+  { 0, 0, 3607, 0 },
+  { 0, 0, 3610, 0 },
+  { 0, 0, 3613, 0 },
+  { 0, 0, 3616, 0 },
+  { 0, 0, 3619, 0 },
+  { 0, 0, 3622, 0 },
+  { 0, 0, 3625, 0 },
+  { 0, 0, 3628, 0 },
+  { 0, 4, 0, 3631 },
+  { 0, 4, 0, 3634 },
+  { 0, 4, 0, 3638 },
+  { 0, 4, 0, 3641 },
+  { 0, 0, 3645, 0 },
+  { 0, 0, 3648, 0 },
+  { 0, 0, 3651, 0 },
+  { 0, 0, 3654, 0 },
+  { 0, 0, 3657, 0 },
+  { 0, 0, 3660, 0 },
+  { 0, 0, 3663, 0 },
+  { 0, 0, 3666, 0 },
+  { 0, 0, 3669, 0 },
+  { 0, 0, 3672, 0 },
+  { 0, 0, 3675, 0 },
+  { 0, 0, 3678, 0 },
+  { 0, 0, 3681, 0 },
+  { 0, 0, 3684, 0 },
+  { 0, 0, 3687, 0 },
+  { 0, 0, 3690, 0 },
+  { 0, 0, 3693, 0 },
+  { 0, 0, 3696, 0 },
+  { 0, 0, 3699, 0 },
+  { 0, 0, 3702, 0 },
+  { 0, 0, 3705, 0 },
+  { 0, 0, 3708, 0 },
+  { 0, 0, 3711, 0 },
+  { 0, 0, 3714, 0 },
+  { 0, 0, 3717, 0 },
+  { 0, 0, 3720, 0 },
+  { 0, 0, 3723, 0 },
+  { 0, 0, 3726, 0 },
+  { 0, 0, 3729, 0 },
+  { 0, 0, 3732, 0 },
+  { 0, 0, 3735, 0 },
+  { 0, 0, 3738, 0 },
+  { 0, 0, 3741, 0 },
+  { 0, 5, 3744, 0 },
+  { 0, 5, 3746, 0 },
+  { 0, 4, 0, 3748 },
+  { 0, 4, 0, 3751 },
+  { 0, 4, 0, 3754 },
+  { 0, 4, 0, 3757 },
+  { 0, 4, 0, 3760 },
+  { 0, 4, 0, 3763 },
+  { 0, 4, 0, 3766 },
+  { 0, 4, 0, 3769 },
+  { 0, 4, 0, 3772 },
+  { 0, 4, 0, 3775 },
+  { 0, 4, 0, 3778 },
+  { 0, 4, 0, 3781 },
+  { 0, 4, 0, 3785 },
+  { 0, 4, 0, 3789 },
+  { 0, 4, 0, 3793 },
+  { 0, 4, 0, 3797 },
+  { 0, 4, 0, 3801 },
+  { 0, 4, 0, 3805 },
+  { 0, 4, 0, 3809 },
+  { 0, 4, 0, 3813 },
+  { 0, 4, 0, 3817 },
+  { 0, 4, 0, 3822 },
+  { 0, 4, 0, 3827 },
+  { 0, 4, 0, 3832 },
+  { 0, 4, 0, 3837 },
+  { 0, 4, 0, 3842 },
+  { 0, 4, 0, 3847 },
+  { 0, 4, 0, 3852 },
+  { 0, 4, 0, 3857 },
+  { 0, 4, 0, 3862 },
+  { 0, 4, 0, 3867 },
+  { 0, 4, 0, 3872 },
+  { 0, 4, 0, 3875 },
+  { 0, 4, 0, 3878 },
+  { 0, 4, 0, 3881 },
+  { 0, 4, 0, 3884 },
+  { 0, 4, 0, 3887 },
+  { 0, 4, 0, 3890 },
+  { 0, 4, 0, 3893 },
+  { 0, 4, 0, 3896 },
+  { 0, 4, 0, 3899 },
+  { 0, 4, 0, 3903 },
+  { 0, 4, 0, 3907 },
+  { 0, 4, 0, 3911 },
+  { 0, 4, 0, 3915 },
+  { 0, 4, 0, 3919 },
+  { 0, 4, 0, 3923 },
+  { 0, 4, 0, 3927 },
+  { 0, 4, 0, 3931 },
+  { 0, 4, 0, 3935 },
+  { 0, 4, 0, 3939 },
+  { 0, 4, 0, 3943 },
+  { 0, 4, 0, 3947 },
+  { 0, 4, 0, 3951 },
+  { 0, 4, 0, 3955 },
+  { 0, 4, 0, 3959 },
+  { 0, 4, 0, 3963 },
+  { 0, 4, 0, 3967 },
+  { 0, 4, 0, 3971 },
+  { 0, 4, 0, 3975 },
+  { 0, 4, 0, 3979 },
+  { 0, 4, 0, 3983 },
+  { 0, 4, 0, 3987 },
+  { 0, 4, 0, 3991 },
+  { 0, 4, 0, 3995 },
+  { 0, 4, 0, 3999 },
+  { 0, 4, 0, 4003 },
+  { 0, 4, 0, 4007 },
+  { 0, 4, 0, 4011 },
+  { 0, 4, 0, 4015 },
+  { 0, 4, 0, 4019 },
+  { 0, 4, 0, 4023 },
+  { 0, 4, 0, 4027 },
+  { 0, 4, 0, 4031 },
+  { 0, 4, 0, 4035 },
+  { 0, 4, 0, 4039 },
+  { 0, 4, 0, 4043 },
+  { 0, 4, 0, 4047 },
+  { 0, 4, 0, 4049 },
+  { 0, 4, 0, 4051 },
+  { 0, 4, 0, 4053 },
+  { 0, 4, 0, 4058 },
+  { 0, 4, 0, 4062 },
+  { 0, 4, 0, 4065 },
+  { 0, 5, 4069, 0 },
+  { 0, 4, 0, 4072 },
+  { 0, 4, 0, 4074 },
+  { 0, 4, 0, 4076 },
+  { 0, 4, 0, 4078 },
+  { 0, 4, 0, 4080 },
+  { 0, 4, 0, 4082 },
+  { 0, 4, 0, 4084 },
+  { 0, 4, 0, 4086 },
+  { 0, 4, 0, 4088 },
+  { 0, 4, 0, 4090 },
+  { 0, 4, 0, 4092 },
+  { 0, 4, 0, 4094 },
+  { 0, 4, 0, 4096 },
+  { 0, 4, 0, 4098 },
+  { 0, 4, 0, 4100 },
+  { 0, 4, 0, 4102 },
+  { 0, 4, 0, 4104 },
+  { 0, 4, 0, 4106 },
+  { 0, 4, 0, 4108 },
+  { 0, 4, 0, 4110 },
+  { 0, 4, 0, 4112 },
+  { 0, 4, 0, 4114 },
+  { 0, 4, 0, 4116 },
+  { 0, 4, 0, 4118 },
+  { 0, 4, 0, 4120 },
+  { 0, 4, 0, 4122 },
+  { 0, 4, 0, 4124 },
+  { 0, 4, 0, 4126 },
+  { 0, 4, 0, 4128 },
+  { 0, 4, 0, 4130 },
+  { 0, 4, 0, 4132 },
+  { 0, 4, 0, 4134 },
+  { 0, 4, 0, 4136 },
+  { 0, 4, 0, 4138 },
+  { 0, 4, 0, 4140 },
+  { 0, 4, 0, 4142 },
+  { 0, 4, 0, 4144 },
+  { 0, 4, 0, 4146 },
+  { 0, 4, 0, 4148 },
+  { 0, 4, 0, 4150 },
+  { 0, 4, 0, 4152 },
+  { 0, 4, 0, 4154 },
+  { 0, 4, 0, 4156 },
+  { 0, 4, 0, 4158 },
+  { 0, 4, 0, 4160 },
+  { 0, 4, 0, 4162 },
+  { 0, 4, 0, 4164 },
+  { 0, 4, 0, 4166 },
+  { 0, 4, 0, 4168 },
+  { 0, 4, 0, 4170 },
+  { 0, 4, 0, 4172 },
+  { 0, 4, 0, 4174 },
+  { 0, 4, 0, 4176 },
+  { 0, 4, 0, 4178 },
+  { 0, 4, 0, 4180 },
+  { 0, 4, 0, 4182 },
+  { 0, 4, 0, 4184 },
+  { 0, 4, 0, 4186 },
+  { 0, 4, 0, 4188 },
+  { 0, 4, 0, 4190 },
+  { 0, 4, 0, 4192 },
+  { 0, 4, 0, 4194 },
+  { 0, 4, 0, 4196 },
+  { 0, 4, 0, 4198 },
+  { 0, 4, 0, 4200 },
+  { 0, 4, 0, 4202 },
+  { 0, 4, 0, 4204 },
+  { 0, 4, 0, 4206 },
+  { 0, 4, 0, 4208 },
+  { 0, 4, 0, 4210 },
+  { 0, 4, 0, 4212 },
+  { 0, 4, 0, 4214 },
+  { 0, 4, 0, 4216 },
+  { 0, 4, 0, 4218 },
+  { 0, 4, 0, 4220 },
+  { 0, 4, 0, 4222 },
+  { 0, 4, 0, 4224 },
+  { 0, 4, 0, 4226 },
+  { 0, 4, 0, 4228 },
+  { 0, 4, 0, 4230 },
+  { 0, 4, 0, 4232 },
+  { 0, 4, 0, 4234 },
+  { 0, 4, 0, 4236 },
+  { 0, 4, 0, 4238 },
+  { 0, 4, 0, 4240 },
+  { 0, 4, 0, 4242 },
+  { 0, 4, 0, 4244 },
+  { 0, 4, 0, 4246 },
+  { 0, 4, 0, 4248 },
+  { 0, 4, 0, 4250 },
+  { 0, 4, 0, 4252 },
+  { 0, 4, 0, 4254 },
+  { 0, 4, 0, 4256 },
+  { 0, 4, 0, 4258 },
+  { 0, 4, 0, 4260 },
+  { 0, 4, 0, 4262 },
+  { 0, 4, 0, 4264 },
+  { 0, 4, 0, 4266 },
+  { 0, 4, 0, 4268 },
+  { 0, 4, 0, 4270 },
+  { 0, 4, 0, 4272 },
+  { 0, 4, 0, 4274 },
+  { 0, 4, 0, 4276 },
+  { 0, 4, 0, 4278 },
+  { 0, 4, 0, 4280 },
+  { 0, 4, 0, 4282 },
+  { 0, 4, 0, 4284 },
+  { 0, 4, 0, 4286 },
+  { 0, 4, 0, 4288 },
+  { 0, 4, 0, 4290 },
+  { 0, 4, 0, 4292 },
+  { 0, 4, 0, 4294 },
+  { 0, 4, 0, 4296 },
+  { 0, 4, 0, 4298 },
+  { 0, 4, 0, 4300 },
+  { 0, 4, 0, 4302 },
+  { 0, 4, 0, 4304 },
+  { 0, 4, 0, 4306 },
+  { 0, 4, 0, 4308 },
+  { 0, 4, 0, 4310 },
+  { 0, 4, 0, 4312 },
+  { 0, 4, 0, 4314 },
+  { 0, 4, 0, 4316 },
+  { 0, 4, 0, 4318 },
+  { 0, 4, 0, 4320 },
+  { 0, 4, 0, 4322 },
+  { 0, 4, 0, 4324 },
+  { 0, 4, 0, 4326 },
+  { 0, 4, 0, 4328 },
+  { 0, 4, 0, 4330 },
+  { 0, 4, 0, 4332 },
+  { 0, 4, 0, 4334 },
+  { 0, 4, 0, 4336 },
+  { 0, 4, 0, 4338 },
+  { 0, 4, 0, 4340 },
+  { 0, 4, 0, 4342 },
+  { 0, 4, 0, 4344 },
+  { 0, 4, 0, 4346 },
+  { 0, 4, 0, 4348 },
+  { 0, 4, 0, 4350 },
+  { 0, 4, 0, 4352 },
+  { 0, 4, 0, 4354 },
+  { 0, 4, 0, 4356 },
+  { 0, 4, 0, 4358 },
+  { 0, 4, 0, 4360 },
+  { 0, 4, 0, 4362 },
+  { 0, 4, 0, 4364 },
+  { 0, 4, 0, 4366 },
+  { 0, 4, 0, 4368 },
+  { 0, 4, 0, 4370 },
+  { 0, 4, 0, 4372 },
+  { 0, 4, 0, 4374 },
+  { 0, 4, 0, 4376 },
+  { 0, 4, 0, 4378 },
+  { 0, 4, 0, 4380 },
+  { 0, 4, 0, 4382 },
+  { 0, 4, 0, 4384 },
+  { 0, 4, 0, 4386 },
+  { 0, 4, 0, 4388 },
+  { 0, 4, 0, 4390 },
+  { 0, 4, 0, 4392 },
+  { 0, 4, 0, 4394 },
+  { 0, 4, 0, 4396 },
+  { 0, 4, 0, 4398 },
+  { 0, 4, 0, 4400 },
+  { 0, 4, 0, 4402 },
+  { 0, 4, 0, 4404 },
+  { 0, 4, 0, 4406 },
+  { 0, 4, 0, 4408 },
+  { 0, 4, 0, 4410 },
+  { 0, 4, 0, 4412 },
+  { 0, 4, 0, 4414 },
+  { 0, 4, 0, 4416 },
+  { 0, 4, 0, 4418 },
+  { 0, 4, 0, 4420 },
+  { 0, 4, 0, 4422 },
+  { 0, 4, 0, 4424 },
+  { 0, 4, 0, 4426 },
+  { 0, 4, 0, 4428 },
+  { 0, 4, 0, 4430 },
+  { 0, 4, 0, 4432 },
+  { 0, 4, 0, 4434 },
+  { 0, 4, 0, 4436 },
+  { 0, 4, 0, 4438 },
+  { 0, 4, 0, 4440 },
+  { 0, 4, 0, 4442 },
+  { 0, 4, 0, 4444 },
+  { 0, 4, 0, 4446 },
+  { 0, 4, 0, 4448 },
+  { 0, 4, 0, 4450 },
+  { 0, 4, 0, 4452 },
+  { 0, 4, 0, 4454 },
+  { 0, 4, 0, 4456 },
+  { 0, 4, 0, 4458 },
+  { 0, 4, 0, 4460 },
+  { 0, 4, 0, 4462 },
+  { 0, 4, 0, 4464 },
+  { 0, 4, 0, 4466 },
+  { 0, 4, 0, 4468 },
+  { 0, 4, 0, 4470 },
+  { 0, 4, 0, 4472 },
+  { 0, 4, 0, 4474 },
+  { 0, 4, 0, 4476 },
+  { 0, 4, 0, 4478 },
+  { 0, 4, 0, 4480 },
+  { 0, 4, 0, 4482 },
+  { 0, 4, 0, 4484 },
+  { 0, 4, 0, 4486 },
+  { 0, 4, 0, 4488 },
+  { 0, 4, 0, 4490 },
+  { 0, 4, 0, 4492 },
+  { 0, 4, 0, 4494 },
+  { 0, 4, 0, 4496 },
+  { 0, 4, 0, 4498 },
+  { 0, 4, 0, 4500 },
+  { 0, 4, 0, 4502 },
+  { 0, 4, 0, 4504 },
+  { 224, 0, 0, 0 },
+  { 0, 4, 0, 4506 },
+  { 0, 4, 0, 4508 },
+  { 0, 4, 0, 4510 },
+  { 0, 0, 4512, 0 },
+  { 0, 0, 4515, 0 },
+  { 0, 0, 4518, 0 },
+  { 0, 0, 4521, 0 },
+  { 0, 0, 4524, 0 },
+  { 0, 0, 4527, 0 },
+  { 0, 0, 4530, 0 },
+  { 0, 0, 4533, 0 },
+  { 0, 0, 4536, 0 },
+  { 0, 0, 4539, 0 },
+  { 0, 0, 4542, 0 },
+  { 0, 0, 4545, 0 },
+  { 0, 0, 4548, 0 },
+  { 0, 0, 4551, 0 },
+  { 0, 0, 4554, 0 },
+  { 0, 0, 4557, 0 },
+  { 0, 0, 4560, 0 },
+  { 0, 0, 4563, 0 },
+  { 0, 0, 4566, 0 },
+  { 0, 0, 4569, 0 },
+  { 0, 0, 4572, 0 },
+  { 0, 0, 4575, 0 },
+  { 0, 0, 4578, 0 },
+  { 0, 0, 4581, 0 },
+  { 0, 0, 4584, 0 },
+  { 0, 0, 4587, 0 },
+  { 8, 10, 0, 0 },
+  { 0, 4, 0, 4590 },
+  { 0, 4, 0, 4593 },
+  { 0, 0, 4596, 0 },
+  { 0, 4, 0, 4599 },
+  { 0, 0, 4602, 0 },
+  { 0, 0, 4605, 0 },
+  { 0, 0, 4608, 0 },
+  { 0, 0, 4611, 0 },
+  { 0, 0, 4614, 0 },
+  { 0, 0, 4617, 0 },
+  { 0, 0, 4620, 0 },
+  { 0, 0, 4623, 0 },
+  { 0, 0, 4626, 0 },
+  { 0, 0, 4629, 0 },
+  { 0, 0, 4632, 0 },
+  { 0, 0, 4635, 0 },
+  { 0, 0, 4638, 0 },
+  { 0, 0, 4641, 0 },
+  { 0, 0, 4644, 0 },
+  { 0, 0, 4647, 0 },
+  { 0, 0, 4650, 0 },
+  { 0, 0, 4653, 0 },
+  { 0, 0, 4656, 0 },
+  { 0, 0, 4659, 0 },
+  { 0, 0, 4662, 0 },
+  { 0, 0, 4665, 0 },
+  { 0, 0, 4668, 0 },
+  { 0, 0, 4671, 0 },
+  { 0, 0, 4674, 0 },
+  { 0, 0, 4677, 0 },
+  { 0, 0, 4680, 0 },
+  { 0, 0, 4683, 0 },
+  { 0, 0, 4686, 0 },
+  { 0, 0, 4689, 0 },
+  { 0, 0, 4692, 0 },
+  { 0, 4, 0, 4695 },
+  { 0, 4, 0, 4698 },
+  { 0, 4, 0, 4700 },
+  { 0, 4, 0, 4702 },
+  { 0, 4, 0, 4704 },
+  { 0, 4, 0, 4706 },
+  { 0, 4, 0, 4708 },
+  { 0, 4, 0, 4710 },
+  { 0, 4, 0, 4712 },
+  { 0, 4, 0, 4714 },
+  { 0, 4, 0, 4716 },
+  { 0, 4, 0, 4718 },
+  { 0, 4, 0, 4720 },
+  { 0, 4, 0, 4722 },
+  { 0, 4, 0, 4724 },
+  { 0, 4, 0, 4726 },
+  { 0, 4, 0, 4728 },
+  { 0, 4, 0, 4730 },
+  { 0, 4, 0, 4732 },
+  { 0, 4, 0, 4734 },
+  { 0, 4, 0, 4736 },
+  { 0, 4, 0, 4738 },
+  { 0, 4, 0, 4740 },
+  { 0, 4, 0, 4742 },
+  { 0, 4, 0, 4744 },
+  { 0, 4, 0, 4746 },
+  { 0, 4, 0, 4748 },
+  { 0, 4, 0, 4750 },
+  { 0, 4, 0, 4752 },
+  { 0, 4, 0, 4754 },
+  { 0, 4, 0, 4756 },
+  { 0, 4, 0, 4758 },
+  { 0, 4, 0, 4760 },
+  { 0, 4, 0, 4762 },
+  { 0, 4, 0, 4764 },
+  { 0, 4, 0, 4766 },
+  { 0, 4, 0, 4768 },
+  { 0, 4, 0, 4770 },
+  { 0, 4, 0, 4772 },
+  { 0, 4, 0, 4774 },
+  { 0, 4, 0, 4776 },
+  { 0, 4, 0, 4778 },
+  { 0, 4, 0, 4780 },
+  { 0, 4, 0, 4782 },
+  { 0, 4, 0, 4784 },
+  { 0, 4, 0, 4786 },
+  { 0, 4, 0, 4788 },
+  { 0, 4, 0, 4790 },
+  { 0, 4, 0, 4792 },
+  { 0, 4, 0, 4794 },
+  { 0, 4, 0, 4796 },
+  { 0, 4, 0, 4798 },
+  { 0, 4, 0, 4800 },
+  { 0, 4, 0, 4802 },
+  { 0, 4, 0, 4804 },
+  { 0, 4, 0, 4806 },
+  { 0, 4, 0, 4808 },
+  { 0, 4, 0, 4810 },
+  { 0, 4, 0, 4812 },
+  { 0, 4, 0, 4814 },
+  { 0, 4, 0, 4816 },
+  { 0, 4, 0, 4818 },
+  { 0, 4, 0, 4820 },
+  { 0, 4, 0, 4822 },
+  { 0, 4, 0, 4824 },
+  { 0, 4, 0, 4826 },
+  { 0, 4, 0, 4828 },
+  { 0, 4, 0, 4830 },
+  { 0, 4, 0, 4832 },
+  { 0, 4, 0, 4834 },
+  { 0, 4, 0, 4836 },
+  { 0, 4, 0, 4838 },
+  { 0, 4, 0, 4840 },
+  { 0, 4, 0, 4842 },
+  { 0, 4, 0, 4844 },
+  { 0, 4, 0, 4846 },
+  { 0, 4, 0, 4848 },
+  { 0, 4, 0, 4850 },
+  { 0, 4, 0, 4852 },
+  { 0, 4, 0, 4854 },
+  { 0, 4, 0, 4856 },
+  { 0, 4, 0, 4858 },
+  { 0, 4, 0, 4860 },
+  { 0, 4, 0, 4862 },
+  { 0, 4, 0, 4864 },
+  { 0, 4, 0, 4866 },
+  { 0, 4, 0, 4868 },
+  { 0, 4, 0, 4870 },
+  { 0, 4, 0, 4872 },
+  { 0, 4, 0, 4874 },
+  { 0, 4, 0, 4876 },
+  { 0, 4, 0, 4878 },
+  { 0, 4, 0, 4880 },
+  { 0, 4, 0, 4882 },
+  { 0, 4, 0, 4884 },
+  { 0, 4, 0, 4886 },
+  { 0, 4, 0, 4888 },
+  { 0, 4, 0, 4890 },
+  { 0, 4, 0, 4892 },
+  { 0, 4, 0, 4894 },
+  { 0, 4, 0, 4896 },
+  { 0, 4, 0, 4898 },
+  { 0, 4, 0, 4900 },
+  { 0, 4, 0, 4902 },
+  { 0, 4, 0, 4904 },
+  { 0, 4, 0, 4906 },
+  { 0, 4, 0, 4910 },
+  { 0, 4, 0, 4914 },
+  { 0, 4, 0, 4918 },
+  { 0, 4, 0, 4922 },
+  { 0, 4, 0, 4926 },
+  { 0, 4, 0, 4930 },
+  { 0, 4, 0, 4934 },
+  { 0, 4, 0, 4938 },
+  { 0, 4, 0, 4942 },
+  { 0, 4, 0, 4946 },
+  { 0, 4, 0, 4950 },
+  { 0, 4, 0, 4954 },
+  { 0, 4, 0, 4958 },
+  { 0, 4, 0, 4962 },
+  { 0, 4, 0, 4967 },
+  { 0, 4, 0, 4972 },
+  { 0, 4, 0, 4977 },
+  { 0, 4, 0, 4982 },
+  { 0, 4, 0, 4987 },
+  { 0, 4, 0, 4992 },
+  { 0, 4, 0, 4997 },
+  { 0, 4, 0, 5002 },
+  { 0, 4, 0, 5007 },
+  { 0, 4, 0, 5012 },
+  { 0, 4, 0, 5017 },
+  { 0, 4, 0, 5022 },
+  { 0, 4, 0, 5027 },
+  { 0, 4, 0, 5032 },
+  { 0, 4, 0, 5037 },
+  { 0, 4, 0, 5045 },
+  { 0, 4, 0, 5052 },
+  { 0, 4, 0, 5056 },
+  { 0, 4, 0, 5060 },
+  { 0, 4, 0, 5064 },
+  { 0, 4, 0, 5068 },
+  { 0, 4, 0, 5072 },
+  { 0, 4, 0, 5076 },
+  { 0, 4, 0, 5080 },
+  { 0, 4, 0, 5084 },
+  { 0, 4, 0, 5088 },
+  { 0, 4, 0, 5092 },
+  { 0, 4, 0, 5096 },
+  { 0, 4, 0, 5100 },
+  { 0, 4, 0, 5104 },
+  { 0, 4, 0, 5108 },
+  { 0, 4, 0, 5112 },
+  { 0, 4, 0, 5116 },
+  { 0, 4, 0, 5120 },
+  { 0, 4, 0, 5124 },
+  { 0, 4, 0, 5128 },
+  { 0, 4, 0, 5132 },
+  { 0, 4, 0, 5136 },
+  { 0, 4, 0, 5140 },
+  { 0, 4, 0, 5144 },
+  { 0, 4, 0, 5148 },
+  { 0, 4, 0, 5152 },
+  { 0, 4, 0, 5156 },
+  { 0, 4, 0, 5160 },
+  { 0, 4, 0, 5164 },
+  { 0, 4, 0, 5168 },
+  { 0, 4, 0, 5172 },
+  { 0, 4, 0, 5176 },
+  { 0, 4, 0, 5180 },
+  { 0, 4, 0, 5184 },
+  { 0, 4, 0, 5188 },
+  { 0, 4, 0, 5192 },
+  { 0, 4, 0, 5196 },
+  { 0, 4, 0, 5198 },
+  { 0, 4, 0, 5200 },
+  { 0, 4, 0, 5202 },
+  { 0, 4, 0, 5206 },
+  { 0, 4, 0, 5209 },
+  { 0, 4, 0, 5212 },
+  { 0, 4, 0, 5215 },
+  { 0, 4, 0, 5218 },
+  { 0, 4, 0, 5221 },
+  { 0, 4, 0, 5224 },
+  { 0, 4, 0, 5227 },
+  { 0, 4, 0, 5230 },
+  { 0, 4, 0, 5233 },
+  { 0, 4, 0, 5236 },
+  { 0, 4, 0, 5239 },
+  { 0, 4, 0, 5242 },
+  { 0, 4, 0, 5245 },
+  { 0, 4, 0, 5248 },
+  { 0, 4, 0, 5251 },
+  { 0, 4, 0, 5254 },
+  { 0, 4, 0, 5257 },
+  { 0, 4, 0, 5260 },
+  { 0, 4, 0, 5263 },
+  { 0, 4, 0, 5266 },
+  { 0, 4, 0, 5269 },
+  { 0, 4, 0, 5272 },
+  { 0, 4, 0, 5275 },
+  { 0, 4, 0, 5278 },
+  { 0, 4, 0, 5281 },
+  { 0, 4, 0, 5284 },
+  { 0, 4, 0, 5287 },
+  { 0, 4, 0, 5290 },
+  { 0, 4, 0, 5293 },
+  { 0, 4, 0, 5299 },
+  { 0, 4, 0, 5304 },
+  { 0, 4, 0, 5307 },
+  { 0, 4, 0, 5309 },
+  { 0, 4, 0, 5311 },
+  { 0, 4, 0, 5313 },
+  { 0, 4, 0, 5315 },
+  { 0, 4, 0, 5317 },
+  { 0, 4, 0, 5319 },
+  { 0, 4, 0, 5321 },
+  { 0, 4, 0, 5323 },
+  { 0, 4, 0, 5325 },
+  { 0, 4, 0, 5327 },
+  { 0, 4, 0, 5329 },
+  { 0, 4, 0, 5331 },
+  { 0, 4, 0, 5333 },
+  { 0, 4, 0, 5335 },
+  { 0, 4, 0, 5337 },
+  { 0, 4, 0, 5339 },
+  { 0, 4, 0, 5341 },
+  { 0, 4, 0, 5343 },
+  { 0, 4, 0, 5345 },
+  { 0, 4, 0, 5347 },
+  { 0, 4, 0, 5349 },
+  { 0, 4, 0, 5351 },
+  { 0, 4, 0, 5353 },
+  { 0, 4, 0, 5355 },
+  { 0, 4, 0, 5357 },
+  { 0, 4, 0, 5359 },
+  { 0, 4, 0, 5361 },
+  { 0, 4, 0, 5363 },
+  { 0, 4, 0, 5365 },
+  { 0, 4, 0, 5367 },
+  { 0, 4, 0, 5369 },
+  { 0, 4, 0, 5371 },
+  { 0, 4, 0, 5374 },
+  { 0, 4, 0, 5377 },
+  { 0, 4, 0, 5380 },
+  { 0, 4, 0, 5383 },
+  { 0, 4, 0, 5386 },
+  { 0, 4, 0, 5389 },
+  { 0, 4, 0, 5392 },
+  { 0, 4, 0, 5395 },
+  { 0, 4, 0, 5398 },
+  { 0, 4, 0, 5401 },
+  { 0, 4, 0, 5404 },
+  { 0, 4, 0, 5407 },
+  { 0, 4, 0, 5410 },
+  { 0, 4, 0, 5413 },
+  { 0, 4, 0, 5416 },
+  { 0, 4, 0, 5419 },
+  { 0, 4, 0, 5422 },
+  { 0, 4, 0, 5425 },
+  { 0, 4, 0, 5428 },
+  { 0, 4, 0, 5431 },
+  { 0, 4, 0, 5434 },
+  { 0, 4, 0, 5437 },
+  { 0, 4, 0, 5440 },
+  { 0, 4, 0, 5443 },
+  { 0, 4, 0, 5447 },
+  { 0, 4, 0, 5451 },
+  { 0, 4, 0, 5455 },
+  { 0, 4, 0, 5458 },
+  { 0, 4, 0, 5462 },
+  { 0, 4, 0, 5465 },
+  { 0, 4, 0, 5469 },
+  { 0, 4, 0, 5471 },
+  { 0, 4, 0, 5473 },
+  { 0, 4, 0, 5475 },
+  { 0, 4, 0, 5477 },
+  { 0, 4, 0, 5479 },
+  { 0, 4, 0, 5481 },
+  { 0, 4, 0, 5483 },
+  { 0, 4, 0, 5485 },
+  { 0, 4, 0, 5487 },
+  { 0, 4, 0, 5489 },
+  { 0, 4, 0, 5491 },
+  { 0, 4, 0, 5493 },
+  { 0, 4, 0, 5495 },
+  { 0, 4, 0, 5497 },
+  { 0, 4, 0, 5499 },
+  { 0, 4, 0, 5501 },
+  { 0, 4, 0, 5503 },
+  { 0, 4, 0, 5505 },
+  { 0, 4, 0, 5507 },
+  { 0, 4, 0, 5509 },
+  { 0, 4, 0, 5511 },
+  { 0, 4, 0, 5513 },
+  { 0, 4, 0, 5515 },
+  { 0, 4, 0, 5517 },
+  { 0, 4, 0, 5519 },
+  { 0, 4, 0, 5521 },
+  { 0, 4, 0, 5523 },
+  { 0, 4, 0, 5525 },
+  { 0, 4, 0, 5527 },
+  { 0, 4, 0, 5529 },
+  { 0, 4, 0, 5531 },
+  { 0, 4, 0, 5533 },
+  { 0, 4, 0, 5535 },
+  { 0, 4, 0, 5537 },
+  { 0, 4, 0, 5539 },
+  { 0, 4, 0, 5541 },
+  { 0, 4, 0, 5543 },
+  { 0, 4, 0, 5545 },
+  { 0, 4, 0, 5547 },
+  { 0, 4, 0, 5549 },
+  { 0, 4, 0, 5551 },
+  { 0, 4, 0, 5553 },
+  { 0, 4, 0, 5555 },
+  { 0, 4, 0, 5557 },
+  { 0, 4, 0, 5559 },
+  { 0, 4, 0, 5561 },
+  { 0, 4, 0, 5563 },
+  { 0, 4, 0, 5566 },
+  { 0, 4, 0, 5572 },
+  { 0, 4, 0, 5577 },
+  { 0, 4, 0, 5583 },
+  { 0, 4, 0, 5587 },
+  { 0, 4, 0, 5593 },
+  { 0, 4, 0, 5597 },
+  { 0, 4, 0, 5601 },
+  { 0, 4, 0, 5608 },
+  { 0, 4, 0, 5613 },
+  { 0, 4, 0, 5617 },
+  { 0, 4, 0, 5621 },
+  { 0, 4, 0, 5625 },
+  { 0, 4, 0, 5630 },
+  { 0, 4, 0, 5635 },
+  { 0, 4, 0, 5640 },
+  { 0, 4, 0, 5645 },
+  { 0, 4, 0, 5650 },
+  { 0, 4, 0, 5655 },
+  { 0, 4, 0, 5660 },
+  { 0, 4, 0, 5667 },
+  { 0, 4, 0, 5670 },
+  { 0, 4, 0, 5677 },
+  { 0, 4, 0, 5684 },
+  { 0, 4, 0, 5690 },
+  { 0, 4, 0, 5695 },
+  { 0, 4, 0, 5702 },
+  { 0, 4, 0, 5709 },
+  { 0, 4, 0, 5714 },
+  { 0, 4, 0, 5718 },
+  { 0, 4, 0, 5722 },
+  { 0, 4, 0, 5727 },
+  { 0, 4, 0, 5732 },
+  { 0, 4, 0, 5738 },
+  { 0, 4, 0, 5744 },
+  { 0, 4, 0, 5748 },
+  { 0, 4, 0, 5752 },
+  { 0, 4, 0, 5757 },
+  { 0, 4, 0, 5761 },
+  { 0, 4, 0, 5765 },
+  { 0, 4, 0, 5768 },
+  { 0, 4, 0, 5771 },
+  { 0, 4, 0, 5775 },
+  { 0, 4, 0, 5779 },
+  { 0, 4, 0, 5786 },
+  { 0, 4, 0, 5791 },
+  { 0, 4, 0, 5797 },
+  { 0, 4, 0, 5804 },
+  { 0, 4, 0, 5809 },
+  { 0, 4, 0, 5813 },
+  { 0, 4, 0, 5817 },
+  { 0, 4, 0, 5824 },
+  { 0, 4, 0, 5829 },
+  { 0, 4, 0, 5836 },
+  { 0, 4, 0, 5840 },
+  { 0, 4, 0, 5846 },
+  { 0, 4, 0, 5850 },
+  { 0, 4, 0, 5855 },
+  { 0, 4, 0, 5859 },
+  { 0, 4, 0, 5864 },
+  { 0, 4, 0, 5870 },
+  { 0, 4, 0, 5875 },
+  { 0, 4, 0, 5881 },
+  { 0, 4, 0, 5886 },
+  { 0, 4, 0, 5889 },
+  { 0, 4, 0, 5895 },
+  { 0, 4, 0, 5899 },
+  { 0, 4, 0, 5903 },
+  { 0, 4, 0, 5908 },
+  { 0, 4, 0, 5912 },
+  { 0, 4, 0, 5916 },
+  { 0, 4, 0, 5920 },
+  { 0, 4, 0, 5926 },
+  { 0, 4, 0, 5931 },
+  { 0, 4, 0, 5934 },
+  { 0, 4, 0, 5941 },
+  { 0, 4, 0, 5945 },
+  { 0, 4, 0, 5951 },
+  { 0, 4, 0, 5956 },
+  { 0, 4, 0, 5961 },
+  { 0, 4, 0, 5965 },
+  { 0, 4, 0, 5969 },
+  { 0, 4, 0, 5974 },
+  { 0, 4, 0, 5977 },
+  { 0, 4, 0, 5982 },
+  { 0, 4, 0, 5988 },
+  { 0, 4, 0, 5991 },
+  { 0, 4, 0, 5998 },
+  { 0, 4, 0, 6002 },
+  { 0, 4, 0, 6005 },
+  { 0, 4, 0, 6008 },
+  { 0, 4, 0, 6011 },
+  { 0, 4, 0, 6014 },
+  { 0, 4, 0, 6017 },
+  { 0, 4, 0, 6020 },
+  { 0, 4, 0, 6023 },
+  { 0, 4, 0, 6026 },
+  { 0, 4, 0, 6029 },
+  { 0, 4, 0, 6032 },
+  { 0, 4, 0, 6036 },
+  { 0, 4, 0, 6040 },
+  { 0, 4, 0, 6044 },
+  { 0, 4, 0, 6048 },
+  { 0, 4, 0, 6052 },
+  { 0, 4, 0, 6056 },
+  { 0, 4, 0, 6060 },
+  { 0, 4, 0, 6064 },
+  { 0, 4, 0, 6068 },
+  { 0, 4, 0, 6072 },
+  { 0, 4, 0, 6076 },
+  { 0, 4, 0, 6080 },
+  { 0, 4, 0, 6084 },
+  { 0, 4, 0, 6088 },
+  { 0, 4, 0, 6092 },
+  { 0, 4, 0, 6096 },
+  { 0, 4, 0, 6099 },
+  { 0, 4, 0, 6102 },
+  { 0, 4, 0, 6106 },
+  { 0, 4, 0, 6109 },
+  { 0, 4, 0, 6112 },
+  { 0, 4, 0, 6115 },
+  { 0, 4, 0, 6119 },
+  { 0, 4, 0, 6123 },
+  { 0, 4, 0, 6126 },
+  { 0, 4, 0, 6129 },
+  { 0, 4, 0, 6132 },
+  { 0, 4, 0, 6135 },
+  { 0, 4, 0, 6138 },
+  { 0, 4, 0, 6143 },
+  { 0, 4, 0, 6146 },
+  { 0, 4, 0, 6149 },
+  { 0, 4, 0, 6152 },
+  { 0, 4, 0, 6155 },
+  { 0, 4, 0, 6158 },
+  { 0, 4, 0, 6161 },
+  { 0, 4, 0, 6164 },
+  { 0, 4, 0, 6167 },
+  { 0, 4, 0, 6171 },
+  { 0, 4, 0, 6176 },
+  { 0, 4, 0, 6179 },
+  { 0, 4, 0, 6182 },
+  { 0, 4, 0, 6185 },
+  { 0, 4, 0, 6188 },
+  { 0, 4, 0, 6191 },
+  { 0, 4, 0, 6194 },
+  { 0, 4, 0, 6197 },
+  { 0, 4, 0, 6201 },
+  { 0, 4, 0, 6205 },
+  { 0, 4, 0, 6209 },
+  { 0, 4, 0, 6213 },
+  { 0, 4, 0, 6216 },
+  { 0, 4, 0, 6219 },
+  { 0, 4, 0, 6222 },
+  { 0, 4, 0, 6225 },
+  { 0, 4, 0, 6228 },
+  { 0, 4, 0, 6231 },
+  { 0, 4, 0, 6234 },
+  { 0, 4, 0, 6237 },
+  { 0, 4, 0, 6240 },
+  { 0, 4, 0, 6243 },
+  { 0, 4, 0, 6247 },
+  { 0, 4, 0, 6251 },
+  { 0, 4, 0, 6254 },
+  { 0, 4, 0, 6258 },
+  { 0, 4, 0, 6262 },
+  { 0, 4, 0, 6266 },
+  { 0, 4, 0, 6269 },
+  { 0, 4, 0, 6273 },
+  { 0, 4, 0, 6277 },
+  { 0, 4, 0, 6282 },
+  { 0, 4, 0, 6285 },
+  { 0, 4, 0, 6289 },
+  { 0, 4, 0, 6293 },
+  { 0, 4, 0, 6297 },
+  { 0, 4, 0, 6301 },
+  { 0, 4, 0, 6307 },
+  { 0, 4, 0, 6314 },
+  { 0, 4, 0, 6317 },
+  { 0, 4, 0, 6320 },
+  { 0, 4, 0, 6323 },
+  { 0, 4, 0, 6326 },
+  { 0, 4, 0, 6329 },
+  { 0, 4, 0, 6332 },
+  { 0, 4, 0, 6335 },
+  { 0, 4, 0, 6338 },
+  { 0, 4, 0, 6341 },
+  { 0, 4, 0, 6344 },
+  { 0, 4, 0, 6347 },
+  { 0, 4, 0, 6350 },
+  { 0, 4, 0, 6353 },
+  { 0, 4, 0, 6356 },
+  { 0, 4, 0, 6359 },
+  { 0, 4, 0, 6362 },
+  { 0, 4, 0, 6365 },
+  { 0, 4, 0, 6368 },
+  { 0, 4, 0, 6373 },
+  { 0, 4, 0, 6376 },
+  { 0, 4, 0, 6379 },
+  { 0, 4, 0, 6382 },
+  { 0, 4, 0, 6387 },
+  { 0, 4, 0, 6391 },
+  { 0, 4, 0, 6394 },
+  { 0, 4, 0, 6397 },
+  { 0, 4, 0, 6400 },
+  { 0, 4, 0, 6403 },
+  { 0, 4, 0, 6406 },
+  { 0, 4, 0, 6409 },
+  { 0, 4, 0, 6412 },
+  { 0, 4, 0, 6415 },
+  { 0, 4, 0, 6418 },
+  { 0, 4, 0, 6421 },
+  { 0, 4, 0, 6425 },
+  { 0, 4, 0, 6428 },
+  { 0, 4, 0, 6431 },
+  { 0, 4, 0, 6435 },
+  { 0, 4, 0, 6439 },
+  { 0, 4, 0, 6442 },
+  { 0, 4, 0, 6447 },
+  { 0, 4, 0, 6451 },
+  { 0, 4, 0, 6454 },
+  { 0, 4, 0, 6457 },
+  { 0, 4, 0, 6460 },
+  { 0, 4, 0, 6463 },
+  { 0, 4, 0, 6467 },
+  { 0, 4, 0, 6471 },
+  { 0, 4, 0, 6474 },
+  { 0, 4, 0, 6477 },
+  { 0, 4, 0, 6480 },
+  { 0, 4, 0, 6483 },
+  { 0, 4, 0, 6486 },
+  { 0, 4, 0, 6489 },
+  { 0, 4, 0, 6492 },
+  { 0, 4, 0, 6495 },
+  { 0, 4, 0, 6498 },
+  { 0, 4, 0, 6502 },
+  { 0, 4, 0, 6506 },
+  { 0, 4, 0, 6510 },
+  { 0, 4, 0, 6514 },
+  { 0, 4, 0, 6518 },
+  { 0, 4, 0, 6522 },
+  { 0, 4, 0, 6526 },
+  { 0, 4, 0, 6530 },
+  { 0, 4, 0, 6534 },
+  { 0, 4, 0, 6538 },
+  { 0, 4, 0, 6542 },
+  { 0, 4, 0, 6546 },
+  { 0, 4, 0, 6550 },
+  { 0, 4, 0, 6554 },
+  { 0, 4, 0, 6558 },
+  { 0, 4, 0, 6562 },
+  { 0, 4, 0, 6566 },
+  { 0, 4, 0, 6570 },
+  { 0, 4, 0, 6574 },
+  { 0, 4, 0, 6578 },
+  { 0, 4, 0, 6582 },
+  { 0, 4, 0, 6586 },
+  { 0, 4, 0, 6590 },
+  { 0, 4, 0, 6592 },
+  { 0, 4, 0, 6594 },
+  { 0, 4, 0, 6596 },
+  { 0, 4, 0, 6598 },
+  { 0, 4, 0, 6600 },
+  { 0, 4, 0, 6602 },
+  { 0, 4, 0, 6604 },
+  { 0, 4, 0, 6606 },
+  { 0, 4, 0, 6608 },
+  { 0, 5, 6610, 0 },
+  { 0, 5, 6612, 0 },
+  { 0, 5, 4394, 0 },
+  { 0, 5, 6614, 0 },
+  { 0, 5, 6616, 0 },
+  { 0, 5, 6618, 0 },
+  { 0, 5, 6620, 0 },
+  { 0, 5, 4502, 0 },
+  { 0, 5, 6622, 0 },
+  { 0, 5, 4410, 0 },
+  { 0, 5, 6624, 0 },
+  { 0, 5, 6626, 0 },
+  { 0, 5, 6628, 0 },
+  { 0, 5, 6630, 0 },
+  { 0, 5, 6632, 0 },
+  { 0, 5, 6634, 0 },
+  { 0, 5, 6636, 0 },
+  { 0, 5, 6638, 0 },
+  { 0, 5, 6640, 0 },
+  { 0, 5, 6642, 0 },
+  { 0, 5, 6644, 0 },
+  { 0, 5, 6646, 0 },
+  { 0, 5, 6648, 0 },
+  { 0, 5, 6650, 0 },
+  { 0, 5, 6652, 0 },
+  { 0, 5, 6654, 0 },
+  { 0, 5, 6656, 0 },
+  { 0, 5, 6658, 0 },
+  { 0, 5, 6660, 0 },
+  { 0, 5, 6662, 0 },
+  { 0, 5, 6664, 0 },
+  { 0, 5, 6666, 0 },
+  { 0, 5, 6668, 0 },
+  { 0, 5, 6670, 0 },
+  { 0, 5, 6672, 0 },
+  { 0, 5, 6674, 0 },
+  { 0, 5, 6676, 0 },
+  { 0, 5, 6678, 0 },
+  { 0, 5, 6680, 0 },
+  { 0, 5, 6682, 0 },
+  { 0, 5, 6684, 0 },
+  { 0, 5, 6686, 0 },
+  { 0, 5, 6688, 0 },
+  { 0, 5, 6690, 0 },
+  { 0, 5, 6692, 0 },
+  { 0, 5, 6694, 0 },
+  { 0, 5, 6696, 0 },
+  { 0, 5, 6698, 0 },
+  { 0, 5, 6700, 0 },
+  { 0, 5, 6702, 0 },
+  { 0, 5, 6704, 0 },
+  { 0, 5, 4326, 0 },
+  { 0, 5, 6706, 0 },
+  { 0, 5, 6708, 0 },
+  { 0, 5, 6710, 0 },
+  { 0, 5, 6712, 0 },
+  { 0, 5, 6714, 0 },
+  { 0, 5, 6716, 0 },
+  { 0, 5, 6718, 0 },
+  { 0, 5, 6720, 0 },
+  { 0, 5, 6722, 0 },
+  { 0, 5, 6724, 0 },
+  { 0, 5, 6726, 0 },
+  { 0, 5, 4472, 0 },
+  { 0, 5, 6728, 0 },
+  { 0, 5, 6730, 0 },
+  { 0, 5, 6732, 0 },
+  { 0, 5, 6734, 0 },
+  { 0, 5, 6736, 0 },
+  { 0, 5, 6738, 0 },
+  { 0, 5, 6740, 0 },
+  { 0, 5, 6742, 0 },
+  { 0, 5, 6744, 0 },
+  { 0, 5, 6746, 0 },
+  { 0, 5, 6748, 0 },
+  { 0, 5, 6750, 0 },
+  { 0, 5, 6752, 0 },
+  { 0, 5, 6754, 0 },
+  { 0, 5, 6756, 0 },
+  { 0, 5, 6758, 0 },
+  { 0, 5, 6760, 0 },
+  { 0, 5, 6762, 0 },
+  { 0, 5, 6764, 0 },
+  { 0, 5, 6766, 0 },
+  { 0, 5, 6768, 0 },
+  { 0, 5, 6770, 0 },
+  { 0, 5, 6772, 0 },
+  { 0, 5, 6774, 0 },
+  { 0, 5, 6776, 0 },
+  { 0, 5, 6778, 0 },
+  { 0, 5, 6780, 0 },
+  { 0, 5, 6782, 0 },
+  { 0, 5, 6784, 0 },
+  { 0, 5, 6786, 0 },
+  { 0, 5, 6788, 0 },
+  { 0, 5, 6790, 0 },
+  { 0, 5, 6792, 0 },
+  { 0, 5, 6794, 0 },
+  { 0, 5, 6796, 0 },
+  { 0, 5, 6798, 0 },
+  { 0, 5, 6800, 0 },
+  { 0, 5, 6802, 0 },
+  { 0, 5, 6804, 0 },
+  { 0, 5, 6806, 0 },
+  { 0, 5, 6808, 0 },
+  { 0, 5, 6810, 0 },
+  { 0, 5, 6812, 0 },
+  { 0, 5, 6814, 0 },
+  { 0, 5, 6816, 0 },
+  { 0, 5, 6818, 0 },
+  { 0, 5, 6820, 0 },
+  { 0, 5, 4398, 0 },
+  { 0, 5, 6822, 0 },
+  { 0, 5, 6824, 0 },
+  { 0, 5, 6826, 0 },
+  { 0, 5, 6828, 0 },
+  { 0, 5, 6830, 0 },
+  { 0, 5, 6832, 0 },
+  { 0, 5, 6834, 0 },
+  { 0, 5, 6836, 0 },
+  { 0, 5, 6838, 0 },
+  { 0, 5, 6840, 0 },
+  { 0, 5, 6842, 0 },
+  { 0, 5, 6844, 0 },
+  { 0, 5, 6846, 0 },
+  { 0, 5, 6848, 0 },
+  { 0, 5, 6850, 0 },
+  { 0, 5, 4152, 0 },
+  { 0, 5, 6852, 0 },
+  { 0, 5, 6854, 0 },
+  { 0, 5, 6856, 0 },
+  { 0, 5, 6858, 0 },
+  { 0, 5, 6860, 0 },
+  { 0, 5, 6862, 0 },
+  { 0, 5, 6864, 0 },
+  { 0, 5, 6866, 0 },
+  { 0, 5, 4114, 0 },
+  { 0, 5, 6868, 0 },
+  { 0, 5, 6870, 0 },
+  { 0, 5, 6872, 0 },
+  { 0, 5, 6874, 0 },
+  { 0, 5, 6876, 0 },
+  { 0, 5, 6878, 0 },
+  { 0, 5, 6880, 0 },
+  { 0, 5, 6882, 0 },
+  { 0, 5, 6884, 0 },
+  { 0, 5, 6886, 0 },
+  { 0, 5, 6888, 0 },
+  { 0, 5, 6890, 0 },
+  { 0, 5, 6892, 0 },
+  { 0, 5, 6894, 0 },
+  { 0, 5, 6896, 0 },
+  { 0, 5, 6898, 0 },
+  { 0, 5, 6900, 0 },
+  { 0, 5, 6902, 0 },
+  { 0, 5, 6904, 0 },
+  { 0, 5, 6906, 0 },
+  { 0, 5, 6908, 0 },
+  { 0, 5, 6910, 0 },
+  { 0, 5, 6912, 0 },
+  { 0, 5, 6914, 0 },
+  { 0, 5, 6916, 0 },
+  { 0, 5, 6918, 0 },
+  { 0, 5, 6920, 0 },
+  { 0, 5, 6922, 0 },
+  { 0, 5, 6924, 0 },
+  { 0, 5, 6926, 0 },
+  { 0, 5, 6928, 0 },
+  { 0, 5, 6930, 0 },
+  { 0, 5, 6932, 0 },
+  { 0, 5, 6934, 0 },
+  { 0, 5, 6936, 0 },
+  { 0, 5, 6938, 0 },
+  { 0, 5, 6940, 0 },
+  { 0, 5, 6942, 0 },
+  { 0, 5, 6944, 0 },
+  { 0, 5, 6946, 0 },
+  { 0, 5, 6948, 0 },
+  { 0, 5, 6950, 0 },
+  { 0, 5, 6952, 0 },
+  { 0, 5, 6954, 0 },
+  { 0, 5, 6956, 0 },
+  { 0, 5, 6958, 0 },
+  { 0, 5, 6960, 0 },
+  { 0, 5, 6962, 0 },
+  { 0, 5, 6964, 0 },
+  { 0, 5, 6966, 0 },
+  { 0, 5, 6968, 0 },
+  { 0, 5, 6970, 0 },
+  { 0, 5, 6972, 0 },
+  { 0, 5, 6974, 0 },
+  { 0, 5, 4500, 0 },
+  { 0, 5, 6976, 0 },
+  { 0, 5, 6978, 0 },
+  { 0, 5, 6980, 0 },
+  { 0, 5, 6982, 0 },
+  { 0, 5, 6984, 0 },
+  { 0, 5, 6986, 0 },
+  { 0, 5, 6988, 0 },
+  { 0, 5, 6990, 0 },
+  { 0, 5, 6992, 0 },
+  { 0, 5, 6994, 0 },
+  { 0, 5, 6996, 0 },
+  { 0, 5, 6998, 0 },
+  { 0, 5, 5309, 0 },
+  { 0, 5, 7000, 0 },
+  { 0, 5, 7002, 0 },
+  { 0, 5, 7004, 0 },
+  { 0, 5, 7006, 0 },
+  { 0, 5, 7008, 0 },
+  { 0, 5, 7010, 0 },
+  { 0, 5, 7012, 0 },
+  { 0, 5, 7014, 0 },
+  { 0, 5, 7016, 0 },
+  { 0, 5, 7018, 0 },
+  { 0, 5, 7020, 0 },
+  { 0, 5, 7022, 0 },
+  { 0, 5, 7024, 0 },
+  { 0, 5, 7026, 0 },
+  { 0, 5, 7028, 0 },
+  { 0, 5, 7030, 0 },
+  { 0, 5, 7032, 0 },
+  { 0, 5, 7034, 0 },
+  { 0, 5, 7036, 0 },
+  { 0, 5, 7038, 0 },
+  { 0, 5, 7040, 0 },
+  { 0, 5, 7042, 0 },
+  { 0, 5, 4408, 0 },
+  { 0, 5, 7044, 0 },
+  { 0, 5, 7046, 0 },
+  { 0, 5, 7048, 0 },
+  { 0, 5, 7050, 0 },
+  { 0, 5, 7052, 0 },
+  { 0, 5, 7054, 0 },
+  { 0, 5, 7056, 0 },
+  { 0, 5, 7058, 0 },
+  { 0, 5, 7060, 0 },
+  { 0, 5, 7062, 0 },
+  { 0, 5, 7064, 0 },
+  { 0, 5, 7066, 0 },
+  { 0, 5, 7068, 0 },
+  { 0, 5, 4310, 0 },
+  { 0, 5, 7070, 0 },
+  { 0, 5, 7072, 0 },
+  { 0, 5, 7074, 0 },
+  { 0, 5, 7076, 0 },
+  { 0, 5, 7078, 0 },
+  { 0, 5, 7080, 0 },
+  { 0, 5, 7082, 0 },
+  { 0, 5, 7084, 0 },
+  { 0, 5, 7086, 0 },
+  { 0, 5, 7088, 0 },
+  { 0, 5, 7090, 0 },
+  { 0, 5, 7092, 0 },
+  { 0, 5, 7094, 0 },
+  { 0, 5, 7096, 0 },
+  { 0, 5, 7098, 0 },
+  { 0, 5, 7100, 0 },
+  { 0, 5, 4364, 0 },
+  { 0, 5, 7102, 0 },
+  { 0, 5, 4370, 0 },
+  { 0, 5, 7104, 0 },
+  { 0, 5, 7106, 0 },
+  { 0, 5, 7108, 0 },
+  { 0, 5, 7110, 0 },
+  { 0, 5, 7112, 0 },
+  { 0, 5, 7114, 0 },
+  { 0, 5, 7116, 0 },
+  { 0, 5, 7118, 0 },
+  { 0, 5, 7120, 0 },
+  { 0, 5, 7122, 0 },
+  { 0, 5, 7124, 0 },
+  { 0, 5, 7126, 0 },
+  { 0, 5, 7128, 0 },
+  { 0, 5, 7130, 0 },
+  { 0, 5, 4324, 0 },
+  { 0, 5, 7132, 0 },
+  { 0, 5, 7134, 0 },
+  { 0, 5, 7136, 0 },
+  { 0, 5, 7138, 0 },
+  { 0, 5, 7140, 0 },
+  { 0, 5, 7142, 0 },
+  { 0, 5, 7144, 0 },
+  { 0, 5, 7146, 0 },
+  { 0, 5, 7148, 0 },
+  { 0, 5, 7150, 0 },
+  { 0, 5, 7152, 0 },
+  { 0, 5, 7154, 0 },
+  { 0, 5, 7156, 0 },
+  { 0, 5, 7158, 0 },
+  { 0, 5, 7160, 0 },
+  { 0, 5, 7162, 0 },
+  { 0, 5, 7164, 0 },
+  { 0, 5, 7166, 0 },
+  { 0, 5, 7168, 0 },
+  { 0, 5, 7170, 0 },
+  { 0, 5, 7172, 0 },
+  { 0, 5, 7174, 0 },
+  { 0, 5, 4166, 0 },
+  { 0, 5, 7176, 0 },
+  { 0, 5, 7178, 0 },
+  { 0, 5, 7180, 0 },
+  { 0, 5, 7182, 0 },
+  { 0, 5, 7184, 0 },
+  { 0, 5, 7186, 0 },
+  { 0, 5, 7188, 0 },
+  { 0, 5, 7190, 0 },
+  { 0, 5, 7192, 0 },
+  { 0, 5, 7194, 0 },
+  { 0, 5, 7196, 0 },
+  { 0, 5, 7198, 0 },
+  { 0, 5, 7200, 0 },
+  { 0, 5, 7202, 0 },
+  { 0, 5, 7204, 0 },
+  { 0, 5, 5319, 0 },
+  { 0, 5, 7206, 0 },
+  { 0, 5, 7208, 0 },
+  { 0, 5, 7210, 0 },
+  { 0, 5, 7212, 0 },
+  { 0, 5, 5327, 0 },
+  { 0, 5, 7214, 0 },
+  { 0, 5, 7216, 0 },
+  { 0, 5, 7218, 0 },
+  { 0, 5, 7220, 0 },
+  { 0, 5, 7222, 0 },
+  { 0, 5, 7224, 0 },
+  { 0, 5, 7226, 0 },
+  { 0, 5, 7228, 0 },
+  { 0, 5, 7230, 0 },
+  { 0, 5, 7232, 0 },
+  { 0, 5, 7234, 0 },
+  { 0, 5, 7236, 0 },
+  { 0, 5, 7238, 0 },
+  { 0, 5, 7240, 0 },
+  { 0, 5, 7242, 0 },
+  { 0, 5, 7244, 0 },
+  { 0, 5, 7246, 0 },
+  { 0, 5, 7248, 0 },
+  { 0, 5, 7250, 0 },
+  { 0, 5, 7252, 0 },
+  { 0, 5, 7254, 0 },
+  { 0, 5, 7256, 0 },
+  { 0, 5, 7258, 0 },
+  { 0, 5, 7260, 0 },
+  { 0, 5, 7262, 0 },
+  { 0, 5, 7264, 0 },
+  { 0, 5, 7266, 0 },
+  { 0, 5, 7268, 0 },
+  { 0, 5, 7270, 0 },
+  { 0, 5, 7272, 0 },
+  { 0, 5, 7274, 0 },
+  { 0, 5, 7276, 0 },
+  { 0, 5, 7278, 0 },
+  { 0, 5, 7280, 0 },
+  { 0, 5, 7282, 0 },
+  { 0, 5, 7284, 0 },
+  { 0, 5, 7286, 0 },
+  { 0, 5, 7288, 0 },
+  { 0, 5, 7290, 0 },
+  { 0, 5, 7292, 0 },
+  { 0, 5, 7294, 0 },
+  { 0, 5, 7296, 0 },
+  { 0, 5, 7298, 0 },
+  { 0, 5, 7300, 0 },
+  { 0, 5, 7302, 0 },
+  { 0, 5, 7304, 0 },
+  { 0, 5, 7306, 0 },
+  { 0, 5, 7308, 0 },
+  { 0, 5, 7310, 0 },
+  { 0, 5, 7312, 0 },
+  { 0, 5, 7314, 0 },
+  { 0, 5, 7316, 0 },
+  { 0, 5, 7318, 0 },
+  { 0, 5, 7320, 0 },
+  { 0, 5, 7322, 0 },
+  { 0, 5, 7324, 0 },
+  { 0, 5, 4232, 0 },
+  { 0, 5, 7326, 0 },
+  { 0, 5, 7328, 0 },
+  { 0, 5, 7330, 0 },
+  { 0, 5, 7332, 0 },
+  { 0, 5, 7334, 0 },
+  { 0, 5, 7336, 0 },
+  { 0, 5, 7338, 0 },
+  { 0, 5, 7340, 0 },
+  { 0, 5, 7342, 0 },
+  { 0, 5, 7344, 0 },
+  { 0, 5, 7346, 0 },
+  { 0, 5, 7348, 0 },
+  { 0, 5, 7350, 0 },
+  { 0, 5, 7352, 0 },
+  { 0, 5, 7354, 0 },
+  { 0, 5, 7356, 0 },
+  { 0, 5, 7358, 0 },
+  { 0, 5, 7360, 0 },
+  { 0, 5, 7362, 0 },
+  { 0, 5, 7364, 0 },
+  { 0, 5, 7366, 0 },
+  { 0, 5, 7368, 0 },
+  { 0, 5, 7370, 0 },
+  { 0, 5, 7372, 0 },
+  { 0, 5, 7374, 0 },
+  { 0, 5, 7376, 0 },
+  { 0, 5, 7378, 0 },
+  { 0, 5, 7380, 0 },
+  { 0, 5, 7382, 0 },
+  { 0, 5, 7384, 0 },
+  { 0, 5, 7386, 0 },
+  { 0, 5, 7388, 0 },
+  { 0, 5, 7390, 0 },
+  { 0, 5, 7392, 0 },
+  { 0, 5, 7394, 0 },
+  { 0, 5, 7396, 0 },
+  { 0, 5, 7398, 0 },
+  { 0, 5, 7400, 0 },
+  { 0, 5, 7402, 0 },
+  { 0, 5, 7404, 0 },
+  { 0, 5, 7406, 0 },
+  { 0, 5, 7408, 0 },
+  { 0, 5, 7410, 0 },
+  { 0, 5, 7412, 0 },
+  { 0, 5, 7414, 0 },
+  { 0, 5, 7416, 0 },
+  { 0, 5, 7418, 0 },
+  { 0, 5, 7420, 0 },
+  { 0, 4, 0, 7422 },
+  { 0, 4, 0, 7425 },
+  { 0, 4, 0, 7428 },
+  { 0, 4, 0, 7431 },
+  { 0, 4, 0, 7435 },
+  { 0, 4, 0, 7439 },
+  { 0, 4, 0, 7442 },
+  { 0, 4, 0, 7445 },
+  { 0, 4, 0, 7448 },
+  { 0, 4, 0, 7451 },
+  { 0, 4, 0, 7454 },
+  { 0, 5, 7457, 0 },
+  { 26, 0, 0, 0 },
+  { 0, 5, 7460, 0 },
+  { 0, 4, 0, 7463 },
+  { 0, 4, 0, 7465 },
+  { 0, 4, 0, 7467 },
+  { 0, 4, 0, 7469 },
+  { 0, 4, 0, 7471 },
+  { 0, 4, 0, 7473 },
+  { 0, 4, 0, 7475 },
+  { 0, 5, 7477, 0 },
+  { 0, 5, 7480, 0 },
+  { 0, 5, 7483, 0 },
+  { 0, 5, 7487, 0 },
+  { 0, 5, 7491, 0 },
+  { 0, 5, 7494, 0 },
+  { 0, 5, 7497, 0 },
+  { 0, 5, 7500, 0 },
+  { 0, 5, 7503, 0 },
+  { 0, 5, 7506, 0 },
+  { 0, 5, 7509, 0 },
+  { 0, 5, 7512, 0 },
+  { 0, 5, 7515, 0 },
+  { 0, 5, 7518, 0 },
+  { 0, 5, 7521, 0 },
+  { 0, 5, 7524, 0 },
+  { 0, 5, 7527, 0 },
+  { 0, 5, 7530, 0 },
+  { 0, 5, 7533, 0 },
+  { 0, 5, 7536, 0 },
+  { 0, 5, 7539, 0 },
+  { 0, 5, 7542, 0 },
+  { 0, 5, 7545, 0 },
+  { 0, 5, 7548, 0 },
+  { 0, 5, 7551, 0 },
+  { 0, 5, 7554, 0 },
+  { 0, 5, 7557, 0 },
+  { 0, 5, 7560, 0 },
+  { 0, 5, 7563, 0 },
+  { 0, 5, 7566, 0 },
+  { 0, 5, 7569, 0 },
+  { 0, 5, 7572, 0 },
+  { 0, 4, 0, 7575 },
+  { 0, 4, 0, 7578 },
+  { 0, 4, 0, 7580 },
+  { 0, 4, 0, 7582 },
+  { 0, 4, 0, 7584 },
+  { 0, 4, 0, 7586 },
+  { 0, 4, 0, 7588 },
+  { 0, 4, 0, 7590 },
+  { 0, 4, 0, 7592 },
+  { 0, 4, 0, 7594 },
+  { 0, 4, 0, 7596 },
+  { 0, 4, 0, 7598 },
+  { 0, 4, 0, 7600 },
+  { 0, 4, 0, 7602 },
+  { 0, 4, 0, 7604 },
+  { 0, 4, 0, 7606 },
+  { 0, 4, 0, 7608 },
+  { 0, 4, 0, 7610 },
+  { 0, 4, 0, 7612 },
+  { 0, 4, 0, 7614 },
+  { 0, 4, 0, 7616 },
+  { 0, 4, 0, 7618 },
+  { 0, 4, 0, 7620 },
+  { 0, 4, 0, 7622 },
+  { 0, 4, 0, 7624 },
+  { 0, 4, 0, 7626 },
+  { 0, 4, 0, 1218 },
+  { 0, 4, 0, 7628 },
+  { 0, 4, 0, 7630 },
+  { 0, 4, 0, 7632 },
+  { 0, 4, 0, 1224 },
+  { 0, 4, 0, 7634 },
+  { 0, 4, 0, 7636 },
+  { 0, 4, 0, 7638 },
+  { 0, 4, 0, 7640 },
+  { 0, 4, 0, 7642 },
+  { 0, 4, 0, 7644 },
+  { 0, 4, 0, 7646 },
+  { 0, 4, 0, 7648 },
+  { 0, 4, 0, 7650 },
+  { 0, 4, 0, 7652 },
+  { 0, 4, 0, 7656 },
+  { 0, 4, 0, 7660 },
+  { 0, 4, 0, 7664 },
+  { 0, 4, 0, 7668 },
+  { 0, 4, 0, 7672 },
+  { 0, 4, 0, 7676 },
+  { 0, 4, 0, 7680 },
+  { 0, 4, 0, 7684 },
+  { 0, 4, 0, 7686 },
+  { 0, 4, 0, 7690 },
+  { 0, 4, 0, 7694 },
+  { 0, 4, 0, 7698 },
+  { 0, 4, 0, 7702 },
+  { 0, 4, 0, 7705 },
+  { 0, 4, 0, 7708 },
+  { 0, 4, 0, 7711 },
+  { 0, 4, 0, 7714 },
+  { 0, 4, 0, 7717 },
+  { 0, 4, 0, 7720 },
+  { 0, 4, 0, 7723 },
+  { 0, 4, 0, 7726 },
+  { 0, 4, 0, 7729 },
+  { 0, 4, 0, 7732 },
+  { 0, 4, 0, 7735 },
+  { 0, 4, 0, 7738 },
+  { 0, 4, 0, 7741 },
+  { 0, 4, 0, 7744 },
+  { 0, 4, 0, 7747 },
+  { 0, 4, 0, 7750 },
+  { 0, 4, 0, 7753 },
+  { 0, 4, 0, 7756 },
+  { 0, 4, 0, 7759 },
+  { 0, 4, 0, 7762 },
+  { 0, 4, 0, 7765 },
+  { 0, 4, 0, 7768 },
+  { 0, 4, 0, 7771 },
+  { 0, 4, 0, 7774 },
+  { 0, 4, 0, 7777 },
+  { 0, 4, 0, 7780 },
+  { 0, 4, 0, 7783 },
+  { 0, 4, 0, 7786 },
+  { 0, 4, 0, 7789 },
+  { 0, 4, 0, 7792 },
+  { 0, 4, 0, 7795 },
+  { 0, 4, 0, 7798 },
+  { 0, 4, 0, 7801 },
+  { 0, 4, 0, 7804 },
+  { 0, 4, 0, 7807 },
+  { 0, 4, 0, 7810 },
+  { 0, 4, 0, 7813 },
+  { 0, 4, 0, 7816 },
+  { 0, 4, 0, 7819 },
+  { 0, 4, 0, 7822 },
+  { 0, 4, 0, 7825 },
+  { 0, 4, 0, 7828 },
+  { 0, 4, 0, 7831 },
+  { 0, 4, 0, 7834 },
+  { 0, 4, 0, 7837 },
+  { 0, 4, 0, 7840 },
+  { 0, 4, 0, 7843 },
+  { 0, 4, 0, 7846 },
+  { 0, 4, 0, 7849 },
+  { 0, 4, 0, 7852 },
+  { 0, 4, 0, 7855 },
+  { 0, 4, 0, 7858 },
+  { 0, 4, 0, 7861 },
+  { 0, 4, 0, 7864 },
+  { 0, 4, 0, 7867 },
+  { 0, 4, 0, 7870 },
+  { 0, 4, 0, 7873 },
+  { 0, 4, 0, 7876 },
+  { 0, 4, 0, 7879 },
+  { 0, 4, 0, 7882 },
+  { 0, 4, 0, 7885 },
+  { 0, 4, 0, 7888 },
+  { 0, 4, 0, 7891 },
+  { 0, 4, 0, 7894 },
+  { 0, 4, 0, 7897 },
+  { 0, 4, 0, 7900 },
+  { 0, 4, 0, 7903 },
+  { 0, 4, 0, 7906 },
+  { 0, 4, 0, 7909 },
+  { 0, 4, 0, 7912 },
+  { 0, 4, 0, 7915 },
+  { 0, 4, 0, 7918 },
+  { 0, 4, 0, 7921 },
+  { 0, 4, 0, 7924 },
+  { 0, 4, 0, 7927 },
+  { 0, 4, 0, 7930 },
+  { 0, 4, 0, 7933 },
+  { 0, 4, 0, 7936 },
+  { 0, 4, 0, 7939 },
+  { 0, 4, 0, 7942 },
+  { 0, 4, 0, 7945 },
+  { 0, 4, 0, 7948 },
+  { 0, 4, 0, 7951 },
+  { 0, 4, 0, 7954 },
+  { 0, 4, 0, 7957 },
+  { 0, 4, 0, 7960 },
+  { 0, 4, 0, 7963 },
+  { 0, 4, 0, 7966 },
+  { 0, 4, 0, 7969 },
+  { 0, 4, 0, 7973 },
+  { 0, 4, 0, 7977 },
+  { 0, 4, 0, 7981 },
+  { 0, 4, 0, 7985 },
+  { 0, 4, 0, 7989 },
+  { 0, 4, 0, 7993 },
+  { 0, 4, 0, 7997 },
+  { 0, 4, 0, 8001 },
+  { 0, 4, 0, 8005 },
+  { 0, 4, 0, 8008 },
+  { 0, 4, 0, 8011 },
+  { 0, 4, 0, 8014 },
+  { 0, 4, 0, 8017 },
+  { 0, 4, 0, 8020 },
+  { 0, 4, 0, 8023 },
+  { 0, 4, 0, 8026 },
+  { 0, 4, 0, 8029 },
+  { 0, 4, 0, 8032 },
+  { 0, 4, 0, 8035 },
+  { 0, 4, 0, 8038 },
+  { 0, 4, 0, 8041 },
+  { 0, 4, 0, 8044 },
+  { 0, 4, 0, 8047 },
+  { 0, 4, 0, 8050 },
+  { 0, 4, 0, 8053 },
+  { 0, 4, 0, 8057 },
+  { 0, 4, 0, 8061 },
+  { 0, 4, 0, 8064 },
+  { 0, 4, 0, 8067 },
+  { 0, 4, 0, 8070 },
+  { 0, 4, 0, 8073 },
+  { 0, 4, 0, 8076 },
+  { 0, 4, 0, 8079 },
+  { 0, 4, 0, 8082 },
+  { 0, 4, 0, 8085 },
+  { 0, 4, 0, 8088 },
+  { 0, 4, 0, 8091 },
+  { 0, 4, 0, 8094 },
+  { 0, 4, 0, 8098 },
+  { 0, 4, 0, 8102 },
+  { 0, 4, 0, 8106 },
+  { 0, 4, 0, 8109 },
+  { 0, 4, 0, 8112 },
+  { 0, 4, 0, 8115 },
+  { 0, 4, 0, 8118 },
+  { 0, 4, 0, 8121 },
+  { 0, 4, 0, 8124 },
+  { 0, 4, 0, 8127 },
+  { 0, 4, 0, 8130 },
+  { 0, 4, 0, 8133 },
+  { 0, 4, 0, 8136 },
+  { 0, 4, 0, 8139 },
+  { 0, 4, 0, 8142 },
+  { 0, 4, 0, 8145 },
+  { 0, 4, 0, 8148 },
+  { 0, 4, 0, 8151 },
+  { 0, 4, 0, 8154 },
+  { 0, 4, 0, 8157 },
+  { 0, 4, 0, 8160 },
+  { 0, 4, 0, 8163 },
+  { 0, 4, 0, 8166 },
+  { 0, 4, 0, 8169 },
+  { 0, 4, 0, 8172 },
+  { 0, 4, 0, 8175 },
+  { 0, 4, 0, 8178 },
+  { 0, 4, 0, 8181 },
+  { 0, 4, 0, 8184 },
+  { 0, 4, 0, 8187 },
+  { 0, 4, 0, 8190 },
+  { 0, 4, 0, 8194 },
+  { 0, 4, 0, 8198 },
+  { 0, 4, 0, 8202 },
+  { 0, 4, 0, 8206 },
+  { 0, 4, 0, 8210 },
+  { 0, 4, 0, 8214 },
+  { 0, 4, 0, 8218 },
+  { 0, 4, 0, 8222 },
+  { 0, 4, 0, 8226 },
+  { 0, 4, 0, 8230 },
+  { 0, 4, 0, 8234 },
+  { 0, 4, 0, 8238 },
+  { 0, 4, 0, 8242 },
+  { 0, 4, 0, 8246 },
+  { 0, 4, 0, 8250 },
+  { 0, 4, 0, 8254 },
+  { 0, 4, 0, 8258 },
+  { 0, 4, 0, 8262 },
+  { 0, 4, 0, 8266 },
+  { 0, 4, 0, 8270 },
+  { 0, 4, 0, 8274 },
+  { 0, 4, 0, 8278 },
+  { 0, 4, 0, 8282 },
+  { 0, 4, 0, 8286 },
+  { 0, 4, 0, 8290 },
+  { 0, 4, 0, 8294 },
+  { 0, 4, 0, 8298 },
+  { 0, 4, 0, 8302 },
+  { 0, 4, 0, 8306 },
+  { 0, 4, 0, 8310 },
+  { 0, 4, 0, 8314 },
+  { 0, 4, 0, 8318 },
+  { 0, 4, 0, 8322 },
+  { 0, 4, 0, 8326 },
+  { 0, 4, 0, 8330 },
+  { 0, 4, 0, 8334 },
+  { 0, 4, 0, 8338 },
+  { 0, 4, 0, 8342 },
+  { 0, 4, 0, 8346 },
+  { 0, 4, 0, 8350 },
+  { 0, 4, 0, 8354 },
+  { 0, 4, 0, 8358 },
+  { 0, 4, 0, 8362 },
+  { 0, 4, 0, 8366 },
+  { 0, 4, 0, 8370 },
+  { 0, 4, 0, 8374 },
+  { 0, 4, 0, 8378 },
+  { 0, 4, 0, 8382 },
+  { 0, 4, 0, 8386 },
+  { 0, 4, 0, 8390 },
+  { 0, 4, 0, 8394 },
+  { 0, 4, 0, 8398 },
+  { 0, 4, 0, 8402 },
+  { 0, 4, 0, 8406 },
+  { 0, 4, 0, 8410 },
+  { 0, 4, 0, 8414 },
+  { 0, 4, 0, 8418 },
+  { 0, 4, 0, 8422 },
+  { 0, 4, 0, 8426 },
+  { 0, 4, 0, 8430 },
+  { 0, 4, 0, 8434 },
+  { 0, 4, 0, 8438 },
+  { 0, 4, 0, 8442 },
+  { 0, 4, 0, 8446 },
+  { 0, 4, 0, 8450 },
+  { 0, 4, 0, 8454 },
+  { 0, 4, 0, 8458 },
+  { 0, 4, 0, 8462 },
+  { 0, 4, 0, 8466 },
+  { 0, 4, 0, 8470 },
+  { 0, 4, 0, 8474 },
+  { 0, 4, 0, 8478 },
+  { 0, 4, 0, 8482 },
+  { 0, 4, 0, 8486 },
+  { 0, 4, 0, 8490 },
+  { 0, 4, 0, 8494 },
+  { 0, 4, 0, 8498 },
+  { 0, 4, 0, 8502 },
+  { 0, 4, 0, 8506 },
+  { 0, 4, 0, 8510 },
+  { 0, 4, 0, 8514 },
+  { 0, 4, 0, 8518 },
+  { 0, 4, 0, 8522 },
+  { 0, 4, 0, 8526 },
+  { 0, 4, 0, 8530 },
+  { 0, 4, 0, 8534 },
+  { 0, 4, 0, 8538 },
+  { 0, 4, 0, 8542 },
+  { 0, 4, 0, 8546 },
+  { 0, 4, 0, 8550 },
+  { 0, 4, 0, 8554 },
+  { 0, 4, 0, 8558 },
+  { 0, 4, 0, 8562 },
+  { 0, 4, 0, 8566 },
+  { 0, 4, 0, 8570 },
+  { 0, 4, 0, 8574 },
+  { 0, 4, 0, 8579 },
+  { 0, 4, 0, 8584 },
+  { 0, 4, 0, 8589 },
+  { 0, 4, 0, 8594 },
+  { 0, 4, 0, 8599 },
+  { 0, 4, 0, 8604 },
+  { 0, 4, 0, 8609 },
+  { 0, 4, 0, 8613 },
+  { 0, 4, 0, 8632 },
+  { 0, 4, 0, 8641 },
+  { 0, 4, 0, 8646 },
+  { 0, 4, 0, 8648 },
+  { 0, 4, 0, 8650 },
+  { 0, 4, 0, 8652 },
+  { 0, 4, 0, 931 },
+  { 0, 4, 0, 8654 },
+  { 0, 4, 0, 8656 },
+  { 0, 4, 0, 8658 },
+  { 0, 4, 0, 8660 },
+  { 0, 4, 0, 8662 },
+  { 0, 4, 0, 8664 },
+  { 0, 4, 0, 8666 },
+  { 0, 4, 0, 8668 },
+  { 0, 4, 0, 8670 },
+  { 0, 4, 0, 8672 },
+  { 0, 4, 0, 8674 },
+  { 0, 4, 0, 8676 },
+  { 0, 4, 0, 8678 },
+  { 0, 4, 0, 8680 },
+  { 0, 4, 0, 8682 },
+  { 0, 4, 0, 3744 },
+  { 0, 4, 0, 3746 },
+  { 0, 4, 0, 8684 },
+  { 0, 4, 0, 8686 },
+  { 0, 4, 0, 8688 },
+  { 0, 4, 0, 8690 },
+  { 0, 4, 0, 8692 },
+  { 0, 4, 0, 8694 },
+  { 0, 4, 0, 8696 },
+  { 0, 4, 0, 8698 },
+  { 0, 4, 0, 8700 },
+  { 0, 4, 0, 8702 },
+  { 0, 4, 0, 8704 },
+  { 0, 4, 0, 8706 },
+  { 0, 4, 0, 8708 },
+  { 0, 4, 0, 8710 },
+  { 0, 4, 0, 8712 },
+  { 0, 4, 0, 8714 },
+  { 0, 4, 0, 8716 },
+  { 0, 4, 0, 8719 },
+  { 0, 4, 0, 8722 },
+  { 0, 4, 0, 8725 },
+  { 0, 4, 0, 8728 },
+  { 0, 4, 0, 8731 },
+  { 0, 4, 0, 8734 },
+  { 0, 4, 0, 8737 },
+  { 0, 4, 0, 8740 },
+  { 0, 4, 0, 8743 },
+  { 0, 4, 0, 8746 },
+  { 0, 4, 0, 8749 },
+  { 0, 4, 0, 8752 },
+  { 0, 4, 0, 8755 },
+  { 0, 4, 0, 8758 },
+  { 0, 4, 0, 1191 },
+  { 0, 4, 0, 1194 },
+  { 0, 4, 0, 1197 },
+  { 0, 4, 0, 1200 },
+  { 0, 4, 0, 1203 },
+  { 0, 4, 0, 8760 },
+  { 0, 4, 0, 8762 },
+  { 0, 4, 0, 8764 },
+  { 0, 4, 0, 8766 },
+  { 0, 4, 0, 8768 },
+  { 0, 4, 0, 8770 },
+  { 0, 4, 0, 8772 },
+  { 0, 4, 0, 8774 },
+  { 0, 4, 0, 8776 },
+  { 0, 4, 0, 8778 },
+  { 0, 4, 0, 8780 },
+  { 0, 4, 0, 8782 },
+  { 0, 4, 0, 8784 },
+  { 0, 4, 0, 8786 },
+  { 0, 4, 0, 8788 },
+  { 0, 4, 0, 8790 },
+  { 0, 4, 0, 8792 },
+  { 0, 4, 0, 8794 },
+  { 0, 4, 0, 8796 },
+  { 0, 4, 0, 8798 },
+  { 0, 4, 0, 8800 },
+  { 0, 4, 0, 8802 },
+  { 0, 4, 0, 8804 },
+  { 0, 4, 0, 8806 },
+  { 0, 4, 0, 8808 },
+  { 0, 4, 0, 8810 },
+  { 0, 4, 0, 8812 },
+  { 0, 4, 0, 8814 },
+  { 0, 4, 0, 8816 },
+  { 0, 4, 0, 8818 },
+  { 0, 4, 0, 8822 },
+  { 0, 4, 0, 8826 },
+  { 0, 4, 0, 8830 },
+  { 0, 4, 0, 8833 },
+  { 0, 4, 0, 8835 },
+  { 0, 4, 0, 8837 },
+  { 0, 4, 0, 8839 },
+  { 0, 4, 0, 3280 },
+  { 0, 4, 0, 8841 },
+  { 0, 4, 0, 8843 },
+  { 0, 4, 0, 8845 },
+  { 0, 4, 0, 8847 },
+  { 0, 4, 0, 8849 },
+  { 0, 4, 0, 8851 },
+  { 0, 4, 0, 8853 },
+  { 0, 4, 0, 8855 },
+  { 0, 4, 0, 8857 },
+  { 0, 4, 0, 8859 },
+  { 0, 4, 0, 8861 },
+  { 0, 4, 0, 8863 },
+  { 0, 4, 0, 8865 },
+  { 0, 4, 0, 8867 },
+  { 0, 4, 0, 8869 },
+  { 0, 4, 0, 8871 },
+  { 0, 4, 0, 8873 },
+  { 0, 4, 0, 8875 },
+  { 0, 4, 0, 8877 },
+  { 0, 4, 0, 8879 },
+  { 0, 4, 0, 8881 },
+  { 0, 4, 0, 8883 },
+  { 0, 4, 0, 8885 },
+  { 0, 4, 0, 8887 },
+  { 0, 4, 0, 8889 },
+  { 0, 4, 0, 8891 },
+  { 0, 4, 0, 8893 },
+  { 0, 4, 0, 8895 },
+  { 0, 4, 0, 8897 },
+  { 0, 4, 0, 8899 },
+  { 0, 4, 0, 8901 },
+  { 0, 4, 0, 8903 },
+  { 0, 4, 0, 8905 },
+  { 0, 4, 0, 8907 },
+  { 0, 4, 0, 8909 },
+  { 0, 4, 0, 8911 },
+  { 0, 4, 0, 8913 },
+  { 0, 4, 0, 8915 },
+  { 0, 4, 0, 8917 },
+  { 0, 4, 0, 8919 },
+  { 0, 4, 0, 8921 },
+  { 0, 4, 0, 8923 },
+  { 0, 4, 0, 8925 },
+  { 0, 4, 0, 8927 },
+  { 0, 4, 0, 8929 },
+  { 0, 4, 0, 8931 },
+  { 0, 4, 0, 8933 },
+  { 0, 4, 0, 8935 },
+  { 0, 4, 0, 8937 },
+  { 0, 4, 0, 8939 },
+  { 0, 4, 0, 8941 },
+  { 0, 4, 0, 8943 },
+  { 0, 4, 0, 8945 },
+  { 0, 4, 0, 8947 },
+  { 0, 4, 0, 8949 },
+  { 0, 4, 0, 8951 },
+  { 0, 4, 0, 8953 },
+  { 0, 4, 0, 8955 },
+  { 0, 4, 0, 8957 },
+  { 0, 4, 0, 8959 },
+  { 0, 4, 0, 8961 },
+  { 0, 4, 0, 8963 },
+  { 0, 4, 0, 8965 },
+  { 0, 4, 0, 8967 },
+  { 0, 4, 0, 8969 },
+  { 0, 4, 0, 8971 },
+  { 0, 4, 0, 8973 },
+  { 0, 4, 0, 8975 },
+  { 0, 4, 0, 8977 },
+  { 0, 4, 0, 8979 },
+  { 0, 4, 0, 8981 },
+  { 0, 4, 0, 8983 },
+  { 0, 4, 0, 8985 },
+  { 0, 4, 0, 8987 },
+  { 0, 4, 0, 8989 },
+  { 0, 4, 0, 8991 },
+  { 0, 4, 0, 8993 },
+  { 0, 4, 0, 8995 },
+  { 0, 4, 0, 8997 },
+  { 0, 4, 0, 8999 },
+  { 0, 4, 0, 9001 },
+  { 0, 4, 0, 9003 },
+  { 0, 4, 0, 9005 },
+  { 0, 4, 0, 9007 },
+  { 0, 4, 0, 9009 },
+  { 0, 0, 9011, 0 },
+  { 0, 0, 9014, 0 },
+  { 0, 0, 9017, 0 },
+  { 0, 0, 9020, 0 },
+  { 0, 0, 9023, 0 },
+  { 0, 0, 9026, 0 },
+  { 0, 0, 9029, 0 },
+  { 0, 0, 9032, 0 },
+  { 0, 0, 9035, 0 },
+  { 0, 0, 9038, 0 },
+  { 0, 0, 9041, 0 },
+  { 0, 0, 9044, 0 },
+  { 0, 0, 9047, 0 },
+  { 6, 0, 0, 0 },
+  { 0, 5, 9050, 0 },
+  { 0, 5, 9053, 0 },
+  { 0, 5, 9056, 0 },
+  { 0, 5, 9060, 0 },
+  { 0, 5, 9064, 0 },
+  { 0, 5, 9068, 0 },
+  { 0, 5, 9072, 0 },
+  { 226, 0, 0, 0 },
+  { 0, 5, 9076, 0 },
+  { 0, 5, 9079, 0 },
+  { 0, 5, 9082, 0 },
+  { 0, 5, 9086, 0 },
+  { 0, 5, 9090, 0 },
+  { 0, 5, 9094, 0 },
+  { 0, 4, 0, 9098 },
+  { 0, 4, 0, 9100 },
+  { 0, 4, 0, 9102 },
+  { 0, 4, 0, 9104 },
+  { 0, 4, 0, 9106 },
+  { 0, 4, 0, 9108 },
+  { 0, 4, 0, 9110 },
+  { 0, 4, 0, 9112 },
+  { 0, 4, 0, 9114 },
+  { 0, 4, 0, 9116 },
+  { 0, 4, 0, 9118 },
+  { 0, 4, 0, 9120 },
+  { 0, 4, 0, 9122 },
+  { 0, 4, 0, 9124 },
+  { 0, 4, 0, 9126 },
+  { 0, 4, 0, 9128 },
+  { 0, 4, 0, 9130 },
+  { 0, 4, 0, 9132 },
+  { 0, 4, 0, 9134 },
+  { 0, 4, 0, 9136 },
+  { 0, 4, 0, 3440 },
+  { 0, 4, 0, 9138 },
+  { 0, 4, 0, 9140 },
+  { 0, 4, 0, 9142 },
+  { 0, 4, 0, 9144 },
+  { 0, 4, 0, 3131 },
+  { 0, 4, 0, 9146 },
+  { 0, 4, 0, 9148 },
+  { 0, 4, 0, 9150 },
+  { 0, 4, 0, 9152 },
+  { 0, 4, 0, 9154 },
+  { 0, 4, 0, 9156 },
+  { 0, 4, 0, 9158 },
+  { 0, 4, 0, 9160 },
+  { 0, 4, 0, 9162 },
+  { 0, 4, 0, 9164 },
+  { 0, 4, 0, 9166 },
+  { 0, 4, 0, 9168 },
+  { 0, 4, 0, 9170 },
+  { 0, 4, 0, 9172 },
+  { 0, 4, 0, 9174 },
+  { 0, 4, 0, 9176 },
+  { 0, 4, 0, 9179 },
+  { 0, 4, 0, 9182 },
+  { 0, 4, 0, 9185 },
+  { 0, 4, 0, 9188 },
+  { 0, 4, 0, 9191 },
+  { 0, 4, 0, 9194 },
+  { 0, 4, 0, 9197 },
+  { 0, 4, 0, 9200 },
+  { 0, 4, 0, 9203 },
+  { 0, 4, 0, 9206 },
+  { 0, 4, 0, 9209 },
+  { 0, 4, 0, 9213 },
+  { 0, 4, 0, 9217 },
+  { 0, 4, 0, 9221 },
+  { 0, 4, 0, 9225 },
+  { 0, 4, 0, 9229 },
+  { 0, 4, 0, 9233 },
+  { 0, 4, 0, 9237 },
+  { 0, 4, 0, 9241 },
+  { 0, 4, 0, 9245 },
+  { 0, 4, 0, 9249 },
+  { 0, 4, 0, 9253 },
+  { 0, 4, 0, 9257 },
+  { 0, 4, 0, 9261 },
+  { 0, 4, 0, 9265 },
+  { 0, 4, 0, 9269 },
+  { 0, 4, 0, 9273 },
+  { 0, 4, 0, 9277 },
+  { 0, 4, 0, 9281 },
+  { 0, 4, 0, 9285 },
+  { 0, 4, 0, 9289 },
+  { 0, 4, 0, 9293 },
+  { 0, 4, 0, 9297 },
+  { 0, 4, 0, 9301 },
+  { 0, 4, 0, 9305 },
+  { 0, 4, 0, 9309 },
+  { 0, 4, 0, 9313 },
+  { 0, 4, 0, 9317 },
+  { 0, 4, 0, 9320 },
+  { 0, 4, 0, 9323 },
+  { 0, 4, 0, 9326 },
+  { 0, 4, 0, 9329 },
+  { 0, 4, 0, 9332 },
+  { 0, 4, 0, 9336 },
+  { 0, 4, 0, 9339 },
+  { 0, 4, 0, 9342 },
+  { 0, 4, 0, 9345 },
+  { 0, 4, 0, 9348 },
+  { 0, 4, 0, 9351 },
+  { 0, 4, 0, 9354 },
+  { 0, 4, 0, 9357 },
+  { 0, 4, 0, 9359 },
+  { 0, 4, 0, 4641 },
+  { 0, 4, 0, 9361 },
+  { 0, 4, 0, 9363 },
+  { 0, 4, 0, 9365 },
+  { 0, 4, 0, 9367 },
+  { 0, 4, 0, 9369 },
+  { 0, 4, 0, 6966 },
+  { 0, 4, 0, 9371 },
+  { 0, 4, 0, 9373 },
+  { 0, 4, 0, 9375 },
+  { 0, 4, 0, 9377 },
+  { 0, 4, 0, 9379 },
+  { 0, 4, 0, 9381 },
+  { 0, 4, 0, 9383 },
+  { 0, 4, 0, 9385 },
+  { 0, 4, 0, 9387 },
+  { 0, 4, 0, 9389 },
+  { 0, 4, 0, 9391 },
+  { 0, 4, 0, 9393 },
+  { 0, 4, 0, 9395 },
+  { 0, 4, 0, 9397 },
+  { 0, 4, 0, 9399 },
+  { 0, 4, 0, 9401 },
+  { 0, 4, 0, 9403 },
+  { 0, 4, 0, 9405 },
+  { 0, 4, 0, 9407 },
+  { 0, 4, 0, 9409 },
+  { 0, 4, 0, 9411 },
+  { 0, 4, 0, 9413 },
+  { 0, 4, 0, 9415 },
+  { 0, 4, 0, 9417 },
+  { 0, 4, 0, 9421 },
+  { 0, 4, 0, 9425 },
+  { 0, 4, 0, 9429 },
+  { 0, 4, 0, 9433 },
+  { 0, 4, 0, 9437 },
+  { 0, 4, 0, 9441 },
+  { 0, 4, 0, 9445 },
+  { 0, 4, 0, 9449 },
+  { 0, 4, 0, 9453 },
+  { 0, 4, 0, 9455 },
+  { 0, 5, 9457, 0 },
+  { 0, 5, 9459, 0 },
+  { 0, 5, 9461, 0 },
+  { 0, 5, 9463, 0 },
+  { 0, 5, 9465, 0 },
+  { 0, 5, 9467, 0 },
+  { 0, 5, 9469, 0 },
+  { 0, 5, 9471, 0 },
+  { 0, 5, 9473, 0 },
+  { 0, 5, 9475, 0 },
+  { 0, 5, 9477, 0 },
+  { 0, 5, 9479, 0 },
+  { 0, 5, 9481, 0 },
+  { 0, 5, 9483, 0 },
+  { 0, 5, 9485, 0 },
+  { 0, 5, 9487, 0 },
+  { 0, 5, 9489, 0 },
+  { 0, 5, 9491, 0 },
+  { 0, 5, 9375, 0 },
+  { 0, 5, 9493, 0 },
+  { 0, 5, 9495, 0 },
+  { 0, 5, 9497, 0 },
+  { 0, 5, 9499, 0 },
+  { 0, 5, 9501, 0 },
+  { 0, 5, 9503, 0 },
+  { 0, 5, 4110, 0 },
+  { 0, 5, 9505, 0 },
+  { 0, 5, 9507, 0 },
+  { 0, 5, 9509, 0 },
+  { 0, 5, 9511, 0 },
+  { 0, 5, 9411, 0 },
+  { 0, 5, 9513, 0 },
+  { 0, 5, 9515, 0 },
+  { 0, 5, 9517, 0 },
+  { 0, 5, 9519, 0 },
+  { 0, 5, 9521, 0 },
+  { 0, 5, 9523, 0 },
+  { 0, 5, 9525, 0 },
+  { 0, 5, 9527, 0 },
+  { 0, 5, 9529, 0 },
+  { 0, 5, 9531, 0 },
+  { 0, 5, 9533, 0 },
+  { 0, 5, 9535, 0 },
+  { 0, 5, 9537, 0 },
+  { 0, 5, 9539, 0 },
+  { 0, 5, 9541, 0 },
+  { 0, 5, 9543, 0 },
+  { 0, 5, 9545, 0 },
+  { 0, 5, 9547, 0 },
+  { 0, 5, 9549, 0 },
+  { 0, 5, 9551, 0 },
+  { 0, 5, 9553, 0 },
+  { 0, 5, 9555, 0 },
+  { 0, 5, 9557, 0 },
+  { 0, 5, 9559, 0 },
+  { 0, 5, 9561, 0 },
+  { 0, 5, 9563, 0 },
+  { 0, 5, 9565, 0 },
+  { 0, 5, 9567, 0 },
+  { 0, 5, 9569, 0 },
+  { 0, 5, 9571, 0 },
+  { 0, 5, 9573, 0 },
+  { 0, 5, 9575, 0 },
+  { 0, 5, 9577, 0 },
+  { 0, 5, 9579, 0 },
+  { 0, 5, 9581, 0 },
+  { 0, 5, 9583, 0 },
+  { 0, 5, 9585, 0 },
+  { 0, 5, 9587, 0 },
+  { 0, 5, 9589, 0 },
+  { 0, 5, 9591, 0 },
+  { 0, 5, 9593, 0 },
+  { 0, 5, 9595, 0 },
+  { 0, 5, 9597, 0 },
+  { 0, 5, 9599, 0 },
+  { 0, 5, 9601, 0 },
+  { 0, 5, 9603, 0 },
+  { 0, 5, 9361, 0 },
+  { 0, 5, 9605, 0 },
+  { 0, 5, 9607, 0 },
+  { 0, 5, 9609, 0 },
+  { 0, 5, 9611, 0 },
+  { 0, 5, 9613, 0 },
+  { 0, 5, 9615, 0 },
+  { 0, 5, 9617, 0 },
+  { 0, 5, 9619, 0 },
+  { 0, 5, 9621, 0 },
+  { 0, 5, 9623, 0 },
+  { 0, 5, 9625, 0 },
+  { 0, 5, 9627, 0 },
+  { 0, 5, 9629, 0 },
+  { 0, 5, 9631, 0 },
+  { 0, 5, 9633, 0 },
+  { 0, 5, 9635, 0 },
+  { 0, 5, 9637, 0 },
+  { 0, 5, 9639, 0 },
+  { 0, 5, 9641, 0 },
+  { 0, 5, 9643, 0 },
+  { 0, 5, 9645, 0 },
+  { 0, 5, 4162, 0 },
+  { 0, 5, 9647, 0 },
+  { 0, 5, 9649, 0 },
+  { 0, 5, 9651, 0 },
+  { 0, 5, 9653, 0 },
+  { 0, 5, 9655, 0 },
+  { 0, 5, 9657, 0 },
+  { 0, 5, 9659, 0 },
+  { 0, 5, 9661, 0 },
+  { 0, 5, 9663, 0 },
+  { 0, 5, 9665, 0 },
+  { 0, 5, 9667, 0 },
+  { 0, 5, 9669, 0 },
+  { 0, 5, 9671, 0 },
+  { 0, 5, 9673, 0 },
+  { 0, 5, 9675, 0 },
+  { 0, 5, 9677, 0 },
+  { 0, 5, 9679, 0 },
+  { 0, 5, 9681, 0 },
+  { 0, 5, 9683, 0 },
+  { 0, 5, 9685, 0 },
+  { 0, 5, 9687, 0 },
+  { 0, 5, 9689, 0 },
+  { 0, 5, 9691, 0 },
+  { 0, 5, 9693, 0 },
+  { 0, 5, 4186, 0 },
+  { 0, 5, 9695, 0 },
+  { 0, 5, 9697, 0 },
+  { 0, 5, 9699, 0 },
+  { 0, 5, 9701, 0 },
+  { 0, 5, 9703, 0 },
+  { 0, 5, 9705, 0 },
+  { 0, 5, 9707, 0 },
+  { 0, 5, 9709, 0 },
+  { 0, 5, 9711, 0 },
+  { 0, 5, 9713, 0 },
+  { 0, 5, 9715, 0 },
+  { 0, 5, 9717, 0 },
+  { 0, 5, 9719, 0 },
+  { 0, 5, 9721, 0 },
+  { 0, 5, 9723, 0 },
+  { 0, 5, 9725, 0 },
+  { 0, 5, 9727, 0 },
+  { 0, 5, 9729, 0 },
+  { 0, 5, 9731, 0 },
+  { 0, 5, 9733, 0 },
+  { 0, 5, 9735, 0 },
+  { 0, 5, 9737, 0 },
+  { 0, 5, 9739, 0 },
+  { 0, 5, 9741, 0 },
+  { 0, 5, 9743, 0 },
+  { 0, 5, 9745, 0 },
+  { 0, 5, 9747, 0 },
+  { 0, 5, 9749, 0 },
+  { 0, 5, 9751, 0 },
+  { 0, 5, 9753, 0 },
+  { 0, 5, 9755, 0 },
+  { 0, 5, 9757, 0 },
+  { 0, 5, 9759, 0 },
+  { 0, 5, 9761, 0 },
+  { 0, 5, 9763, 0 },
+  { 0, 5, 9765, 0 },
+  { 0, 5, 9767, 0 },
+  { 0, 5, 9769, 0 },
+  { 0, 5, 9771, 0 },
+  { 0, 5, 9773, 0 },
+  { 0, 5, 9775, 0 },
+  { 0, 5, 9777, 0 },
+  { 0, 5, 9779, 0 },
+  { 0, 5, 9781, 0 },
+  { 0, 5, 9783, 0 },
+  { 0, 5, 9785, 0 },
+  { 0, 5, 9787, 0 },
+  { 0, 5, 9789, 0 },
+  { 0, 5, 9791, 0 },
+  { 0, 5, 9793, 0 },
+  { 0, 5, 9795, 0 },
+  { 0, 5, 9797, 0 },
+  { 0, 5, 9799, 0 },
+  { 0, 5, 9801, 0 },
+  { 0, 5, 9803, 0 },
+  { 0, 5, 9805, 0 },
+  { 0, 5, 9807, 0 },
+  { 0, 5, 9809, 0 },
+  { 0, 5, 9811, 0 },
+  { 0, 5, 9813, 0 },
+  { 0, 5, 9815, 0 },
+  { 0, 5, 9817, 0 },
+  { 0, 5, 9819, 0 },
+  { 0, 5, 9821, 0 },
+  { 0, 5, 9823, 0 },
+  { 0, 5, 9825, 0 },
+  { 0, 5, 9827, 0 },
+  { 0, 5, 9829, 0 },
+  { 0, 5, 9831, 0 },
+  { 0, 5, 9833, 0 },
+  { 0, 5, 9835, 0 },
+  { 0, 5, 9837, 0 },
+  { 0, 5, 9839, 0 },
+  { 0, 5, 9841, 0 },
+  { 0, 5, 9843, 0 },
+  { 0, 5, 9845, 0 },
+  { 0, 5, 9847, 0 },
+  { 0, 5, 9849, 0 },
+  { 0, 5, 9851, 0 },
+  { 0, 5, 9853, 0 },
+  { 0, 5, 9855, 0 },
+  { 0, 5, 9857, 0 },
+  { 0, 5, 9859, 0 },
+  { 0, 5, 9861, 0 },
+  { 0, 5, 9863, 0 },
+  { 0, 5, 9865, 0 },
+  { 0, 5, 9867, 0 },
+  { 0, 5, 9869, 0 },
+  { 0, 5, 9871, 0 },
+  { 0, 5, 9873, 0 },
+  { 0, 5, 9875, 0 },
+  { 0, 5, 9877, 0 },
+  { 0, 5, 9879, 0 },
+  { 0, 5, 9881, 0 },
+  { 0, 5, 9883, 0 },
+  { 0, 5, 9885, 0 },
+  { 0, 5, 9887, 0 },
+  { 0, 5, 9889, 0 },
+  { 0, 5, 9891, 0 },
+  { 0, 5, 9893, 0 },
+  { 0, 5, 9895, 0 },
+  { 0, 5, 9897, 0 },
+  { 0, 5, 9899, 0 },
+  { 0, 5, 9901, 0 },
+  { 0, 5, 9903, 0 },
+  { 0, 5, 9905, 0 },
+  { 0, 5, 9907, 0 },
+  { 0, 5, 9909, 0 },
+  { 0, 5, 9911, 0 },
+  { 0, 5, 9913, 0 },
+  { 0, 5, 9915, 0 },
+  { 0, 5, 9917, 0 },
+  { 0, 5, 9919, 0 },
+  { 0, 5, 9921, 0 },
+  { 0, 5, 9923, 0 },
+  { 0, 5, 9925, 0 },
+  { 0, 5, 9927, 0 },
+  { 0, 5, 9929, 0 },
+  { 0, 5, 9931, 0 },
+  { 0, 5, 9933, 0 },
+  { 0, 5, 9935, 0 },
+  { 0, 5, 9937, 0 },
+  { 0, 5, 9939, 0 },
+  { 0, 5, 9941, 0 },
+  { 0, 5, 9943, 0 },
+  { 0, 5, 9945, 0 },
+  { 0, 5, 9947, 0 },
+  { 0, 5, 9949, 0 },
+  { 0, 5, 9951, 0 },
+  { 0, 5, 9953, 0 },
+  { 0, 5, 9955, 0 },
+  { 0, 5, 9957, 0 },
+  { 0, 5, 9959, 0 },
+  { 0, 5, 9961, 0 },
+  { 0, 5, 9963, 0 },
+  { 0, 5, 9965, 0 },
+  { 0, 5, 9967, 0 },
+  { 0, 5, 9969, 0 },
+  { 0, 5, 9971, 0 },
+  { 0, 5, 9973, 0 },
+  { 0, 5, 9975, 0 },
+  { 0, 5, 9977, 0 },
+  { 0, 5, 9979, 0 },
+  { 0, 5, 9981, 0 },
+  { 0, 5, 9983, 0 },
+  { 0, 5, 9985, 0 },
+  { 0, 5, 9987, 0 },
+  { 0, 5, 9989, 0 },
+  { 0, 5, 9991, 0 },
+  { 0, 5, 9993, 0 },
+  { 0, 5, 9995, 0 },
+  { 0, 5, 9997, 0 },
+  { 0, 5, 9999, 0 },
+  { 0, 5, 10001, 0 },
+  { 0, 5, 10003, 0 },
+  { 0, 5, 10005, 0 },
+  { 0, 5, 10007, 0 },
+  { 0, 5, 10009, 0 },
+  { 0, 5, 10011, 0 },
+  { 0, 5, 10013, 0 },
+  { 0, 5, 10015, 0 },
+  { 0, 5, 10017, 0 },
+  { 0, 5, 10019, 0 },
+  { 0, 5, 10021, 0 },
+  { 0, 5, 10023, 0 },
+  { 0, 5, 10025, 0 },
+  { 0, 5, 10027, 0 },
+  { 0, 5, 10029, 0 },
+  { 0, 5, 10031, 0 },
+  { 0, 5, 10033, 0 },
+  { 0, 5, 10035, 0 },
+  { 0, 5, 10037, 0 },
+  { 0, 5, 10039, 0 },
+  { 0, 5, 10041, 0 },
+  { 0, 5, 10043, 0 },
+  { 0, 5, 10045, 0 },
+  { 0, 5, 10047, 0 },
+  { 0, 5, 10049, 0 },
+  { 0, 5, 10051, 0 },
+  { 0, 5, 10053, 0 },
+  { 0, 5, 10055, 0 },
+  { 0, 5, 10057, 0 },
+  { 0, 5, 10059, 0 },
+  { 0, 5, 10061, 0 },
+  { 0, 5, 10063, 0 },
+  { 0, 5, 10065, 0 },
+  { 0, 5, 10067, 0 },
+  { 0, 5, 10069, 0 },
+  { 0, 5, 10071, 0 },
+  { 0, 5, 10073, 0 },
+  { 0, 5, 10075, 0 },
+  { 0, 5, 10077, 0 },
+  { 0, 5, 10079, 0 },
+  { 0, 5, 10081, 0 },
+  { 0, 5, 10083, 0 },
+  { 0, 5, 10085, 0 },
+  { 0, 5, 10087, 0 },
+  { 0, 5, 10089, 0 },
+  { 0, 5, 10091, 0 },
+  { 0, 5, 10093, 0 },
+  { 0, 5, 10095, 0 },
+  { 0, 5, 10097, 0 },
+  { 0, 5, 10099, 0 },
+  { 0, 5, 10101, 0 },
+  { 0, 5, 10103, 0 },
+  { 0, 5, 10105, 0 },
+  { 0, 5, 10107, 0 },
+  { 0, 5, 10109, 0 },
+  { 0, 5, 10111, 0 },
+  { 0, 5, 10113, 0 },
+  { 0, 5, 10115, 0 },
+  { 0, 5, 10117, 0 },
+  { 0, 5, 10119, 0 },
+  { 0, 5, 10121, 0 },
+  { 0, 5, 10123, 0 },
+  { 0, 5, 10125, 0 },
+  { 0, 5, 10127, 0 },
+  { 0, 5, 10129, 0 },
+  { 0, 5, 10131, 0 },
+  { 0, 5, 10133, 0 },
+  { 0, 5, 10135, 0 },
+  { 0, 5, 10137, 0 },
+  { 0, 5, 10139, 0 },
+  { 0, 5, 10141, 0 },
+  { 0, 5, 10143, 0 },
+  { 0, 5, 10145, 0 },
+  { 0, 5, 10147, 0 },
+  { 0, 5, 10149, 0 },
+  { 0, 5, 10151, 0 },
+  { 0, 5, 10153, 0 },
+  { 0, 5, 10155, 0 },
+  { 0, 5, 10157, 0 },
+  { 0, 5, 10159, 0 },
+  { 0, 5, 10161, 0 },
+  { 0, 5, 10163, 0 },
+  { 0, 5, 10165, 0 },
+  { 0, 5, 10167, 0 },
+  { 0, 5, 10169, 0 },
+  { 0, 5, 10171, 0 },
+  { 0, 5, 10173, 0 },
+  { 0, 5, 10175, 0 },
+  { 0, 5, 10177, 0 },
+  { 0, 5, 10179, 0 },
+  { 0, 5, 10181, 0 },
+  { 0, 5, 10183, 0 },
+  { 0, 5, 10185, 0 },
+  { 0, 5, 10187, 0 },
+  { 0, 5, 10189, 0 },
+  { 0, 5, 10191, 0 },
+  { 0, 5, 10193, 0 },
+  { 0, 5, 10195, 0 },
+  { 0, 5, 10197, 0 },
+  { 0, 5, 10199, 0 },
+  { 0, 5, 10201, 0 },
+  { 0, 5, 10203, 0 },
+  { 0, 5, 10205, 0 },
+  { 0, 5, 10207, 0 },
+  { 0, 5, 10209, 0 },
+  { 0, 5, 10211, 0 },
+  { 0, 5, 10213, 0 },
+  { 0, 5, 10215, 0 },
+  { 0, 5, 10217, 0 },
+  { 0, 5, 10219, 0 },
+  { 0, 5, 10221, 0 },
+  { 0, 5, 10223, 0 },
+  { 0, 5, 10225, 0 },
+  { 0, 5, 10227, 0 },
+  { 0, 5, 10229, 0 },
+  { 0, 5, 4366, 0 },
+  { 0, 5, 10231, 0 },
+  { 0, 5, 10233, 0 },
+  { 0, 5, 10235, 0 },
+  { 0, 5, 10237, 0 },
+  { 0, 5, 10239, 0 },
+  { 0, 5, 10241, 0 },
+  { 0, 5, 10243, 0 },
+  { 0, 5, 10245, 0 },
+  { 0, 5, 10247, 0 },
+  { 0, 5, 10249, 0 },
+  { 0, 5, 10251, 0 },
+  { 0, 5, 4380, 0 },
+  { 0, 5, 10253, 0 },
+  { 0, 5, 10255, 0 },
+  { 0, 5, 10257, 0 },
+  { 0, 5, 10259, 0 },
+  { 0, 5, 10261, 0 },
+  { 0, 5, 10263, 0 },
+  { 0, 5, 10265, 0 },
+  { 0, 5, 10267, 0 },
+  { 0, 5, 10269, 0 },
+  { 0, 5, 10271, 0 },
+  { 0, 5, 10273, 0 },
+  { 0, 5, 10275, 0 },
+  { 0, 5, 10277, 0 },
+  { 0, 5, 10279, 0 },
+  { 0, 5, 10281, 0 },
+  { 0, 5, 10283, 0 },
+  { 0, 5, 10285, 0 },
+  { 0, 5, 10287, 0 },
+  { 0, 5, 10289, 0 },
+  { 0, 5, 10291, 0 },
+  { 0, 5, 10293, 0 },
+  { 0, 5, 10295, 0 },
+  { 0, 5, 10297, 0 },
+  { 0, 5, 10299, 0 },
+  { 0, 5, 10301, 0 },
+  { 0, 5, 10303, 0 },
+  { 0, 5, 10305, 0 },
+  { 0, 5, 10307, 0 },
+  { 0, 5, 10309, 0 },
+  { 0, 5, 10311, 0 },
+  { 0, 5, 10313, 0 },
+  { 0, 5, 10315, 0 },
+  { 0, 5, 10317, 0 },
+  { 0, 5, 10319, 0 },
+  { 0, 5, 10321, 0 },
+  { 0, 5, 10323, 0 },
+  { 0, 5, 10325, 0 },
+  { 0, 5, 10327, 0 },
+  { 0, 5, 10329, 0 },
+  { 0, 5, 10331, 0 },
+  { 0, 5, 10333, 0 },
+  { 0, 5, 10335, 0 },
+  { 0, 5, 10337, 0 },
+  { 0, 5, 10339, 0 },
+  { 0, 5, 10341, 0 },
+  { 0, 5, 10343, 0 },
+  { 0, 5, 10345, 0 },
+  { 0, 5, 10347, 0 },
+  { 0, 5, 10349, 0 },
+  { 0, 5, 10351, 0 },
+  { 0, 5, 10353, 0 },
+  { 0, 5, 10355, 0 },
+  { 0, 5, 10357, 0 },
+  { 0, 5, 10359, 0 },
+  { 0, 5, 10361, 0 },
+  { 0, 5, 10363, 0 },
+  { 0, 5, 10365, 0 },
+  { 0, 5, 10367, 0 },
+  { 0, 5, 10369, 0 },
+  { 0, 5, 10371, 0 },
+  { 0, 5, 10373, 0 },
+  { 0, 5, 10375, 0 },
+  { 0, 5, 4476, 0 },
+  { 0, 5, 10377, 0 },
+  { 0, 5, 4484, 0 },
+  { 0, 5, 10379, 0 },
+  { 0, 5, 10381, 0 },
+  { 0, 5, 10383, 0 },
+  { 0, 5, 10385, 0 },
+  { 0, 5, 4494, 0 },
+  { 0, 5, 10387, 0 },
+};
+
+const uint32_t normData[10389] = {
+  0x0, 0x1, 0x20, 0x2, 0x20, 0x308, 0x1, 0x61, 0x2, 0x20, 0x304, 0x1,
+  0x32, 0x1, 0x33, 0x2, 0x20, 0x301, 0x1, 0x3BC, 0x2, 0x20, 0x327, 0x1,
+  0x31, 0x1, 0x6F, 0x3, 0x31, 0x2044, 0x34, 0x3, 0x31, 0x2044, 0x32, 0x3,
+  0x33, 0x2044, 0x34, 0x2, 0x41, 0x300, 0x2, 0x41, 0x301, 0x2, 0x41, 0x302,
+  0x2, 0x41, 0x303, 0x2, 0x41, 0x308, 0x2, 0x41, 0x30A, 0x2, 0x43, 0x327,
+  0x2, 0x45, 0x300, 0x2, 0x45, 0x301, 0x2, 0x45, 0x302, 0x2, 0x45, 0x308,
+  0x2, 0x49, 0x300, 0x2, 0x49, 0x301, 0x2, 0x49, 0x302, 0x2, 0x49, 0x308,
+  0x2, 0x4E, 0x303, 0x2, 0x4F, 0x300, 0x2, 0x4F, 0x301, 0x2, 0x4F, 0x302,
+  0x2, 0x4F, 0x303, 0x2, 0x4F, 0x308, 0x2, 0x55, 0x300, 0x2, 0x55, 0x301,
+  0x2, 0x55, 0x302, 0x2, 0x55, 0x308, 0x2, 0x59, 0x301, 0x2, 0x61, 0x300,
+  0x2, 0x61, 0x301, 0x2, 0x61, 0x302, 0x2, 0x61, 0x303, 0x2, 0x61, 0x308,
+  0x2, 0x61, 0x30A, 0x2, 0x63, 0x327, 0x2, 0x65, 0x300, 0x2, 0x65, 0x301,
+  0x2, 0x65, 0x302, 0x2, 0x65, 0x308, 0x2, 0x69, 0x300, 0x2, 0x69, 0x301,
+  0x2, 0x69, 0x302, 0x2, 0x69, 0x308, 0x2, 0x6E, 0x303, 0x2, 0x6F, 0x300,
+  0x2, 0x6F, 0x301, 0x2, 0x6F, 0x302, 0x2, 0x6F, 0x303, 0x2, 0x6F, 0x308,
+  0x2, 0x75, 0x300, 0x2, 0x75, 0x301, 0x2, 0x75, 0x302, 0x2, 0x75, 0x308,
+  0x2, 0x79, 0x301, 0x2, 0x79, 0x308, 0x2, 0x41, 0x304, 0x2, 0x61, 0x304,
+  0x2, 0x41, 0x306, 0x2, 0x61, 0x306, 0x2, 0x41, 0x328, 0x2, 0x61, 0x328,
+  0x2, 0x43, 0x301, 0x2, 0x63, 0x301, 0x2, 0x43, 0x302, 0x2, 0x63, 0x302,
+  0x2, 0x43, 0x307, 0x2, 0x63, 0x307, 0x2, 0x43, 0x30C, 0x2, 0x63, 0x30C,
+  0x2, 0x44, 0x30C, 0x2, 0x64, 0x30C, 0x2, 0x45, 0x304, 0x2, 0x65, 0x304,
+  0x2, 0x45, 0x306, 0x2, 0x65, 0x306, 0x2, 0x45, 0x307, 0x2, 0x65, 0x307,
+  0x2, 0x45, 0x328, 0x2, 0x65, 0x328, 0x2, 0x45, 0x30C, 0x2, 0x65, 0x30C,
+  0x2, 0x47, 0x302, 0x2, 0x67, 0x302, 0x2, 0x47, 0x306, 0x2, 0x67, 0x306,
+  0x2, 0x47, 0x307, 0x2, 0x67, 0x307, 0x2, 0x47, 0x327, 0x2, 0x67, 0x327,
+  0x2, 0x48, 0x302, 0x2, 0x68, 0x302, 0x2, 0x49, 0x303, 0x2, 0x69, 0x303,
+  0x2, 0x49, 0x304, 0x2, 0x69, 0x304, 0x2, 0x49, 0x306, 0x2, 0x69, 0x306,
+  0x2, 0x49, 0x328, 0x2, 0x69, 0x328, 0x2, 0x49, 0x307, 0x2, 0x49, 0x4A,
+  0x2, 0x69, 0x6A, 0x2, 0x4A, 0x302, 0x2, 0x6A, 0x302, 0x2, 0x4B, 0x327,
+  0x2, 0x6B, 0x327, 0x2, 0x4C, 0x301, 0x2, 0x6C, 0x301, 0x2, 0x4C, 0x327,
+  0x2, 0x6C, 0x327, 0x2, 0x4C, 0x30C, 0x2, 0x6C, 0x30C, 0x2, 0x4C, 0xB7,
+  0x2, 0x6C, 0xB7, 0x2, 0x4E, 0x301, 0x2, 0x6E, 0x301, 0x2, 0x4E, 0x327,
+  0x2, 0x6E, 0x327, 0x2, 0x4E, 0x30C, 0x2, 0x6E, 0x30C, 0x2, 0x2BC, 0x6E,
+  0x2, 0x4F, 0x304, 0x2, 0x6F, 0x304, 0x2, 0x4F, 0x306, 0x2, 0x6F, 0x306,
+  0x2, 0x4F, 0x30B, 0x2, 0x6F, 0x30B, 0x2, 0x52, 0x301, 0x2, 0x72, 0x301,
+  0x2, 0x52, 0x327, 0x2, 0x72, 0x327, 0x2, 0x52, 0x30C, 0x2, 0x72, 0x30C,
+  0x2, 0x53, 0x301, 0x2, 0x73, 0x301, 0x2, 0x53, 0x302, 0x2, 0x73, 0x302,
+  0x2, 0x53, 0x327, 0x2, 0x73, 0x327, 0x2, 0x53, 0x30C, 0x2, 0x73, 0x30C,
+  0x2, 0x54, 0x327, 0x2, 0x74, 0x327, 0x2, 0x54, 0x30C, 0x2, 0x74, 0x30C,
+  0x2, 0x55, 0x303, 0x2, 0x75, 0x303, 0x2, 0x55, 0x304, 0x2, 0x75, 0x304,
+  0x2, 0x55, 0x306, 0x2, 0x75, 0x306, 0x2, 0x55, 0x30A, 0x2, 0x75, 0x30A,
+  0x2, 0x55, 0x30B, 0x2, 0x75, 0x30B, 0x2, 0x55, 0x328, 0x2, 0x75, 0x328,
+  0x2, 0x57, 0x302, 0x2, 0x77, 0x302, 0x2, 0x59, 0x302, 0x2, 0x79, 0x302,
+  0x2, 0x59, 0x308, 0x2, 0x5A, 0x301, 0x2, 0x7A, 0x301, 0x2, 0x5A, 0x307,
+  0x2, 0x7A, 0x307, 0x2, 0x5A, 0x30C, 0x2, 0x7A, 0x30C, 0x1, 0x73, 0x2,
+  0x4F, 0x31B, 0x2, 0x6F, 0x31B, 0x2, 0x55, 0x31B, 0x2, 0x75, 0x31B, 0x3,
+  0x44, 0x5A, 0x30C, 0x3, 0x44, 0x7A, 0x30C, 0x3, 0x64, 0x7A, 0x30C, 0x2,
+  0x4C, 0x4A, 0x2, 0x4C, 0x6A, 0x2, 0x6C, 0x6A, 0x2, 0x4E, 0x4A, 0x2,
+  0x4E, 0x6A, 0x2, 0x6E, 0x6A, 0x2, 0x41, 0x30C, 0x2, 0x61, 0x30C, 0x2,
+  0x49, 0x30C, 0x2, 0x69, 0x30C, 0x2, 0x4F, 0x30C, 0x2, 0x6F, 0x30C, 0x2,
+  0x55, 0x30C, 0x2, 0x75, 0x30C, 0x3, 0x55, 0x308, 0x304, 0x3, 0x75, 0x308,
+  0x304, 0x3, 0x55, 0x308, 0x301, 0x3, 0x75, 0x308, 0x301, 0x3, 0x55, 0x308,
+  0x30C, 0x3, 0x75, 0x308, 0x30C, 0x3, 0x55, 0x308, 0x300, 0x3, 0x75, 0x308,
+  0x300, 0x3, 0x41, 0x308, 0x304, 0x3, 0x61, 0x308, 0x304, 0x3, 0x41, 0x307,
+  0x304, 0x3, 0x61, 0x307, 0x304, 0x2, 0xC6, 0x304, 0x2, 0xE6, 0x304, 0x2,
+  0x47, 0x30C, 0x2, 0x67, 0x30C, 0x2, 0x4B, 0x30C, 0x2, 0x6B, 0x30C, 0x2,
+  0x4F, 0x328, 0x2, 0x6F, 0x328, 0x3, 0x4F, 0x328, 0x304, 0x3, 0x6F, 0x328,
+  0x304, 0x2, 0x1B7, 0x30C, 0x2, 0x292, 0x30C, 0x2, 0x6A, 0x30C, 0x2, 0x44,
+  0x5A, 0x2, 0x44, 0x7A, 0x2, 0x64, 0x7A, 0x2, 0x47, 0x301, 0x2, 0x67,
+  0x301, 0x2, 0x4E, 0x300, 0x2, 0x6E, 0x300, 0x3, 0x41, 0x30A, 0x301, 0x3,
+  0x61, 0x30A, 0x301, 0x2, 0xC6, 0x301, 0x2, 0xE6, 0x301, 0x2, 0xD8, 0x301,
+  0x2, 0xF8, 0x301, 0x2, 0x41, 0x30F, 0x2, 0x61, 0x30F, 0x2, 0x41, 0x311,
+  0x2, 0x61, 0x311, 0x2, 0x45, 0x30F, 0x2, 0x65, 0x30F, 0x2, 0x45, 0x311,
+  0x2, 0x65, 0x311, 0x2, 0x49, 0x30F, 0x2, 0x69, 0x30F, 0x2, 0x49, 0x311,
+  0x2, 0x69, 0x311, 0x2, 0x4F, 0x30F, 0x2, 0x6F, 0x30F, 0x2, 0x4F, 0x311,
+  0x2, 0x6F, 0x311, 0x2, 0x52, 0x30F, 0x2, 0x72, 0x30F, 0x2, 0x52, 0x311,
+  0x2, 0x72, 0x311, 0x2, 0x55, 0x30F, 0x2, 0x75, 0x30F, 0x2, 0x55, 0x311,
+  0x2, 0x75, 0x311, 0x2, 0x53, 0x326, 0x2, 0x73, 0x326, 0x2, 0x54, 0x326,
+  0x2, 0x74, 0x326, 0x2, 0x48, 0x30C, 0x2, 0x68, 0x30C, 0x2, 0x41, 0x307,
+  0x2, 0x61, 0x307, 0x2, 0x45, 0x327, 0x2, 0x65, 0x327, 0x3, 0x4F, 0x308,
+  0x304, 0x3, 0x6F, 0x308, 0x304, 0x3, 0x4F, 0x303, 0x304, 0x3, 0x6F, 0x303,
+  0x304, 0x2, 0x4F, 0x307, 0x2, 0x6F, 0x307, 0x3, 0x4F, 0x307, 0x304, 0x3,
+  0x6F, 0x307, 0x304, 0x2, 0x59, 0x304, 0x2, 0x79, 0x304, 0x1, 0x68, 0x1,
+  0x266, 0x1, 0x6A, 0x1, 0x72, 0x1, 0x279, 0x1, 0x27B, 0x1, 0x281, 0x1,
+  0x77, 0x1, 0x79, 0x2, 0x20, 0x306, 0x2, 0x20, 0x307, 0x2, 0x20, 0x30A,
+  0x2, 0x20, 0x328, 0x2, 0x20, 0x303, 0x2, 0x20, 0x30B, 0x1, 0x263, 0x1,
+  0x6C, 0x1, 0x78, 0x1, 0x295, 0x1, 0x300, 0x1, 0x301, 0x1, 0x313, 0x2,
+  0x308, 0x301, 0x1, 0x2B9, 0x2, 0x20, 0x345, 0x1, 0x3B, 0x2, 0xA8, 0x301,
+  0x3, 0x20, 0x308, 0x301, 0x2, 0x391, 0x301, 0x1, 0xB7, 0x2, 0x395, 0x301,
+  0x2, 0x397, 0x301, 0x2, 0x399, 0x301, 0x2, 0x39F, 0x301, 0x2, 0x3A5, 0x301,
+  0x2, 0x3A9, 0x301, 0x3, 0x3B9, 0x308, 0x301, 0x2, 0x399, 0x308, 0x2, 0x3A5,
+  0x308, 0x2, 0x3B1, 0x301, 0x2, 0x3B5, 0x301, 0x2, 0x3B7, 0x301, 0x2, 0x3B9,
+  0x301, 0x3, 0x3C5, 0x308, 0x301, 0x2, 0x3B9, 0x308, 0x2, 0x3C5, 0x308, 0x2,
+  0x3BF, 0x301, 0x2, 0x3C5, 0x301, 0x2, 0x3C9, 0x301, 0x1, 0x3B2, 0x1, 0x3B8,
+  0x1, 0x3A5, 0x2, 0x3D2, 0x301, 0x2, 0x3D2, 0x308, 0x1, 0x3C6, 0x1, 0x3C0,
+  0x1, 0x3BA, 0x1, 0x3C1, 0x1, 0x3C2, 0x1, 0x398, 0x1, 0x3B5, 0x1, 0x3A3,
+  0x2, 0x415, 0x300, 0x2, 0x415, 0x308, 0x2, 0x413, 0x301, 0x2, 0x406, 0x308,
+  0x2, 0x41A, 0x301, 0x2, 0x418, 0x300, 0x2, 0x423, 0x306, 0x2, 0x418, 0x306,
+  0x2, 0x438, 0x306, 0x2, 0x435, 0x300, 0x2, 0x435, 0x308, 0x2, 0x433, 0x301,
+  0x2, 0x456, 0x308, 0x2, 0x43A, 0x301, 0x2, 0x438, 0x300, 0x2, 0x443, 0x306,
+  0x2, 0x474, 0x30F, 0x2, 0x475, 0x30F, 0x2, 0x416, 0x306, 0x2, 0x436, 0x306,
+  0x2, 0x410, 0x306, 0x2, 0x430, 0x306, 0x2, 0x410, 0x308, 0x2, 0x430, 0x308,
+  0x2, 0x415, 0x306, 0x2, 0x435, 0x306, 0x2, 0x4D8, 0x308, 0x2, 0x4D9, 0x308,
+  0x2, 0x416, 0x308, 0x2, 0x436, 0x308, 0x2, 0x417, 0x308, 0x2, 0x437, 0x308,
+  0x2, 0x418, 0x304, 0x2, 0x438, 0x304, 0x2, 0x418, 0x308, 0x2, 0x438, 0x308,
+  0x2, 0x41E, 0x308, 0x2, 0x43E, 0x308, 0x2, 0x4E8, 0x308, 0x2, 0x4E9, 0x308,
+  0x2, 0x42D, 0x308, 0x2, 0x44D, 0x308, 0x2, 0x423, 0x304, 0x2, 0x443, 0x304,
+  0x2, 0x423, 0x308, 0x2, 0x443, 0x308, 0x2, 0x423, 0x30B, 0x2, 0x443, 0x30B,
+  0x2, 0x427, 0x308, 0x2, 0x447, 0x308, 0x2, 0x42B, 0x308, 0x2, 0x44B, 0x308,
+  0x2, 0x565, 0x582, 0x2, 0x627, 0x653, 0x2, 0x627, 0x654, 0x2, 0x648, 0x654,
+  0x2, 0x627, 0x655, 0x2, 0x64A, 0x654, 0x2, 0x627, 0x674, 0x2, 0x648, 0x674,
+  0x2, 0x6C7, 0x674, 0x2, 0x64A, 0x674, 0x2, 0x6D5, 0x654, 0x2, 0x6C1, 0x654,
+  0x2, 0x6D2, 0x654, 0x2, 0x928, 0x93C, 0x2, 0x930, 0x93C, 0x2, 0x933, 0x93C,
+  0x2, 0x915, 0x93C, 0x2, 0x916, 0x93C, 0x2, 0x917, 0x93C, 0x2, 0x91C, 0x93C,
+  0x2, 0x921, 0x93C, 0x2, 0x922, 0x93C, 0x2, 0x92B, 0x93C, 0x2, 0x92F, 0x93C,
+  0x2, 0x9C7, 0x9BE, 0x2, 0x9C7, 0x9D7, 0x2, 0x9A1, 0x9BC, 0x2, 0x9A2, 0x9BC,
+  0x2, 0x9AF, 0x9BC, 0x2, 0xA32, 0xA3C, 0x2, 0xA38, 0xA3C, 0x2, 0xA16, 0xA3C,
+  0x2, 0xA17, 0xA3C, 0x2, 0xA1C, 0xA3C, 0x2, 0xA2B, 0xA3C, 0x2, 0xB47, 0xB56,
+  0x2, 0xB47, 0xB3E, 0x2, 0xB47, 0xB57, 0x2, 0xB21, 0xB3C, 0x2, 0xB22, 0xB3C,
+  0x2, 0xB92, 0xBD7, 0x2, 0xBC6, 0xBBE, 0x2, 0xBC7, 0xBBE, 0x2, 0xBC6, 0xBD7,
+  0x2, 0xC46, 0xC56, 0x2, 0xCBF, 0xCD5, 0x2, 0xCC6, 0xCD5, 0x2, 0xCC6, 0xCD6,
+  0x2, 0xCC6, 0xCC2, 0x3, 0xCC6, 0xCC2, 0xCD5, 0x2, 0xD46, 0xD3E, 0x2, 0xD47,
+  0xD3E, 0x2, 0xD46, 0xD57, 0x2, 0xDD9, 0xDCA, 0x2, 0xDD9, 0xDCF, 0x3, 0xDD9,
+  0xDCF, 0xDCA, 0x2, 0xDD9, 0xDDF, 0x2, 0xE4D, 0xE32, 0x2, 0xECD, 0xEB2, 0x2,
+  0xEAB, 0xE99, 0x2, 0xEAB, 0xEA1, 0x1, 0xF0B, 0x2, 0xF42, 0xFB7, 0x2, 0xF4C,
+  0xFB7, 0x2, 0xF51, 0xFB7, 0x2, 0xF56, 0xFB7, 0x2, 0xF5B, 0xFB7, 0x2, 0xF40,
+  0xFB5, 0x2, 0xF71, 0xF72, 0x2, 0xF71, 0xF74, 0x2, 0xFB2, 0xF80, 0x3, 0xFB2,
+  0xF71, 0xF80, 0x2, 0xFB3, 0xF80, 0x3, 0xFB3, 0xF71, 0xF80, 0x2, 0xF71, 0xF80,
+  0x2, 0xF92, 0xFB7, 0x2, 0xF9C, 0xFB7, 0x2, 0xFA1, 0xFB7, 0x2, 0xFA6, 0xFB7,
+  0x2, 0xFAB, 0xFB7, 0x2, 0xF90, 0xFB5, 0x2, 0x1025, 0x102E, 0x1, 0x10DC, 0x2,
+  0x1B05, 0x1B35, 0x2, 0x1B07, 0x1B35, 0x2, 0x1B09, 0x1B35, 0x2, 0x1B0B, 0x1B35, 0x2,
+  0x1B0D, 0x1B35, 0x2, 0x1B11, 0x1B35, 0x2, 0x1B3A, 0x1B35, 0x2, 0x1B3C, 0x1B35, 0x2,
+  0x1B3E, 0x1B35, 0x2, 0x1B3F, 0x1B35, 0x2, 0x1B42, 0x1B35, 0x1, 0x41, 0x1, 0xC6,
+  0x1, 0x42, 0x1, 0x44, 0x1, 0x45, 0x1, 0x18E, 0x1, 0x47, 0x1, 0x48,
+  0x1, 0x49, 0x1, 0x4A, 0x1, 0x4B, 0x1, 0x4C, 0x1, 0x4D, 0x1, 0x4E,
+  0x1, 0x4F, 0x1, 0x222, 0x1, 0x50, 0x1, 0x52, 0x1, 0x54, 0x1, 0x55,
+  0x1, 0x57, 0x1, 0x250, 0x1, 0x251, 0x1, 0x1D02, 0x1, 0x62, 0x1, 0x64,
+  0x1, 0x65, 0x1, 0x259, 0x1, 0x25B, 0x1, 0x25C, 0x1, 0x67, 0x1, 0x6B,
+  0x1, 0x6D, 0x1, 0x14B, 0x1, 0x254, 0x1, 0x1D16, 0x1, 0x1D17, 0x1, 0x70,
+  0x1, 0x74, 0x1, 0x75, 0x1, 0x1D1D, 0x1, 0x26F, 0x1, 0x76, 0x1, 0x1D25,
+  0x1, 0x3B3, 0x1, 0x3B4, 0x1, 0x3C7, 0x1, 0x69, 0x1, 0x43D, 0x1, 0x252,
+  0x1, 0x63, 0x1, 0x255, 0x1, 0xF0, 0x1, 0x66, 0x1, 0x25F, 0x1, 0x261,
+  0x1, 0x265, 0x1, 0x268, 0x1, 0x269, 0x1, 0x26A, 0x1, 0x1D7B, 0x1, 0x29D,
+  0x1, 0x26D, 0x1, 0x1D85, 0x1, 0x29F, 0x1, 0x271, 0x1, 0x270, 0x1, 0x272,
+  0x1, 0x273, 0x1, 0x274, 0x1, 0x275, 0x1, 0x278, 0x1, 0x282, 0x1, 0x283,
+  0x1, 0x1AB, 0x1, 0x289, 0x1, 0x28A, 0x1, 0x1D1C, 0x1, 0x28B, 0x1, 0x28C,
+  0x1, 0x7A, 0x1, 0x290, 0x1, 0x291, 0x1, 0x292, 0x2, 0x41, 0x325, 0x2,
+  0x61, 0x325, 0x2, 0x42, 0x307, 0x2, 0x62, 0x307, 0x2, 0x42, 0x323, 0x2,
+  0x62, 0x323, 0x2, 0x42, 0x331, 0x2, 0x62, 0x331, 0x3, 0x43, 0x327, 0x301,
+  0x3, 0x63, 0x327, 0x301, 0x2, 0x44, 0x307, 0x2, 0x64, 0x307, 0x2, 0x44,
+  0x323, 0x2, 0x64, 0x323, 0x2, 0x44, 0x331, 0x2, 0x64, 0x331, 0x2, 0x44,
+  0x327, 0x2, 0x64, 0x327, 0x2, 0x44, 0x32D, 0x2, 0x64, 0x32D, 0x3, 0x45,
+  0x304, 0x300, 0x3, 0x65, 0x304, 0x300, 0x3, 0x45, 0x304, 0x301, 0x3, 0x65,
+  0x304, 0x301, 0x2, 0x45, 0x32D, 0x2, 0x65, 0x32D, 0x2, 0x45, 0x330, 0x2,
+  0x65, 0x330, 0x3, 0x45, 0x327, 0x306, 0x3, 0x65, 0x327, 0x306, 0x2, 0x46,
+  0x307, 0x2, 0x66, 0x307, 0x2, 0x47, 0x304, 0x2, 0x67, 0x304, 0x2, 0x48,
+  0x307, 0x2, 0x68, 0x307, 0x2, 0x48, 0x323, 0x2, 0x68, 0x323, 0x2, 0x48,
+  0x308, 0x2, 0x68, 0x308, 0x2, 0x48, 0x327, 0x2, 0x68, 0x327, 0x2, 0x48,
+  0x32E, 0x2, 0x68, 0x32E, 0x2, 0x49, 0x330, 0x2, 0x69, 0x330, 0x3, 0x49,
+  0x308, 0x301, 0x3, 0x69, 0x308, 0x301, 0x2, 0x4B, 0x301, 0x2, 0x6B, 0x301,
+  0x2, 0x4B, 0x323, 0x2, 0x6B, 0x323, 0x2, 0x4B, 0x331, 0x2, 0x6B, 0x331,
+  0x2, 0x4C, 0x323, 0x2, 0x6C, 0x323, 0x3, 0x4C, 0x323, 0x304, 0x3, 0x6C,
+  0x323, 0x304, 0x2, 0x4C, 0x331, 0x2, 0x6C, 0x331, 0x2, 0x4C, 0x32D, 0x2,
+  0x6C, 0x32D, 0x2, 0x4D, 0x301, 0x2, 0x6D, 0x301, 0x2, 0x4D, 0x307, 0x2,
+  0x6D, 0x307, 0x2, 0x4D, 0x323, 0x2, 0x6D, 0x323, 0x2, 0x4E, 0x307, 0x2,
+  0x6E, 0x307, 0x2, 0x4E, 0x323, 0x2, 0x6E, 0x323, 0x2, 0x4E, 0x331, 0x2,
+  0x6E, 0x331, 0x2, 0x4E, 0x32D, 0x2, 0x6E, 0x32D, 0x3, 0x4F, 0x303, 0x301,
+  0x3, 0x6F, 0x303, 0x301, 0x3, 0x4F, 0x303, 0x308, 0x3, 0x6F, 0x303, 0x308,
+  0x3, 0x4F, 0x304, 0x300, 0x3, 0x6F, 0x304, 0x300, 0x3, 0x4F, 0x304, 0x301,
+  0x3, 0x6F, 0x304, 0x301, 0x2, 0x50, 0x301, 0x2, 0x70, 0x301, 0x2, 0x50,
+  0x307, 0x2, 0x70, 0x307, 0x2, 0x52, 0x307, 0x2, 0x72, 0x307, 0x2, 0x52,
+  0x323, 0x2, 0x72, 0x323, 0x3, 0x52, 0x323, 0x304, 0x3, 0x72, 0x323, 0x304,
+  0x2, 0x52, 0x331, 0x2, 0x72, 0x331, 0x2, 0x53, 0x307, 0x2, 0x73, 0x307,
+  0x2, 0x53, 0x323, 0x2, 0x73, 0x323, 0x3, 0x53, 0x301, 0x307, 0x3, 0x73,
+  0x301, 0x307, 0x3, 0x53, 0x30C, 0x307, 0x3, 0x73, 0x30C, 0x307, 0x3, 0x53,
+  0x323, 0x307, 0x3, 0x73, 0x323, 0x307, 0x2, 0x54, 0x307, 0x2, 0x74, 0x307,
+  0x2, 0x54, 0x323, 0x2, 0x74, 0x323, 0x2, 0x54, 0x331, 0x2, 0x74, 0x331,
+  0x2, 0x54, 0x32D, 0x2, 0x74, 0x32D, 0x2, 0x55, 0x324, 0x2, 0x75, 0x324,
+  0x2, 0x55, 0x330, 0x2, 0x75, 0x330, 0x2, 0x55, 0x32D, 0x2, 0x75, 0x32D,
+  0x3, 0x55, 0x303, 0x301, 0x3, 0x75, 0x303, 0x301, 0x3, 0x55, 0x304, 0x308,
+  0x3, 0x75, 0x304, 0x308, 0x2, 0x56, 0x303, 0x2, 0x76, 0x303, 0x2, 0x56,
+  0x323, 0x2, 0x76, 0x323, 0x2, 0x57, 0x300, 0x2, 0x77, 0x300, 0x2, 0x57,
+  0x301, 0x2, 0x77, 0x301, 0x2, 0x57, 0x308, 0x2, 0x77, 0x308, 0x2, 0x57,
+  0x307, 0x2, 0x77, 0x307, 0x2, 0x57, 0x323, 0x2, 0x77, 0x323, 0x2, 0x58,
+  0x307, 0x2, 0x78, 0x307, 0x2, 0x58, 0x308, 0x2, 0x78, 0x308, 0x2, 0x59,
+  0x307, 0x2, 0x79, 0x307, 0x2, 0x5A, 0x302, 0x2, 0x7A, 0x302, 0x2, 0x5A,
+  0x323, 0x2, 0x7A, 0x323, 0x2, 0x5A, 0x331, 0x2, 0x7A, 0x331, 0x2, 0x68,
+  0x331, 0x2, 0x74, 0x308, 0x2, 0x77, 0x30A, 0x2, 0x79, 0x30A, 0x2, 0x61,
+  0x2BE, 0x2, 0x17F, 0x307, 0x2, 0x41, 0x323, 0x2, 0x61, 0x323, 0x2, 0x41,
+  0x309, 0x2, 0x61, 0x309, 0x3, 0x41, 0x302, 0x301, 0x3, 0x61, 0x302, 0x301,
+  0x3, 0x41, 0x302, 0x300, 0x3, 0x61, 0x302, 0x300, 0x3, 0x41, 0x302, 0x309,
+  0x3, 0x61, 0x302, 0x309, 0x3, 0x41, 0x302, 0x303, 0x3, 0x61, 0x302, 0x303,
+  0x3, 0x41, 0x323, 0x302, 0x3, 0x61, 0x323, 0x302, 0x3, 0x41, 0x306, 0x301,
+  0x3, 0x61, 0x306, 0x301, 0x3, 0x41, 0x306, 0x300, 0x3, 0x61, 0x306, 0x300,
+  0x3, 0x41, 0x306, 0x309, 0x3, 0x61, 0x306, 0x309, 0x3, 0x41, 0x306, 0x303,
+  0x3, 0x61, 0x306, 0x303, 0x3, 0x41, 0x323, 0x306, 0x3, 0x61, 0x323, 0x306,
+  0x2, 0x45, 0x323, 0x2, 0x65, 0x323, 0x2, 0x45, 0x309, 0x2, 0x65, 0x309,
+  0x2, 0x45, 0x303, 0x2, 0x65, 0x303, 0x3, 0x45, 0x302, 0x301, 0x3, 0x65,
+  0x302, 0x301, 0x3, 0x45, 0x302, 0x300, 0x3, 0x65, 0x302, 0x300, 0x3, 0x45,
+  0x302, 0x309, 0x3, 0x65, 0x302, 0x309, 0x3, 0x45, 0x302, 0x303, 0x3, 0x65,
+  0x302, 0x303, 0x3, 0x45, 0x323, 0x302, 0x3, 0x65, 0x323, 0x302, 0x2, 0x49,
+  0x309, 0x2, 0x69, 0x309, 0x2, 0x49, 0x323, 0x2, 0x69, 0x323, 0x2, 0x4F,
+  0x323, 0x2, 0x6F, 0x323, 0x2, 0x4F, 0x309, 0x2, 0x6F, 0x309, 0x3, 0x4F,
+  0x302, 0x301, 0x3, 0x6F, 0x302, 0x301, 0x3, 0x4F, 0x302, 0x300, 0x3, 0x6F,
+  0x302, 0x300, 0x3, 0x4F, 0x302, 0x309, 0x3, 0x6F, 0x302, 0x309, 0x3, 0x4F,
+  0x302, 0x303, 0x3, 0x6F, 0x302, 0x303, 0x3, 0x4F, 0x323, 0x302, 0x3, 0x6F,
+  0x323, 0x302, 0x3, 0x4F, 0x31B, 0x301, 0x3, 0x6F, 0x31B, 0x301, 0x3, 0x4F,
+  0x31B, 0x300, 0x3, 0x6F, 0x31B, 0x300, 0x3, 0x4F, 0x31B, 0x309, 0x3, 0x6F,
+  0x31B, 0x309, 0x3, 0x4F, 0x31B, 0x303, 0x3, 0x6F, 0x31B, 0x303, 0x3, 0x4F,
+  0x31B, 0x323, 0x3, 0x6F, 0x31B, 0x323, 0x2, 0x55, 0x323, 0x2, 0x75, 0x323,
+  0x2, 0x55, 0x309, 0x2, 0x75, 0x309, 0x3, 0x55, 0x31B, 0x301, 0x3, 0x75,
+  0x31B, 0x301, 0x3, 0x55, 0x31B, 0x300, 0x3, 0x75, 0x31B, 0x300, 0x3, 0x55,
+  0x31B, 0x309, 0x3, 0x75, 0x31B, 0x309, 0x3, 0x55, 0x31B, 0x303, 0x3, 0x75,
+  0x31B, 0x303, 0x3, 0x55, 0x31B, 0x323, 0x3, 0x75, 0x31B, 0x323, 0x2, 0x59,
+  0x300, 0x2, 0x79, 0x300, 0x2, 0x59, 0x323, 0x2, 0x79, 0x323, 0x2, 0x59,
+  0x309, 0x2, 0x79, 0x309, 0x2, 0x59, 0x303, 0x2, 0x79, 0x303, 0x2, 0x3B1,
+  0x313, 0x2, 0x3B1, 0x314, 0x3, 0x3B1, 0x313, 0x300, 0x3, 0x3B1, 0x314, 0x300,
+  0x3, 0x3B1, 0x313, 0x301, 0x3, 0x3B1, 0x314, 0x301, 0x3, 0x3B1, 0x313, 0x342,
+  0x3, 0x3B1, 0x314, 0x342, 0x2, 0x391, 0x313, 0x2, 0x391, 0x314, 0x3, 0x391,
+  0x313, 0x300, 0x3, 0x391, 0x314, 0x300, 0x3, 0x391, 0x313, 0x301, 0x3, 0x391,
+  0x314, 0x301, 0x3, 0x391, 0x313, 0x342, 0x3, 0x391, 0x314, 0x342, 0x2, 0x3B5,
+  0x313, 0x2, 0x3B5, 0x314, 0x3, 0x3B5, 0x313, 0x300, 0x3, 0x3B5, 0x314, 0x300,
+  0x3, 0x3B5, 0x313, 0x301, 0x3, 0x3B5, 0x314, 0x301, 0x2, 0x395, 0x313, 0x2,
+  0x395, 0x314, 0x3, 0x395, 0x313, 0x300, 0x3, 0x395, 0x314, 0x300, 0x3, 0x395,
+  0x313, 0x301, 0x3, 0x395, 0x314, 0x301, 0x2, 0x3B7, 0x313, 0x2, 0x3B7, 0x314,
+  0x3, 0x3B7, 0x313, 0x300, 0x3, 0x3B7, 0x314, 0x300, 0x3, 0x3B7, 0x313, 0x301,
+  0x3, 0x3B7, 0x314, 0x301, 0x3, 0x3B7, 0x313, 0x342, 0x3, 0x3B7, 0x314, 0x342,
+  0x2, 0x397, 0x313, 0x2, 0x397, 0x314, 0x3, 0x397, 0x313, 0x300, 0x3, 0x397,
+  0x314, 0x300, 0x3, 0x397, 0x313, 0x301, 0x3, 0x397, 0x314, 0x301, 0x3, 0x397,
+  0x313, 0x342, 0x3, 0x397, 0x314, 0x342, 0x2, 0x3B9, 0x313, 0x2, 0x3B9, 0x314,
+  0x3, 0x3B9, 0x313, 0x300, 0x3, 0x3B9, 0x314, 0x300, 0x3, 0x3B9, 0x313, 0x301,
+  0x3, 0x3B9, 0x314, 0x301, 0x3, 0x3B9, 0x313, 0x342, 0x3, 0x3B9, 0x314, 0x342,
+  0x2, 0x399, 0x313, 0x2, 0x399, 0x314, 0x3, 0x399, 0x313, 0x300, 0x3, 0x399,
+  0x314, 0x300, 0x3, 0x399, 0x313, 0x301, 0x3, 0x399, 0x314, 0x301, 0x3, 0x399,
+  0x313, 0x342, 0x3, 0x399, 0x314, 0x342, 0x2, 0x3BF, 0x313, 0x2, 0x3BF, 0x314,
+  0x3, 0x3BF, 0x313, 0x300, 0x3, 0x3BF, 0x314, 0x300, 0x3, 0x3BF, 0x313, 0x301,
+  0x3, 0x3BF, 0x314, 0x301, 0x2, 0x39F, 0x313, 0x2, 0x39F, 0x314, 0x3, 0x39F,
+  0x313, 0x300, 0x3, 0x39F, 0x314, 0x300, 0x3, 0x39F, 0x313, 0x301, 0x3, 0x39F,
+  0x314, 0x301, 0x2, 0x3C5, 0x313, 0x2, 0x3C5, 0x314, 0x3, 0x3C5, 0x313, 0x300,
+  0x3, 0x3C5, 0x314, 0x300, 0x3, 0x3C5, 0x313, 0x301, 0x3, 0x3C5, 0x314, 0x301,
+  0x3, 0x3C5, 0x313, 0x342, 0x3, 0x3C5, 0x314, 0x342, 0x2, 0x3A5, 0x314, 0x3,
+  0x3A5, 0x314, 0x300, 0x3, 0x3A5, 0x314, 0x301, 0x3, 0x3A5, 0x314, 0x342, 0x2,
+  0x3C9, 0x313, 0x2, 0x3C9, 0x314, 0x3, 0x3C9, 0x313, 0x300, 0x3, 0x3C9, 0x314,
+  0x300, 0x3, 0x3C9, 0x313, 0x301, 0x3, 0x3C9, 0x314, 0x301, 0x3, 0x3C9, 0x313,
+  0x342, 0x3, 0x3C9, 0x314, 0x342, 0x2, 0x3A9, 0x313, 0x2, 0x3A9, 0x314, 0x3,
+  0x3A9, 0x313, 0x300, 0x3, 0x3A9, 0x314, 0x300, 0x3, 0x3A9, 0x313, 0x301, 0x3,
+  0x3A9, 0x314, 0x301, 0x3, 0x3A9, 0x313, 0x342, 0x3, 0x3A9, 0x314, 0x342, 0x2,
+  0x3B1, 0x300, 0x2, 0x3B5, 0x300, 0x2, 0x3B7, 0x300, 0x2, 0x3B9, 0x300, 0x2,
+  0x3BF, 0x300, 0x2, 0x3C5, 0x300, 0x2, 0x3C9, 0x300, 0x3, 0x3B1, 0x313, 0x345,
+  0x3, 0x3B1, 0x314, 0x345, 0x4, 0x3B1, 0x313, 0x300, 0x345, 0x4, 0x3B1, 0x314,
+  0x300, 0x345, 0x4, 0x3B1, 0x313, 0x301, 0x345, 0x4, 0x3B1, 0x314, 0x301, 0x345,
+  0x4, 0x3B1, 0x313, 0x342, 0x345, 0x4, 0x3B1, 0x314, 0x342, 0x345, 0x3, 0x391,
+  0x313, 0x345, 0x3, 0x391, 0x314, 0x345, 0x4, 0x391, 0x313, 0x300, 0x345, 0x4,
+  0x391, 0x314, 0x300, 0x345, 0x4, 0x391, 0x313, 0x301, 0x345, 0x4, 0x391, 0x314,
+  0x301, 0x345, 0x4, 0x391, 0x313, 0x342, 0x345, 0x4, 0x391, 0x314, 0x342, 0x345,
+  0x3, 0x3B7, 0x313, 0x345, 0x3, 0x3B7, 0x314, 0x345, 0x4, 0x3B7, 0x313, 0x300,
+  0x345, 0x4, 0x3B7, 0x314, 0x300, 0x345, 0x4, 0x3B7, 0x313, 0x301, 0x345, 0x4,
+  0x3B7, 0x314, 0x301, 0x345, 0x4, 0x3B7, 0x313, 0x342, 0x345, 0x4, 0x3B7, 0x314,
+  0x342, 0x345, 0x3, 0x397, 0x313, 0x345, 0x3, 0x397, 0x314, 0x345, 0x4, 0x397,
+  0x313, 0x300, 0x345, 0x4, 0x397, 0x314, 0x300, 0x345, 0x4, 0x397, 0x313, 0x301,
+  0x345, 0x4, 0x397, 0x314, 0x301, 0x345, 0x4, 0x397, 0x313, 0x342, 0x345, 0x4,
+  0x397, 0x314, 0x342, 0x345, 0x3, 0x3C9, 0x313, 0x345, 0x3, 0x3C9, 0x314, 0x345,
+  0x4, 0x3C9, 0x313, 0x300, 0x345, 0x4, 0x3C9, 0x314, 0x300, 0x345, 0x4, 0x3C9,
+  0x313, 0x301, 0x345, 0x4, 0x3C9, 0x314, 0x301, 0x345, 0x4, 0x3C9, 0x313, 0x342,
+  0x345, 0x4, 0x3C9, 0x314, 0x342, 0x345, 0x3, 0x3A9, 0x313, 0x345, 0x3, 0x3A9,
+  0x314, 0x345, 0x4, 0x3A9, 0x313, 0x300, 0x345, 0x4, 0x3A9, 0x314, 0x300, 0x345,
+  0x4, 0x3A9, 0x313, 0x301, 0x345, 0x4, 0x3A9, 0x314, 0x301, 0x345, 0x4, 0x3A9,
+  0x313, 0x342, 0x345, 0x4, 0x3A9, 0x314, 0x342, 0x345, 0x2, 0x3B1, 0x306, 0x2,
+  0x3B1, 0x304, 0x3, 0x3B1, 0x300, 0x345, 0x2, 0x3B1, 0x345, 0x3, 0x3B1, 0x301,
+  0x345, 0x2, 0x3B1, 0x342, 0x3, 0x3B1, 0x342, 0x345, 0x2, 0x391, 0x306, 0x2,
+  0x391, 0x304, 0x2, 0x391, 0x300, 0x2, 0x391, 0x345, 0x2, 0x20, 0x313, 0x1,
+  0x3B9, 0x2, 0x20, 0x342, 0x2, 0xA8, 0x342, 0x3, 0x20, 0x308, 0x342, 0x3,
+  0x3B7, 0x300, 0x345, 0x2, 0x3B7, 0x345, 0x3, 0x3B7, 0x301, 0x345, 0x2, 0x3B7,
+  0x342, 0x3, 0x3B7, 0x342, 0x345, 0x2, 0x395, 0x300, 0x2, 0x397, 0x300, 0x2,
+  0x397, 0x345, 0x2, 0x1FBF, 0x300, 0x3, 0x20, 0x313, 0x300, 0x2, 0x1FBF, 0x301,
+  0x3, 0x20, 0x313, 0x301, 0x2, 0x1FBF, 0x342, 0x3, 0x20, 0x313, 0x342, 0x2,
+  0x3B9, 0x306, 0x2, 0x3B9, 0x304, 0x3, 0x3B9, 0x308, 0x300, 0x2, 0x3B9, 0x342,
+  0x3, 0x3B9, 0x308, 0x342, 0x2, 0x399, 0x306, 0x2, 0x399, 0x304, 0x2, 0x399,
+  0x300, 0x2, 0x1FFE, 0x300, 0x3, 0x20, 0x314, 0x300, 0x2, 0x1FFE, 0x301, 0x3,
+  0x20, 0x314, 0x301, 0x2, 0x1FFE, 0x342, 0x3, 0x20, 0x314, 0x342, 0x2, 0x3C5,
+  0x306, 0x2, 0x3C5, 0x304, 0x3, 0x3C5, 0x308, 0x300, 0x2, 0x3C1, 0x313, 0x2,
+  0x3C1, 0x314, 0x2, 0x3C5, 0x342, 0x3, 0x3C5, 0x308, 0x342, 0x2, 0x3A5, 0x306,
+  0x2, 0x3A5, 0x304, 0x2, 0x3A5, 0x300, 0x2, 0x3A1, 0x314, 0x2, 0xA8, 0x300,
+  0x3, 0x20, 0x308, 0x300, 0x1, 0x60, 0x3, 0x3C9, 0x300, 0x345, 0x2, 0x3C9,
+  0x345, 0x3, 0x3C9, 0x301, 0x345, 0x2, 0x3C9, 0x342, 0x3, 0x3C9, 0x342, 0x345,
+  0x2, 0x39F, 0x300, 0x2, 0x3A9, 0x300, 0x2, 0x3A9, 0x345, 0x1, 0xB4, 0x2,
+  0x20, 0x314, 0x1, 0x2002, 0x1, 0x2003, 0x1, 0x2010, 0x2, 0x20, 0x333, 0x1,
+  0x2E, 0x2, 0x2E, 0x2E, 0x3, 0x2E, 0x2E, 0x2E, 0x2, 0x2032, 0x2032, 0x3,
+  0x2032, 0x2032, 0x2032, 0x2, 0x2035, 0x2035, 0x3, 0x2035, 0x2035, 0x2035, 0x2, 0x21,
+  0x21, 0x2, 0x20, 0x305, 0x2, 0x3F, 0x3F, 0x2, 0x3F, 0x21, 0x2, 0x21,
+  0x3F, 0x4, 0x2032, 0x2032, 0x2032, 0x2032, 0x1, 0x30, 0x1, 0x34, 0x1, 0x35,
+  0x1, 0x36, 0x1, 0x37, 0x1, 0x38, 0x1, 0x39, 0x1, 0x2B, 0x1, 0x2212,
+  0x1, 0x3D, 0x1, 0x28, 0x1, 0x29, 0x1, 0x6E, 0x2, 0x52, 0x73, 0x3,
+  0x61, 0x2F, 0x63, 0x3, 0x61, 0x2F, 0x73, 0x1, 0x43, 0x2, 0xB0, 0x43,
+  0x3, 0x63, 0x2F, 0x6F, 0x3, 0x63, 0x2F, 0x75, 0x1, 0x190, 0x2, 0xB0,
+  0x46, 0x1, 0x127, 0x2, 0x4E, 0x6F, 0x1, 0x51, 0x2, 0x53, 0x4D, 0x3,
+  0x54, 0x45, 0x4C, 0x2, 0x54, 0x4D, 0x1, 0x5A, 0x1, 0x3A9, 0x1, 0x46,
+  0x1, 0x5D0, 0x1, 0x5D1, 0x1, 0x5D2, 0x1, 0x5D3, 0x3, 0x46, 0x41, 0x58,
+  0x1, 0x393, 0x1, 0x3A0, 0x1, 0x2211, 0x3, 0x31, 0x2044, 0x37, 0x3, 0x31,
+  0x2044, 0x39, 0x4, 0x31, 0x2044, 0x31, 0x30, 0x3, 0x31, 0x2044, 0x33, 0x3,
+  0x32, 0x2044, 0x33, 0x3, 0x31, 0x2044, 0x35, 0x3, 0x32, 0x2044, 0x35, 0x3,
+  0x33, 0x2044, 0x35, 0x3, 0x34, 0x2044, 0x35, 0x3, 0x31, 0x2044, 0x36, 0x3,
+  0x35, 0x2044, 0x36, 0x3, 0x31, 0x2044, 0x38, 0x3, 0x33, 0x2044, 0x38, 0x3,
+  0x35, 0x2044, 0x38, 0x3, 0x37, 0x2044, 0x38, 0x2, 0x31, 0x2044, 0x2, 0x49,
+  0x49, 0x3, 0x49, 0x49, 0x49, 0x2, 0x49, 0x56, 0x1, 0x56, 0x2, 0x56,
+  0x49, 0x3, 0x56, 0x49, 0x49, 0x4, 0x56, 0x49, 0x49, 0x49, 0x2, 0x49,
+  0x58, 0x1, 0x58, 0x2, 0x58, 0x49, 0x3, 0x58, 0x49, 0x49, 0x2, 0x69,
+  0x69, 0x3, 0x69, 0x69, 0x69, 0x2, 0x69, 0x76, 0x2, 0x76, 0x69, 0x3,
+  0x76, 0x69, 0x69, 0x4, 0x76, 0x69, 0x69, 0x69, 0x2, 0x69, 0x78, 0x2,
+  0x78, 0x69, 0x3, 0x78, 0x69, 0x69, 0x3, 0x30, 0x2044, 0x33, 0x2, 0x2190,
+  0x338, 0x2, 0x2192, 0x338, 0x2, 0x2194, 0x338, 0x2, 0x21D0, 0x338, 0x2, 0x21D4,
+  0x338, 0x2, 0x21D2, 0x338, 0x2, 0x2203, 0x338, 0x2, 0x2208, 0x338, 0x2, 0x220B,
+  0x338, 0x2, 0x2223, 0x338, 0x2, 0x2225, 0x338, 0x2, 0x222B, 0x222B, 0x3, 0x222B,
+  0x222B, 0x222B, 0x2, 0x222E, 0x222E, 0x3, 0x222E, 0x222E, 0x222E, 0x2, 0x223C, 0x338,
+  0x2, 0x2243, 0x338, 0x2, 0x2245, 0x338, 0x2, 0x2248, 0x338, 0x2, 0x3D, 0x338,
+  0x2, 0x2261, 0x338, 0x2, 0x224D, 0x338, 0x2, 0x3C, 0x338, 0x2, 0x3E, 0x338,
+  0x2, 0x2264, 0x338, 0x2, 0x2265, 0x338, 0x2, 0x2272, 0x338, 0x2, 0x2273, 0x338,
+  0x2, 0x2276, 0x338, 0x2, 0x2277, 0x338, 0x2, 0x227A, 0x338, 0x2, 0x227B, 0x338,
+  0x2, 0x2282, 0x338, 0x2, 0x2283, 0x338, 0x2, 0x2286, 0x338, 0x2, 0x2287, 0x338,
+  0x2, 0x22A2, 0x338, 0x2, 0x22A8, 0x338, 0x2, 0x22A9, 0x338, 0x2, 0x22AB, 0x338,
+  0x2, 0x227C, 0x338, 0x2, 0x227D, 0x338, 0x2, 0x2291, 0x338, 0x2, 0x2292, 0x338,
+  0x2, 0x22B2, 0x338, 0x2, 0x22B3, 0x338, 0x2, 0x22B4, 0x338, 0x2, 0x22B5, 0x338,
+  0x1, 0x3008, 0x1, 0x3009, 0x2, 0x31, 0x30, 0x2, 0x31, 0x31, 0x2, 0x31,
+  0x32, 0x2, 0x31, 0x33, 0x2, 0x31, 0x34, 0x2, 0x31, 0x35, 0x2, 0x31,
+  0x36, 0x2, 0x31, 0x37, 0x2, 0x31, 0x38, 0x2, 0x31, 0x39, 0x2, 0x32,
+  0x30, 0x3, 0x28, 0x31, 0x29, 0x3, 0x28, 0x32, 0x29, 0x3, 0x28, 0x33,
+  0x29, 0x3, 0x28, 0x34, 0x29, 0x3, 0x28, 0x35, 0x29, 0x3, 0x28, 0x36,
+  0x29, 0x3, 0x28, 0x37, 0x29, 0x3, 0x28, 0x38, 0x29, 0x3, 0x28, 0x39,
+  0x29, 0x4, 0x28, 0x31, 0x30, 0x29, 0x4, 0x28, 0x31, 0x31, 0x29, 0x4,
+  0x28, 0x31, 0x32, 0x29, 0x4, 0x28, 0x31, 0x33, 0x29, 0x4, 0x28, 0x31,
+  0x34, 0x29, 0x4, 0x28, 0x31, 0x35, 0x29, 0x4, 0x28, 0x31, 0x36, 0x29,
+  0x4, 0x28, 0x31, 0x37, 0x29, 0x4, 0x28, 0x31, 0x38, 0x29, 0x4, 0x28,
+  0x31, 0x39, 0x29, 0x4, 0x28, 0x32, 0x30, 0x29, 0x2, 0x31, 0x2E, 0x2,
+  0x32, 0x2E, 0x2, 0x33, 0x2E, 0x2, 0x34, 0x2E, 0x2, 0x35, 0x2E, 0x2,
+  0x36, 0x2E, 0x2, 0x37, 0x2E, 0x2, 0x38, 0x2E, 0x2, 0x39, 0x2E, 0x3,
+  0x31, 0x30, 0x2E, 0x3, 0x31, 0x31, 0x2E, 0x3, 0x31, 0x32, 0x2E, 0x3,
+  0x31, 0x33, 0x2E, 0x3, 0x31, 0x34, 0x2E, 0x3, 0x31, 0x35, 0x2E, 0x3,
+  0x31, 0x36, 0x2E, 0x3, 0x31, 0x37, 0x2E, 0x3, 0x31, 0x38, 0x2E, 0x3,
+  0x31, 0x39, 0x2E, 0x3, 0x32, 0x30, 0x2E, 0x3, 0x28, 0x61, 0x29, 0x3,
+  0x28, 0x62, 0x29, 0x3, 0x28, 0x63, 0x29, 0x3, 0x28, 0x64, 0x29, 0x3,
+  0x28, 0x65, 0x29, 0x3, 0x28, 0x66, 0x29, 0x3, 0x28, 0x67, 0x29, 0x3,
+  0x28, 0x68, 0x29, 0x3, 0x28, 0x69, 0x29, 0x3, 0x28, 0x6A, 0x29, 0x3,
+  0x28, 0x6B, 0x29, 0x3, 0x28, 0x6C, 0x29, 0x3, 0x28, 0x6D, 0x29, 0x3,
+  0x28, 0x6E, 0x29, 0x3, 0x28, 0x6F, 0x29, 0x3, 0x28, 0x70, 0x29, 0x3,
+  0x28, 0x71, 0x29, 0x3, 0x28, 0x72, 0x29, 0x3, 0x28, 0x73, 0x29, 0x3,
+  0x28, 0x74, 0x29, 0x3, 0x28, 0x75, 0x29, 0x3, 0x28, 0x76, 0x29, 0x3,
+  0x28, 0x77, 0x29, 0x3, 0x28, 0x78, 0x29, 0x3, 0x28, 0x79, 0x29, 0x3,
+  0x28, 0x7A, 0x29, 0x1, 0x53, 0x1, 0x59, 0x1, 0x71, 0x4, 0x222B, 0x222B,
+  0x222B, 0x222B, 0x3, 0x3A, 0x3A, 0x3D, 0x2, 0x3D, 0x3D, 0x3, 0x3D, 0x3D,
+  0x3D, 0x2, 0x2ADD, 0x338, 0x1, 0x2D61, 0x1, 0x6BCD, 0x1, 0x9F9F, 0x1, 0x4E00,
+  0x1, 0x4E28, 0x1, 0x4E36, 0x1, 0x4E3F, 0x1, 0x4E59, 0x1, 0x4E85, 0x1, 0x4E8C,
+  0x1, 0x4EA0, 0x1, 0x4EBA, 0x1, 0x513F, 0x1, 0x5165, 0x1, 0x516B, 0x1, 0x5182,
+  0x1, 0x5196, 0x1, 0x51AB, 0x1, 0x51E0, 0x1, 0x51F5, 0x1, 0x5200, 0x1, 0x529B,
+  0x1, 0x52F9, 0x1, 0x5315, 0x1, 0x531A, 0x1, 0x5338, 0x1, 0x5341, 0x1, 0x535C,
+  0x1, 0x5369, 0x1, 0x5382, 0x1, 0x53B6, 0x1, 0x53C8, 0x1, 0x53E3, 0x1, 0x56D7,
+  0x1, 0x571F, 0x1, 0x58EB, 0x1, 0x5902, 0x1, 0x590A, 0x1, 0x5915, 0x1, 0x5927,
+  0x1, 0x5973, 0x1, 0x5B50, 0x1, 0x5B80, 0x1, 0x5BF8, 0x1, 0x5C0F, 0x1, 0x5C22,
+  0x1, 0x5C38, 0x1, 0x5C6E, 0x1, 0x5C71, 0x1, 0x5DDB, 0x1, 0x5DE5, 0x1, 0x5DF1,
+  0x1, 0x5DFE, 0x1, 0x5E72, 0x1, 0x5E7A, 0x1, 0x5E7F, 0x1, 0x5EF4, 0x1, 0x5EFE,
+  0x1, 0x5F0B, 0x1, 0x5F13, 0x1, 0x5F50, 0x1, 0x5F61, 0x1, 0x5F73, 0x1, 0x5FC3,
+  0x1, 0x6208, 0x1, 0x6236, 0x1, 0x624B, 0x1, 0x652F, 0x1, 0x6534, 0x1, 0x6587,
+  0x1, 0x6597, 0x1, 0x65A4, 0x1, 0x65B9, 0x1, 0x65E0, 0x1, 0x65E5, 0x1, 0x66F0,
+  0x1, 0x6708, 0x1, 0x6728, 0x1, 0x6B20, 0x1, 0x6B62, 0x1, 0x6B79, 0x1, 0x6BB3,
+  0x1, 0x6BCB, 0x1, 0x6BD4, 0x1, 0x6BDB, 0x1, 0x6C0F, 0x1, 0x6C14, 0x1, 0x6C34,
+  0x1, 0x706B, 0x1, 0x722A, 0x1, 0x7236, 0x1, 0x723B, 0x1, 0x723F, 0x1, 0x7247,
+  0x1, 0x7259, 0x1, 0x725B, 0x1, 0x72AC, 0x1, 0x7384, 0x1, 0x7389, 0x1, 0x74DC,
+  0x1, 0x74E6, 0x1, 0x7518, 0x1, 0x751F, 0x1, 0x7528, 0x1, 0x7530, 0x1, 0x758B,
+  0x1, 0x7592, 0x1, 0x7676, 0x1, 0x767D, 0x1, 0x76AE, 0x1, 0x76BF, 0x1, 0x76EE,
+  0x1, 0x77DB, 0x1, 0x77E2, 0x1, 0x77F3, 0x1, 0x793A, 0x1, 0x79B8, 0x1, 0x79BE,
+  0x1, 0x7A74, 0x1, 0x7ACB, 0x1, 0x7AF9, 0x1, 0x7C73, 0x1, 0x7CF8, 0x1, 0x7F36,
+  0x1, 0x7F51, 0x1, 0x7F8A, 0x1, 0x7FBD, 0x1, 0x8001, 0x1, 0x800C, 0x1, 0x8012,
+  0x1, 0x8033, 0x1, 0x807F, 0x1, 0x8089, 0x1, 0x81E3, 0x1, 0x81EA, 0x1, 0x81F3,
+  0x1, 0x81FC, 0x1, 0x820C, 0x1, 0x821B, 0x1, 0x821F, 0x1, 0x826E, 0x1, 0x8272,
+  0x1, 0x8278, 0x1, 0x864D, 0x1, 0x866B, 0x1, 0x8840, 0x1, 0x884C, 0x1, 0x8863,
+  0x1, 0x897E, 0x1, 0x898B, 0x1, 0x89D2, 0x1, 0x8A00, 0x1, 0x8C37, 0x1, 0x8C46,
+  0x1, 0x8C55, 0x1, 0x8C78, 0x1, 0x8C9D, 0x1, 0x8D64, 0x1, 0x8D70, 0x1, 0x8DB3,
+  0x1, 0x8EAB, 0x1, 0x8ECA, 0x1, 0x8F9B, 0x1, 0x8FB0, 0x1, 0x8FB5, 0x1, 0x9091,
+  0x1, 0x9149, 0x1, 0x91C6, 0x1, 0x91CC, 0x1, 0x91D1, 0x1, 0x9577, 0x1, 0x9580,
+  0x1, 0x961C, 0x1, 0x96B6, 0x1, 0x96B9, 0x1, 0x96E8, 0x1, 0x9751, 0x1, 0x975E,
+  0x1, 0x9762, 0x1, 0x9769, 0x1, 0x97CB, 0x1, 0x97ED, 0x1, 0x97F3, 0x1, 0x9801,
+  0x1, 0x98A8, 0x1, 0x98DB, 0x1, 0x98DF, 0x1, 0x9996, 0x1, 0x9999, 0x1, 0x99AC,
+  0x1, 0x9AA8, 0x1, 0x9AD8, 0x1, 0x9ADF, 0x1, 0x9B25, 0x1, 0x9B2F, 0x1, 0x9B32,
+  0x1, 0x9B3C, 0x1, 0x9B5A, 0x1, 0x9CE5, 0x1, 0x9E75, 0x1, 0x9E7F, 0x1, 0x9EA5,
+  0x1, 0x9EBB, 0x1, 0x9EC3, 0x1, 0x9ECD, 0x1, 0x9ED1, 0x1, 0x9EF9, 0x1, 0x9EFD,
+  0x1, 0x9F0E, 0x1, 0x9F13, 0x1, 0x9F20, 0x1, 0x9F3B, 0x1, 0x9F4A, 0x1, 0x9F52,
+  0x1, 0x9F8D, 0x1, 0x9F9C, 0x1, 0x9FA0, 0x1, 0x3012, 0x1, 0x5344, 0x1, 0x5345,
+  0x2, 0x304B, 0x3099, 0x2, 0x304D, 0x3099, 0x2, 0x304F, 0x3099, 0x2, 0x3051, 0x3099,
+  0x2, 0x3053, 0x3099, 0x2, 0x3055, 0x3099, 0x2, 0x3057, 0x3099, 0x2, 0x3059, 0x3099,
+  0x2, 0x305B, 0x3099, 0x2, 0x305D, 0x3099, 0x2, 0x305F, 0x3099, 0x2, 0x3061, 0x3099,
+  0x2, 0x3064, 0x3099, 0x2, 0x3066, 0x3099, 0x2, 0x3068, 0x3099, 0x2, 0x306F, 0x3099,
+  0x2, 0x306F, 0x309A, 0x2, 0x3072, 0x3099, 0x2, 0x3072, 0x309A, 0x2, 0x3075, 0x3099,
+  0x2, 0x3075, 0x309A, 0x2, 0x3078, 0x3099, 0x2, 0x3078, 0x309A, 0x2, 0x307B, 0x3099,
+  0x2, 0x307B, 0x309A, 0x2, 0x3046, 0x3099, 0x2, 0x20, 0x3099, 0x2, 0x20, 0x309A,
+  0x2, 0x309D, 0x3099, 0x2, 0x3088, 0x308A, 0x2, 0x30AB, 0x3099, 0x2, 0x30AD, 0x3099,
+  0x2, 0x30AF, 0x3099, 0x2, 0x30B1, 0x3099, 0x2, 0x30B3, 0x3099, 0x2, 0x30B5, 0x3099,
+  0x2, 0x30B7, 0x3099, 0x2, 0x30B9, 0x3099, 0x2, 0x30BB, 0x3099, 0x2, 0x30BD, 0x3099,
+  0x2, 0x30BF, 0x3099, 0x2, 0x30C1, 0x3099, 0x2, 0x30C4, 0x3099, 0x2, 0x30C6, 0x3099,
+  0x2, 0x30C8, 0x3099, 0x2, 0x30CF, 0x3099, 0x2, 0x30CF, 0x309A, 0x2, 0x30D2, 0x3099,
+  0x2, 0x30D2, 0x309A, 0x2, 0x30D5, 0x3099, 0x2, 0x30D5, 0x309A, 0x2, 0x30D8, 0x3099,
+  0x2, 0x30D8, 0x309A, 0x2, 0x30DB, 0x3099, 0x2, 0x30DB, 0x309A, 0x2, 0x30A6, 0x3099,
+  0x2, 0x30EF, 0x3099, 0x2, 0x30F0, 0x3099, 0x2, 0x30F1, 0x3099, 0x2, 0x30F2, 0x3099,
+  0x2, 0x30FD, 0x3099, 0x2, 0x30B3, 0x30C8, 0x1, 0x1100, 0x1, 0x1101, 0x1, 0x11AA,
+  0x1, 0x1102, 0x1, 0x11AC, 0x1, 0x11AD, 0x1, 0x1103, 0x1, 0x1104, 0x1, 0x1105,
+  0x1, 0x11B0, 0x1, 0x11B1, 0x1, 0x11B2, 0x1, 0x11B3, 0x1, 0x11B4, 0x1, 0x11B5,
+  0x1, 0x111A, 0x1, 0x1106, 0x1, 0x1107, 0x1, 0x1108, 0x1, 0x1121, 0x1, 0x1109,
+  0x1, 0x110A, 0x1, 0x110B, 0x1, 0x110C, 0x1, 0x110D, 0x1, 0x110E, 0x1, 0x110F,
+  0x1, 0x1110, 0x1, 0x1111, 0x1, 0x1112, 0x1, 0x1161, 0x1, 0x1162, 0x1, 0x1163,
+  0x1, 0x1164, 0x1, 0x1165, 0x1, 0x1166, 0x1, 0x1167, 0x1, 0x1168, 0x1, 0x1169,
+  0x1, 0x116A, 0x1, 0x116B, 0x1, 0x116C, 0x1, 0x116D, 0x1, 0x116E, 0x1, 0x116F,
+  0x1, 0x1170, 0x1, 0x1171, 0x1, 0x1172, 0x1, 0x1173, 0x1, 0x1174, 0x1, 0x1175,
+  0x1, 0x1160, 0x1, 0x1114, 0x1, 0x1115, 0x1, 0x11C7, 0x1, 0x11C8, 0x1, 0x11CC,
+  0x1, 0x11CE, 0x1, 0x11D3, 0x1, 0x11D7, 0x1, 0x11D9, 0x1, 0x111C, 0x1, 0x11DD,
+  0x1, 0x11DF, 0x1, 0x111D, 0x1, 0x111E, 0x1, 0x1120, 0x1, 0x1122, 0x1, 0x1123,
+  0x1, 0x1127, 0x1, 0x1129, 0x1, 0x112B, 0x1, 0x112C, 0x1, 0x112D, 0x1, 0x112E,
+  0x1, 0x112F, 0x1, 0x1132, 0x1, 0x1136, 0x1, 0x1140, 0x1, 0x1147, 0x1, 0x114C,
+  0x1, 0x11F1, 0x1, 0x11F2, 0x1, 0x1157, 0x1, 0x1158, 0x1, 0x1159, 0x1, 0x1184,
+  0x1, 0x1185, 0x1, 0x1188, 0x1, 0x1191, 0x1, 0x1192, 0x1, 0x1194, 0x1, 0x119E,
+  0x1, 0x11A1, 0x1, 0x4E09, 0x1, 0x56DB, 0x1, 0x4E0A, 0x1, 0x4E2D, 0x1, 0x4E0B,
+  0x1, 0x7532, 0x1, 0x4E19, 0x1, 0x4E01, 0x1, 0x5929, 0x1, 0x5730, 0x3, 0x28,
+  0x1100, 0x29, 0x3, 0x28, 0x1102, 0x29, 0x3, 0x28, 0x1103, 0x29, 0x3, 0x28,
+  0x1105, 0x29, 0x3, 0x28, 0x1106, 0x29, 0x3, 0x28, 0x1107, 0x29, 0x3, 0x28,
+  0x1109, 0x29, 0x3, 0x28, 0x110B, 0x29, 0x3, 0x28, 0x110C, 0x29, 0x3, 0x28,
+  0x110E, 0x29, 0x3, 0x28, 0x110F, 0x29, 0x3, 0x28, 0x1110, 0x29, 0x3, 0x28,
+  0x1111, 0x29, 0x3, 0x28, 0x1112, 0x29, 0x4, 0x28, 0x1100, 0x1161, 0x29, 0x4,
+  0x28, 0x1102, 0x1161, 0x29, 0x4, 0x28, 0x1103, 0x1161, 0x29, 0x4, 0x28, 0x1105,
+  0x1161, 0x29, 0x4, 0x28, 0x1106, 0x1161, 0x29, 0x4, 0x28, 0x1107, 0x1161, 0x29,
+  0x4, 0x28, 0x1109, 0x1161, 0x29, 0x4, 0x28, 0x110B, 0x1161, 0x29, 0x4, 0x28,
+  0x110C, 0x1161, 0x29, 0x4, 0x28, 0x110E, 0x1161, 0x29, 0x4, 0x28, 0x110F, 0x1161,
+  0x29, 0x4, 0x28, 0x1110, 0x1161, 0x29, 0x4, 0x28, 0x1111, 0x1161, 0x29, 0x4,
+  0x28, 0x1112, 0x1161, 0x29, 0x4, 0x28, 0x110C, 0x116E, 0x29, 0x7, 0x28, 0x110B,
+  0x1169, 0x110C, 0x1165, 0x11AB, 0x29, 0x6, 0x28, 0x110B, 0x1169, 0x1112, 0x116E, 0x29,
+  0x3, 0x28, 0x4E00, 0x29, 0x3, 0x28, 0x4E8C, 0x29, 0x3, 0x28, 0x4E09, 0x29,
+  0x3, 0x28, 0x56DB, 0x29, 0x3, 0x28, 0x4E94, 0x29, 0x3, 0x28, 0x516D, 0x29,
+  0x3, 0x28, 0x4E03, 0x29, 0x3, 0x28, 0x516B, 0x29, 0x3, 0x28, 0x4E5D, 0x29,
+  0x3, 0x28, 0x5341, 0x29, 0x3, 0x28, 0x6708, 0x29, 0x3, 0x28, 0x706B, 0x29,
+  0x3, 0x28, 0x6C34, 0x29, 0x3, 0x28, 0x6728, 0x29, 0x3, 0x28, 0x91D1, 0x29,
+  0x3, 0x28, 0x571F, 0x29, 0x3, 0x28, 0x65E5, 0x29, 0x3, 0x28, 0x682A, 0x29,
+  0x3, 0x28, 0x6709, 0x29, 0x3, 0x28, 0x793E, 0x29, 0x3, 0x28, 0x540D, 0x29,
+  0x3, 0x28, 0x7279, 0x29, 0x3, 0x28, 0x8CA1, 0x29, 0x3, 0x28, 0x795D, 0x29,
+  0x3, 0x28, 0x52B4, 0x29, 0x3, 0x28, 0x4EE3, 0x29, 0x3, 0x28, 0x547C, 0x29,
+  0x3, 0x28, 0x5B66, 0x29, 0x3, 0x28, 0x76E3, 0x29, 0x3, 0x28, 0x4F01, 0x29,
+  0x3, 0x28, 0x8CC7, 0x29, 0x3, 0x28, 0x5354, 0x29, 0x3, 0x28, 0x796D, 0x29,
+  0x3, 0x28, 0x4F11, 0x29, 0x3, 0x28, 0x81EA, 0x29, 0x3, 0x28, 0x81F3, 0x29,
+  0x1, 0x554F, 0x1, 0x5E7C, 0x1, 0x7B8F, 0x3, 0x50, 0x54, 0x45, 0x2, 0x32,
+  0x31, 0x2, 0x32, 0x32, 0x2, 0x32, 0x33, 0x2, 0x32, 0x34, 0x2, 0x32,
+  0x35, 0x2, 0x32, 0x36, 0x2, 0x32, 0x37, 0x2, 0x32, 0x38, 0x2, 0x32,
+  0x39, 0x2, 0x33, 0x30, 0x2, 0x33, 0x31, 0x2, 0x33, 0x32, 0x2, 0x33,
+  0x33, 0x2, 0x33, 0x34, 0x2, 0x33, 0x35, 0x2, 0x1100, 0x1161, 0x2, 0x1102,
+  0x1161, 0x2, 0x1103, 0x1161, 0x2, 0x1105, 0x1161, 0x2, 0x1106, 0x1161, 0x2, 0x1107,
+  0x1161, 0x2, 0x1109, 0x1161, 0x2, 0x110B, 0x1161, 0x2, 0x110C, 0x1161, 0x2, 0x110E,
+  0x1161, 0x2, 0x110F, 0x1161, 0x2, 0x1110, 0x1161, 0x2, 0x1111, 0x1161, 0x2, 0x1112,
+  0x1161, 0x5, 0x110E, 0x1161, 0x11B7, 0x1100, 0x1169, 0x4, 0x110C, 0x116E, 0x110B, 0x1174,
+  0x2, 0x110B, 0x116E, 0x1, 0x4E94, 0x1, 0x516D, 0x1, 0x4E03, 0x1, 0x4E5D, 0x1,
+  0x682A, 0x1, 0x6709, 0x1, 0x793E, 0x1, 0x540D, 0x1, 0x7279, 0x1, 0x8CA1, 0x1,
+  0x795D, 0x1, 0x52B4, 0x1, 0x79D8, 0x1, 0x7537, 0x1, 0x9069, 0x1, 0x512A, 0x1,
+  0x5370, 0x1, 0x6CE8, 0x1, 0x9805, 0x1, 0x4F11, 0x1, 0x5199, 0x1, 0x6B63, 0x1,
+  0x5DE6, 0x1, 0x53F3, 0x1, 0x533B, 0x1, 0x5B97, 0x1, 0x5B66, 0x1, 0x76E3, 0x1,
+  0x4F01, 0x1, 0x8CC7, 0x1, 0x5354, 0x1, 0x591C, 0x2, 0x33, 0x36, 0x2, 0x33,
+  0x37, 0x2, 0x33, 0x38, 0x2, 0x33, 0x39, 0x2, 0x34, 0x30, 0x2, 0x34,
+  0x31, 0x2, 0x34, 0x32, 0x2, 0x34, 0x33, 0x2, 0x34, 0x34, 0x2, 0x34,
+  0x35, 0x2, 0x34, 0x36, 0x2, 0x34, 0x37, 0x2, 0x34, 0x38, 0x2, 0x34,
+  0x39, 0x2, 0x35, 0x30, 0x2, 0x31, 0x6708, 0x2, 0x32, 0x6708, 0x2, 0x33,
+  0x6708, 0x2, 0x34, 0x6708, 0x2, 0x35, 0x6708, 0x2, 0x36, 0x6708, 0x2, 0x37,
+  0x6708, 0x2, 0x38, 0x6708, 0x2, 0x39, 0x6708, 0x3, 0x31, 0x30, 0x6708, 0x3,
+  0x31, 0x31, 0x6708, 0x3, 0x31, 0x32, 0x6708, 0x2, 0x48, 0x67, 0x3, 0x65,
+  0x72, 0x67, 0x2, 0x65, 0x56, 0x3, 0x4C, 0x54, 0x44, 0x1, 0x30A2, 0x1,
+  0x30A4, 0x1, 0x30A6, 0x1, 0x30A8, 0x1, 0x30AA, 0x1, 0x30AB, 0x1, 0x30AD, 0x1,
+  0x30AF, 0x1, 0x30B1, 0x1, 0x30B3, 0x1, 0x30B5, 0x1, 0x30B7, 0x1, 0x30B9, 0x1,
+  0x30BB, 0x1, 0x30BD, 0x1, 0x30BF, 0x1, 0x30C1, 0x1, 0x30C4, 0x1, 0x30C6, 0x1,
+  0x30C8, 0x1, 0x30CA, 0x1, 0x30CB, 0x1, 0x30CC, 0x1, 0x30CD, 0x1, 0x30CE, 0x1,
+  0x30CF, 0x1, 0x30D2, 0x1, 0x30D5, 0x1, 0x30D8, 0x1, 0x30DB, 0x1, 0x30DE, 0x1,
+  0x30DF, 0x1, 0x30E0, 0x1, 0x30E1, 0x1, 0x30E2, 0x1, 0x30E4, 0x1, 0x30E6, 0x1,
+  0x30E8, 0x1, 0x30E9, 0x1, 0x30EA, 0x1, 0x30EB, 0x1, 0x30EC, 0x1, 0x30ED, 0x1,
+  0x30EF, 0x1, 0x30F0, 0x1, 0x30F1, 0x1, 0x30F2, 0x2, 0x4EE4, 0x548C, 0x5, 0x30A2,
+  0x30CF, 0x309A, 0x30FC, 0x30C8, 0x4, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x5, 0x30A2, 0x30F3,
+  0x30D8, 0x309A, 0x30A2, 0x3, 0x30A2, 0x30FC, 0x30EB, 0x5, 0x30A4, 0x30CB, 0x30F3, 0x30AF,
+  0x3099, 0x3, 0x30A4, 0x30F3, 0x30C1, 0x3, 0x30A6, 0x30A9, 0x30F3, 0x6, 0x30A8, 0x30B9,
+  0x30AF, 0x30FC, 0x30C8, 0x3099, 0x4, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x3, 0x30AA, 0x30F3,
+  0x30B9, 0x3, 0x30AA, 0x30FC, 0x30E0, 0x3, 0x30AB, 0x30A4, 0x30EA, 0x4, 0x30AB, 0x30E9,
+  0x30C3, 0x30C8, 0x4, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x4, 0x30AB, 0x3099, 0x30ED, 0x30F3,
+  0x4, 0x30AB, 0x3099, 0x30F3, 0x30DE, 0x4, 0x30AD, 0x3099, 0x30AB, 0x3099, 0x4, 0x30AD,
+  0x3099, 0x30CB, 0x30FC, 0x4, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x6, 0x30AD, 0x3099, 0x30EB,
+  0x30BF, 0x3099, 0x30FC, 0x2, 0x30AD, 0x30ED, 0x6, 0x30AD, 0x30ED, 0x30AF, 0x3099, 0x30E9,
+  0x30E0, 0x6, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x5, 0x30AD, 0x30ED, 0x30EF,
+  0x30C3, 0x30C8, 0x4, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x6, 0x30AF, 0x3099, 0x30E9, 0x30E0,
+  0x30C8, 0x30F3, 0x6, 0x30AF, 0x30EB, 0x30BB, 0x3099, 0x30A4, 0x30ED, 0x4, 0x30AF, 0x30ED,
+  0x30FC, 0x30CD, 0x3, 0x30B1, 0x30FC, 0x30B9, 0x3, 0x30B3, 0x30EB, 0x30CA, 0x4, 0x30B3,
+  0x30FC, 0x30DB, 0x309A, 0x4, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x5, 0x30B5, 0x30F3, 0x30C1,
+  0x30FC, 0x30E0, 0x5, 0x30B7, 0x30EA, 0x30F3, 0x30AF, 0x3099, 0x3, 0x30BB, 0x30F3, 0x30C1,
+  0x3, 0x30BB, 0x30F3, 0x30C8, 0x4, 0x30BF, 0x3099, 0x30FC, 0x30B9, 0x3, 0x30C6, 0x3099,
+  0x30B7, 0x3, 0x30C8, 0x3099, 0x30EB, 0x2, 0x30C8, 0x30F3, 0x2, 0x30CA, 0x30CE, 0x3,
+  0x30CE, 0x30C3, 0x30C8, 0x3, 0x30CF, 0x30A4, 0x30C4, 0x6, 0x30CF, 0x309A, 0x30FC, 0x30BB,
+  0x30F3, 0x30C8, 0x4, 0x30CF, 0x309A, 0x30FC, 0x30C4, 0x5, 0x30CF, 0x3099, 0x30FC, 0x30EC,
+  0x30EB, 0x6, 0x30D2, 0x309A, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x4, 0x30D2, 0x309A, 0x30AF,
+  0x30EB, 0x3, 0x30D2, 0x309A, 0x30B3, 0x3, 0x30D2, 0x3099, 0x30EB, 0x6, 0x30D5, 0x30A1,
+  0x30E9, 0x30C3, 0x30C8, 0x3099, 0x4, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x6, 0x30D5, 0x3099,
+  0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x3, 0x30D5, 0x30E9, 0x30F3, 0x5, 0x30D8, 0x30AF, 0x30BF,
+  0x30FC, 0x30EB, 0x3, 0x30D8, 0x309A, 0x30BD, 0x4, 0x30D8, 0x309A, 0x30CB, 0x30D2, 0x3,
+  0x30D8, 0x30EB, 0x30C4, 0x4, 0x30D8, 0x309A, 0x30F3, 0x30B9, 0x5, 0x30D8, 0x309A, 0x30FC,
+  0x30B7, 0x3099, 0x4, 0x30D8, 0x3099, 0x30FC, 0x30BF, 0x5, 0x30DB, 0x309A, 0x30A4, 0x30F3,
+  0x30C8, 0x4, 0x30DB, 0x3099, 0x30EB, 0x30C8, 0x2, 0x30DB, 0x30F3, 0x5, 0x30DB, 0x309A,
+  0x30F3, 0x30C8, 0x3099, 0x3, 0x30DB, 0x30FC, 0x30EB, 0x3, 0x30DB, 0x30FC, 0x30F3, 0x4,
+  0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x3, 0x30DE, 0x30A4, 0x30EB, 0x3, 0x30DE, 0x30C3, 0x30CF,
+  0x3, 0x30DE, 0x30EB, 0x30AF, 0x5, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x4, 0x30DF,
+  0x30AF, 0x30ED, 0x30F3, 0x2, 0x30DF, 0x30EA, 0x6, 0x30DF, 0x30EA, 0x30CF, 0x3099, 0x30FC,
+  0x30EB, 0x3, 0x30E1, 0x30AB, 0x3099, 0x5, 0x30E1, 0x30AB, 0x3099, 0x30C8, 0x30F3, 0x4,
+  0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x4, 0x30E4, 0x30FC, 0x30C8, 0x3099, 0x3, 0x30E4, 0x30FC,
+  0x30EB, 0x3, 0x30E6, 0x30A2, 0x30F3, 0x4, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x2, 0x30EA,
+  0x30E9, 0x4, 0x30EB, 0x30D2, 0x309A, 0x30FC, 0x5, 0x30EB, 0x30FC, 0x30D5, 0x3099, 0x30EB,
+  0x2, 0x30EC, 0x30E0, 0x6, 0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x3099, 0x30F3, 0x3, 0x30EF,
+  0x30C3, 0x30C8, 0x2, 0x30, 0x70B9, 0x2, 0x31, 0x70B9, 0x2, 0x32, 0x70B9, 0x2,
+  0x33, 0x70B9, 0x2, 0x34, 0x70B9, 0x2, 0x35, 0x70B9, 0x2, 0x36, 0x70B9, 0x2,
+  0x37, 0x70B9, 0x2, 0x38, 0x70B9, 0x2, 0x39, 0x70B9, 0x3, 0x31, 0x30, 0x70B9,
+  0x3, 0x31, 0x31, 0x70B9, 0x3, 0x31, 0x32, 0x70B9, 0x3, 0x31, 0x33, 0x70B9,
+  0x3, 0x31, 0x34, 0x70B9, 0x3, 0x31, 0x35, 0x70B9, 0x3, 0x31, 0x36, 0x70B9,
+  0x3, 0x31, 0x37, 0x70B9, 0x3, 0x31, 0x38, 0x70B9, 0x3, 0x31, 0x39, 0x70B9,
+  0x3, 0x32, 0x30, 0x70B9, 0x3, 0x32, 0x31, 0x70B9, 0x3, 0x32, 0x32, 0x70B9,
+  0x3, 0x32, 0x33, 0x70B9, 0x3, 0x32, 0x34, 0x70B9, 0x3, 0x68, 0x50, 0x61,
+  0x2, 0x64, 0x61, 0x2, 0x41, 0x55, 0x3, 0x62, 0x61, 0x72, 0x2, 0x6F,
+  0x56, 0x2, 0x70, 0x63, 0x2, 0x64, 0x6D, 0x3, 0x64, 0x6D, 0x32, 0x3,
+  0x64, 0x6D, 0x33, 0x2, 0x49, 0x55, 0x2, 0x5E73, 0x6210, 0x2, 0x662D, 0x548C,
+  0x2, 0x5927, 0x6B63, 0x2, 0x660E, 0x6CBB, 0x4, 0x682A, 0x5F0F, 0x4F1A, 0x793E, 0x2,
+  0x70, 0x41, 0x2, 0x6E, 0x41, 0x2, 0x3BC, 0x41, 0x2, 0x6D, 0x41, 0x2,
+  0x6B, 0x41, 0x2, 0x4B, 0x42, 0x2, 0x4D, 0x42, 0x2, 0x47, 0x42, 0x3,
+  0x63, 0x61, 0x6C, 0x4, 0x6B, 0x63, 0x61, 0x6C, 0x2, 0x70, 0x46, 0x2,
+  0x6E, 0x46, 0x2, 0x3BC, 0x46, 0x2, 0x3BC, 0x67, 0x2, 0x6D, 0x67, 0x2,
+  0x6B, 0x67, 0x2, 0x48, 0x7A, 0x3, 0x6B, 0x48, 0x7A, 0x3, 0x4D, 0x48,
+  0x7A, 0x3, 0x47, 0x48, 0x7A, 0x3, 0x54, 0x48, 0x7A, 0x2, 0x3BC, 0x6C,
+  0x2, 0x6D, 0x6C, 0x2, 0x64, 0x6C, 0x2, 0x6B, 0x6C, 0x2, 0x66, 0x6D,
+  0x2, 0x6E, 0x6D, 0x2, 0x3BC, 0x6D, 0x2, 0x6D, 0x6D, 0x2, 0x63, 0x6D,
+  0x2, 0x6B, 0x6D, 0x3, 0x6D, 0x6D, 0x32, 0x3, 0x63, 0x6D, 0x32, 0x2,
+  0x6D, 0x32, 0x3, 0x6B, 0x6D, 0x32, 0x3, 0x6D, 0x6D, 0x33, 0x3, 0x63,
+  0x6D, 0x33, 0x2, 0x6D, 0x33, 0x3, 0x6B, 0x6D, 0x33, 0x3, 0x6D, 0x2215,
+  0x73, 0x4, 0x6D, 0x2215, 0x73, 0x32, 0x2, 0x50, 0x61, 0x3, 0x6B, 0x50,
+  0x61, 0x3, 0x4D, 0x50, 0x61, 0x3, 0x47, 0x50, 0x61, 0x3, 0x72, 0x61,
+  0x64, 0x5, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x6, 0x72, 0x61, 0x64, 0x2215,
+  0x73, 0x32, 0x2, 0x70, 0x73, 0x2, 0x6E, 0x73, 0x2, 0x3BC, 0x73, 0x2,
+  0x6D, 0x73, 0x2, 0x70, 0x56, 0x2, 0x6E, 0x56, 0x2, 0x3BC, 0x56, 0x2,
+  0x6D, 0x56, 0x2, 0x6B, 0x56, 0x2, 0x4D, 0x56, 0x2, 0x70, 0x57, 0x2,
+  0x6E, 0x57, 0x2, 0x3BC, 0x57, 0x2, 0x6D, 0x57, 0x2, 0x6B, 0x57, 0x2,
+  0x4D, 0x57, 0x2, 0x6B, 0x3A9, 0x2, 0x4D, 0x3A9, 0x4, 0x61, 0x2E, 0x6D,
+  0x2E, 0x2, 0x42, 0x71, 0x2, 0x63, 0x63, 0x2, 0x63, 0x64, 0x4, 0x43,
+  0x2215, 0x6B, 0x67, 0x3, 0x43, 0x6F, 0x2E, 0x2, 0x64, 0x42, 0x2, 0x47,
+  0x79, 0x2, 0x68, 0x61, 0x2, 0x48, 0x50, 0x2, 0x69, 0x6E, 0x2, 0x4B,
+  0x4B, 0x2, 0x4B, 0x4D, 0x2, 0x6B, 0x74, 0x2, 0x6C, 0x6D, 0x2, 0x6C,
+  0x6E, 0x3, 0x6C, 0x6F, 0x67, 0x2, 0x6C, 0x78, 0x2, 0x6D, 0x62, 0x3,
+  0x6D, 0x69, 0x6C, 0x3, 0x6D, 0x6F, 0x6C, 0x2, 0x50, 0x48, 0x4, 0x70,
+  0x2E, 0x6D, 0x2E, 0x3, 0x50, 0x50, 0x4D, 0x2, 0x50, 0x52, 0x2, 0x73,
+  0x72, 0x2, 0x53, 0x76, 0x2, 0x57, 0x62, 0x3, 0x56, 0x2215, 0x6D, 0x3,
+  0x41, 0x2215, 0x6D, 0x2, 0x31, 0x65E5, 0x2, 0x32, 0x65E5, 0x2, 0x33, 0x65E5,
+  0x2, 0x34, 0x65E5, 0x2, 0x35, 0x65E5, 0x2, 0x36, 0x65E5, 0x2, 0x37, 0x65E5,
+  0x2, 0x38, 0x65E5, 0x2, 0x39, 0x65E5, 0x3, 0x31, 0x30, 0x65E5, 0x3, 0x31,
+  0x31, 0x65E5, 0x3, 0x31, 0x32, 0x65E5, 0x3, 0x31, 0x33, 0x65E5, 0x3, 0x31,
+  0x34, 0x65E5, 0x3, 0x31, 0x35, 0x65E5, 0x3, 0x31, 0x36, 0x65E5, 0x3, 0x31,
+  0x37, 0x65E5, 0x3, 0x31, 0x38, 0x65E5, 0x3, 0x31, 0x39, 0x65E5, 0x3, 0x32,
+  0x30, 0x65E5, 0x3, 0x32, 0x31, 0x65E5, 0x3, 0x32, 0x32, 0x65E5, 0x3, 0x32,
+  0x33, 0x65E5, 0x3, 0x32, 0x34, 0x65E5, 0x3, 0x32, 0x35, 0x65E5, 0x3, 0x32,
+  0x36, 0x65E5, 0x3, 0x32, 0x37, 0x65E5, 0x3, 0x32, 0x38, 0x65E5, 0x3, 0x32,
+  0x39, 0x65E5, 0x3, 0x33, 0x30, 0x65E5, 0x3, 0x33, 0x31, 0x65E5, 0x3, 0x67,
+  0x61, 0x6C, 0x1, 0x44A, 0x1, 0x44C, 0x1, 0xA76F, 0x1, 0x126, 0x1, 0x153,
+  0x1, 0xA727, 0x1, 0xAB37, 0x1, 0x26B, 0x1, 0xAB52, 0x1, 0x28D, 0x1, 0x8C48,
+  0x1, 0x66F4, 0x1, 0x8CC8, 0x1, 0x6ED1, 0x1, 0x4E32, 0x1, 0x53E5, 0x1, 0x5951,
+  0x1, 0x5587, 0x1, 0x5948, 0x1, 0x61F6, 0x1, 0x7669, 0x1, 0x7F85, 0x1, 0x863F,
+  0x1, 0x87BA, 0x1, 0x88F8, 0x1, 0x908F, 0x1, 0x6A02, 0x1, 0x6D1B, 0x1, 0x70D9,
+  0x1, 0x73DE, 0x1, 0x843D, 0x1, 0x916A, 0x1, 0x99F1, 0x1, 0x4E82, 0x1, 0x5375,
+  0x1, 0x6B04, 0x1, 0x721B, 0x1, 0x862D, 0x1, 0x9E1E, 0x1, 0x5D50, 0x1, 0x6FEB,
+  0x1, 0x85CD, 0x1, 0x8964, 0x1, 0x62C9, 0x1, 0x81D8, 0x1, 0x881F, 0x1, 0x5ECA,
+  0x1, 0x6717, 0x1, 0x6D6A, 0x1, 0x72FC, 0x1, 0x90CE, 0x1, 0x4F86, 0x1, 0x51B7,
+  0x1, 0x52DE, 0x1, 0x64C4, 0x1, 0x6AD3, 0x1, 0x7210, 0x1, 0x76E7, 0x1, 0x8606,
+  0x1, 0x865C, 0x1, 0x8DEF, 0x1, 0x9732, 0x1, 0x9B6F, 0x1, 0x9DFA, 0x1, 0x788C,
+  0x1, 0x797F, 0x1, 0x7DA0, 0x1, 0x83C9, 0x1, 0x9304, 0x1, 0x8AD6, 0x1, 0x58DF,
+  0x1, 0x5F04, 0x1, 0x7C60, 0x1, 0x807E, 0x1, 0x7262, 0x1, 0x78CA, 0x1, 0x8CC2,
+  0x1, 0x96F7, 0x1, 0x58D8, 0x1, 0x5C62, 0x1, 0x6A13, 0x1, 0x6DDA, 0x1, 0x6F0F,
+  0x1, 0x7D2F, 0x1, 0x7E37, 0x1, 0x964B, 0x1, 0x52D2, 0x1, 0x808B, 0x1, 0x51DC,
+  0x1, 0x51CC, 0x1, 0x7A1C, 0x1, 0x7DBE, 0x1, 0x83F1, 0x1, 0x9675, 0x1, 0x8B80,
+  0x1, 0x62CF, 0x1, 0x8AFE, 0x1, 0x4E39, 0x1, 0x5BE7, 0x1, 0x6012, 0x1, 0x7387,
+  0x1, 0x7570, 0x1, 0x5317, 0x1, 0x78FB, 0x1, 0x4FBF, 0x1, 0x5FA9, 0x1, 0x4E0D,
+  0x1, 0x6CCC, 0x1, 0x6578, 0x1, 0x7D22, 0x1, 0x53C3, 0x1, 0x585E, 0x1, 0x7701,
+  0x1, 0x8449, 0x1, 0x8AAA, 0x1, 0x6BBA, 0x1, 0x6C88, 0x1, 0x62FE, 0x1, 0x82E5,
+  0x1, 0x63A0, 0x1, 0x7565, 0x1, 0x4EAE, 0x1, 0x5169, 0x1, 0x51C9, 0x1, 0x6881,
+  0x1, 0x7CE7, 0x1, 0x826F, 0x1, 0x8AD2, 0x1, 0x91CF, 0x1, 0x52F5, 0x1, 0x5442,
+  0x1, 0x5EEC, 0x1, 0x65C5, 0x1, 0x6FFE, 0x1, 0x792A, 0x1, 0x95AD, 0x1, 0x9A6A,
+  0x1, 0x9E97, 0x1, 0x9ECE, 0x1, 0x66C6, 0x1, 0x6B77, 0x1, 0x8F62, 0x1, 0x5E74,
+  0x1, 0x6190, 0x1, 0x6200, 0x1, 0x649A, 0x1, 0x6F23, 0x1, 0x7149, 0x1, 0x7489,
+  0x1, 0x79CA, 0x1, 0x7DF4, 0x1, 0x806F, 0x1, 0x8F26, 0x1, 0x84EE, 0x1, 0x9023,
+  0x1, 0x934A, 0x1, 0x5217, 0x1, 0x52A3, 0x1, 0x54BD, 0x1, 0x70C8, 0x1, 0x88C2,
+  0x1, 0x5EC9, 0x1, 0x5FF5, 0x1, 0x637B, 0x1, 0x6BAE, 0x1, 0x7C3E, 0x1, 0x7375,
+  0x1, 0x4EE4, 0x1, 0x56F9, 0x1, 0x5DBA, 0x1, 0x601C, 0x1, 0x73B2, 0x1, 0x7469,
+  0x1, 0x7F9A, 0x1, 0x8046, 0x1, 0x9234, 0x1, 0x96F6, 0x1, 0x9748, 0x1, 0x9818,
+  0x1, 0x4F8B, 0x1, 0x79AE, 0x1, 0x91B4, 0x1, 0x96B8, 0x1, 0x60E1, 0x1, 0x4E86,
+  0x1, 0x50DA, 0x1, 0x5BEE, 0x1, 0x5C3F, 0x1, 0x6599, 0x1, 0x71CE, 0x1, 0x7642,
+  0x1, 0x84FC, 0x1, 0x907C, 0x1, 0x6688, 0x1, 0x962E, 0x1, 0x5289, 0x1, 0x677B,
+  0x1, 0x67F3, 0x1, 0x6D41, 0x1, 0x6E9C, 0x1, 0x7409, 0x1, 0x7559, 0x1, 0x786B,
+  0x1, 0x7D10, 0x1, 0x985E, 0x1, 0x622E, 0x1, 0x9678, 0x1, 0x502B, 0x1, 0x5D19,
+  0x1, 0x6DEA, 0x1, 0x8F2A, 0x1, 0x5F8B, 0x1, 0x6144, 0x1, 0x6817, 0x1, 0x9686,
+  0x1, 0x5229, 0x1, 0x540F, 0x1, 0x5C65, 0x1, 0x6613, 0x1, 0x674E, 0x1, 0x68A8,
+  0x1, 0x6CE5, 0x1, 0x7406, 0x1, 0x75E2, 0x1, 0x7F79, 0x1, 0x88CF, 0x1, 0x88E1,
+  0x1, 0x96E2, 0x1, 0x533F, 0x1, 0x6EBA, 0x1, 0x541D, 0x1, 0x71D0, 0x1, 0x7498,
+  0x1, 0x85FA, 0x1, 0x96A3, 0x1, 0x9C57, 0x1, 0x9E9F, 0x1, 0x6797, 0x1, 0x6DCB,
+  0x1, 0x81E8, 0x1, 0x7B20, 0x1, 0x7C92, 0x1, 0x72C0, 0x1, 0x7099, 0x1, 0x8B58,
+  0x1, 0x4EC0, 0x1, 0x8336, 0x1, 0x523A, 0x1, 0x5207, 0x1, 0x5EA6, 0x1, 0x62D3,
+  0x1, 0x7CD6, 0x1, 0x5B85, 0x1, 0x6D1E, 0x1, 0x66B4, 0x1, 0x8F3B, 0x1, 0x964D,
+  0x1, 0x5ED3, 0x1, 0x5140, 0x1, 0x55C0, 0x1, 0x585A, 0x1, 0x6674, 0x1, 0x51DE,
+  0x1, 0x732A, 0x1, 0x76CA, 0x1, 0x793C, 0x1, 0x795E, 0x1, 0x7965, 0x1, 0x798F,
+  0x1, 0x9756, 0x1, 0x7CBE, 0x1, 0x8612, 0x1, 0x8AF8, 0x1, 0x9038, 0x1, 0x90FD,
+  0x1, 0x98EF, 0x1, 0x98FC, 0x1, 0x9928, 0x1, 0x9DB4, 0x1, 0x90DE, 0x1, 0x96B7,
+  0x1, 0x4FAE, 0x1, 0x50E7, 0x1, 0x514D, 0x1, 0x52C9, 0x1, 0x52E4, 0x1, 0x5351,
+  0x1, 0x559D, 0x1, 0x5606, 0x1, 0x5668, 0x1, 0x5840, 0x1, 0x58A8, 0x1, 0x5C64,
+  0x1, 0x6094, 0x1, 0x6168, 0x1, 0x618E, 0x1, 0x61F2, 0x1, 0x654F, 0x1, 0x65E2,
+  0x1, 0x6691, 0x1, 0x6885, 0x1, 0x6D77, 0x1, 0x6E1A, 0x1, 0x6F22, 0x1, 0x716E,
+  0x1, 0x722B, 0x1, 0x7422, 0x1, 0x7891, 0x1, 0x7949, 0x1, 0x7948, 0x1, 0x7950,
+  0x1, 0x7956, 0x1, 0x798D, 0x1, 0x798E, 0x1, 0x7A40, 0x1, 0x7A81, 0x1, 0x7BC0,
+  0x1, 0x7E09, 0x1, 0x7E41, 0x1, 0x7F72, 0x1, 0x8005, 0x1, 0x81ED, 0x1, 0x8279,
+  0x1, 0x8457, 0x1, 0x8910, 0x1, 0x8996, 0x1, 0x8B01, 0x1, 0x8B39, 0x1, 0x8CD3,
+  0x1, 0x8D08, 0x1, 0x8FB6, 0x1, 0x96E3, 0x1, 0x97FF, 0x1, 0x983B, 0x1, 0x6075,
+  0x1, 0x242EE, 0x1, 0x8218, 0x1, 0x4E26, 0x1, 0x51B5, 0x1, 0x5168, 0x1, 0x4F80,
+  0x1, 0x5145, 0x1, 0x5180, 0x1, 0x52C7, 0x1, 0x52FA, 0x1, 0x5555, 0x1, 0x5599,
+  0x1, 0x55E2, 0x1, 0x58B3, 0x1, 0x5944, 0x1, 0x5954, 0x1, 0x5A62, 0x1, 0x5B28,
+  0x1, 0x5ED2, 0x1, 0x5ED9, 0x1, 0x5F69, 0x1, 0x5FAD, 0x1, 0x60D8, 0x1, 0x614E,
+  0x1, 0x6108, 0x1, 0x6160, 0x1, 0x6234, 0x1, 0x63C4, 0x1, 0x641C, 0x1, 0x6452,
+  0x1, 0x6556, 0x1, 0x671B, 0x1, 0x6756, 0x1, 0x6EDB, 0x1, 0x6ECB, 0x1, 0x701E,
+  0x1, 0x77A7, 0x1, 0x7235, 0x1, 0x72AF, 0x1, 0x7471, 0x1, 0x7506, 0x1, 0x753B,
+  0x1, 0x761D, 0x1, 0x761F, 0x1, 0x76DB, 0x1, 0x76F4, 0x1, 0x774A, 0x1, 0x7740,
+  0x1, 0x78CC, 0x1, 0x7AB1, 0x1, 0x7C7B, 0x1, 0x7D5B, 0x1, 0x7F3E, 0x1, 0x8352,
+  0x1, 0x83EF, 0x1, 0x8779, 0x1, 0x8941, 0x1, 0x8986, 0x1, 0x8ABF, 0x1, 0x8ACB,
+  0x1, 0x8AED, 0x1, 0x8B8A, 0x1, 0x8F38, 0x1, 0x9072, 0x1, 0x9199, 0x1, 0x9276,
+  0x1, 0x967C, 0x1, 0x97DB, 0x1, 0x980B, 0x1, 0x9B12, 0x1, 0x2284A, 0x1, 0x22844,
+  0x1, 0x233D5, 0x1, 0x3B9D, 0x1, 0x4018, 0x1, 0x4039, 0x1, 0x25249, 0x1, 0x25CD0,
+  0x1, 0x27ED3, 0x1, 0x9F43, 0x1, 0x9F8E, 0x2, 0x66, 0x66, 0x2, 0x66, 0x69,
+  0x2, 0x66, 0x6C, 0x3, 0x66, 0x66, 0x69, 0x3, 0x66, 0x66, 0x6C, 0x2,
+  0x73, 0x74, 0x2, 0x574, 0x576, 0x2, 0x574, 0x565, 0x2, 0x574, 0x56B, 0x2,
+  0x57E, 0x576, 0x2, 0x574, 0x56D, 0x2, 0x5D9, 0x5B4, 0x2, 0x5F2, 0x5B7, 0x1,
+  0x5E2, 0x1, 0x5D4, 0x1, 0x5DB, 0x1, 0x5DC, 0x1, 0x5DD, 0x1, 0x5E8, 0x1,
+  0x5EA, 0x2, 0x5E9, 0x5C1, 0x2, 0x5E9, 0x5C2, 0x3, 0x5E9, 0x5BC, 0x5C1, 0x3,
+  0x5E9, 0x5BC, 0x5C2, 0x2, 0x5D0, 0x5B7, 0x2, 0x5D0, 0x5B8, 0x2, 0x5D0, 0x5BC,
+  0x2, 0x5D1, 0x5BC, 0x2, 0x5D2, 0x5BC, 0x2, 0x5D3, 0x5BC, 0x2, 0x5D4, 0x5BC,
+  0x2, 0x5D5, 0x5BC, 0x2, 0x5D6, 0x5BC, 0x2, 0x5D8, 0x5BC, 0x2, 0x5D9, 0x5BC,
+  0x2, 0x5DA, 0x5BC, 0x2, 0x5DB, 0x5BC, 0x2, 0x5DC, 0x5BC, 0x2, 0x5DE, 0x5BC,
+  0x2, 0x5E0, 0x5BC, 0x2, 0x5E1, 0x5BC, 0x2, 0x5E3, 0x5BC, 0x2, 0x5E4, 0x5BC,
+  0x2, 0x5E6, 0x5BC, 0x2, 0x5E7, 0x5BC, 0x2, 0x5E8, 0x5BC, 0x2, 0x5E9, 0x5BC,
+  0x2, 0x5EA, 0x5BC, 0x2, 0x5D5, 0x5B9, 0x2, 0x5D1, 0x5BF, 0x2, 0x5DB, 0x5BF,
+  0x2, 0x5E4, 0x5BF, 0x2, 0x5D0, 0x5DC, 0x1, 0x671, 0x1, 0x67B, 0x1, 0x67E,
+  0x1, 0x680, 0x1, 0x67A, 0x1, 0x67F, 0x1, 0x679, 0x1, 0x6A4, 0x1, 0x6A6,
+  0x1, 0x684, 0x1, 0x683, 0x1, 0x686, 0x1, 0x687, 0x1, 0x68D, 0x1, 0x68C,
+  0x1, 0x68E, 0x1, 0x688, 0x1, 0x698, 0x1, 0x691, 0x1, 0x6A9, 0x1, 0x6AF,
+  0x1, 0x6B3, 0x1, 0x6B1, 0x1, 0x6BA, 0x1, 0x6BB, 0x1, 0x6C1, 0x1, 0x6BE,
+  0x1, 0x6D2, 0x1, 0x6AD, 0x1, 0x6C7, 0x1, 0x6C6, 0x1, 0x6C8, 0x1, 0x6CB,
+  0x1, 0x6C5, 0x1, 0x6C9, 0x1, 0x6D0, 0x1, 0x649, 0x3, 0x64A, 0x654, 0x627,
+  0x3, 0x64A, 0x654, 0x6D5, 0x3, 0x64A, 0x654, 0x648, 0x3, 0x64A, 0x654, 0x6C7,
+  0x3, 0x64A, 0x654, 0x6C6, 0x3, 0x64A, 0x654, 0x6C8, 0x3, 0x64A, 0x654, 0x6D0,
+  0x3, 0x64A, 0x654, 0x649, 0x1, 0x6CC, 0x3, 0x64A, 0x654, 0x62C, 0x3, 0x64A,
+  0x654, 0x62D, 0x3, 0x64A, 0x654, 0x645, 0x3, 0x64A, 0x654, 0x64A, 0x2, 0x628,
+  0x62C, 0x2, 0x628, 0x62D, 0x2, 0x628, 0x62E, 0x2, 0x628, 0x645, 0x2, 0x628,
+  0x649, 0x2, 0x628, 0x64A, 0x2, 0x62A, 0x62C, 0x2, 0x62A, 0x62D, 0x2, 0x62A,
+  0x62E, 0x2, 0x62A, 0x645, 0x2, 0x62A, 0x649, 0x2, 0x62A, 0x64A, 0x2, 0x62B,
+  0x62C, 0x2, 0x62B, 0x645, 0x2, 0x62B, 0x649, 0x2, 0x62B, 0x64A, 0x2, 0x62C,
+  0x62D, 0x2, 0x62C, 0x645, 0x2, 0x62D, 0x62C, 0x2, 0x62D, 0x645, 0x2, 0x62E,
+  0x62C, 0x2, 0x62E, 0x62D, 0x2, 0x62E, 0x645, 0x2, 0x633, 0x62C, 0x2, 0x633,
+  0x62D, 0x2, 0x633, 0x62E, 0x2, 0x633, 0x645, 0x2, 0x635, 0x62D, 0x2, 0x635,
+  0x645, 0x2, 0x636, 0x62C, 0x2, 0x636, 0x62D, 0x2, 0x636, 0x62E, 0x2, 0x636,
+  0x645, 0x2, 0x637, 0x62D, 0x2, 0x637, 0x645, 0x2, 0x638, 0x645, 0x2, 0x639,
+  0x62C, 0x2, 0x639, 0x645, 0x2, 0x63A, 0x62C, 0x2, 0x63A, 0x645, 0x2, 0x641,
+  0x62C, 0x2, 0x641, 0x62D, 0x2, 0x641, 0x62E, 0x2, 0x641, 0x645, 0x2, 0x641,
+  0x649, 0x2, 0x641, 0x64A, 0x2, 0x642, 0x62D, 0x2, 0x642, 0x645, 0x2, 0x642,
+  0x649, 0x2, 0x642, 0x64A, 0x2, 0x643, 0x627, 0x2, 0x643, 0x62C, 0x2, 0x643,
+  0x62D, 0x2, 0x643, 0x62E, 0x2, 0x643, 0x644, 0x2, 0x643, 0x645, 0x2, 0x643,
+  0x649, 0x2, 0x643, 0x64A, 0x2, 0x644, 0x62C, 0x2, 0x644, 0x62D, 0x2, 0x644,
+  0x62E, 0x2, 0x644, 0x645, 0x2, 0x644, 0x649, 0x2, 0x644, 0x64A, 0x2, 0x645,
+  0x62C, 0x2, 0x645, 0x62D, 0x2, 0x645, 0x62E, 0x2, 0x645, 0x645, 0x2, 0x645,
+  0x649, 0x2, 0x645, 0x64A, 0x2, 0x646, 0x62C, 0x2, 0x646, 0x62D, 0x2, 0x646,
+  0x62E, 0x2, 0x646, 0x645, 0x2, 0x646, 0x649, 0x2, 0x646, 0x64A, 0x2, 0x647,
+  0x62C, 0x2, 0x647, 0x645, 0x2, 0x647, 0x649, 0x2, 0x647, 0x64A, 0x2, 0x64A,
+  0x62C, 0x2, 0x64A, 0x62D, 0x2, 0x64A, 0x62E, 0x2, 0x64A, 0x645, 0x2, 0x64A,
+  0x649, 0x2, 0x64A, 0x64A, 0x2, 0x630, 0x670, 0x2, 0x631, 0x670, 0x2, 0x649,
+  0x670, 0x3, 0x20, 0x64C, 0x651, 0x3, 0x20, 0x64D, 0x651, 0x3, 0x20, 0x64E,
+  0x651, 0x3, 0x20, 0x64F, 0x651, 0x3, 0x20, 0x650, 0x651, 0x3, 0x20, 0x651,
+  0x670, 0x3, 0x64A, 0x654, 0x631, 0x3, 0x64A, 0x654, 0x632, 0x3, 0x64A, 0x654,
+  0x646, 0x2, 0x628, 0x631, 0x2, 0x628, 0x632, 0x2, 0x628, 0x646, 0x2, 0x62A,
+  0x631, 0x2, 0x62A, 0x632, 0x2, 0x62A, 0x646, 0x2, 0x62B, 0x631, 0x2, 0x62B,
+  0x632, 0x2, 0x62B, 0x646, 0x2, 0x645, 0x627, 0x2, 0x646, 0x631, 0x2, 0x646,
+  0x632, 0x2, 0x646, 0x646, 0x2, 0x64A, 0x631, 0x2, 0x64A, 0x632, 0x2, 0x64A,
+  0x646, 0x3, 0x64A, 0x654, 0x62E, 0x3, 0x64A, 0x654, 0x647, 0x2, 0x628, 0x647,
+  0x2, 0x62A, 0x647, 0x2, 0x635, 0x62E, 0x2, 0x644, 0x647, 0x2, 0x646, 0x647,
+  0x2, 0x647, 0x670, 0x2, 0x64A, 0x647, 0x2, 0x62B, 0x647, 0x2, 0x633, 0x647,
+  0x2, 0x634, 0x645, 0x2, 0x634, 0x647, 0x3, 0x640, 0x64E, 0x651, 0x3, 0x640,
+  0x64F, 0x651, 0x3, 0x640, 0x650, 0x651, 0x2, 0x637, 0x649, 0x2, 0x637, 0x64A,
+  0x2, 0x639, 0x649, 0x2, 0x639, 0x64A, 0x2, 0x63A, 0x649, 0x2, 0x63A, 0x64A,
+  0x2, 0x633, 0x649, 0x2, 0x633, 0x64A, 0x2, 0x634, 0x649, 0x2, 0x634, 0x64A,
+  0x2, 0x62D, 0x649, 0x2, 0x62D, 0x64A, 0x2, 0x62C, 0x649, 0x2, 0x62C, 0x64A,
+  0x2, 0x62E, 0x649, 0x2, 0x62E, 0x64A, 0x2, 0x635, 0x649, 0x2, 0x635, 0x64A,
+  0x2, 0x636, 0x649, 0x2, 0x636, 0x64A, 0x2, 0x634, 0x62C, 0x2, 0x634, 0x62D,
+  0x2, 0x634, 0x62E, 0x2, 0x634, 0x631, 0x2, 0x633, 0x631, 0x2, 0x635, 0x631,
+  0x2, 0x636, 0x631, 0x2, 0x627, 0x64B, 0x3, 0x62A, 0x62C, 0x645, 0x3, 0x62A,
+  0x62D, 0x62C, 0x3, 0x62A, 0x62D, 0x645, 0x3, 0x62A, 0x62E, 0x645, 0x3, 0x62A,
+  0x645, 0x62C, 0x3, 0x62A, 0x645, 0x62D, 0x3, 0x62A, 0x645, 0x62E, 0x3, 0x62C,
+  0x645, 0x62D, 0x3, 0x62D, 0x645, 0x64A, 0x3, 0x62D, 0x645, 0x649, 0x3, 0x633,
+  0x62D, 0x62C, 0x3, 0x633, 0x62C, 0x62D, 0x3, 0x633, 0x62C, 0x649, 0x3, 0x633,
+  0x645, 0x62D, 0x3, 0x633, 0x645, 0x62C, 0x3, 0x633, 0x645, 0x645, 0x3, 0x635,
+  0x62D, 0x62D, 0x3, 0x635, 0x645, 0x645, 0x3, 0x634, 0x62D, 0x645, 0x3, 0x634,
+  0x62C, 0x64A, 0x3, 0x634, 0x645, 0x62E, 0x3, 0x634, 0x645, 0x645, 0x3, 0x636,
+  0x62D, 0x649, 0x3, 0x636, 0x62E, 0x645, 0x3, 0x637, 0x645, 0x62D, 0x3, 0x637,
+  0x645, 0x645, 0x3, 0x637, 0x645, 0x64A, 0x3, 0x639, 0x62C, 0x645, 0x3, 0x639,
+  0x645, 0x645, 0x3, 0x639, 0x645, 0x649, 0x3, 0x63A, 0x645, 0x645, 0x3, 0x63A,
+  0x645, 0x64A, 0x3, 0x63A, 0x645, 0x649, 0x3, 0x641, 0x62E, 0x645, 0x3, 0x642,
+  0x645, 0x62D, 0x3, 0x642, 0x645, 0x645, 0x3, 0x644, 0x62D, 0x645, 0x3, 0x644,
+  0x62D, 0x64A, 0x3, 0x644, 0x62D, 0x649, 0x3, 0x644, 0x62C, 0x62C, 0x3, 0x644,
+  0x62E, 0x645, 0x3, 0x644, 0x645, 0x62D, 0x3, 0x645, 0x62D, 0x62C, 0x3, 0x645,
+  0x62D, 0x645, 0x3, 0x645, 0x62D, 0x64A, 0x3, 0x645, 0x62C, 0x62D, 0x3, 0x645,
+  0x62C, 0x645, 0x3, 0x645, 0x62E, 0x62C, 0x3, 0x645, 0x62E, 0x645, 0x3, 0x645,
+  0x62C, 0x62E, 0x3, 0x647, 0x645, 0x62C, 0x3, 0x647, 0x645, 0x645, 0x3, 0x646,
+  0x62D, 0x645, 0x3, 0x646, 0x62D, 0x649, 0x3, 0x646, 0x62C, 0x645, 0x3, 0x646,
+  0x62C, 0x649, 0x3, 0x646, 0x645, 0x64A, 0x3, 0x646, 0x645, 0x649, 0x3, 0x64A,
+  0x645, 0x645, 0x3, 0x628, 0x62E, 0x64A, 0x3, 0x62A, 0x62C, 0x64A, 0x3, 0x62A,
+  0x62C, 0x649, 0x3, 0x62A, 0x62E, 0x64A, 0x3, 0x62A, 0x62E, 0x649, 0x3, 0x62A,
+  0x645, 0x64A, 0x3, 0x62A, 0x645, 0x649, 0x3, 0x62C, 0x645, 0x64A, 0x3, 0x62C,
+  0x62D, 0x649, 0x3, 0x62C, 0x645, 0x649, 0x3, 0x633, 0x62E, 0x649, 0x3, 0x635,
+  0x62D, 0x64A, 0x3, 0x634, 0x62D, 0x64A, 0x3, 0x636, 0x62D, 0x64A, 0x3, 0x644,
+  0x62C, 0x64A, 0x3, 0x644, 0x645, 0x64A, 0x3, 0x64A, 0x62D, 0x64A, 0x3, 0x64A,
+  0x62C, 0x64A, 0x3, 0x64A, 0x645, 0x64A, 0x3, 0x645, 0x645, 0x64A, 0x3, 0x642,
+  0x645, 0x64A, 0x3, 0x646, 0x62D, 0x64A, 0x3, 0x639, 0x645, 0x64A, 0x3, 0x643,
+  0x645, 0x64A, 0x3, 0x646, 0x62C, 0x62D, 0x3, 0x645, 0x62E, 0x64A, 0x3, 0x644,
+  0x62C, 0x645, 0x3, 0x643, 0x645, 0x645, 0x3, 0x62C, 0x62D, 0x64A, 0x3, 0x62D,
+  0x62C, 0x64A, 0x3, 0x645, 0x62C, 0x64A, 0x3, 0x641, 0x645, 0x64A, 0x3, 0x628,
+  0x62D, 0x64A, 0x3, 0x633, 0x62E, 0x64A, 0x3, 0x646, 0x62C, 0x64A, 0x3, 0x635,
+  0x644, 0x6D2, 0x3, 0x642, 0x644, 0x6D2, 0x4, 0x627, 0x644, 0x644, 0x647, 0x4,
+  0x627, 0x643, 0x628, 0x631, 0x4, 0x645, 0x62D, 0x645, 0x62F, 0x4, 0x635, 0x644,
+  0x639, 0x645, 0x4, 0x631, 0x633, 0x648, 0x644, 0x4, 0x639, 0x644, 0x64A, 0x647,
+  0x4, 0x648, 0x633, 0x644, 0x645, 0x3, 0x635, 0x644, 0x649, 0x12, 0x635, 0x644,
+  0x649, 0x20, 0x627, 0x644, 0x644, 0x647, 0x20, 0x639, 0x644, 0x64A, 0x647, 0x20,
+  0x648, 0x633, 0x644, 0x645, 0x8, 0x62C, 0x644, 0x20, 0x62C, 0x644, 0x627, 0x644,
+  0x647, 0x4, 0x631, 0x6CC, 0x627, 0x644, 0x1, 0x2C, 0x1, 0x3001, 0x1, 0x3002,
+  0x1, 0x3A, 0x1, 0x21, 0x1, 0x3F, 0x1, 0x3016, 0x1, 0x3017, 0x1, 0x2014,
+  0x1, 0x2013, 0x1, 0x5F, 0x1, 0x7B, 0x1, 0x7D, 0x1, 0x3014, 0x1, 0x3015,
+  0x1, 0x3010, 0x1, 0x3011, 0x1, 0x300A, 0x1, 0x300B, 0x1, 0x300C, 0x1, 0x300D,
+  0x1, 0x300E, 0x1, 0x300F, 0x1, 0x5B, 0x1, 0x5D, 0x1, 0x23, 0x1, 0x26,
+  0x1, 0x2A, 0x1, 0x2D, 0x1, 0x3C, 0x1, 0x3E, 0x1, 0x5C, 0x1, 0x24,
+  0x1, 0x25, 0x1, 0x40, 0x2, 0x20, 0x64B, 0x2, 0x640, 0x64B, 0x2, 0x20,
+  0x64C, 0x2, 0x20, 0x64D, 0x2, 0x20, 0x64E, 0x2, 0x640, 0x64E, 0x2, 0x20,
+  0x64F, 0x2, 0x640, 0x64F, 0x2, 0x20, 0x650, 0x2, 0x640, 0x650, 0x2, 0x20,
+  0x651, 0x2, 0x640, 0x651, 0x2, 0x20, 0x652, 0x2, 0x640, 0x652, 0x1, 0x621,
+  0x1, 0x627, 0x1, 0x628, 0x1, 0x629, 0x1, 0x62A, 0x1, 0x62B, 0x1, 0x62C,
+  0x1, 0x62D, 0x1, 0x62E, 0x1, 0x62F, 0x1, 0x630, 0x1, 0x631, 0x1, 0x632,
+  0x1, 0x633, 0x1, 0x634, 0x1, 0x635, 0x1, 0x636, 0x1, 0x637, 0x1, 0x638,
+  0x1, 0x639, 0x1, 0x63A, 0x1, 0x641, 0x1, 0x642, 0x1, 0x643, 0x1, 0x644,
+  0x1, 0x645, 0x1, 0x646, 0x1, 0x647, 0x1, 0x648, 0x1, 0x64A, 0x3, 0x644,
+  0x627, 0x653, 0x3, 0x644, 0x627, 0x654, 0x3, 0x644, 0x627, 0x655, 0x2, 0x644,
+  0x627, 0x1, 0x22, 0x1, 0x27, 0x1, 0x2F, 0x1, 0x5E, 0x1, 0x7C, 0x1,
+  0x7E, 0x1, 0x2985, 0x1, 0x2986, 0x1, 0x30FB, 0x1, 0x30A1, 0x1, 0x30A3, 0x1,
+  0x30A5, 0x1, 0x30A7, 0x1, 0x30A9, 0x1, 0x30E3, 0x1, 0x30E5, 0x1, 0x30E7, 0x1,
+  0x30C3, 0x1, 0x30FC, 0x1, 0x30F3, 0x1, 0x3099, 0x1, 0x309A, 0x1, 0xA2, 0x1,
+  0xA3, 0x1, 0xAC, 0x1, 0xA6, 0x1, 0xA5, 0x1, 0x20A9, 0x1, 0x2502, 0x1,
+  0x2190, 0x1, 0x2191, 0x1, 0x2192, 0x1, 0x2193, 0x1, 0x25A0, 0x1, 0x25CB, 0x1,
+  0x2D0, 0x1, 0x2D1, 0x1, 0xE6, 0x1, 0x299, 0x1, 0x253, 0x1, 0x2A3, 0x1,
+  0xAB66, 0x1, 0x2A5, 0x1, 0x2A4, 0x1, 0x256, 0x1, 0x257, 0x1, 0x1D91, 0x1,
+  0x258, 0x1, 0x25E, 0x1, 0x2A9, 0x1, 0x264, 0x1, 0x262, 0x1, 0x260, 0x1,
+  0x29B, 0x1, 0x29C, 0x1, 0x267, 0x1, 0x284, 0x1, 0x2AA, 0x1, 0x2AB, 0x1,
+  0x26C, 0x1, 0x1DF04, 0x1, 0xA78E, 0x1, 0x26E, 0x1, 0x1DF05, 0x1, 0x28E, 0x1,
+  0x1DF06, 0x1, 0xF8, 0x1, 0x276, 0x1, 0x277, 0x1, 0x27A, 0x1, 0x1DF08, 0x1,
+  0x27D, 0x1, 0x27E, 0x1, 0x280, 0x1, 0x2A8, 0x1, 0x2A6, 0x1, 0xAB67, 0x1,
+  0x2A7, 0x1, 0x288, 0x1, 0x2C71, 0x1, 0x28F, 0x1, 0x2A1, 0x1, 0x2A2, 0x1,
+  0x298, 0x1, 0x1C0, 0x1, 0x1C1, 0x1, 0x1C2, 0x1, 0x1DF0A, 0x1, 0x1DF1E, 0x2,
+  0x11099, 0x110BA, 0x2, 0x1109B, 0x110BA, 0x2, 0x110A5, 0x110BA, 0x2, 0x11131, 0x11127, 0x2,
+  0x11132, 0x11127, 0x2, 0x11347, 0x1133E, 0x2, 0x11347, 0x11357, 0x2, 0x114B9, 0x114BA, 0x2,
+  0x114B9, 0x114B0, 0x2, 0x114B9, 0x114BD, 0x2, 0x115B8, 0x115AF, 0x2, 0x115B9, 0x115AF, 0x2,
+  0x11935, 0x11930, 0x2, 0x1D157, 0x1D165, 0x2, 0x1D158, 0x1D165, 0x3, 0x1D158, 0x1D165, 0x1D16E,
+  0x3, 0x1D158, 0x1D165, 0x1D16F, 0x3, 0x1D158, 0x1D165, 0x1D170, 0x3, 0x1D158, 0x1D165, 0x1D171,
+  0x3, 0x1D158, 0x1D165, 0x1D172, 0x2, 0x1D1B9, 0x1D165, 0x2, 0x1D1BA, 0x1D165, 0x3, 0x1D1B9,
+  0x1D165, 0x1D16E, 0x3, 0x1D1BA, 0x1D165, 0x1D16E, 0x3, 0x1D1B9, 0x1D165, 0x1D16F, 0x3, 0x1D1BA,
+  0x1D165, 0x1D16F, 0x1, 0x131, 0x1, 0x237, 0x1, 0x391, 0x1, 0x392, 0x1, 0x394,
+  0x1, 0x395, 0x1, 0x396, 0x1, 0x397, 0x1, 0x399, 0x1, 0x39A, 0x1, 0x39B,
+  0x1, 0x39C, 0x1, 0x39D, 0x1, 0x39E, 0x1, 0x39F, 0x1, 0x3A1, 0x1, 0x3A4,
+  0x1, 0x3A6, 0x1, 0x3A7, 0x1, 0x3A8, 0x1, 0x2207, 0x1, 0x3B1, 0x1, 0x3B6,
+  0x1, 0x3B7, 0x1, 0x3BB, 0x1, 0x3BD, 0x1, 0x3BE, 0x1, 0x3BF, 0x1, 0x3C3,
+  0x1, 0x3C4, 0x1, 0x3C5, 0x1, 0x3C8, 0x1, 0x3C9, 0x1, 0x2202, 0x1, 0x3DC,
+  0x1, 0x3DD, 0x1, 0x66E, 0x1, 0x6A1, 0x1, 0x66F, 0x2, 0x30, 0x2E, 0x2,
+  0x30, 0x2C, 0x2, 0x31, 0x2C, 0x2, 0x32, 0x2C, 0x2, 0x33, 0x2C, 0x2,
+  0x34, 0x2C, 0x2, 0x35, 0x2C, 0x2, 0x36, 0x2C, 0x2, 0x37, 0x2C, 0x2,
+  0x38, 0x2C, 0x2, 0x39, 0x2C, 0x3, 0x28, 0x41, 0x29, 0x3, 0x28, 0x42,
+  0x29, 0x3, 0x28, 0x43, 0x29, 0x3, 0x28, 0x44, 0x29, 0x3, 0x28, 0x45,
+  0x29, 0x3, 0x28, 0x46, 0x29, 0x3, 0x28, 0x47, 0x29, 0x3, 0x28, 0x48,
+  0x29, 0x3, 0x28, 0x49, 0x29, 0x3, 0x28, 0x4A, 0x29, 0x3, 0x28, 0x4B,
+  0x29, 0x3, 0x28, 0x4C, 0x29, 0x3, 0x28, 0x4D, 0x29, 0x3, 0x28, 0x4E,
+  0x29, 0x3, 0x28, 0x4F, 0x29, 0x3, 0x28, 0x50, 0x29, 0x3, 0x28, 0x51,
+  0x29, 0x3, 0x28, 0x52, 0x29, 0x3, 0x28, 0x53, 0x29, 0x3, 0x28, 0x54,
+  0x29, 0x3, 0x28, 0x55, 0x29, 0x3, 0x28, 0x56, 0x29, 0x3, 0x28, 0x57,
+  0x29, 0x3, 0x28, 0x58, 0x29, 0x3, 0x28, 0x59, 0x29, 0x3, 0x28, 0x5A,
+  0x29, 0x3, 0x3014, 0x53, 0x3015, 0x2, 0x43, 0x44, 0x2, 0x57, 0x5A, 0x2,
+  0x48, 0x56, 0x2, 0x53, 0x44, 0x2, 0x53, 0x53, 0x3, 0x50, 0x50, 0x56,
+  0x2, 0x57, 0x43, 0x2, 0x4D, 0x43, 0x2, 0x4D, 0x44, 0x2, 0x4D, 0x52,
+  0x2, 0x44, 0x4A, 0x2, 0x307B, 0x304B, 0x2, 0x30B3, 0x30B3, 0x1, 0x5B57, 0x1,
+  0x53CC, 0x1, 0x591A, 0x1, 0x89E3, 0x1, 0x4EA4, 0x1, 0x6620, 0x1, 0x7121, 0x1,
+  0x524D, 0x1, 0x5F8C, 0x1, 0x518D, 0x1, 0x65B0, 0x1, 0x521D, 0x1, 0x7D42, 0x1,
+  0x8CA9, 0x1, 0x58F0, 0x1, 0x5439, 0x1, 0x6F14, 0x1, 0x6295, 0x1, 0x6355, 0x1,
+  0x904A, 0x1, 0x6307, 0x1, 0x6253, 0x1, 0x7981, 0x1, 0x7A7A, 0x1, 0x5408, 0x1,
+  0x6E80, 0x1, 0x7533, 0x1, 0x5272, 0x1, 0x55B6, 0x1, 0x914D, 0x3, 0x3014, 0x672C,
+  0x3015, 0x3, 0x3014, 0x4E09, 0x3015, 0x3, 0x3014, 0x4E8C, 0x3015, 0x3, 0x3014, 0x5B89,
+  0x3015, 0x3, 0x3014, 0x70B9, 0x3015, 0x3, 0x3014, 0x6253, 0x3015, 0x3, 0x3014, 0x76D7,
+  0x3015, 0x3, 0x3014, 0x52DD, 0x3015, 0x3, 0x3014, 0x6557, 0x3015, 0x1, 0x5F97, 0x1,
+  0x53EF, 0x1, 0x4E3D, 0x1, 0x4E38, 0x1, 0x4E41, 0x1, 0x20122, 0x1, 0x4F60, 0x1,
+  0x4FBB, 0x1, 0x5002, 0x1, 0x507A, 0x1, 0x5099, 0x1, 0x50CF, 0x1, 0x349E, 0x1,
+  0x2063A, 0x1, 0x5154, 0x1, 0x5164, 0x1, 0x5177, 0x1, 0x2051C, 0x1, 0x34B9, 0x1,
+  0x5167, 0x1, 0x2054B, 0x1, 0x5197, 0x1, 0x51A4, 0x1, 0x4ECC, 0x1, 0x51AC, 0x1,
+  0x291DF, 0x1, 0x5203, 0x1, 0x34DF, 0x1, 0x523B, 0x1, 0x5246, 0x1, 0x5277, 0x1,
+  0x3515, 0x1, 0x5305, 0x1, 0x5306, 0x1, 0x5349, 0x1, 0x535A, 0x1, 0x5373, 0x1,
+  0x537D, 0x1, 0x537F, 0x1, 0x20A2C, 0x1, 0x7070, 0x1, 0x53CA, 0x1, 0x53DF, 0x1,
+  0x20B63, 0x1, 0x53EB, 0x1, 0x53F1, 0x1, 0x5406, 0x1, 0x549E, 0x1, 0x5438, 0x1,
+  0x5448, 0x1, 0x5468, 0x1, 0x54A2, 0x1, 0x54F6, 0x1, 0x5510, 0x1, 0x5553, 0x1,
+  0x5563, 0x1, 0x5584, 0x1, 0x55AB, 0x1, 0x55B3, 0x1, 0x55C2, 0x1, 0x5716, 0x1,
+  0x5717, 0x1, 0x5651, 0x1, 0x5674, 0x1, 0x58EE, 0x1, 0x57CE, 0x1, 0x57F4, 0x1,
+  0x580D, 0x1, 0x578B, 0x1, 0x5832, 0x1, 0x5831, 0x1, 0x58AC, 0x1, 0x214E4, 0x1,
+  0x58F2, 0x1, 0x58F7, 0x1, 0x5906, 0x1, 0x5922, 0x1, 0x5962, 0x1, 0x216A8, 0x1,
+  0x216EA, 0x1, 0x59EC, 0x1, 0x5A1B, 0x1, 0x5A27, 0x1, 0x59D8, 0x1, 0x5A66, 0x1,
+  0x36EE, 0x1, 0x36FC, 0x1, 0x5B08, 0x1, 0x5B3E, 0x1, 0x219C8, 0x1, 0x5BC3, 0x1,
+  0x5BD8, 0x1, 0x5BF3, 0x1, 0x21B18, 0x1, 0x5BFF, 0x1, 0x5C06, 0x1, 0x5F53, 0x1,
+  0x3781, 0x1, 0x5C60, 0x1, 0x5CC0, 0x1, 0x5C8D, 0x1, 0x21DE4, 0x1, 0x5D43, 0x1,
+  0x21DE6, 0x1, 0x5D6E, 0x1, 0x5D6B, 0x1, 0x5D7C, 0x1, 0x5DE1, 0x1, 0x5DE2, 0x1,
+  0x382F, 0x1, 0x5DFD, 0x1, 0x5E28, 0x1, 0x5E3D, 0x1, 0x5E69, 0x1, 0x3862, 0x1,
+  0x22183, 0x1, 0x387C, 0x1, 0x5EB0, 0x1, 0x5EB3, 0x1, 0x5EB6, 0x1, 0x2A392, 0x1,
+  0x22331, 0x1, 0x8201, 0x1, 0x5F22, 0x1, 0x38C7, 0x1, 0x232B8, 0x1, 0x261DA, 0x1,
+  0x5F62, 0x1, 0x5F6B, 0x1, 0x38E3, 0x1, 0x5F9A, 0x1, 0x5FCD, 0x1, 0x5FD7, 0x1,
+  0x5FF9, 0x1, 0x6081, 0x1, 0x393A, 0x1, 0x391C, 0x1, 0x226D4, 0x1, 0x60C7, 0x1,
+  0x6148, 0x1, 0x614C, 0x1, 0x617A, 0x1, 0x61B2, 0x1, 0x61A4, 0x1, 0x61AF, 0x1,
+  0x61DE, 0x1, 0x6210, 0x1, 0x621B, 0x1, 0x625D, 0x1, 0x62B1, 0x1, 0x62D4, 0x1,
+  0x6350, 0x1, 0x22B0C, 0x1, 0x633D, 0x1, 0x62FC, 0x1, 0x6368, 0x1, 0x6383, 0x1,
+  0x63E4, 0x1, 0x22BF1, 0x1, 0x6422, 0x1, 0x63C5, 0x1, 0x63A9, 0x1, 0x3A2E, 0x1,
+  0x6469, 0x1, 0x647E, 0x1, 0x649D, 0x1, 0x6477, 0x1, 0x3A6C, 0x1, 0x656C, 0x1,
+  0x2300A, 0x1, 0x65E3, 0x1, 0x66F8, 0x1, 0x6649, 0x1, 0x3B19, 0x1, 0x3B08, 0x1,
+  0x3AE4, 0x1, 0x5192, 0x1, 0x5195, 0x1, 0x6700, 0x1, 0x669C, 0x1, 0x80AD, 0x1,
+  0x43D9, 0x1, 0x6721, 0x1, 0x675E, 0x1, 0x6753, 0x1, 0x233C3, 0x1, 0x3B49, 0x1,
+  0x67FA, 0x1, 0x6785, 0x1, 0x6852, 0x1, 0x2346D, 0x1, 0x688E, 0x1, 0x681F, 0x1,
+  0x6914, 0x1, 0x6942, 0x1, 0x69A3, 0x1, 0x69EA, 0x1, 0x6AA8, 0x1, 0x236A3, 0x1,
+  0x6ADB, 0x1, 0x3C18, 0x1, 0x6B21, 0x1, 0x238A7, 0x1, 0x6B54, 0x1, 0x3C4E, 0x1,
+  0x6B72, 0x1, 0x6B9F, 0x1, 0x6BBB, 0x1, 0x23A8D, 0x1, 0x21D0B, 0x1, 0x23AFA, 0x1,
+  0x6C4E, 0x1, 0x23CBC, 0x1, 0x6CBF, 0x1, 0x6CCD, 0x1, 0x6C67, 0x1, 0x6D16, 0x1,
+  0x6D3E, 0x1, 0x6D69, 0x1, 0x6D78, 0x1, 0x6D85, 0x1, 0x23D1E, 0x1, 0x6D34, 0x1,
+  0x6E2F, 0x1, 0x6E6E, 0x1, 0x3D33, 0x1, 0x6EC7, 0x1, 0x23ED1, 0x1, 0x6DF9, 0x1,
+  0x6F6E, 0x1, 0x23F5E, 0x1, 0x23F8E, 0x1, 0x6FC6, 0x1, 0x7039, 0x1, 0x701B, 0x1,
+  0x3D96, 0x1, 0x704A, 0x1, 0x707D, 0x1, 0x7077, 0x1, 0x70AD, 0x1, 0x20525, 0x1,
+  0x7145, 0x1, 0x24263, 0x1, 0x719C, 0x1, 0x243AB, 0x1, 0x7228, 0x1, 0x7250, 0x1,
+  0x24608, 0x1, 0x7280, 0x1, 0x7295, 0x1, 0x24735, 0x1, 0x24814, 0x1, 0x737A, 0x1,
+  0x738B, 0x1, 0x3EAC, 0x1, 0x73A5, 0x1, 0x3EB8, 0x1, 0x7447, 0x1, 0x745C, 0x1,
+  0x7485, 0x1, 0x74CA, 0x1, 0x3F1B, 0x1, 0x7524, 0x1, 0x24C36, 0x1, 0x753E, 0x1,
+  0x24C92, 0x1, 0x2219F, 0x1, 0x7610, 0x1, 0x24FA1, 0x1, 0x24FB8, 0x1, 0x25044, 0x1,
+  0x3FFC, 0x1, 0x4008, 0x1, 0x250F3, 0x1, 0x250F2, 0x1, 0x25119, 0x1, 0x25133, 0x1,
+  0x771E, 0x1, 0x771F, 0x1, 0x778B, 0x1, 0x4046, 0x1, 0x4096, 0x1, 0x2541D, 0x1,
+  0x784E, 0x1, 0x40E3, 0x1, 0x25626, 0x1, 0x2569A, 0x1, 0x256C5, 0x1, 0x79EB, 0x1,
+  0x412F, 0x1, 0x7A4A, 0x1, 0x7A4F, 0x1, 0x2597C, 0x1, 0x25AA7, 0x1, 0x7AEE, 0x1,
+  0x4202, 0x1, 0x25BAB, 0x1, 0x7BC6, 0x1, 0x7BC9, 0x1, 0x4227, 0x1, 0x25C80, 0x1,
+  0x7CD2, 0x1, 0x42A0, 0x1, 0x7CE8, 0x1, 0x7CE3, 0x1, 0x7D00, 0x1, 0x25F86, 0x1,
+  0x7D63, 0x1, 0x4301, 0x1, 0x7DC7, 0x1, 0x7E02, 0x1, 0x7E45, 0x1, 0x4334, 0x1,
+  0x26228, 0x1, 0x26247, 0x1, 0x4359, 0x1, 0x262D9, 0x1, 0x7F7A, 0x1, 0x2633E, 0x1,
+  0x7F95, 0x1, 0x7FFA, 0x1, 0x264DA, 0x1, 0x26523, 0x1, 0x8060, 0x1, 0x265A8, 0x1,
+  0x8070, 0x1, 0x2335F, 0x1, 0x43D5, 0x1, 0x80B2, 0x1, 0x8103, 0x1, 0x440B, 0x1,
+  0x813E, 0x1, 0x5AB5, 0x1, 0x267A7, 0x1, 0x267B5, 0x1, 0x23393, 0x1, 0x2339C, 0x1,
+  0x8204, 0x1, 0x8F9E, 0x1, 0x446B, 0x1, 0x8291, 0x1, 0x828B, 0x1, 0x829D, 0x1,
+  0x52B3, 0x1, 0x82B1, 0x1, 0x82B3, 0x1, 0x82BD, 0x1, 0x82E6, 0x1, 0x26B3C, 0x1,
+  0x831D, 0x1, 0x8363, 0x1, 0x83AD, 0x1, 0x8323, 0x1, 0x83BD, 0x1, 0x83E7, 0x1,
+  0x8353, 0x1, 0x83CA, 0x1, 0x83CC, 0x1, 0x83DC, 0x1, 0x26C36, 0x1, 0x26D6B, 0x1,
+  0x26CD5, 0x1, 0x452B, 0x1, 0x84F1, 0x1, 0x84F3, 0x1, 0x8516, 0x1, 0x273CA, 0x1,
+  0x8564, 0x1, 0x26F2C, 0x1, 0x455D, 0x1, 0x4561, 0x1, 0x26FB1, 0x1, 0x270D2, 0x1,
+  0x456B, 0x1, 0x8650, 0x1, 0x8667, 0x1, 0x8669, 0x1, 0x86A9, 0x1, 0x8688, 0x1,
+  0x870E, 0x1, 0x86E2, 0x1, 0x8728, 0x1, 0x876B, 0x1, 0x8786, 0x1, 0x45D7, 0x1,
+  0x87E1, 0x1, 0x8801, 0x1, 0x45F9, 0x1, 0x8860, 0x1, 0x27667, 0x1, 0x88D7, 0x1,
+  0x88DE, 0x1, 0x4635, 0x1, 0x88FA, 0x1, 0x34BB, 0x1, 0x278AE, 0x1, 0x27966, 0x1,
+  0x46BE, 0x1, 0x46C7, 0x1, 0x8AA0, 0x1, 0x27CA8, 0x1, 0x8CAB, 0x1, 0x8CC1, 0x1,
+  0x8D1B, 0x1, 0x8D77, 0x1, 0x27F2F, 0x1, 0x20804, 0x1, 0x8DCB, 0x1, 0x8DBC, 0x1,
+  0x8DF0, 0x1, 0x208DE, 0x1, 0x8ED4, 0x1, 0x285D2, 0x1, 0x285ED, 0x1, 0x9094, 0x1,
+  0x90F1, 0x1, 0x9111, 0x1, 0x2872E, 0x1, 0x911B, 0x1, 0x9238, 0x1, 0x92D7, 0x1,
+  0x92D8, 0x1, 0x927C, 0x1, 0x93F9, 0x1, 0x9415, 0x1, 0x28BFA, 0x1, 0x958B, 0x1,
+  0x4995, 0x1, 0x95B7, 0x1, 0x28D77, 0x1, 0x49E6, 0x1, 0x96C3, 0x1, 0x5DB2, 0x1,
+  0x9723, 0x1, 0x29145, 0x1, 0x2921A, 0x1, 0x4A6E, 0x1, 0x4A76, 0x1, 0x97E0, 0x1,
+  0x2940A, 0x1, 0x4AB2, 0x1, 0x29496, 0x1, 0x9829, 0x1, 0x295B6, 0x1, 0x98E2, 0x1,
+  0x4B33, 0x1, 0x9929, 0x1, 0x99A7, 0x1, 0x99C2, 0x1, 0x99FE, 0x1, 0x4BCE, 0x1,
+  0x29B30, 0x1, 0x9C40, 0x1, 0x9CFD, 0x1, 0x4CCE, 0x1, 0x4CED, 0x1, 0x9D67, 0x1,
+  0x2A0CE, 0x1, 0x4CF8, 0x1, 0x2A105, 0x1, 0x2A20E, 0x1, 0x2A291, 0x1, 0x4D56, 0x1,
+  0x9EFE, 0x1, 0x9F05, 0x1, 0x9F0F, 0x1, 0x9F16, 0x1, 0x2A600,
+};
+
+const Composition compositions[941] = {
+  { 0x3C, 0x338, 0x226E },
+  { 0x3D, 0x338, 0x2260 },
+  { 0x3E, 0x338, 0x226F },
+  { 0x41, 0x300, 0xC0 },
+  { 0x41, 0x301, 0xC1 },
+  { 0x41, 0x302, 0xC2 },
+  { 0x41, 0x303, 0xC3 },
+  { 0x41, 0x304, 0x100 },
+  { 0x41, 0x306, 0x102 },
+  { 0x41, 0x307, 0x226 },
+  { 0x41, 0x308, 0xC4 },
+  { 0x41, 0x309, 0x1EA2 },
+  { 0x41, 0x30A, 0xC5 },
+  { 0x41, 0x30C, 0x1CD },
+  { 0x41, 0x30F, 0x200 },
+  { 0x41, 0x311, 0x202 },
+  { 0x41, 0x323, 0x1EA0 },
+  { 0x41, 0x325, 0x1E00 },
+  { 0x41, 0x328, 0x104 },
+  { 0x42, 0x307, 0x1E02 },
+  { 0x42, 0x323, 0x1E04 },
+  { 0x42, 0x331, 0x1E06 },
+  { 0x43, 0x301, 0x106 },
+  { 0x43, 0x302, 0x108 },
+  { 0x43, 0x307, 0x10A },
+  { 0x43, 0x30C, 0x10C },
+  { 0x43, 0x327, 0xC7 },
+  { 0x44, 0x307, 0x1E0A },
+  { 0x44, 0x30C, 0x10E },
+  { 0x44, 0x323, 0x1E0C },
+  { 0x44, 0x327, 0x1E10 },
+  { 0x44, 0x32D, 0x1E12 },
+  { 0x44, 0x331, 0x1E0E },
+  { 0x45, 0x300, 0xC8 },
+  { 0x45, 0x301, 0xC9 },
+  { 0x45, 0x302, 0xCA },
+  { 0x45, 0x303, 0x1EBC },
+  { 0x45, 0x304, 0x112 },
+  { 0x45, 0x306, 0x114 },
+  { 0x45, 0x307, 0x116 },
+  { 0x45, 0x308, 0xCB },
+  { 0x45, 0x309, 0x1EBA },
+  { 0x45, 0x30C, 0x11A },
+  { 0x45, 0x30F, 0x204 },
+  { 0x45, 0x311, 0x206 },
+  { 0x45, 0x323, 0x1EB8 },
+  { 0x45, 0x327, 0x228 },
+  { 0x45, 0x328, 0x118 },
+  { 0x45, 0x32D, 0x1E18 },
+  { 0x45, 0x330, 0x1E1A },
+  { 0x46, 0x307, 0x1E1E },
+  { 0x47, 0x301, 0x1F4 },
+  { 0x47, 0x302, 0x11C },
+  { 0x47, 0x304, 0x1E20 },
+  { 0x47, 0x306, 0x11E },
+  { 0x47, 0x307, 0x120 },
+  { 0x47, 0x30C, 0x1E6 },
+  { 0x47, 0x327, 0x122 },
+  { 0x48, 0x302, 0x124 },
+  { 0x48, 0x307, 0x1E22 },
+  { 0x48, 0x308, 0x1E26 },
+  { 0x48, 0x30C, 0x21E },
+  { 0x48, 0x323, 0x1E24 },
+  { 0x48, 0x327, 0x1E28 },
+  { 0x48, 0x32E, 0x1E2A },
+  { 0x49, 0x300, 0xCC },
+  { 0x49, 0x301, 0xCD },
+  { 0x49, 0x302, 0xCE },
+  { 0x49, 0x303, 0x128 },
+  { 0x49, 0x304, 0x12A },
+  { 0x49, 0x306, 0x12C },
+  { 0x49, 0x307, 0x130 },
+  { 0x49, 0x308, 0xCF },
+  { 0x49, 0x309, 0x1EC8 },
+  { 0x49, 0x30C, 0x1CF },
+  { 0x49, 0x30F, 0x208 },
+  { 0x49, 0x311, 0x20A },
+  { 0x49, 0x323, 0x1ECA },
+  { 0x49, 0x328, 0x12E },
+  { 0x49, 0x330, 0x1E2C },
+  { 0x4A, 0x302, 0x134 },
+  { 0x4B, 0x301, 0x1E30 },
+  { 0x4B, 0x30C, 0x1E8 },
+  { 0x4B, 0x323, 0x1E32 },
+  { 0x4B, 0x327, 0x136 },
+  { 0x4B, 0x331, 0x1E34 },
+  { 0x4C, 0x301, 0x139 },
+  { 0x4C, 0x30C, 0x13D },
+  { 0x4C, 0x323, 0x1E36 },
+  { 0x4C, 0x327, 0x13B },
+  { 0x4C, 0x32D, 0x1E3C },
+  { 0x4C, 0x331, 0x1E3A },
+  { 0x4D, 0x301, 0x1E3E },
+  { 0x4D, 0x307, 0x1E40 },
+  { 0x4D, 0x323, 0x1E42 },
+  { 0x4E, 0x300, 0x1F8 },
+  { 0x4E, 0x301, 0x143 },
+  { 0x4E, 0x303, 0xD1 },
+  { 0x4E, 0x307, 0x1E44 },
+  { 0x4E, 0x30C, 0x147 },
+  { 0x4E, 0x323, 0x1E46 },
+  { 0x4E, 0x327, 0x145 },
+  { 0x4E, 0x32D, 0x1E4A },
+  { 0x4E, 0x331, 0x1E48 },
+  { 0x4F, 0x300, 0xD2 },
+  { 0x4F, 0x301, 0xD3 },
+  { 0x4F, 0x302, 0xD4 },
+  { 0x4F, 0x303, 0xD5 },
+  { 0x4F, 0x304, 0x14C },
+  { 0x4F, 0x306, 0x14E },
+  { 0x4F, 0x307, 0x22E },
+  { 0x4F, 0x308, 0xD6 },
+  { 0x4F, 0x309, 0x1ECE },
+  { 0x4F, 0x30B, 0x150 },
+  { 0x4F, 0x30C, 0x1D1 },
+  { 0x4F, 0x30F, 0x20C },
+  { 0x4F, 0x311, 0x20E },
+  { 0x4F, 0x31B, 0x1A0 },
+  { 0x4F, 0x323, 0x1ECC },
+  { 0x4F, 0x328, 0x1EA },
+  { 0x50, 0x301, 0x1E54 },
+  { 0x50, 0x307, 0x1E56 },
+  { 0x52, 0x301, 0x154 },
+  { 0x52, 0x307, 0x1E58 },
+  { 0x52, 0x30C, 0x158 },
+  { 0x52, 0x30F, 0x210 },
+  { 0x52, 0x311, 0x212 },
+  { 0x52, 0x323, 0x1E5A },
+  { 0x52, 0x327, 0x156 },
+  { 0x52, 0x331, 0x1E5E },
+  { 0x53, 0x301, 0x15A },
+  { 0x53, 0x302, 0x15C },
+  { 0x53, 0x307, 0x1E60 },
+  { 0x53, 0x30C, 0x160 },
+  { 0x53, 0x323, 0x1E62 },
+  { 0x53, 0x326, 0x218 },
+  { 0x53, 0x327, 0x15E },
+  { 0x54, 0x307, 0x1E6A },
+  { 0x54, 0x30C, 0x164 },
+  { 0x54, 0x323, 0x1E6C },
+  { 0x54, 0x326, 0x21A },
+  { 0x54, 0x327, 0x162 },
+  { 0x54, 0x32D, 0x1E70 },
+  { 0x54, 0x331, 0x1E6E },
+  { 0x55, 0x300, 0xD9 },
+  { 0x55, 0x301, 0xDA },
+  { 0x55, 0x302, 0xDB },
+  { 0x55, 0x303, 0x168 },
+  { 0x55, 0x304, 0x16A },
+  { 0x55, 0x306, 0x16C },
+  { 0x55, 0x308, 0xDC },
+  { 0x55, 0x309, 0x1EE6 },
+  { 0x55, 0x30A, 0x16E },
+  { 0x55, 0x30B, 0x170 },
+  { 0x55, 0x30C, 0x1D3 },
+  { 0x55, 0x30F, 0x214 },
+  { 0x55, 0x311, 0x216 },
+  { 0x55, 0x31B, 0x1AF },
+  { 0x55, 0x323, 0x1EE4 },
+  { 0x55, 0x324, 0x1E72 },
+  { 0x55, 0x328, 0x172 },
+  { 0x55, 0x32D, 0x1E76 },
+  { 0x55, 0x330, 0x1E74 },
+  { 0x56, 0x303, 0x1E7C },
+  { 0x56, 0x323, 0x1E7E },
+  { 0x57, 0x300, 0x1E80 },
+  { 0x57, 0x301, 0x1E82 },
+  { 0x57, 0x302, 0x174 },
+  { 0x57, 0x307, 0x1E86 },
+  { 0x57, 0x308, 0x1E84 },
+  { 0x57, 0x323, 0x1E88 },
+  { 0x58, 0x307, 0x1E8A },
+  { 0x58, 0x308, 0x1E8C },
+  { 0x59, 0x300, 0x1EF2 },
+  { 0x59, 0x301, 0xDD },
+  { 0x59, 0x302, 0x176 },
+  { 0x59, 0x303, 0x1EF8 },
+  { 0x59, 0x304, 0x232 },
+  { 0x59, 0x307, 0x1E8E },
+  { 0x59, 0x308, 0x178 },
+  { 0x59, 0x309, 0x1EF6 },
+  { 0x59, 0x323, 0x1EF4 },
+  { 0x5A, 0x301, 0x179 },
+  { 0x5A, 0x302, 0x1E90 },
+  { 0x5A, 0x307, 0x17B },
+  { 0x5A, 0x30C, 0x17D },
+  { 0x5A, 0x323, 0x1E92 },
+  { 0x5A, 0x331, 0x1E94 },
+  { 0x61, 0x300, 0xE0 },
+  { 0x61, 0x301, 0xE1 },
+  { 0x61, 0x302, 0xE2 },
+  { 0x61, 0x303, 0xE3 },
+  { 0x61, 0x304, 0x101 },
+  { 0x61, 0x306, 0x103 },
+  { 0x61, 0x307, 0x227 },
+  { 0x61, 0x308, 0xE4 },
+  { 0x61, 0x309, 0x1EA3 },
+  { 0x61, 0x30A, 0xE5 },
+  { 0x61, 0x30C, 0x1CE },
+  { 0x61, 0x30F, 0x201 },
+  { 0x61, 0x311, 0x203 },
+  { 0x61, 0x323, 0x1EA1 },
+  { 0x61, 0x325, 0x1E01 },
+  { 0x61, 0x328, 0x105 },
+  { 0x62, 0x307, 0x1E03 },
+  { 0x62, 0x323, 0x1E05 },
+  { 0x62, 0x331, 0x1E07 },
+  { 0x63, 0x301, 0x107 },
+  { 0x63, 0x302, 0x109 },
+  { 0x63, 0x307, 0x10B },
+  { 0x63, 0x30C, 0x10D },
+  { 0x63, 0x327, 0xE7 },
+  { 0x64, 0x307, 0x1E0B },
+  { 0x64, 0x30C, 0x10F },
+  { 0x64, 0x323, 0x1E0D },
+  { 0x64, 0x327, 0x1E11 },
+  { 0x64, 0x32D, 0x1E13 },
+  { 0x64, 0x331, 0x1E0F },
+  { 0x65, 0x300, 0xE8 },
+  { 0x65, 0x301, 0xE9 },
+  { 0x65, 0x302, 0xEA },
+  { 0x65, 0x303, 0x1EBD },
+  { 0x65, 0x304, 0x113 },
+  { 0x65, 0x306, 0x115 },
+  { 0x65, 0x307, 0x117 },
+  { 0x65, 0x308, 0xEB },
+  { 0x65, 0x309, 0x1EBB },
+  { 0x65, 0x30C, 0x11B },
+  { 0x65, 0x30F, 0x205 },
+  { 0x65, 0x311, 0x207 },
+  { 0x65, 0x323, 0x1EB9 },
+  { 0x65, 0x327, 0x229 },
+  { 0x65, 0x328, 0x119 },
+  { 0x65, 0x32D, 0x1E19 },
+  { 0x65, 0x330, 0x1E1B },
+  { 0x66, 0x307, 0x1E1F },
+  { 0x67, 0x301, 0x1F5 },
+  { 0x67, 0x302, 0x11D },
+  { 0x67, 0x304, 0x1E21 },
+  { 0x67, 0x306, 0x11F },
+  { 0x67, 0x307, 0x121 },
+  { 0x67, 0x30C, 0x1E7 },
+  { 0x67, 0x327, 0x123 },
+  { 0x68, 0x302, 0x125 },
+  { 0x68, 0x307, 0x1E23 },
+  { 0x68, 0x308, 0x1E27 },
+  { 0x68, 0x30C, 0x21F },
+  { 0x68, 0x323, 0x1E25 },
+  { 0x68, 0x327, 0x1E29 },
+  { 0x68, 0x32E, 0x1E2B },
+  { 0x68, 0x331, 0x1E96 },
+  { 0x69, 0x300, 0xEC },
+  { 0x69, 0x301, 0xED },
+  { 0x69, 0x302, 0xEE },
+  { 0x69, 0x303, 0x129 },
+  { 0x69, 0x304, 0x12B },
+  { 0x69, 0x306, 0x12D },
+  { 0x69, 0x308, 0xEF },
+  { 0x69, 0x309, 0x1EC9 },
+  { 0x69, 0x30C, 0x1D0 },
+  { 0x69, 0x30F, 0x209 },
+  { 0x69, 0x311, 0x20B },
+  { 0x69, 0x323, 0x1ECB },
+  { 0x69, 0x328, 0x12F },
+  { 0x69, 0x330, 0x1E2D },
+  { 0x6A, 0x302, 0x135 },
+  { 0x6A, 0x30C, 0x1F0 },
+  { 0x6B, 0x301, 0x1E31 },
+  { 0x6B, 0x30C, 0x1E9 },
+  { 0x6B, 0x323, 0x1E33 },
+  { 0x6B, 0x327, 0x137 },
+  { 0x6B, 0x331, 0x1E35 },
+  { 0x6C, 0x301, 0x13A },
+  { 0x6C, 0x30C, 0x13E },
+  { 0x6C, 0x323, 0x1E37 },
+  { 0x6C, 0x327, 0x13C },
+  { 0x6C, 0x32D, 0x1E3D },
+  { 0x6C, 0x331, 0x1E3B },
+  { 0x6D, 0x301, 0x1E3F },
+  { 0x6D, 0x307, 0x1E41 },
+  { 0x6D, 0x323, 0x1E43 },
+  { 0x6E, 0x300, 0x1F9 },
+  { 0x6E, 0x301, 0x144 },
+  { 0x6E, 0x303, 0xF1 },
+  { 0x6E, 0x307, 0x1E45 },
+  { 0x6E, 0x30C, 0x148 },
+  { 0x6E, 0x323, 0x1E47 },
+  { 0x6E, 0x327, 0x146 },
+  { 0x6E, 0x32D, 0x1E4B },
+  { 0x6E, 0x331, 0x1E49 },
+  { 0x6F, 0x300, 0xF2 },
+  { 0x6F, 0x301, 0xF3 },
+  { 0x6F, 0x302, 0xF4 },
+  { 0x6F, 0x303, 0xF5 },
+  { 0x6F, 0x304, 0x14D },
+  { 0x6F, 0x306, 0x14F },
+  { 0x6F, 0x307, 0x22F },
+  { 0x6F, 0x308, 0xF6 },
+  { 0x6F, 0x309, 0x1ECF },
+  { 0x6F, 0x30B, 0x151 },
+  { 0x6F, 0x30C, 0x1D2 },
+  { 0x6F, 0x30F, 0x20D },
+  { 0x6F, 0x311, 0x20F },
+  { 0x6F, 0x31B, 0x1A1 },
+  { 0x6F, 0x323, 0x1ECD },
+  { 0x6F, 0x328, 0x1EB },
+  { 0x70, 0x301, 0x1E55 },
+  { 0x70, 0x307, 0x1E57 },
+  { 0x72, 0x301, 0x155 },
+  { 0x72, 0x307, 0x1E59 },
+  { 0x72, 0x30C, 0x159 },
+  { 0x72, 0x30F, 0x211 },
+  { 0x72, 0x311, 0x213 },
+  { 0x72, 0x323, 0x1E5B },
+  { 0x72, 0x327, 0x157 },
+  { 0x72, 0x331, 0x1E5F },
+  { 0x73, 0x301, 0x15B },
+  { 0x73, 0x302, 0x15D },
+  { 0x73, 0x307, 0x1E61 },
+  { 0x73, 0x30C, 0x161 },
+  { 0x73, 0x323, 0x1E63 },
+  { 0x73, 0x326, 0x219 },
+  { 0x73, 0x327, 0x15F },
+  { 0x74, 0x307, 0x1E6B },
+  { 0x74, 0x308, 0x1E97 },
+  { 0x74, 0x30C, 0x165 },
+  { 0x74, 0x323, 0x1E6D },
+  { 0x74, 0x326, 0x21B },
+  { 0x74, 0x327, 0x163 },
+  { 0x74, 0x32D, 0x1E71 },
+  { 0x74, 0x331, 0x1E6F },
+  { 0x75, 0x300, 0xF9 },
+  { 0x75, 0x301, 0xFA },
+  { 0x75, 0x302, 0xFB },
+  { 0x75, 0x303, 0x169 },
+  { 0x75, 0x304, 0x16B },
+  { 0x75, 0x306, 0x16D },
+  { 0x75, 0x308, 0xFC },
+  { 0x75, 0x309, 0x1EE7 },
+  { 0x75, 0x30A, 0x16F },
+  { 0x75, 0x30B, 0x171 },
+  { 0x75, 0x30C, 0x1D4 },
+  { 0x75, 0x30F, 0x215 },
+  { 0x75, 0x311, 0x217 },
+  { 0x75, 0x31B, 0x1B0 },
+  { 0x75, 0x323, 0x1EE5 },
+  { 0x75, 0x324, 0x1E73 },
+  { 0x75, 0x328, 0x173 },
+  { 0x75, 0x32D, 0x1E77 },
+  { 0x75, 0x330, 0x1E75 },
+  { 0x76, 0x303, 0x1E7D },
+  { 0x76, 0x323, 0x1E7F },
+  { 0x77, 0x300, 0x1E81 },
+  { 0x77, 0x301, 0x1E83 },
+  { 0x77, 0x302, 0x175 },
+  { 0x77, 0x307, 0x1E87 },
+  { 0x77, 0x308, 0x1E85 },
+  { 0x77, 0x30A, 0x1E98 },
+  { 0x77, 0x323, 0x1E89 },
+  { 0x78, 0x307, 0x1E8B },
+  { 0x78, 0x308, 0x1E8D },
+  { 0x79, 0x300, 0x1EF3 },
+  { 0x79, 0x301, 0xFD },
+  { 0x79, 0x302, 0x177 },
+  { 0x79, 0x303, 0x1EF9 },
+  { 0x79, 0x304, 0x233 },
+  { 0x79, 0x307, 0x1E8F },
+  { 0x79, 0x308, 0xFF },
+  { 0x79, 0x309, 0x1EF7 },
+  { 0x79, 0x30A, 0x1E99 },
+  { 0x79, 0x323, 0x1EF5 },
+  { 0x7A, 0x301, 0x17A },
+  { 0x7A, 0x302, 0x1E91 },
+  { 0x7A, 0x307, 0x17C },
+  { 0x7A, 0x30C, 0x17E },
+  { 0x7A, 0x323, 0x1E93 },
+  { 0x7A, 0x331, 0x1E95 },
+  { 0xA8, 0x300, 0x1FED },
+  { 0xA8, 0x301, 0x385 },
+  { 0xA8, 0x342, 0x1FC1 },
+  { 0xC2, 0x300, 0x1EA6 },
+  { 0xC2, 0x301, 0x1EA4 },
+  { 0xC2, 0x303, 0x1EAA },
+  { 0xC2, 0x309, 0x1EA8 },
+  { 0xC4, 0x304, 0x1DE },
+  { 0xC5, 0x301, 0x1FA },
+  { 0xC6, 0x301, 0x1FC },
+  { 0xC6, 0x304, 0x1E2 },
+  { 0xC7, 0x301, 0x1E08 },
+  { 0xCA, 0x300, 0x1EC0 },
+  { 0xCA, 0x301, 0x1EBE },
+  { 0xCA, 0x303, 0x1EC4 },
+  { 0xCA, 0x309, 0x1EC2 },
+  { 0xCF, 0x301, 0x1E2E },
+  { 0xD4, 0x300, 0x1ED2 },
+  { 0xD4, 0x301, 0x1ED0 },
+  { 0xD4, 0x303, 0x1ED6 },
+  { 0xD4, 0x309, 0x1ED4 },
+  { 0xD5, 0x301, 0x1E4C },
+  { 0xD5, 0x304, 0x22C },
+  { 0xD5, 0x308, 0x1E4E },
+  { 0xD6, 0x304, 0x22A },
+  { 0xD8, 0x301, 0x1FE },
+  { 0xDC, 0x300, 0x1DB },
+  { 0xDC, 0x301, 0x1D7 },
+  { 0xDC, 0x304, 0x1D5 },
+  { 0xDC, 0x30C, 0x1D9 },
+  { 0xE2, 0x300, 0x1EA7 },
+  { 0xE2, 0x301, 0x1EA5 },
+  { 0xE2, 0x303, 0x1EAB },
+  { 0xE2, 0x309, 0x1EA9 },
+  { 0xE4, 0x304, 0x1DF },
+  { 0xE5, 0x301, 0x1FB },
+  { 0xE6, 0x301, 0x1FD },
+  { 0xE6, 0x304, 0x1E3 },
+  { 0xE7, 0x301, 0x1E09 },
+  { 0xEA, 0x300, 0x1EC1 },
+  { 0xEA, 0x301, 0x1EBF },
+  { 0xEA, 0x303, 0x1EC5 },
+  { 0xEA, 0x309, 0x1EC3 },
+  { 0xEF, 0x301, 0x1E2F },
+  { 0xF4, 0x300, 0x1ED3 },
+  { 0xF4, 0x301, 0x1ED1 },
+  { 0xF4, 0x303, 0x1ED7 },
+  { 0xF4, 0x309, 0x1ED5 },
+  { 0xF5, 0x301, 0x1E4D },
+  { 0xF5, 0x304, 0x22D },
+  { 0xF5, 0x308, 0x1E4F },
+  { 0xF6, 0x304, 0x22B },
+  { 0xF8, 0x301, 0x1FF },
+  { 0xFC, 0x300, 0x1DC },
+  { 0xFC, 0x301, 0x1D8 },
+  { 0xFC, 0x304, 0x1D6 },
+  { 0xFC, 0x30C, 0x1DA },
+  { 0x102, 0x300, 0x1EB0 },
+  { 0x102, 0x301, 0x1EAE },
+  { 0x102, 0x303, 0x1EB4 },
+  { 0x102, 0x309, 0x1EB2 },
+  { 0x103, 0x300, 0x1EB1 },
+  { 0x103, 0x301, 0x1EAF },
+  { 0x103, 0x303, 0x1EB5 },
+  { 0x103, 0x309, 0x1EB3 },
+  { 0x112, 0x300, 0x1E14 },
+  { 0x112, 0x301, 0x1E16 },
+  { 0x113, 0x300, 0x1E15 },
+  { 0x113, 0x301, 0x1E17 },
+  { 0x14C, 0x300, 0x1E50 },
+  { 0x14C, 0x301, 0x1E52 },
+  { 0x14D, 0x300, 0x1E51 },
+  { 0x14D, 0x301, 0x1E53 },
+  { 0x15A, 0x307, 0x1E64 },
+  { 0x15B, 0x307, 0x1E65 },
+  { 0x160, 0x307, 0x1E66 },
+  { 0x161, 0x307, 0x1E67 },
+  { 0x168, 0x301, 0x1E78 },
+  { 0x169, 0x301, 0x1E79 },
+  { 0x16A, 0x308, 0x1E7A },
+  { 0x16B, 0x308, 0x1E7B },
+  { 0x17F, 0x307, 0x1E9B },
+  { 0x1A0, 0x300, 0x1EDC },
+  { 0x1A0, 0x301, 0x1EDA },
+  { 0x1A0, 0x303, 0x1EE0 },
+  { 0x1A0, 0x309, 0x1EDE },
+  { 0x1A0, 0x323, 0x1EE2 },
+  { 0x1A1, 0x300, 0x1EDD },
+  { 0x1A1, 0x301, 0x1EDB },
+  { 0x1A1, 0x303, 0x1EE1 },
+  { 0x1A1, 0x309, 0x1EDF },
+  { 0x1A1, 0x323, 0x1EE3 },
+  { 0x1AF, 0x300, 0x1EEA },
+  { 0x1AF, 0x301, 0x1EE8 },
+  { 0x1AF, 0x303, 0x1EEE },
+  { 0x1AF, 0x309, 0x1EEC },
+  { 0x1AF, 0x323, 0x1EF0 },
+  { 0x1B0, 0x300, 0x1EEB },
+  { 0x1B0, 0x301, 0x1EE9 },
+  { 0x1B0, 0x303, 0x1EEF },
+  { 0x1B0, 0x309, 0x1EED },
+  { 0x1B0, 0x323, 0x1EF1 },
+  { 0x1B7, 0x30C, 0x1EE },
+  { 0x1EA, 0x304, 0x1EC },
+  { 0x1EB, 0x304, 0x1ED },
+  { 0x226, 0x304, 0x1E0 },
+  { 0x227, 0x304, 0x1E1 },
+  { 0x228, 0x306, 0x1E1C },
+  { 0x229, 0x306, 0x1E1D },
+  { 0x22E, 0x304, 0x230 },
+  { 0x22F, 0x304, 0x231 },
+  { 0x292, 0x30C, 0x1EF },
+  { 0x391, 0x300, 0x1FBA },
+  { 0x391, 0x301, 0x386 },
+  { 0x391, 0x304, 0x1FB9 },
+  { 0x391, 0x306, 0x1FB8 },
+  { 0x391, 0x313, 0x1F08 },
+  { 0x391, 0x314, 0x1F09 },
+  { 0x391, 0x345, 0x1FBC },
+  { 0x395, 0x300, 0x1FC8 },
+  { 0x395, 0x301, 0x388 },
+  { 0x395, 0x313, 0x1F18 },
+  { 0x395, 0x314, 0x1F19 },
+  { 0x397, 0x300, 0x1FCA },
+  { 0x397, 0x301, 0x389 },
+  { 0x397, 0x313, 0x1F28 },
+  { 0x397, 0x314, 0x1F29 },
+  { 0x397, 0x345, 0x1FCC },
+  { 0x399, 0x300, 0x1FDA },
+  { 0x399, 0x301, 0x38A },
+  { 0x399, 0x304, 0x1FD9 },
+  { 0x399, 0x306, 0x1FD8 },
+  { 0x399, 0x308, 0x3AA },
+  { 0x399, 0x313, 0x1F38 },
+  { 0x399, 0x314, 0x1F39 },
+  { 0x39F, 0x300, 0x1FF8 },
+  { 0x39F, 0x301, 0x38C },
+  { 0x39F, 0x313, 0x1F48 },
+  { 0x39F, 0x314, 0x1F49 },
+  { 0x3A1, 0x314, 0x1FEC },
+  { 0x3A5, 0x300, 0x1FEA },
+  { 0x3A5, 0x301, 0x38E },
+  { 0x3A5, 0x304, 0x1FE9 },
+  { 0x3A5, 0x306, 0x1FE8 },
+  { 0x3A5, 0x308, 0x3AB },
+  { 0x3A5, 0x314, 0x1F59 },
+  { 0x3A9, 0x300, 0x1FFA },
+  { 0x3A9, 0x301, 0x38F },
+  { 0x3A9, 0x313, 0x1F68 },
+  { 0x3A9, 0x314, 0x1F69 },
+  { 0x3A9, 0x345, 0x1FFC },
+  { 0x3AC, 0x345, 0x1FB4 },
+  { 0x3AE, 0x345, 0x1FC4 },
+  { 0x3B1, 0x300, 0x1F70 },
+  { 0x3B1, 0x301, 0x3AC },
+  { 0x3B1, 0x304, 0x1FB1 },
+  { 0x3B1, 0x306, 0x1FB0 },
+  { 0x3B1, 0x313, 0x1F00 },
+  { 0x3B1, 0x314, 0x1F01 },
+  { 0x3B1, 0x342, 0x1FB6 },
+  { 0x3B1, 0x345, 0x1FB3 },
+  { 0x3B5, 0x300, 0x1F72 },
+  { 0x3B5, 0x301, 0x3AD },
+  { 0x3B5, 0x313, 0x1F10 },
+  { 0x3B5, 0x314, 0x1F11 },
+  { 0x3B7, 0x300, 0x1F74 },
+  { 0x3B7, 0x301, 0x3AE },
+  { 0x3B7, 0x313, 0x1F20 },
+  { 0x3B7, 0x314, 0x1F21 },
+  { 0x3B7, 0x342, 0x1FC6 },
+  { 0x3B7, 0x345, 0x1FC3 },
+  { 0x3B9, 0x300, 0x1F76 },
+  { 0x3B9, 0x301, 0x3AF },
+  { 0x3B9, 0x304, 0x1FD1 },
+  { 0x3B9, 0x306, 0x1FD0 },
+  { 0x3B9, 0x308, 0x3CA },
+  { 0x3B9, 0x313, 0x1F30 },
+  { 0x3B9, 0x314, 0x1F31 },
+  { 0x3B9, 0x342, 0x1FD6 },
+  { 0x3BF, 0x300, 0x1F78 },
+  { 0x3BF, 0x301, 0x3CC },
+  { 0x3BF, 0x313, 0x1F40 },
+  { 0x3BF, 0x314, 0x1F41 },
+  { 0x3C1, 0x313, 0x1FE4 },
+  { 0x3C1, 0x314, 0x1FE5 },
+  { 0x3C5, 0x300, 0x1F7A },
+  { 0x3C5, 0x301, 0x3CD },
+  { 0x3C5, 0x304, 0x1FE1 },
+  { 0x3C5, 0x306, 0x1FE0 },
+  { 0x3C5, 0x308, 0x3CB },
+  { 0x3C5, 0x313, 0x1F50 },
+  { 0x3C5, 0x314, 0x1F51 },
+  { 0x3C5, 0x342, 0x1FE6 },
+  { 0x3C9, 0x300, 0x1F7C },
+  { 0x3C9, 0x301, 0x3CE },
+  { 0x3C9, 0x313, 0x1F60 },
+  { 0x3C9, 0x314, 0x1F61 },
+  { 0x3C9, 0x342, 0x1FF6 },
+  { 0x3C9, 0x345, 0x1FF3 },
+  { 0x3CA, 0x300, 0x1FD2 },
+  { 0x3CA, 0x301, 0x390 },
+  { 0x3CA, 0x342, 0x1FD7 },
+  { 0x3CB, 0x300, 0x1FE2 },
+  { 0x3CB, 0x301, 0x3B0 },
+  { 0x3CB, 0x342, 0x1FE7 },
+  { 0x3CE, 0x345, 0x1FF4 },
+  { 0x3D2, 0x301, 0x3D3 },
+  { 0x3D2, 0x308, 0x3D4 },
+  { 0x406, 0x308, 0x407 },
+  { 0x410, 0x306, 0x4D0 },
+  { 0x410, 0x308, 0x4D2 },
+  { 0x413, 0x301, 0x403 },
+  { 0x415, 0x300, 0x400 },
+  { 0x415, 0x306, 0x4D6 },
+  { 0x415, 0x308, 0x401 },
+  { 0x416, 0x306, 0x4C1 },
+  { 0x416, 0x308, 0x4DC },
+  { 0x417, 0x308, 0x4DE },
+  { 0x418, 0x300, 0x40D },
+  { 0x418, 0x304, 0x4E2 },
+  { 0x418, 0x306, 0x419 },
+  { 0x418, 0x308, 0x4E4 },
+  { 0x41A, 0x301, 0x40C },
+  { 0x41E, 0x308, 0x4E6 },
+  { 0x423, 0x304, 0x4EE },
+  { 0x423, 0x306, 0x40E },
+  { 0x423, 0x308, 0x4F0 },
+  { 0x423, 0x30B, 0x4F2 },
+  { 0x427, 0x308, 0x4F4 },
+  { 0x42B, 0x308, 0x4F8 },
+  { 0x42D, 0x308, 0x4EC },
+  { 0x430, 0x306, 0x4D1 },
+  { 0x430, 0x308, 0x4D3 },
+  { 0x433, 0x301, 0x453 },
+  { 0x435, 0x300, 0x450 },
+  { 0x435, 0x306, 0x4D7 },
+  { 0x435, 0x308, 0x451 },
+  { 0x436, 0x306, 0x4C2 },
+  { 0x436, 0x308, 0x4DD },
+  { 0x437, 0x308, 0x4DF },
+  { 0x438, 0x300, 0x45D },
+  { 0x438, 0x304, 0x4E3 },
+  { 0x438, 0x306, 0x439 },
+  { 0x438, 0x308, 0x4E5 },
+  { 0x43A, 0x301, 0x45C },
+  { 0x43E, 0x308, 0x4E7 },
+  { 0x443, 0x304, 0x4EF },
+  { 0x443, 0x306, 0x45E },
+  { 0x443, 0x308, 0x4F1 },
+  { 0x443, 0x30B, 0x4F3 },
+  { 0x447, 0x308, 0x4F5 },
+  { 0x44B, 0x308, 0x4F9 },
+  { 0x44D, 0x308, 0x4ED },
+  { 0x456, 0x308, 0x457 },
+  { 0x474, 0x30F, 0x476 },
+  { 0x475, 0x30F, 0x477 },
+  { 0x4D8, 0x308, 0x4DA },
+  { 0x4D9, 0x308, 0x4DB },
+  { 0x4E8, 0x308, 0x4EA },
+  { 0x4E9, 0x308, 0x4EB },
+  { 0x627, 0x653, 0x622 },
+  { 0x627, 0x654, 0x623 },
+  { 0x627, 0x655, 0x625 },
+  { 0x648, 0x654, 0x624 },
+  { 0x64A, 0x654, 0x626 },
+  { 0x6C1, 0x654, 0x6C2 },
+  { 0x6D2, 0x654, 0x6D3 },
+  { 0x6D5, 0x654, 0x6C0 },
+  { 0x928, 0x93C, 0x929 },
+  { 0x930, 0x93C, 0x931 },
+  { 0x933, 0x93C, 0x934 },
+  { 0x9C7, 0x9BE, 0x9CB },
+  { 0x9C7, 0x9D7, 0x9CC },
+  { 0xB47, 0xB3E, 0xB4B },
+  { 0xB47, 0xB56, 0xB48 },
+  { 0xB47, 0xB57, 0xB4C },
+  { 0xB92, 0xBD7, 0xB94 },
+  { 0xBC6, 0xBBE, 0xBCA },
+  { 0xBC6, 0xBD7, 0xBCC },
+  { 0xBC7, 0xBBE, 0xBCB },
+  { 0xC46, 0xC56, 0xC48 },
+  { 0xCBF, 0xCD5, 0xCC0 },
+  { 0xCC6, 0xCC2, 0xCCA },
+  { 0xCC6, 0xCD5, 0xCC7 },
+  { 0xCC6, 0xCD6, 0xCC8 },
+  { 0xCCA, 0xCD5, 0xCCB },
+  { 0xD46, 0xD3E, 0xD4A },
+  { 0xD46, 0xD57, 0xD4C },
+  { 0xD47, 0xD3E, 0xD4B },
+  { 0xDD9, 0xDCA, 0xDDA },
+  { 0xDD9, 0xDCF, 0xDDC },
+  { 0xDD9, 0xDDF, 0xDDE },
+  { 0xDDC, 0xDCA, 0xDDD },
+  { 0x1025, 0x102E, 0x1026 },
+  { 0x1B05, 0x1B35, 0x1B06 },
+  { 0x1B07, 0x1B35, 0x1B08 },
+  { 0x1B09, 0x1B35, 0x1B0A },
+  { 0x1B0B, 0x1B35, 0x1B0C },
+  { 0x1B0D, 0x1B35, 0x1B0E },
+  { 0x1B11, 0x1B35, 0x1B12 },
+  { 0x1B3A, 0x1B35, 0x1B3B },
+  { 0x1B3C, 0x1B35, 0x1B3D },
+  { 0x1B3E, 0x1B35, 0x1B40 },
+  { 0x1B3F, 0x1B35, 0x1B41 },
+  { 0x1B42, 0x1B35, 0x1B43 },
+  { 0x1E36, 0x304, 0x1E38 },
+  { 0x1E37, 0x304, 0x1E39 },
+  { 0x1E5A, 0x304, 0x1E5C },
+  { 0x1E5B, 0x304, 0x1E5D },
+  { 0x1E62, 0x307, 0x1E68 },
+  { 0x1E63, 0x307, 0x1E69 },
+  { 0x1EA0, 0x302, 0x1EAC },
+  { 0x1EA0, 0x306, 0x1EB6 },
+  { 0x1EA1, 0x302, 0x1EAD },
+  { 0x1EA1, 0x306, 0x1EB7 },
+  { 0x1EB8, 0x302, 0x1EC6 },
+  { 0x1EB9, 0x302, 0x1EC7 },
+  { 0x1ECC, 0x302, 0x1ED8 },
+  { 0x1ECD, 0x302, 0x1ED9 },
+  { 0x1F00, 0x300, 0x1F02 },
+  { 0x1F00, 0x301, 0x1F04 },
+  { 0x1F00, 0x342, 0x1F06 },
+  { 0x1F00, 0x345, 0x1F80 },
+  { 0x1F01, 0x300, 0x1F03 },
+  { 0x1F01, 0x301, 0x1F05 },
+  { 0x1F01, 0x342, 0x1F07 },
+  { 0x1F01, 0x345, 0x1F81 },
+  { 0x1F02, 0x345, 0x1F82 },
+  { 0x1F03, 0x345, 0x1F83 },
+  { 0x1F04, 0x345, 0x1F84 },
+  { 0x1F05, 0x345, 0x1F85 },
+  { 0x1F06, 0x345, 0x1F86 },
+  { 0x1F07, 0x345, 0x1F87 },
+  { 0x1F08, 0x300, 0x1F0A },
+  { 0x1F08, 0x301, 0x1F0C },
+  { 0x1F08, 0x342, 0x1F0E },
+  { 0x1F08, 0x345, 0x1F88 },
+  { 0x1F09, 0x300, 0x1F0B },
+  { 0x1F09, 0x301, 0x1F0D },
+  { 0x1F09, 0x342, 0x1F0F },
+  { 0x1F09, 0x345, 0x1F89 },
+  { 0x1F0A, 0x345, 0x1F8A },
+  { 0x1F0B, 0x345, 0x1F8B },
+  { 0x1F0C, 0x345, 0x1F8C },
+  { 0x1F0D, 0x345, 0x1F8D },
+  { 0x1F0E, 0x345, 0x1F8E },
+  { 0x1F0F, 0x345, 0x1F8F },
+  { 0x1F10, 0x300, 0x1F12 },
+  { 0x1F10, 0x301, 0x1F14 },
+  { 0x1F11, 0x300, 0x1F13 },
+  { 0x1F11, 0x301, 0x1F15 },
+  { 0x1F18, 0x300, 0x1F1A },
+  { 0x1F18, 0x301, 0x1F1C },
+  { 0x1F19, 0x300, 0x1F1B },
+  { 0x1F19, 0x301, 0x1F1D },
+  { 0x1F20, 0x300, 0x1F22 },
+  { 0x1F20, 0x301, 0x1F24 },
+  { 0x1F20, 0x342, 0x1F26 },
+  { 0x1F20, 0x345, 0x1F90 },
+  { 0x1F21, 0x300, 0x1F23 },
+  { 0x1F21, 0x301, 0x1F25 },
+  { 0x1F21, 0x342, 0x1F27 },
+  { 0x1F21, 0x345, 0x1F91 },
+  { 0x1F22, 0x345, 0x1F92 },
+  { 0x1F23, 0x345, 0x1F93 },
+  { 0x1F24, 0x345, 0x1F94 },
+  { 0x1F25, 0x345, 0x1F95 },
+  { 0x1F26, 0x345, 0x1F96 },
+  { 0x1F27, 0x345, 0x1F97 },
+  { 0x1F28, 0x300, 0x1F2A },
+  { 0x1F28, 0x301, 0x1F2C },
+  { 0x1F28, 0x342, 0x1F2E },
+  { 0x1F28, 0x345, 0x1F98 },
+  { 0x1F29, 0x300, 0x1F2B },
+  { 0x1F29, 0x301, 0x1F2D },
+  { 0x1F29, 0x342, 0x1F2F },
+  { 0x1F29, 0x345, 0x1F99 },
+  { 0x1F2A, 0x345, 0x1F9A },
+  { 0x1F2B, 0x345, 0x1F9B },
+  { 0x1F2C, 0x345, 0x1F9C },
+  { 0x1F2D, 0x345, 0x1F9D },
+  { 0x1F2E, 0x345, 0x1F9E },
+  { 0x1F2F, 0x345, 0x1F9F },
+  { 0x1F30, 0x300, 0x1F32 },
+  { 0x1F30, 0x301, 0x1F34 },
+  { 0x1F30, 0x342, 0x1F36 },
+  { 0x1F31, 0x300, 0x1F33 },
+  { 0x1F31, 0x301, 0x1F35 },
+  { 0x1F31, 0x342, 0x1F37 },
+  { 0x1F38, 0x300, 0x1F3A },
+  { 0x1F38, 0x301, 0x1F3C },
+  { 0x1F38, 0x342, 0x1F3E },
+  { 0x1F39, 0x300, 0x1F3B },
+  { 0x1F39, 0x301, 0x1F3D },
+  { 0x1F39, 0x342, 0x1F3F },
+  { 0x1F40, 0x300, 0x1F42 },
+  { 0x1F40, 0x301, 0x1F44 },
+  { 0x1F41, 0x300, 0x1F43 },
+  { 0x1F41, 0x301, 0x1F45 },
+  { 0x1F48, 0x300, 0x1F4A },
+  { 0x1F48, 0x301, 0x1F4C },
+  { 0x1F49, 0x300, 0x1F4B },
+  { 0x1F49, 0x301, 0x1F4D },
+  { 0x1F50, 0x300, 0x1F52 },
+  { 0x1F50, 0x301, 0x1F54 },
+  { 0x1F50, 0x342, 0x1F56 },
+  { 0x1F51, 0x300, 0x1F53 },
+  { 0x1F51, 0x301, 0x1F55 },
+  { 0x1F51, 0x342, 0x1F57 },
+  { 0x1F59, 0x300, 0x1F5B },
+  { 0x1F59, 0x301, 0x1F5D },
+  { 0x1F59, 0x342, 0x1F5F },
+  { 0x1F60, 0x300, 0x1F62 },
+  { 0x1F60, 0x301, 0x1F64 },
+  { 0x1F60, 0x342, 0x1F66 },
+  { 0x1F60, 0x345, 0x1FA0 },
+  { 0x1F61, 0x300, 0x1F63 },
+  { 0x1F61, 0x301, 0x1F65 },
+  { 0x1F61, 0x342, 0x1F67 },
+  { 0x1F61, 0x345, 0x1FA1 },
+  { 0x1F62, 0x345, 0x1FA2 },
+  { 0x1F63, 0x345, 0x1FA3 },
+  { 0x1F64, 0x345, 0x1FA4 },
+  { 0x1F65, 0x345, 0x1FA5 },
+  { 0x1F66, 0x345, 0x1FA6 },
+  { 0x1F67, 0x345, 0x1FA7 },
+  { 0x1F68, 0x300, 0x1F6A },
+  { 0x1F68, 0x301, 0x1F6C },
+  { 0x1F68, 0x342, 0x1F6E },
+  { 0x1F68, 0x345, 0x1FA8 },
+  { 0x1F69, 0x300, 0x1F6B },
+  { 0x1F69, 0x301, 0x1F6D },
+  { 0x1F69, 0x342, 0x1F6F },
+  { 0x1F69, 0x345, 0x1FA9 },
+  { 0x1F6A, 0x345, 0x1FAA },
+  { 0x1F6B, 0x345, 0x1FAB },
+  { 0x1F6C, 0x345, 0x1FAC },
+  { 0x1F6D, 0x345, 0x1FAD },
+  { 0x1F6E, 0x345, 0x1FAE },
+  { 0x1F6F, 0x345, 0x1FAF },
+  { 0x1F70, 0x345, 0x1FB2 },
+  { 0x1F74, 0x345, 0x1FC2 },
+  { 0x1F7C, 0x345, 0x1FF2 },
+  { 0x1FB6, 0x345, 0x1FB7 },
+  { 0x1FBF, 0x300, 0x1FCD },
+  { 0x1FBF, 0x301, 0x1FCE },
+  { 0x1FBF, 0x342, 0x1FCF },
+  { 0x1FC6, 0x345, 0x1FC7 },
+  { 0x1FF6, 0x345, 0x1FF7 },
+  { 0x1FFE, 0x300, 0x1FDD },
+  { 0x1FFE, 0x301, 0x1FDE },
+  { 0x1FFE, 0x342, 0x1FDF },
+  { 0x2190, 0x338, 0x219A },
+  { 0x2192, 0x338, 0x219B },
+  { 0x2194, 0x338, 0x21AE },
+  { 0x21D0, 0x338, 0x21CD },
+  { 0x21D2, 0x338, 0x21CF },
+  { 0x21D4, 0x338, 0x21CE },
+  { 0x2203, 0x338, 0x2204 },
+  { 0x2208, 0x338, 0x2209 },
+  { 0x220B, 0x338, 0x220C },
+  { 0x2223, 0x338, 0x2224 },
+  { 0x2225, 0x338, 0x2226 },
+  { 0x223C, 0x338, 0x2241 },
+  { 0x2243, 0x338, 0x2244 },
+  { 0x2245, 0x338, 0x2247 },
+  { 0x2248, 0x338, 0x2249 },
+  { 0x224D, 0x338, 0x226D },
+  { 0x2261, 0x338, 0x2262 },
+  { 0x2264, 0x338, 0x2270 },
+  { 0x2265, 0x338, 0x2271 },
+  { 0x2272, 0x338, 0x2274 },
+  { 0x2273, 0x338, 0x2275 },
+  { 0x2276, 0x338, 0x2278 },
+  { 0x2277, 0x338, 0x2279 },
+  { 0x227A, 0x338, 0x2280 },
+  { 0x227B, 0x338, 0x2281 },
+  { 0x227C, 0x338, 0x22E0 },
+  { 0x227D, 0x338, 0x22E1 },
+  { 0x2282, 0x338, 0x2284 },
+  { 0x2283, 0x338, 0x2285 },
+  { 0x2286, 0x338, 0x2288 },
+  { 0x2287, 0x338, 0x2289 },
+  { 0x2291, 0x338, 0x22E2 },
+  { 0x2292, 0x338, 0x22E3 },
+  { 0x22A2, 0x338, 0x22AC },
+  { 0x22A8, 0x338, 0x22AD },
+  { 0x22A9, 0x338, 0x22AE },
+  { 0x22AB, 0x338, 0x22AF },
+  { 0x22B2, 0x338, 0x22EA },
+  { 0x22B3, 0x338, 0x22EB },
+  { 0x22B4, 0x338, 0x22EC },
+  { 0x22B5, 0x338, 0x22ED },
+  { 0x3046, 0x3099, 0x3094 },
+  { 0x304B, 0x3099, 0x304C },
+  { 0x304D, 0x3099, 0x304E },
+  { 0x304F, 0x3099, 0x3050 },
+  { 0x3051, 0x3099, 0x3052 },
+  { 0x3053, 0x3099, 0x3054 },
+  { 0x3055, 0x3099, 0x3056 },
+  { 0x3057, 0x3099, 0x3058 },
+  { 0x3059, 0x3099, 0x305A },
+  { 0x305B, 0x3099, 0x305C },
+  { 0x305D, 0x3099, 0x305E },
+  { 0x305F, 0x3099, 0x3060 },
+  { 0x3061, 0x3099, 0x3062 },
+  { 0x3064, 0x3099, 0x3065 },
+  { 0x3066, 0x3099, 0x3067 },
+  { 0x3068, 0x3099, 0x3069 },
+  { 0x306F, 0x3099, 0x3070 },
+  { 0x306F, 0x309A, 0x3071 },
+  { 0x3072, 0x3099, 0x3073 },
+  { 0x3072, 0x309A, 0x3074 },
+  { 0x3075, 0x3099, 0x3076 },
+  { 0x3075, 0x309A, 0x3077 },
+  { 0x3078, 0x3099, 0x3079 },
+  { 0x3078, 0x309A, 0x307A },
+  { 0x307B, 0x3099, 0x307C },
+  { 0x307B, 0x309A, 0x307D },
+  { 0x309D, 0x3099, 0x309E },
+  { 0x30A6, 0x3099, 0x30F4 },
+  { 0x30AB, 0x3099, 0x30AC },
+  { 0x30AD, 0x3099, 0x30AE },
+  { 0x30AF, 0x3099, 0x30B0 },
+  { 0x30B1, 0x3099, 0x30B2 },
+  { 0x30B3, 0x3099, 0x30B4 },
+  { 0x30B5, 0x3099, 0x30B6 },
+  { 0x30B7, 0x3099, 0x30B8 },
+  { 0x30B9, 0x3099, 0x30BA },
+  { 0x30BB, 0x3099, 0x30BC },
+  { 0x30BD, 0x3099, 0x30BE },
+  { 0x30BF, 0x3099, 0x30C0 },
+  { 0x30C1, 0x3099, 0x30C2 },
+  { 0x30C4, 0x3099, 0x30C5 },
+  { 0x30C6, 0x3099, 0x30C7 },
+  { 0x30C8, 0x3099, 0x30C9 },
+  { 0x30CF, 0x3099, 0x30D0 },
+  { 0x30CF, 0x309A, 0x30D1 },
+  { 0x30D2, 0x3099, 0x30D3 },
+  { 0x30D2, 0x309A, 0x30D4 },
+  { 0x30D5, 0x3099, 0x30D6 },
+  { 0x30D5, 0x309A, 0x30D7 },
+  { 0x30D8, 0x3099, 0x30D9 },
+  { 0x30D8, 0x309A, 0x30DA },
+  { 0x30DB, 0x3099, 0x30DC },
+  { 0x30DB, 0x309A, 0x30DD },
+  { 0x30EF, 0x3099, 0x30F7 },
+  { 0x30F0, 0x3099, 0x30F8 },
+  { 0x30F1, 0x3099, 0x30F9 },
+  { 0x30F2, 0x3099, 0x30FA },
+  { 0x30FD, 0x3099, 0x30FE },
+  { 0x11099, 0x110BA, 0x1109A },
+  { 0x1109B, 0x110BA, 0x1109C },
+  { 0x110A5, 0x110BA, 0x110AB },
+  { 0x11131, 0x11127, 0x1112E },
+  { 0x11132, 0x11127, 0x1112F },
+  { 0x11347, 0x1133E, 0x1134B },
+  { 0x11347, 0x11357, 0x1134C },
+  { 0x114B9, 0x114B0, 0x114BC },
+  { 0x114B9, 0x114BA, 0x114BB },
+  { 0x114B9, 0x114BD, 0x114BE },
+  { 0x115B8, 0x115AF, 0x115BA },
+  { 0x115B9, 0x115AF, 0x115BB },
+  { 0x11935, 0x11930, 0x11938 },
+};
+
+const CaseRecord& caseRecord(uint32_t cp) noexcept {
+  if (cp >= CASE_LIMIT) return caseRecords[0];
+  return caseRecords[caseStage2[((size_t)caseStage1[cp >> 7] << 7) | (cp & 127)]];
+}
+
+const uint32_t* caseSequence(uint16_t offset) noexcept {
+  return caseSpecial + offset;
+}
+
+const NormRecord& normRecord(uint32_t cp) noexcept {
+  if (cp >= NORM_LIMIT) return normRecords[0];
+  return normRecords[normStage2[((size_t)normStage1[cp >> 7] << 7) | (cp & 127)]];
+}
+
+const uint32_t* normSequence(uint16_t offset) noexcept {
+  return normData + offset;
+}
+
+const Composition* compositionsBegin() noexcept {
+  return compositions;
+}
+
+const Composition* compositionsEnd() noexcept {
+  return compositions + 941;
+}
+
+}
+}
+}
@@ -0,0 +1,156 @@
+#include "uring.hpp"
+
+#if JSCPP_HAVE_IO_URING
+
+#include "jscpp/String.hpp"
+#include "fserror.hpp"
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+namespace js {
+namespace internal {
+
+namespace {
+
+int setup(unsigned entries, struct io_uring_params* params) noexcept {
+  return (int)::syscall(__NR_io_uring_setup, entries, params);
+}
+
+int enter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) noexcept {
+  return (int)::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+// Supported opcodes, probed once per process
+std::once_flag probeOnce;
+bool probed[256];
+
+void probe() noexcept {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  int fd = setup(2, &params);
+  if (fd < 0) return;
+  size_t size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+  struct io_uring_probe* p = static_cast<struct io_uring_probe*>(calloc(1, size));
+  if (p != NULL && ::syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, p, 256) == 0) {
+    for (unsigned i = 0; i <= p->last_op && i < 256; i++) {
+      probed[i] = (p->ops[i].flags & IO_URING_OP_SUPPORTED) != 0;
+    }
+  }
+  free(p);
+  ::close(fd);
+}
+
+void* map(int fd, size_t size, off_t offset) noexcept {
+  void* p = ::mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+  return p == MAP_FAILED ? NULL : p;
+}
+
+template <typename T>
+T* at(void* ring, unsigned offset) noexcept {
+  return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+
+}
+
+bool Uring::supports(unsigned char op) noexcept {
+  std::call_once(probeOnce, probe);
+  return probed[op];
+}
+
+Uring::Uring(unsigned entries):
+  fd_(-1), entries_(0), sqRing_(NULL), sqRingSize_(0), cqRing_(NULL), cqRingSize_(0),
+  sqes_(NULL), sqesSize_(0), sqLocalTail_(0), submitted_(0) {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  fd_ = setup(entries, &params);
+  if (fd_ < 0) {
+    throwFsError(errnoCode(errno), "io_uring_setup", String());
+  }
+  entries_ = params.sq_entries;
+
+  sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (single && cqRingSize_ > sqRingSize_) sqRingSize_ = cqRingSize_;
+  sqRing_ = map(fd_, sqRingSize_, IORING_OFF_SQ_RING);
+  cqRing_ = single ? sqRing_ : map(fd_, cqRingSize_, IORING_OFF_CQ_RING);
+  sqesSize_ = params.sq_entries * sizeof(struct io_uring_sqe);
+  sqes_ = static_cast<struct io_uring_sqe*>(map(fd_, sqesSize_, IORING_OFF_SQES));
+  if (sqRing_ == NULL || cqRing_ == NULL || sqes_ == NULL) {
+    int err = errno;
+    release();
+    throwFsError(errnoCode(err), "mmap", String());
+  }
+
+  sqHead_ = at<unsigned>(sqRing_, params.sq_off.head);
+  sqTail_ = at<unsigned>(sqRing_, params.sq_off.tail);
+  sqMask_ = at<unsigned>(sqRing_, params.sq_off.ring_mask);
+  sqArray_ = at<unsigned>(sqRing_, params.sq_off.array);
+  sqLocalTail_ = *sqTail_;
+  submitted_ = sqLocalTail_;
+  cqHead_ = at<unsigned>(cqRing_, params.cq_off.head);
+  cqTail_ = at<unsigned>(cqRing_, params.cq_off.tail);
+  cqMask_ = at<unsigned>(cqRing_, params.cq_off.ring_mask);
+  cqes_ = at<struct io_uring_cqe>(cqRing_, params.cq_off.cqes);
+}
+
+Uring::~Uring() {
+  release();
+}
+
+void Uring::release() noexcept {
+  if (sqes_ != NULL) ::munmap(sqes_, sqesSize_);
+  if (cqRing_ != NULL && cqRing_ != sqRing_) ::munmap(cqRing_, cqRingSize_);
+  if (sqRing_ != NULL) ::munmap(sqRing_, sqRingSize_);
+  if (fd_ >= 0) ::close(fd_);
+  sqes_ = NULL;
+  cqRing_ = sqRing_ = NULL;
+  fd_ = -1;
+}
+
+unsigned Uring::entries() const noexcept {
+  return entries_;
+}
+
+struct io_uring_sqe* Uring::sqe() noexcept {
+  unsigned head = __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+  if (sqLocalTail_ - head >= entries_) return NULL;
+  unsigned index = sqLocalTail_ & *sqMask_;
+  struct io_uring_sqe* e = &sqes_[index];
+  memset(e, 0, sizeof(*e));
+  sqArray_[index] = index;
+  sqLocalTail_++;
+  return e;
+}
+
+int Uring::submit(unsigned waitFor) noexcept {
+  __atomic_store_n(sqTail_, sqLocalTail_, __ATOMIC_RELEASE);
+  unsigned toSubmit = sqLocalTail_ - submitted_;
+  unsigned flags = waitFor > 0 ? IORING_ENTER_GETEVENTS : 0;
+  for (;;) {
+    int r = enter(fd_, toSubmit, waitFor, flags);
+    if (r >= 0) {
+      // Whatever the kernel left, say with the completion queue full, goes
+      // out with the next call once the caller has reaped
+      submitted_ += (unsigned)r;
+      return 0;
+    }
+    if (errno != EINTR) return errno;
+  }
+}
+
+int Uring::wait(unsigned waitFor) noexcept {
+  for (;;) {
+    if (enter(fd_, 0, waitFor, IORING_ENTER_GETEVENTS) >= 0) return 0;
+    if (errno != EINTR) return errno;
+  }
+}
+
+}
+}
+
+#endif
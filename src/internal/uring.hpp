@@ -0,0 +1,106 @@
+#ifndef __JSCPP_URING_HPP__
+#define __JSCPP_URING_HPP__
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+// IORING_OP_STATX is an enumerator, 5.7's FAST_POLL feature bit stands in
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_FAST_POLL)
+#define JSCPP_HAVE_IO_URING 1
+#endif
+#endif
+
+#ifndef JSCPP_HAVE_IO_URING
+#define JSCPP_HAVE_IO_URING 0
+#endif
+
+#if JSCPP_HAVE_IO_URING
+
+#include <cstddef>
+
+namespace js {
+namespace internal {
+
+/**
+ * Bare io_uring instance driven through the raw syscalls. Not thread safe;
+ * one thread fills submission entries, submits them in one io_uring_enter
+ * and reaps the completions.
+ */
+class Uring {
+public:
+  // Whether the running kernel has io_uring and implements the opcode.
+  static bool supports(unsigned char op) noexcept;
+
+  // Throws when the ring cannot be set up.
+  explicit Uring(unsigned entries);
+  ~Uring();
+
+  Uring(const Uring&) = delete;
+  Uring& operator=(const Uring&) = delete;
+
+  unsigned entries() const noexcept;
+
+  // Next free submission entry, zeroed, or NULL when the queue is full.
+  struct io_uring_sqe* sqe() noexcept;
+
+  // Submits the queued entries and blocks until at least waitFor
+  // completions are available. Returns 0 or the errno value.
+  int submit(unsigned waitFor) noexcept;
+
+  // Blocks until at least waitFor completions are available, submitting
+  // nothing. Returns 0 or the errno value.
+  int wait(unsigned waitFor) noexcept;
+
+  // Takes back the queued entries the kernel has not consumed, calling
+  // fn(const io_uring_sqe&) for each, so they can be given up on once
+  // submit fails.
+  template <typename Fn>
+  void discard(Fn fn) {
+    for (unsigned i = submitted_; i != sqLocalTail_; i++) fn(sqes_[i & *sqMask_]);
+    sqLocalTail_ = submitted_;
+    __atomic_store_n(sqTail_, sqLocalTail_, __ATOMIC_RELEASE);
+  }
+
+  // Calls fn(const io_uring_cqe&) for every available completion.
+  template <typename Fn>
+  void reap(Fn fn) {
+    unsigned head = *cqHead_;
+    unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+    while (head != tail) {
+      fn(cqes_[head & *cqMask_]);
+      head++;
+    }
+    __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+  }
+
+private:
+  void release() noexcept;
+
+  int fd_;
+  unsigned entries_;
+  void* sqRing_;
+  size_t sqRingSize_;
+  void* cqRing_;
+  size_t cqRingSize_;
+  struct io_uring_sqe* sqes_;
+  size_t sqesSize_;
+
+  unsigned* sqHead_;
+  unsigned* sqTail_;
+  unsigned* sqMask_;
+  unsigned* sqArray_;
+  unsigned sqLocalTail_;
+  unsigned submitted_;
+
+  unsigned* cqHead_;
+  unsigned* cqTail_;
+  unsigned* cqMask_;
+  struct io_uring_cqe* cqes_;
+};
+
+}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef __JSCPP_WHITESPACE_HPP__
+#define __JSCPP_WHITESPACE_HPP__
+
+#include "transcode.hpp"
+
+namespace js {
+namespace internal {
+
+// ECMAScript WhiteSpace and LineTerminator, which is what trim() removes.
+inline bool isWhiteSpace(uint32_t c) noexcept {
+  if (c < 0x80) return c == 0x20 || (c >= 0x09 && c <= 0x0D);
+  switch (c) {
+    case 0x00A0: case 0x1680: case 0x2028: case 0x2029:
+    case 0x202F: case 0x205F: case 0x3000: case 0xFEFF:
+      return true;
+    default:
+      return c >= 0x2000 && c <= 0x200A;
+  }
+}
+
+namespace whitespace {
+
+#if JSCPP_TRANSCODE_SSE2
+// Lanes holding 0x20 or 0x09-0x0D. Compares are signed, so v - 9 only lands
+// in [0, 4] for the control characters themselves.
+template <typename CharT>
+inline int asciiSpaceMask(__m128i v) noexcept {
+  if (sizeof(CharT) == 1) {
+    __m128i x = _mm_sub_epi8(v, _mm_set1_epi8(0x09));
+    __m128i ctrl = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8(-1)), _mm_cmplt_epi8(x, _mm_set1_epi8(5)));
+    return _mm_movemask_epi8(_mm_or_si128(ctrl, _mm_cmpeq_epi8(v, _mm_set1_epi8(0x20))));
+  }
+  if (sizeof(CharT) == 2) {
+    __m128i x = _mm_sub_epi16(v, _mm_set1_epi16(0x09));
+    __m128i ctrl = _mm_and_si128(_mm_cmpgt_epi16(x, _mm_set1_epi16(-1)), _mm_cmplt_epi16(x, _mm_set1_epi16(5)));
+    return _mm_movemask_epi8(_mm_or_si128(ctrl, _mm_cmpeq_epi16(v, _mm_set1_epi16(0x20))));
+  }
+  __m128i x = _mm_sub_epi32(v, _mm_set1_epi32(0x09));
+  __m128i ctrl = _mm_and_si128(_mm_cmpgt_epi32(x, _mm_set1_epi32(-1)), _mm_cmplt_epi32(x, _mm_set1_epi32(5)));
+  return _mm_movemask_epi8(_mm_or_si128(ctrl, _mm_cmpeq_epi32(v, _mm_set1_epi32(0x20))));
+}
+#endif
+
+// Length of the leading run of ASCII whitespace.
+template <typename CharT>
+inline size_t asciiSpaceRun(const CharT* src, size_t len) noexcept {
+  size_t i = 0;
+#if JSCPP_TRANSCODE_SSE2
+  const size_t step = 16 / sizeof(CharT);
+  for (; i + step <= len; i += step) {
+    if (asciiSpaceMask<CharT>(_mm_loadu_si128((const __m128i*)(src + i))) != 0xFFFF) break;
+  }
+#endif
+  while (i < len && codeUnit(src[i]) < 0x80 && isWhiteSpace(codeUnit(src[i]))) i++;
+  return i;
+}
+
+// Length of the trailing run of ASCII whitespace.
+template <typename CharT>
+inline size_t asciiSpaceRunBack(const CharT* src, size_t len) noexcept {
+  size_t i = len;
+#if JSCPP_TRANSCODE_SSE2
+  const size_t step = 16 / sizeof(CharT);
+  for (; i >= step; i -= step) {
+    if (asciiSpaceMask<CharT>(_mm_loadu_si128((const __m128i*)(src + i - step))) != 0xFFFF) break;
+  }
+#endif
+  while (i > 0 && codeUnit(src[i - 1]) < 0x80 && isWhiteSpace(codeUnit(src[i - 1]))) i--;
+  return len - i;
+}
+
+// Bytes of the non-ASCII whitespace sequence starting at s, or 0.
+inline size_t utf8SpaceAt(const char* s, size_t len) noexcept {
+  const uint8_t* p = (const uint8_t*)s;
+  if (len >= 2 && p[0] == 0xC2 && p[1] == 0xA0) return 2;
+  if (len < 3) return 0;
+  uint32_t c = ((uint32_t)(p[0] & 0x0F) << 12) | ((uint32_t)(p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+  return (p[0] & 0xF0) == 0xE0 && (p[1] & 0xC0) == 0x80 && (p[2] & 0xC0) == 0x80 && isWhiteSpace(c) ? 3 : 0;
+}
+
+// Bytes of the non-ASCII whitespace sequence ending at s + len, or 0.
+inline size_t utf8SpaceBefore(const char* s, size_t len) noexcept {
+  if (len >= 2 && utf8SpaceAt(s + len - 2, 2) == 2) return 2;
+  if (len >= 3 && utf8SpaceAt(s + len - 3, 3) == 3) return 3;
+  return 0;
+}
+
+}
+
+// Index of the first code unit that is not whitespace.
+template <typename CharT>
+inline size_t trimStartIndex(const CharT* s, size_t len) noexcept {
+  size_t i = 0;
+  for (;;) {
+    i += whitespace::asciiSpaceRun(s + i, len - i);
+    if (i < len && isWhiteSpace(codeUnit(s[i]))) {
+      i++;
+      continue;
+    }
+    return i;
+  }
+}
+
+inline size_t trimStartIndex(const char* s, size_t len) noexcept {
+  size_t i = 0;
+  for (;;) {
+    i += whitespace::asciiSpaceRun(s + i, len - i);
+    size_t n = i < len ? whitespace::utf8SpaceAt(s + i, len - i) : 0;
+    if (n == 0) return i;
+    i += n;
+  }
+}
+
+// Index one past the last code unit that is not whitespace.
+template <typename CharT>
+inline size_t trimEndIndex(const CharT* s, size_t len) noexcept {
+  size_t i = len;
+  for (;;) {
+    i -= whitespace::asciiSpaceRunBack(s, i);
+    if (i > 0 && isWhiteSpace(codeUnit(s[i - 1]))) {
+      i--;
+      continue;
+    }
+    return i;
+  }
+}
+
+inline size_t trimEndIndex(const char* s, size_t len) noexcept {
+  size_t i = len;
+  for (;;) {
+    i -= whitespace::asciiSpaceRunBack(s, i);
+    size_t n = whitespace::utf8SpaceBefore(s, i);
+    if (n == 0) return i;
+    i -= n;
+  }
+}
+
+}
+}
+
+#endif
@@ -76,6 +76,19 @@ const wchar_t EOL[] = L"\r\n";
 const wchar_t EOL[] = L"\n";
 #endif
 
+const String::value_type DOT_CHARS[] = { '.', 0 };
+const StringView DOT(DOT_CHARS, 1);
+
+ParsedPath toParsedPath(const ParsedPathView& view) {
+  ParsedPath ret;
+  ret.root = view.root.toString();
+  ret.dir = view.dir.toString();
+  ret.base = view.base.toString();
+  ret.ext = view.ext.toString();
+  ret.name = view.name.toString();
+  return ret;
+}
+
 bool isPathSeparator(uint16_t code) {
   return code == CHAR_FORWARD_SLASH || code == CHAR_BACKWARD_SLASH;
 }
@@ -167,7 +180,7 @@ String _format(const String& sep, const ParsedPath& pathObject) {
 
 namespace win32 {
 
-bool isAbsolute(const String& path) {
+bool isAbsolute(StringView path) {
   size_t len = path.length();
   if (len == 0)
     return false;
@@ -300,7 +313,7 @@ String resolve(const String& arg1, const String& arg2) {
       if (resolvedDevice.length() > 0)
         break;
     } else {
-      resolvedTail = path.slice(rootEnd) + L"\\" + resolvedTail;
+      resolvedTail = path.slice(rootEnd).concat(L"\\", resolvedTail);
       resolvedAbsolute = isAbsolute;
       if (isAbsolute && resolvedDevice.length() > 0) {
         break;
@@ -317,7 +330,7 @@ String resolve(const String& arg1, const String& arg2) {
                                   isPathSeparator);
 
   if (resolvedAbsolute) {
-    return resolvedDevice + L"\\" + resolvedTail;
+    return resolvedDevice.concat(L"\\", resolvedTail);
   }
   String r = resolvedDevice + resolvedTail;
   if (r.length() > 0) {
@@ -633,10 +646,10 @@ String toNamespacedPath(const String& path) {
   return path;
 }
 
-String dirname(const String& path) {
+StringView dirname(StringView path) {
   int len = (int)path.length();
   if (len == 0)
-    return L".";
+    return DOT;
   int rootEnd = -1;
   int offset = 0;
   uint16_t code = path.charCodeAt(0);
@@ -644,7 +657,7 @@ String dirname(const String& path) {
   if (len == 1) {
     // `path` contains just a path separator, exit early to avoid
     // unnecessary work or a dot.
-    return isPathSeparator(code) ? path : '.';
+    return isPathSeparator(code) ? path : DOT;
   }
 
   // Try to match a root
@@ -711,14 +724,14 @@ String dirname(const String& path) {
 
   if (end == -1) {
     if (rootEnd == -1)
-      return L".";
+      return DOT;
 
     end = rootEnd;
   }
   return path.slice(0, end);
 }
 
-String basename(const String& path, const String& ext) {
+StringView basename(StringView path, StringView ext) {
   int start = 0;
   int end = -1;
   bool matchedSlash = true;
@@ -734,7 +747,7 @@ String basename(const String& path, const String& ext) {
 
   if (ext.length() > 0 && ext.length() <= path.length()) {
     if (ext == path)
-      return L"";
+      return StringView();
     int extIdx = (int)ext.length() - 1;
     int firstNonSlashEnd = -1;
     for (int i = (int)path.length() - 1; i >= start; --i) {
@@ -795,11 +808,11 @@ String basename(const String& path, const String& ext) {
   }
 
   if (end == -1)
-    return L"";
+    return StringView();
   return path.slice(start, end);
 }
 
-String extname(const String& path) {
+StringView extname(StringView path) {
   int start = 0;
   int startDot = -1;
   int startPart = 0;
@@ -857,7 +870,7 @@ String extname(const String& path) {
       (preDotState == 1 &&
         startDot == end - 1 &&
         startDot == startPart + 1)) {
-    return L"";
+    return StringView();
   }
   return path.slice(startDot, end);
 }
@@ -866,8 +879,8 @@ String format(const ParsedPath& pathObject) {
   return _format(L"\\", pathObject);
 }
 
-ParsedPath parse(const String& path) {
-  ParsedPath ret;
+ParsedPathView parse(StringView path) {
+  ParsedPathView ret;
   if (path.length() == 0)
     return ret;
 
@@ -1012,6 +1025,12 @@ ParsedPath parse(const String& path) {
   return ret;
 }
 
+bool isAbsolute(const String& path) { return isAbsolute(StringView(path)); }
+String dirname(const String& path) { return dirname(StringView(path)).toString(); }
+String basename(const String& path, const String& ext) { return basename(StringView(path), StringView(ext)).toString(); }
+String extname(const String& path) { return extname(StringView(path)).toString(); }
+ParsedPath parse(const String& path) { return toParsedPath(parse(StringView(path))); }
+
 const String sep = L"\\";
 const String delimiter = L";";
 
@@ -1019,7 +1038,7 @@ const String delimiter = L";";
 
 namespace posix {
 
-bool isAbsolute(const String& path) { return path.length() > 0 && path.charCodeAt(0) == CHAR_FORWARD_SLASH; }
+bool isAbsolute(StringView path) { return path.length() > 0 && path.charCodeAt(0) == CHAR_FORWARD_SLASH; }
 
 String resolve(const String& arg1, const String& arg2) {
   std::vector<String> args = { arg1, arg2 };
@@ -1034,7 +1053,7 @@ String resolve(const String& arg1, const String& arg2) {
       continue;
     }
 
-    resolvedPath = path + L"/" + resolvedPath;
+    resolvedPath = path.concat(L"/", resolvedPath);
     resolvedAbsolute = path.charCodeAt(0) == CHAR_FORWARD_SLASH;
   }
 
@@ -1174,9 +1193,9 @@ String toNamespacedPath(const String& path) {
   return path;
 }
 
-String dirname(const String& path) {
+StringView dirname(StringView path) {
   if (path.length() == 0)
-    return L".";
+    return DOT;
   bool hasRoot = path.charCodeAt(0) == CHAR_FORWARD_SLASH;
   int end = -1;
   bool matchedSlash = true;
@@ -1193,20 +1212,20 @@ String dirname(const String& path) {
   }
 
   if (end == -1)
-    return hasRoot ? L"/" : L".";
+    return hasRoot ? path.slice(0, 1) : DOT;
   if (hasRoot && end == 1)
-    return L"//";
+    return path.slice(0, 2);
   return path.slice(0, end);
 }
 
-String basename(const String& path, const String& ext) {
+StringView basename(StringView path, StringView ext) {
   int start = 0;
   int end = -1;
   bool matchedSlash = true;
 
   if (ext.length() > 0 && ext.length() <= path.length()) {
     if (ext == path)
-      return L"";
+      return StringView();
     int extIdx = (int)ext.length() - 1;
     int firstNonSlashEnd = -1;
     for (int i = (int)path.length() - 1; i >= 0; --i) {
@@ -1267,11 +1286,11 @@ String basename(const String& path, const String& ext) {
   }
 
   if (end == -1)
-    return L"";
+    return StringView();
   return path.slice(start, end);
 }
 
-String extname(const String& path) {
+StringView extname(StringView path) {
   int startDot = -1;
   int startPart = 0;
   int end = -1;
@@ -1317,7 +1336,7 @@ String extname(const String& path) {
       (preDotState == 1 &&
         startDot == end - 1 &&
         startDot == startPart + 1)) {
-    return L"";
+    return StringView();
   }
   return path.slice(startDot, end);
 }
@@ -1326,14 +1345,14 @@ String format(const ParsedPath& pathObject) {
   return _format(L"/", pathObject);
 }
 
-ParsedPath parse(const String& path) {
-  ParsedPath ret;
+ParsedPathView parse(StringView path) {
+  ParsedPathView ret;
   if (path.length() == 0)
     return ret;
   bool isAbs = path.charCodeAt(0) == CHAR_FORWARD_SLASH;
   int start;
   if (isAbs) {
-    ret.root = '/';
+    ret.root = path.slice(0, 1);
     start = 1;
   } else {
     start = 0;
@@ -1399,11 +1418,17 @@ ParsedPath parse(const String& path) {
   if (startPart > 0)
     ret.dir = path.slice(0, startPart - 1);
   else if (isAbs)
-    ret.dir = '/';
+    ret.dir = path.slice(0, 1);
 
   return ret;
 }
 
+bool isAbsolute(const String& path) { return isAbsolute(StringView(path)); }
+String dirname(const String& path) { return dirname(StringView(path)).toString(); }
+String basename(const String& path, const String& ext) { return basename(StringView(path), StringView(ext)).toString(); }
+String extname(const String& path) { return extname(StringView(path)).toString(); }
+ParsedPath parse(const String& path) { return toParsedPath(parse(StringView(path))); }
+
 const String sep = L"/";
 const String delimiter = L":";
 
@@ -5,14 +5,10 @@
 #endif
 #include <Windows.h>
 
-#else
-
-#include <clocale>
-#include <cstddef>
-
 #endif
 
 #include "jscpp/utf8.hpp"
+#include "./internal/transcode.hpp"
 
 #ifdef JSCPP_UTF8
   #define JSCPP_STR ::js::toUtf8
@@ -25,33 +21,11 @@
 namespace js {
 
 std::wstring fromUtf8(const std::string& str) {
-#ifdef _WIN32
-  int len = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, nullptr, 0);
-  if (len == 0) return L"";
-  std::wstring res;
-  res.resize(len - 1);
-  MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, &res[0], len);
-  return res;
-#else
-  std::string targetLocale = "en_US.utf8";
-  const char* cLocale = std::setlocale(LC_CTYPE, nullptr);
-  std::string locale(cLocale ? cLocale : "");
-
-  if (locale != targetLocale) {
-    std::setlocale(LC_CTYPE, targetLocale.c_str());
-  }
-
-  size_t len = std::mbstowcs(nullptr, str.c_str(), 0);
-  if (len == (size_t)-1) return L"";
   std::wstring res;
+  res.resize(str.size());
+  size_t len = internal::decodeUtf8(str.data(), str.size(), &res[0]);
   res.resize(len);
-  std::mbstowcs(&res[0], str.c_str(), len + 1);
-
-  if (locale != "") {
-    std::setlocale(LC_CTYPE, locale.c_str());
-  }
   return res;
-#endif
 }
 
 std::wstring fromAcp(const std::string& str) {
@@ -73,33 +47,10 @@ std::wstring fromAcp(const std::string& str) {
 }
 
 std::string toUtf8(const std::wstring& wstr) {
-#ifdef _WIN32
-  int len = WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), -1, nullptr, 0, nullptr, nullptr);
-  if (len == 0) return "";
-  std::string res;
-  res.resize(len - 1);
-  WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), -1, &res[0], len, nullptr, nullptr);
-  return res;
-#else
-  std::string targetLocale = "en_US.utf8";
-  const char* cLocale = std::setlocale(LC_CTYPE, nullptr);
-  std::string locale(cLocale ? cLocale : "");
-
-  if (locale != targetLocale) {
-    std::setlocale(LC_CTYPE, targetLocale.c_str());
-  }
-
-  size_t len = std::wcstombs(nullptr, wstr.c_str(), 0);
-  if (len == (size_t)-1) return "";
   std::string res;
-  res.resize(len);
-  std::wcstombs(&res[0], wstr.c_str(), len + 1);
-
-  if (locale != "") {
-    std::setlocale(LC_CTYPE, locale.c_str());
-  }
+  res.resize(internal::utf8Length(wstr.data(), wstr.size()));
+  internal::encodeUtf8(wstr.data(), wstr.size(), &res[0]);
   return res;
-#endif
 }
 
 std::string toAcp(const std::wstring& wstr) {
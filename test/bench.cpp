@@ -0,0 +1,41 @@
+#include "bench.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Kept out of the benchmark files, where inlining these into library code
+// makes GCC warn about free() on memory from operator new
+
+namespace {
+
+std::atomic<size_t> allocations(0);
+
+}
+
+size_t allocationCount() noexcept {
+  return allocations;
+}
+
+void* operator new(size_t size) {
+  allocations++;
+  void* p = std::malloc(size ? size : 1);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+  std::free(p);
+}
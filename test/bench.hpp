@@ -0,0 +1,26 @@
+#ifndef __JSCPP_TEST_BENCH_HPP__
+#define __JSCPP_TEST_BENCH_HPP__
+
+#include <chrono>
+#include <cstddef>
+
+// Calls to operator new so far, counted by the replacement in bench.cpp
+size_t allocationCount() noexcept;
+
+template <typename F>
+size_t countAllocations(const F& fn) {
+  size_t before = allocationCount();
+  fn();
+  return allocationCount() - before;
+}
+
+template <typename F>
+double measure(size_t iterations, const F& fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; i++) {
+    fn();
+  }
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+#endif
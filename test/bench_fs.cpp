@@ -0,0 +1,158 @@
+#include "gtest/gtest.h"
+#include "jscpp/index.hpp"
+#include "bench.hpp"
+
+#include <algorithm>
+#include <future>
+
+using namespace js;
+
+TEST(jscppBenchmark, fsMiss) {
+  const size_t iterations = 20000;
+  const String missing = L"notexists/missing.txt";
+  std::error_code ec;
+  fs::Stats stats;
+
+#if JSCPP_USE_ERROR
+  double throwTime = measure(iterations, [&]() {
+    try {
+      fs::stat(missing);
+    } catch (const std::exception&) {}
+  });
+#endif
+  double ecTime = measure(iterations, [&]() { fs::stat(missing, ec); });
+  double noThrowTime = measure(iterations, [&]() { fs::Stats::createNoThrow(stats, missing, true); });
+  EXPECT_TRUE(ec);
+
+#if JSCPP_USE_ERROR
+  console.log("stat miss x%d: throw/catch %8.2f ms, error_code %8.2f ms, createNoThrow %8.2f ms",
+    (int)iterations, throwTime, ecTime, noThrowTime);
+#else
+  console.log("stat miss x%d: error_code %8.2f ms, createNoThrow %8.2f ms", (int)iterations, ecTime, noThrowTime);
+#endif
+}
+
+TEST(jscppBenchmark, fsAsync) {
+  const size_t files = 2000;
+  std::vector<String> paths;
+  fs::mkdirs("benchasync");
+  for (size_t i = 0; i < files; i++) {
+    paths.push_back(path::join(L"benchasync", String((unsigned long)i) + L".txt"));
+    fs::writeFile(paths[i], std::vector<uint8_t>(512, 'x'));
+  }
+
+  size_t total = 0;
+  double syncTime = measure(1, [&]() {
+    for (size_t i = 0; i < files; i++) total += fs::readFile(paths[i]).size();
+  });
+  double asyncTime = measure(1, [&]() {
+    std::vector<std::future<std::vector<uint8_t>>> reads;
+    for (size_t i = 0; i < files; i++) reads.push_back(fs::readFileAsync(paths[i]));
+    for (size_t i = 0; i < files; i++) total += reads[i].get().size();
+  });
+  EXPECT_EQ(total, 2 * files * 512);
+
+  // Reads served from the page cache only overlap with spare cores, while
+  // waiting on the disk overlaps everywhere
+  const size_t synced = 200;
+  fs::WriteFileOptions options;
+  options.fsync = true;
+  std::vector<uint8_t> content(512, 'y');
+  double syncWriteTime = measure(1, [&]() {
+    for (size_t i = 0; i < synced; i++) fs::writeFile(paths[i], content, options);
+  });
+  double asyncWriteTime = measure(1, [&]() {
+    std::vector<std::future<void>> writes;
+    for (size_t i = 0; i < synced; i++) writes.push_back(fs::writeFileAsync(paths[i], content, options));
+    for (size_t i = 0; i < synced; i++) writes[i].get();
+  });
+  fs::remove("benchasync");
+
+  console.log("read %d files of 512 B: one by one %8.2f ms, readFileAsync on %u threads %8.2f ms",
+    (int)files, syncTime, fs::threadPoolSize(), asyncTime);
+  console.log("fsync'ed write of %d files: one by one %8.2f ms, writeFileAsync %8.2f ms",
+    (int)synced, syncWriteTime, asyncWriteTime);
+}
+
+TEST(jscppBenchmark, fsMany) {
+  const size_t files = 2000;
+  const int rounds = 3;
+  std::vector<uint8_t> content(512, 'z');
+  std::vector<String> paths;
+  std::vector<std::pair<String, fs::ByteView>> outputs;
+  fs::mkdirs("benchmany");
+  for (size_t i = 0; i < files; i++) {
+    paths.push_back(path::join(L"benchmany", String((unsigned long)i) + L".txt"));
+    outputs.push_back(std::make_pair(paths[i], fs::ByteView(content.data(), content.size())));
+  }
+
+  // Every variant overwrites, creating the files costs more than writing
+  // them. Writeback makes later rounds slower, so the variants take turns
+  // and the best round counts.
+  fs::WriteManyOptions pooledWrite;
+  pooledWrite.ioUring = false;
+  fs::ReadManyOptions pooledRead;
+  pooledRead.ioUring = false;
+  fs::writeMany(outputs, pooledWrite);
+  double writeTime = 1e9, writePoolTime = 1e9, writeUringTime = 1e9;
+  double readTime = 1e9, readPoolTime = 1e9, readUringTime = 1e9;
+  size_t total = 0;
+  for (int round = 0; round < rounds; round++) {
+    writeTime = std::min(writeTime, measure(1, [&]() {
+      for (size_t i = 0; i < files; i++) fs::writeFile(paths[i], content);
+    }));
+    writePoolTime = std::min(writePoolTime, measure(1, [&]() { fs::writeMany(outputs, pooledWrite); }));
+    writeUringTime = std::min(writeUringTime, measure(1, [&]() { fs::writeMany(outputs); }));
+
+    readTime = std::min(readTime, measure(1, [&]() {
+      for (size_t i = 0; i < files; i++) total += fs::readFile(paths[i]).size();
+    }));
+    readPoolTime = std::min(readPoolTime, measure(1, [&]() {
+      std::vector<std::pair<int, std::vector<uint8_t>>> res = fs::readMany(paths, pooledRead);
+      for (size_t i = 0; i < res.size(); i++) total += res[i].second.size();
+    }));
+    readUringTime = std::min(readUringTime, measure(1, [&]() {
+      std::vector<std::pair<int, std::vector<uint8_t>>> res = fs::readMany(paths);
+      for (size_t i = 0; i < res.size(); i++) total += res[i].second.size();
+    }));
+  }
+  EXPECT_EQ(total, rounds * 3 * files * 512);
+  fs::remove("benchmany");
+
+  console.log("write %d files of 512 B: writeFile %8.2f ms, writeMany pool %8.2f ms, io_uring %8.2f ms",
+    (int)files, writeTime, writePoolTime, writeUringTime);
+  console.log("read %d files of 512 B: readFile %8.2f ms, readMany pool %8.2f ms, io_uring %8.2f ms",
+    (int)files, readTime, readPoolTime, readUringTime);
+}
+
+TEST(jscppBenchmark, fsStream) {
+  const size_t size = 64 * 1024 * 1024;
+  {
+    std::vector<uint8_t> data(size, 's');
+    fs::writeFile("benchstream.bin", data);
+  }
+
+  size_t total = 0;
+  size_t wholeAllocations = 0, streamAllocations = 0;
+  double wholeTime = measure(1, [&]() {
+    wholeAllocations = countAllocations([&]() { total += fs::readFile("benchstream.bin").size(); });
+  });
+  double streamTime = measure(1, [&]() {
+    streamAllocations = countAllocations([&]() {
+      fs::ReadStream in = fs::createReadStream("benchstream.bin");
+      for (fs::ByteView chunk : in) total += chunk.size();
+    });
+  });
+  double pipeTime = measure(1, [&]() {
+    fs::ReadStream in = fs::createReadStream("benchstream.bin");
+    fs::WriteStream out = fs::createWriteStream("benchstream2.bin");
+    total += (size_t)in.pipe(out);
+  });
+  EXPECT_EQ(total, 3 * size);
+  fs::remove("benchstream.bin");
+  fs::remove("benchstream2.bin");
+
+  console.log("64 MiB: readFile %8.2f ms (%d allocations, all of it held), ReadStream %8.2f ms "
+    "(%d allocations, 64 KiB held), pipe %8.2f ms", wholeTime, (int)wholeAllocations, streamTime,
+    (int)streamAllocations, pipeTime);
+}
@@ -0,0 +1,300 @@
+#include "gtest/gtest.h"
+#include "jscpp/index.hpp"
+#include "bench.hpp"
+
+#include <algorithm>
+#include <clocale>
+#include <cstdlib>
+#include <regex>
+
+using namespace js;
+
+namespace {
+
+std::string repeatText(const std::string& unit, size_t bytes) {
+  std::string res;
+  res.reserve(bytes + unit.size());
+  while (res.size() < bytes) res += unit;
+  return res;
+}
+
+// The setlocale + mbstowcs/wcstombs converters fromUtf8/toUtf8 used to be,
+// kept here as the baseline.
+std::wstring legacyFromUtf8(const std::string& str) {
+  std::string targetLocale = "en_US.utf8";
+  const char* cLocale = std::setlocale(LC_CTYPE, nullptr);
+  std::string locale(cLocale ? cLocale : "");
+  if (locale != targetLocale) {
+    std::setlocale(LC_CTYPE, targetLocale.c_str());
+  }
+  size_t len = std::mbstowcs(nullptr, str.c_str(), 0);
+  if (len == (size_t)-1) return L"";
+  std::wstring res;
+  res.resize(len);
+  std::mbstowcs(&res[0], str.c_str(), len + 1);
+  if (locale != "") {
+    std::setlocale(LC_CTYPE, locale.c_str());
+  }
+  return res;
+}
+
+std::string legacyToUtf8(const std::wstring& wstr) {
+  std::string targetLocale = "en_US.utf8";
+  const char* cLocale = std::setlocale(LC_CTYPE, nullptr);
+  std::string locale(cLocale ? cLocale : "");
+  if (locale != targetLocale) {
+    std::setlocale(LC_CTYPE, targetLocale.c_str());
+  }
+  size_t len = std::wcstombs(nullptr, wstr.c_str(), 0);
+  if (len == (size_t)-1) return "";
+  std::string res;
+  res.resize(len);
+  std::wcstombs(&res[0], wstr.c_str(), len + 1);
+  if (locale != "") {
+    std::setlocale(LC_CTYPE, locale.c_str());
+  }
+  return res;
+}
+
+}
+
+TEST(jscppBenchmark, utf8) {
+  const size_t size = 1 << 20;
+  const size_t iterations = 10;
+  struct Input {
+    const char* name;
+    std::string text;
+  } inputs[] = {
+    { "ascii", repeatText("The quick brown fox jumps over the lazy dog. ", size) },
+    { "cjk", repeatText("\xe4\xb8\xad\xe6\x96\x87\xe6\xb5\x8b\xe8\xaf\x95 /\xe6\x96\x87\xe4\xbb\xb6\xe5\xa4\xb9", size) },
+    { "emoji", repeatText("\xf0\x9f\x8d\x8c\xf0\x9f\x9a\x80 ok \xf0\x9f\x91\x8d", size) }
+  };
+
+  for (const Input& input : inputs) {
+    std::wstring wide = fromUtf8(input.text);
+    EXPECT_EQ(toUtf8(wide), input.text);
+
+    bool legacyOk = legacyFromUtf8(input.text) == wide;
+    double legacyDecode = measure(iterations, [&]() { legacyFromUtf8(input.text); });
+    double decode = measure(iterations, [&]() { fromUtf8(input.text); });
+    double legacyEncode = measure(iterations, [&]() { legacyToUtf8(wide); });
+    double encode = measure(iterations, [&]() { toUtf8(wide); });
+
+    console.log("utf8 %-5s decode: legacy %8.2f ms, new %8.2f ms | encode: legacy %8.2f ms, new %8.2f ms%s",
+      input.name, legacyDecode, decode, legacyEncode, encode,
+      legacyOk ? "" : " (legacy conversion failed, en_US.utf8 unavailable)");
+  }
+}
+
+TEST(jscppBenchmark, concat) {
+  const size_t iterations = 100000;
+  const String dir = "/home/user/projects/jscpp";
+  const String base = "node_modules";
+  const String name = "package.json";
+  const String expected = "/home/user/projects/jscpp/node_modules/package.json";
+
+  // Every step copies into a fresh string, which is what operator+ did
+  // before it learned to reuse temporaries.
+  auto legacy = [&]() {
+    String a = dir.concat(L"/");
+    String b = a.concat(base);
+    String c = b.concat(L"/");
+    return c.concat(name);
+  };
+  auto chain = [&]() { return dir + L"/" + base + L"/" + name; };
+  auto concat = [&]() { return dir.concat(L"/", base, L"/", name); };
+
+  EXPECT_EQ(legacy(), expected);
+  EXPECT_EQ(chain(), expected);
+  EXPECT_EQ(concat(), expected);
+
+  size_t legacyAllocs = countAllocations([&]() { legacy(); });
+  size_t chainAllocs = countAllocations([&]() { chain(); });
+  size_t concatAllocs = countAllocations([&]() { concat(); });
+#ifndef JSCPP_IMPORT_DLL
+  EXPECT_LE(concatAllocs, 1);
+  EXPECT_LT(chainAllocs, legacyAllocs);
+#endif
+
+  double legacyTime = measure(iterations, legacy);
+  double chainTime = measure(iterations, chain);
+  double concatTime = measure(iterations, concat);
+
+  console.log("concat 5 parts allocations: legacy %d, operator+ %d, concat() %d",
+    (int)legacyAllocs, (int)chainAllocs, (int)concatAllocs);
+  console.log("concat 5 parts x%d: legacy %8.2f ms, operator+ %8.2f ms, concat() %8.2f ms",
+    (int)iterations, legacyTime, chainTime, concatTime);
+}
+
+TEST(jscppBenchmark, pathParse) {
+  const size_t iterations = 100000;
+  const String file = "/home/user/projects/jscpp/node_modules/package.json";
+  const StringView view = file;
+
+  path::ParsedPath owned = path::posix::parse(file);
+  path::ParsedPathView viewed = path::posix::parse(view);
+  EXPECT_EQ(viewed.dir, owned.dir);
+  EXPECT_EQ(viewed.base, owned.base);
+  EXPECT_EQ(viewed.ext, owned.ext);
+
+  size_t ownedAllocs = countAllocations([&]() { path::posix::parse(file); });
+  size_t viewAllocs = countAllocations([&]() {
+    path::posix::parse(view);
+    path::posix::dirname(view);
+    path::posix::basename(view);
+    path::posix::extname(view);
+  });
+#ifndef JSCPP_IMPORT_DLL
+  EXPECT_EQ(viewAllocs, 0);
+#endif
+
+  double ownedTime = measure(iterations, [&]() { path::posix::parse(file); });
+  double viewTime = measure(iterations, [&]() { path::posix::parse(view); });
+
+  console.log("path parse allocations: String %d, StringView %d", (int)ownedAllocs, (int)viewAllocs);
+  console.log("path parse x%d: String %8.2f ms, StringView %8.2f ms", (int)iterations, ownedTime, viewTime);
+}
+
+TEST(jscppBenchmark, trim) {
+  const size_t iterations = 5000;
+  const String line = "\t  2024-05-01T12:00:00.000Z [info] worker 3 finished job 1234 in 56 ms (queue depth 7)   \r";
+  const String expected = line.slice(3, -4);
+
+  // The regex trim() used to run on every call.
+  auto legacy = [&]() {
+    return String(std::regex_replace(line.wstr(), std::wregex(L"[\\s\\uFEFF\\xA0]+|[\\s\\uFEFF\\xA0]+$"), L""));
+  };
+  auto trim = [&]() { return line.trim(); };
+  auto view = [&]() { return StringView(line).trim(); };
+
+  EXPECT_EQ(trim(), expected);
+  EXPECT_EQ(view(), expected);
+
+  double legacyTime = measure(iterations, legacy);
+  double trimTime = measure(iterations, trim);
+  double viewTime = measure(iterations, view);
+
+  console.log("trim %d-unit line x%d: regex %8.2f ms, trim() %8.2f ms, StringView::trim() %8.2f ms",
+    (int)line.length(), (int)iterations, legacyTime, trimTime, viewTime);
+}
+
+TEST(jscppBenchmark, search) {
+  const String line = "2024-05-01T12:00:00.000Z [info] worker 3 finished job 1234 in 56 ms\n";
+  const String small = line.repeat(1000);
+  const String large = line.repeat(250000);
+  const String newline = "\n";
+  const double largeMiB = large.length() * sizeof(String::value_type) / 1048576.0;
+
+  // The split loop used before, copying the remaining tail on every match.
+  auto legacySplit = [&](const String& str) {
+    std::vector<String> res;
+    String sub = str;
+    size_t index;
+    while ((index = sub.indexOf(newline)) != std::wstring::npos) {
+      res.push_back(sub.substring(0, index));
+      sub = sub.substring(index + 1);
+    }
+    res.push_back(sub);
+    return res;
+  };
+
+  EXPECT_EQ(legacySplit(small).size(), small.split(newline).size());
+  EXPECT_EQ(StringView(large).split(newline).size(), 250001);
+
+  double legacyTime = measure(1, [&]() { legacySplit(small); });
+  double splitTime = measure(1, [&]() { small.split(newline); });
+  console.log("split %d lines: legacy %8.2f ms, split() %8.2f ms", 1000, legacyTime, splitTime);
+
+  double viewTime = measure(1, [&]() { StringView(large).split(newline); });
+  double ownedTime = measure(1, [&]() { large.split(newline); });
+  console.log("split %.0f MiB: StringView %8.2f ms (%.0f MiB/s), String %8.2f ms",
+    largeMiB, viewTime, largeMiB / viewTime * 1000, ownedTime);
+
+  const String needles[] = { "queue depth", "2024-05-01T12:00:00.000Z [info] worker 3 finished job 1234 in 56 ms\n!" };
+  for (const String& needle : needles) {
+    size_t found = 0;
+    size_t expected = 0;
+    double engineTime = measure(1, [&]() { found = large.indexOf(needle); });
+    double stdTime = measure(1, [&]() { expected = large.ref().find(needle.ref()); });
+    EXPECT_EQ(found, expected);
+    console.log("indexOf %2d-unit needle in %.0f MiB: %8.2f ms, string_type::find %8.2f ms",
+      (int)needle.length(), largeMiB, engineTime, stdTime);
+  }
+}
+
+TEST(jscppBenchmark, regexp) {
+  const String line = "2024-05-01T12:00:00.000Z [info] worker 3 finished job 1234 in 56 ms\n";
+  const String log = line.repeat(2000);
+  const String pattern = L"job (\\d+) in (\\d+) ms";
+
+  size_t engineCount = 0;
+  double engineTime = measure(1, [&]() { engineCount = log.matchAll(RegExp(pattern, L"g")).size(); });
+  size_t stdCount = 0;
+  double stdTime = measure(1, [&]() {
+    std::wstring wide = log.wstr();
+    std::wregex re(pattern.wstr());
+    stdCount = (size_t)std::distance(std::wsregex_iterator(wide.begin(), wide.end(), re), std::wsregex_iterator());
+  });
+  EXPECT_EQ(engineCount, 2000);
+  EXPECT_EQ(engineCount, stdCount);
+  console.log("matchAll %d lines: RegExp %8.2f ms, std::wregex %8.2f ms", 2000, engineTime, stdTime);
+
+  // Building the same pattern repeatedly hits the compiled-pattern cache.
+  const String one = line;
+  double cachedTime = measure(1000, [&]() { one.replace(RegExp(pattern), L"job $1"); });
+  double rebuildTime = measure(1000, [&]() {
+    std::regex_replace(one.wstr(), std::wregex(pattern.wstr()), std::wstring(L"job $1"));
+  });
+  console.log("replace x1000 with a fresh pattern: RegExp %8.2f ms, std::wregex %8.2f ms", cachedTime, rebuildTime);
+
+  // Nested quantifiers that make a backtracking engine exponential.
+  const String evil = String("a").repeat(100000);
+  size_t found = 0;
+  double linearTime = measure(1, [&]() { found = evil.search(RegExp(L"(a|aa)*b")); });
+  EXPECT_EQ(found, std::wstring::npos);
+  console.log("(a|aa)*b over %d units: %8.2f ms", 100000, linearTime);
+}
+
+TEST(jscppBenchmark, toCase) {
+  const String ascii = String("The Quick Brown Fox Jumps Over The Lazy Dog 0123456789\n").repeat(100000);
+  const double asciiMiB = ascii.length() * sizeof(String::value_type) / 1048576.0;
+
+  // The ASCII-only loop toLowerCase used to be.
+  auto legacyLower = [](const String& str) {
+    String res = str;
+    size_t len = res.length();
+    for (size_t i = 0; i < len; i++) {
+      if (res[i] >= 65 && res[i] <= 90) {
+        res[i] += 32;
+      }
+    }
+    return res;
+  };
+
+  String expected;
+  String actual;
+  // Best of a few runs each, so one noisy run cannot decide the comparison
+  double legacyTime = 0;
+  double tableTime = 0;
+  for (int round = 0; round < 5; round++) {
+    double t = measure(1, [&]() { expected = legacyLower(ascii); });
+    if (round == 0 || t < legacyTime) legacyTime = t;
+    t = measure(1, [&]() { actual = ascii.toLowerCase(); });
+    if (round == 0 || t < tableTime) tableTime = t;
+  }
+  EXPECT_EQ(actual, expected);
+  EXPECT_LE(tableTime, legacyTime);
+  console.log("toLowerCase %.0f MiB ASCII: legacy %8.2f ms (%.0f MiB/s), table %8.2f ms (%.0f MiB/s)",
+    asciiMiB, legacyTime, asciiMiB / legacyTime * 1000, tableTime, asciiMiB / tableTime * 1000);
+
+  const String mixed = String(L"Größe ÄRGER naïve café ΣΟΦΙΑ Привет 中文\n").repeat(20000);
+  double mixedTime = measure(1, [&]() { mixed.toUpperCase(); });
+  console.log("toUpperCase %d mixed lines: %8.2f ms", 20000, mixedTime);
+
+  const String composed = String(L"Crème brûlée à la française, s'il vous plaît\n").repeat(20000);
+  const String decomposed = composed.normalize(L"NFD");
+  double quickTime = measure(1, [&]() { composed.normalize(); });
+  double composeTime = measure(1, [&]() { actual = decomposed.normalize(); });
+  EXPECT_EQ(actual, composed);
+  console.log("normalize NFC %d lines: already NFC %8.2f ms, from NFD %8.2f ms", 20000, quickTime, composeTime);
+}
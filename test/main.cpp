@@ -3,6 +3,7 @@
 // #define JSCPP_FORCE_UTF8
 #include "jscpp/index.hpp"
 // #include <cstdlib>
+#include <algorithm>
 #include <unordered_map>
 #include <map>
 
@@ -29,6 +30,18 @@ TEST(jscppString, utf8) {
   EXPECT_STREQ(o.c_str(), original.c_str());
 }
 
+TEST(jscppString, utf8Replacement) {
+  EXPECT_EQ(fromUtf8("a\x80" "b"), std::wstring(L"a\xFFFD" L"b"));
+  EXPECT_EQ(fromUtf8("\xF0\x9F\x8D"), std::wstring(L"\xFFFD"));
+  EXPECT_EQ(fromUtf8("\xED\xA0\x80"), std::wstring(L"\xFFFD\xFFFD\xFFFD"));
+  EXPECT_EQ(fromUtf8("\xC0\xAFz"), std::wstring(L"\xFFFD\xFFFDz"));
+  EXPECT_EQ(fromUtf8(std::string(40, 'x') + "\xE6\xB0\xB4"), std::wstring(40, L'x') + L"\x6C34");
+
+  EXPECT_EQ(toUtf8(std::wstring(L"\xD83C\xDF4C")), "\xF0\x9F\x8D\x8C");
+  EXPECT_EQ(toUtf8(std::wstring(L"\xD800!")), "\xEF\xBF\xBD!");
+  EXPECT_EQ(toUtf8(std::wstring(40, L'y') + L"\x00DF"), std::string(40, 'y') + "\xC3\x9F");
+}
+
 TEST(jscppString, charAt) {
   String str = L"Brave中文 new world";
   EXPECT_STREQ(str.charAt(0).str().c_str(), "B");
@@ -36,11 +49,17 @@ TEST(jscppString, charAt) {
   EXPECT_STREQ(str.charAt(2).str().c_str(), "a");
   EXPECT_STREQ(str.charAt(3).str().c_str(), "v");
   EXPECT_STREQ(str.charAt(4).str().c_str(), "e");
-  EXPECT_STREQ(str.charAt(5).data(), L"中");
-  EXPECT_STREQ(str.charAt(6).data(), L"文");
+#if JSCPP_STRING_UTF8
+  EXPECT_STREQ(str.charAt(5).str().c_str(), "\xe4");
+  EXPECT_STREQ(str.charAt(11).str().c_str(), " ");
+  EXPECT_STREQ(str.charAt(12).str().c_str(), "n");
+#else
+  EXPECT_EQ(str.charAt(5), L"中");
+  EXPECT_EQ(str.charAt(6), L"文");
   EXPECT_STREQ(str.charAt(7).str().c_str(), " ");
   EXPECT_STREQ(str.charAt(8).str().c_str(), "n");
   EXPECT_STREQ(str.charAt(9).str().c_str(), "e");
+#endif
   EXPECT_STREQ(str.charAt(999).str().c_str(), "");
 }
 
@@ -49,10 +68,48 @@ TEST(jscppString, charCodeAt) {
   EXPECT_EQ(str.charCodeAt(0), 65);
   EXPECT_EQ(str.charCodeAt(1), 66);
   EXPECT_EQ(str.charCodeAt(2), 67);
+#if JSCPP_STRING_UTF8
+  EXPECT_EQ(str.charCodeAt(3), 0xE7);
+  EXPECT_EQ(str.charCodeAt(6), 69);
+  EXPECT_EQ(str.charCodeAt(7), 0);
+#else
   EXPECT_EQ(str.charCodeAt(3), 31532);
   EXPECT_EQ(str.charCodeAt(4), 69);
   EXPECT_EQ(str.charCodeAt(5), 0);
+#endif
+}
+
+#if JSCPP_STRING_UTF8
+TEST(jscppString, utf8Storage) {
+  String str = "\xe4\xb8\xad\xe6\x96\x87/file.txt";
+  EXPECT_EQ(str.length(), 15);
+  EXPECT_EQ(&str.str(), &str.ref());
+  EXPECT_EQ(str.codePointAt(0), 0x4E2D);
+  EXPECT_EQ(str.wstr(), std::wstring(L"\x4E2D\x6587/file.txt"));
+  EXPECT_EQ(String(L"\x4E2D").str(), "\xe4\xb8\xad");
+  EXPECT_EQ(str.split("").size(), 11);
 }
+#endif
+
+#if JSCPP_STRING_UTF16
+TEST(jscppString, utf16Storage) {
+  String str = "\xf0\x9f\x8d\x8c.txt";
+  EXPECT_EQ(str.length(), 6);
+  EXPECT_EQ(str.charCodeAt(0), 0xD83C);
+  EXPECT_EQ(str.charCodeAt(1), 0xDF4C);
+  EXPECT_EQ(str.codePointAt(0), 0x1F34C);
+  EXPECT_EQ(str.str(), "\xf0\x9f\x8d\x8c.txt");
+  EXPECT_EQ(String(u"\xD83C\xDF4C").str(), "\xf0\x9f\x8d\x8c");
+  EXPECT_EQ(str + u'!', L"\xD83C\xDF4C.txt!");
+
+  String shortName = "node_modules";
+  EXPECT_LE(shortName.ref().capacity(), 23);
+  String longName = "a-rather-long-path-component-name.txt";
+  EXPECT_EQ(longName.length(), 37);
+  EXPECT_GT(longName.ref().capacity(), 23);
+  EXPECT_EQ(longName.slice(2, 8), L"rather");
+}
+#endif
 
 TEST(jscppString, codePointAt) {
   EXPECT_EQ(String("ABC").codePointAt(1), 66);
@@ -61,18 +118,18 @@ TEST(jscppString, codePointAt) {
 }
 
 TEST(jscppString, fromCharCode) {
-  EXPECT_STREQ(String::fromCharCode(65, 66, 67).data(), L"ABC");
-  EXPECT_STREQ(String::fromCharCode(0x2014).data(), L"—");
-  EXPECT_STREQ(String::fromCharCode(0x12014).data(), L"—");
-  EXPECT_STREQ(String::fromCharCode(8212).data(), L"—");
+  EXPECT_EQ(String::fromCharCode(65, 66, 67), L"ABC");
+  EXPECT_EQ(String::fromCharCode(0x2014), L"—");
+  EXPECT_EQ(String::fromCharCode(0x12014), L"—");
+  EXPECT_EQ(String::fromCharCode(8212), L"—");
 }
 
 TEST(jscppString, fromCodePoint) {
-  EXPECT_STREQ(String::fromCodePoint(42).data(), L"*");
-  EXPECT_STREQ(String::fromCodePoint(0x404).data(), L"\x0404");
-  EXPECT_STREQ(String::fromCodePoint(0x2F804).data(), L"\xD87E\xDC04");
-  EXPECT_STREQ(String::fromCodePoint(194564).data(), L"\xD87E\xDC04");
-  EXPECT_STREQ(String::fromCodePoint({ 0x1D306, 0x61, 0x1D307 }).data(), L"\xD834\xDF06\x61\xD834\xDF07");
+  EXPECT_EQ(String::fromCodePoint(42), L"*");
+  EXPECT_EQ(String::fromCodePoint(0x404), L"\x0404");
+  EXPECT_EQ(String::fromCodePoint(0x2F804), L"\xD87E\xDC04");
+  EXPECT_EQ(String::fromCodePoint(194564), L"\xD87E\xDC04");
+  EXPECT_EQ(String::fromCodePoint({ 0x1D306, 0x61, 0x1D307 }), L"\xD834\xDF06\x61\xD834\xDF07");
 #if JSCPP_USE_ERROR
   EXPECT_THROW(String::fromCodePoint(8888888), Error);
 #else
@@ -82,10 +139,17 @@ TEST(jscppString, fromCodePoint) {
 
 TEST(jscppString, concat) {
   String hello = "Hello, ";
-  EXPECT_STREQ(hello.concat("Kevin", ". Have a nice day.").data(), L"Hello, Kevin. Have a nice day.");
+  EXPECT_EQ(hello.concat("Kevin", ". Have a nice day."), L"Hello, Kevin. Have a nice day.");
 
   String str;
-  EXPECT_STREQ(str.concat("Hello", " ", "Venkat", "!").data(), L"Hello Venkat!");
+  EXPECT_EQ(str.concat("Hello", " ", "Venkat", "!"), L"Hello Venkat!");
+  EXPECT_EQ(str.concat(1, L'-', 2.5, true), L"1-2.5true");
+
+  String dir = "/usr";
+  String joined = dir + L"/" + "local" + '/' + L'b' + String("in");
+  EXPECT_EQ(joined, L"/usr/local/bin");
+  EXPECT_EQ(dir, L"/usr");
+  EXPECT_EQ(String(L"n=") + 3 + L',' + 1.5 + L',' + false, L"n=3,1.5,false");
 }
 
 TEST(jscppString, endsWith) {
@@ -117,65 +181,175 @@ TEST(jscppString, lastIndexOf) {
 TEST(jscppString, padEnd) {
   String str = "abc";
 
-  EXPECT_STREQ(str.padEnd(10).data(), L"abc       ");
-  EXPECT_STREQ(str.padEnd(10, "foo").data(), L"abcfoofoof");
-  EXPECT_STREQ(str.padEnd(6, "123456").data(), L"abc123");
-  EXPECT_STREQ(str.padEnd(1).data(), L"abc");
+  EXPECT_EQ(str.padEnd(10), L"abc       ");
+  EXPECT_EQ(str.padEnd(10, "foo"), L"abcfoofoof");
+  EXPECT_EQ(str.padEnd(6, "123456"), L"abc123");
+  EXPECT_EQ(str.padEnd(1), L"abc");
 }
 
 TEST(jscppString, padStart) {
   String str = "abc";
 
-  EXPECT_STREQ(str.padStart(10).data(), L"       abc");
-  EXPECT_STREQ(str.padStart(10, "foo").data(), L"foofoofabc");
-  EXPECT_STREQ(str.padStart(6, "123456").data(), L"123abc");
-  EXPECT_STREQ(str.padStart(8, "0").data(), L"00000abc");
-  EXPECT_STREQ(str.padStart(1).data(), L"abc");
+  EXPECT_EQ(str.padStart(10), L"       abc");
+  EXPECT_EQ(str.padStart(10, "foo"), L"foofoofabc");
+  EXPECT_EQ(str.padStart(6, "123456"), L"123abc");
+  EXPECT_EQ(str.padStart(8, "0"), L"00000abc");
+  EXPECT_EQ(str.padStart(1), L"abc");
 }
 
 TEST(jscppString, repeat) {
   String str = "abc";
 
-  EXPECT_STREQ(str.repeat(0).data(), L"");
-  EXPECT_STREQ(str.repeat(1).data(), L"abc");
-  EXPECT_STREQ(str.repeat(2).data(), L"abcabc");
+  EXPECT_EQ(str.repeat(0), L"");
+  EXPECT_EQ(str.repeat(1), L"abc");
+  EXPECT_EQ(str.repeat(2), L"abcabc");
 }
 
 TEST(jscppString, replace) {
   String str = L"中文一二三中文";
 
-  EXPECT_STREQ(str.replace(L"中文", L"英文").data(), L"英文一二三中文");
-  EXPECT_STREQ(str.replace(std::wregex(L"中文"), L"英文").data(), L"英文一二三英文");
+  EXPECT_EQ(str.replace(L"中文", L"英文"), L"英文一二三中文");
+  EXPECT_EQ(str.replace(std::wregex(L"中文"), L"英文"), L"英文一二三英文");
+}
+
+TEST(jscppString, replaceAll) {
+  String str = L"中文一二三中文";
+  EXPECT_EQ(str.replaceAll(L"中文", L"英文"), L"英文一二三英文");
+  EXPECT_EQ(str.replaceAll(L"四", L"五"), str);
+  EXPECT_EQ(String("aaaa").replaceAll("aa", "b"), L"bb");
+  EXPECT_EQ(String("a.b.c").replaceAll(".", ""), L"abc");
+  EXPECT_EQ(String("abc").replaceAll("", "-"), L"-a-b-c-");
+  EXPECT_EQ(String("").replaceAll("", "-"), L"-");
+}
+
+TEST(jscppString, regexp) {
+  String log = L"2024-01-02 ERROR disk full\n2024-01-03 INFO ok\n2024-01-04 ERROR 中文";
+  RegExp date(L"(\\d{4})-(\\d\\d)-(\\d\\d)", L"g");
+  EXPECT_TRUE(date.global());
+  EXPECT_TRUE(date.linear());
+  EXPECT_EQ(log.match(date), std::vector<String>({ L"2024-01-02", L"2024-01-03", L"2024-01-04" }));
+  EXPECT_EQ(log.replace(date, L"$3/$2/$1"), L"02/01/2024 ERROR disk full\n03/01/2024 INFO ok\n04/01/2024 ERROR 中文");
+  EXPECT_EQ(log.replaceAll(date, L"[$&]").substring(0, 13), L"[2024-01-02] ");
+
+  std::vector<RegExpMatch> all = log.matchAll(RegExp(L"^(\\S+) (ERROR|INFO)", L"gm"));
+  ASSERT_EQ(all.size(), 3);
+  EXPECT_EQ(all[1].index, log.indexOf(L"2024-01-03"));
+  EXPECT_EQ(all[1][2], L"INFO");
+  EXPECT_EQ(log.search(RegExp(L"中文$")), log.indexOf(L"中文"));
+  EXPECT_EQ(log.search(RegExp(L"WARN")), String::string_type::npos);
+
+  std::vector<String> first = String(L"key=value").match(RegExp(L"(\\w+)=(\\w+)|(x)"));
+  EXPECT_EQ(first, std::vector<String>({ L"key=value", L"key", L"value", L"" }));
+  EXPECT_EQ(String(L"aaa").replace(RegExp(L"a*?"), L"-"), L"-aaa");
+  EXPECT_EQ(String(L"aaa").replace(RegExp(L"a*?", L"g"), L"-"), L"-a-a-a-");
+  EXPECT_EQ(String(L"abcABC").replace(RegExp(L"[a-c]+", L"gi"), L"x"), L"x");
+  EXPECT_EQ(String(L"a\nb").replace(RegExp(L"a.b", L"s"), L"$$"), L"$");
+  EXPECT_EQ(String(L"price 10").replace(RegExp(L"\\d+"), L"$`|$'|$9"), L"price price ||$9");
+  EXPECT_EQ(String(L"one two").replace(RegExp(L"\\bt"), L"T"), L"one Two");
+  EXPECT_EQ(String(L"abab").replace(RegExp(L"(a|ab)(c|bab)"), L"[$1,$2]"), L"[a,bab]");
+  // Captures inside a quantified group start over on every iteration
+  EXPECT_EQ(String(L"zaacbbbcac").match(RegExp(L"(z)((a+)?(b+)?(c))*")),
+    std::vector<String>({ L"zaacbbbcac", L"z", L"ac", L"a", L"", L"c" }));
+  EXPECT_EQ(String(L"ab").replace(RegExp(L"((a)|b)+"), L"[$1,$2]"), L"[b,]");
+  EXPECT_EQ(String(L"aaa").replace(RegExp(L"a{2}", L"y"), L"b"), L"ba");
+  EXPECT_EQ(String(L"xaa").replace(RegExp(L"a", L"y"), L"b"), L"xaa");
+
+  EXPECT_EQ(String(L"a1b22c").split(RegExp(L"\\d+")), std::vector<String>({ L"a", L"b", L"c" }));
+  EXPECT_EQ(String(L"a1b22c").split(RegExp(L"(\\d)+"), 3), std::vector<String>({ L"a", L"1", L"b" }));
+  EXPECT_EQ(String(L"abc").split(RegExp(L"")), std::vector<String>({ L"a", L"b", L"c" }));
+  EXPECT_EQ(String(L"").split(RegExp(L"x")), std::vector<String>({ L"" }));
+  EXPECT_EQ(String(L"").split(RegExp(L"x*")), std::vector<String>());
+  EXPECT_EQ(String(L"中,文").split(RegExp(L",")), std::vector<String>({ L"中", L"文" }));
+
+  RegExp word(L"o", L"g");
+  EXPECT_TRUE(word.test(L"foo"));
+  EXPECT_EQ(word.lastIndex, 2);
+  RegExpMatch m = word.exec(L"foo");
+  EXPECT_TRUE(m);
+  EXPECT_EQ(m.index, 2);
+  EXPECT_FALSE(word.exec(L"foo"));
+  EXPECT_EQ(word.lastIndex, 0);
+
+  // Backreferences fall back to the backtracking engine
+  RegExp twice(L"(\\w)\\1");
+  EXPECT_FALSE(twice.linear());
+  EXPECT_EQ(String(L"中abccd").replace(twice, L"<$1>"), L"中ab<c>d");
+#if JSCPP_USE_ERROR
+  EXPECT_THROW(RegExp(L"(\\w)\\1", L"l"), std::exception);
+  EXPECT_THROW(RegExp(L"a", L"gg"), std::exception);
+  EXPECT_THROW(RegExp(L"(a"), std::exception);
+  EXPECT_THROW(String(L"a").replaceAll(RegExp(L"a"), L"b"), std::exception);
+  EXPECT_THROW(String(L"a").matchAll(RegExp(L"a")), std::exception);
+#else
+  EXPECT_DEATH_IF_SUPPORTED(RegExp(L"(\\w)\\1", L"l"), "linear time");
+  EXPECT_DEATH_IF_SUPPORTED(RegExp(L"a", L"gg"), "Invalid flags");
+  EXPECT_DEATH_IF_SUPPORTED(RegExp(L"(a"), "Invalid regular expression");
+  EXPECT_DEATH_IF_SUPPORTED(String(L"a").replaceAll(RegExp(L"a"), L"b"), "global RegExp");
+  EXPECT_DEATH_IF_SUPPORTED(String(L"a").matchAll(RegExp(L"a")), "non-global RegExp");
+#endif
+
+  // Catastrophic for a backtracking engine, linear here
+  String evil = String(L"a").repeat(5000);
+  EXPECT_EQ(evil.search(RegExp(L"(a*)*b")), String::string_type::npos);
+}
+
+TEST(jscppString, search) {
+  std::wstring text;
+  for (int i = 0; i < 2000; i++) {
+    text += (wchar_t)(L'a' + (i * 7919) % 5);
+    if (i % 97 == 0) text += L'\x4E2D';
+  }
+  String str = text;
+  const size_t npos = std::wstring::npos;
+  for (size_t len = 1; len <= 80; len += 3) {
+    for (size_t at = 0; at + len <= text.size(); at += 131) {
+      String pattern = text.substr(at, len);
+      EXPECT_EQ(str.indexOf(pattern), str.ref().find(pattern.ref()));
+      EXPECT_EQ(str.indexOf(pattern, at + 1), str.ref().find(pattern.ref(), at + 1));
+      EXPECT_EQ(str.lastIndexOf(pattern), str.ref().rfind(pattern.ref()));
+      EXPECT_EQ(str.lastIndexOf(pattern, at), str.ref().rfind(pattern.ref(), at));
+    }
+  }
+  String missing = std::wstring(40, L'e');
+  EXPECT_EQ(str.indexOf(missing), npos);
+  EXPECT_EQ(str.lastIndexOf(missing), npos);
+  EXPECT_EQ(str.indexOf(L"", 5), 5);
+  EXPECT_EQ(str.lastIndexOf(L""), str.length());
+  EXPECT_EQ(String("abc").indexOf("c", 5), npos);
 }
 
 TEST(jscppString, slice) {
   String str = "The morning is upon us.";
 
-  EXPECT_STREQ(str.slice(1, 8).data(), L"he morn");
-  EXPECT_STREQ(str.slice(4, -2).data(), L"morning is upon u");
-  EXPECT_STREQ(str.slice(12).data(), L"is upon us.");
-  EXPECT_STREQ(str.slice(30).data(), L"");
-  EXPECT_STREQ(str.slice(-3).data(), L"us.");
-  EXPECT_STREQ(str.slice(-3, -1).data(), L"us");
-  EXPECT_STREQ(str.slice(0, -1).data(), L"The morning is upon us");
+  EXPECT_EQ(str.slice(1, 8), L"he morn");
+  EXPECT_EQ(str.slice(4, -2), L"morning is upon u");
+  EXPECT_EQ(str.slice(12), L"is upon us.");
+  EXPECT_EQ(str.slice(30), L"");
+  EXPECT_EQ(str.slice(-3), L"us.");
+  EXPECT_EQ(str.slice(-3, -1), L"us");
+  EXPECT_EQ(str.slice(0, -1), L"The morning is upon us");
+  EXPECT_EQ(str.slice(-100, 3), L"The");
+  EXPECT_EQ(str.slice(4, 2), L"");
+  EXPECT_EQ(str.slice(-2, -3), L"");
+  EXPECT_EQ(str.slice(3, 3), L"");
 }
 
 TEST(jscppString, split) {
   String myString = "Hello World. How are you doing?";
   std::vector<String> splits = myString.split(" ", 3);
   EXPECT_EQ(splits.size(), 3);
-  EXPECT_STREQ(splits[0].data(), L"Hello");
-  EXPECT_STREQ(splits[1].data(), L"World.");
-  EXPECT_STREQ(splits[2].data(), L"How");
+  EXPECT_EQ(splits[0], L"Hello");
+  EXPECT_EQ(splits[1], L"World.");
+  EXPECT_EQ(splits[2], L"How");
 
   std::vector<String> splits2 = myString.split(" ");
   EXPECT_EQ(splits2.size(), 6);
-  EXPECT_STREQ(splits2[0].data(), L"Hello");
-  EXPECT_STREQ(splits2[1].data(), L"World.");
-  EXPECT_STREQ(splits2[2].data(), L"How");
-  EXPECT_STREQ(splits2[3].data(), L"are");
-  EXPECT_STREQ(splits2[4].data(), L"you");
-  EXPECT_STREQ(splits2[5].data(), L"doing?");
+  EXPECT_EQ(splits2[0], L"Hello");
+  EXPECT_EQ(splits2[1], L"World.");
+  EXPECT_EQ(splits2[2], L"How");
+  EXPECT_EQ(splits2[3], L"are");
+  EXPECT_EQ(splits2[4], L"you");
+  EXPECT_EQ(splits2[5], L"doing?");
 
   std::vector<String> splits3 = myString.split();
   EXPECT_EQ(splits3.size(), 1);
@@ -185,6 +359,39 @@ TEST(jscppString, split) {
   EXPECT_EQ(splits4.size(), myString.length());
 }
 
+TEST(jscppString, view) {
+  String str = "The quick brown fox";
+  StringView view = str;
+  EXPECT_EQ(view.data(), str.data());
+  EXPECT_EQ(view.length(), str.length());
+
+  StringView quick = view.slice(4, 9);
+  EXPECT_EQ(quick, String("quick"));
+  EXPECT_EQ(quick.data(), str.data() + 4);
+  EXPECT_EQ(quick.toString(), L"quick");
+  EXPECT_EQ(view.substring(16, 10), String("brown "));
+  EXPECT_EQ(view.slice(-3), String("fox"));
+  EXPECT_EQ(view.slice(9, 4).length(), 0);
+  EXPECT_EQ(view.charCodeAt(0), 84);
+
+  EXPECT_TRUE(view.startsWith(quick, 4));
+  EXPECT_FALSE(view.startsWith(quick));
+  EXPECT_TRUE(view.endsWith(String("fox")));
+  EXPECT_FALSE(view.endsWith(String("quick brown"), 4));
+  EXPECT_EQ(view.indexOf(String("o")), 12);
+  EXPECT_EQ(view.lastIndexOf(String("o")), 17);
+  EXPECT_EQ(view.indexOf(String("cat")), StringView::npos);
+  EXPECT_TRUE(str.includes(quick));
+  EXPECT_EQ(str.indexOf(quick), 4);
+
+  std::vector<StringView> words = view.split(String(" "));
+  EXPECT_EQ(words.size(), 4);
+  EXPECT_EQ(words[3], String("fox"));
+  EXPECT_EQ(words[3].data(), str.data() + 16);
+  EXPECT_EQ(view.split(String(" "), 2).size(), 2);
+  EXPECT_EQ(str.split(view.charAt(3)).size(), 4);
+}
+
 TEST(jscppString, startsWith) {
   String str = "To be, or not to be, that is the question.";
 
@@ -194,19 +401,76 @@ TEST(jscppString, startsWith) {
 }
 
 TEST(jscppString, toCase) {
-  EXPECT_STREQ(String(L"中文简体 zh-CN || zh-Hans").toLowerCase().data(), L"中文简体 zh-cn || zh-hans");
-  EXPECT_STREQ(String("ALPHABET").toLowerCase().data(), L"alphabet");
+  EXPECT_EQ(String(L"中文简体 zh-CN || zh-Hans").toLowerCase(), L"中文简体 zh-cn || zh-hans");
+  EXPECT_EQ(String("ALPHABET").toLowerCase(), L"alphabet");
+
+  EXPECT_EQ(String(L"中文简体 zh-cn || zh-hans").toUpperCase(), L"中文简体 ZH-CN || ZH-HANS");
+  EXPECT_EQ(String("alphabet").toUpperCase(), L"ALPHABET");
+
+  EXPECT_EQ(String(L"ÀÉÎÕÜ ÑANDÚ").toLowerCase(), L"àéîõü ñandú");
+  EXPECT_EQ(String(L"straße").toUpperCase(), L"STRASSE");
+  EXPECT_EQ(String(L"\u0130").toLowerCase(), L"i\u0307");
+  EXPECT_EQ(String(L"ΌΣΟΣ Σ").toLowerCase(), L"όσος σ");
+  EXPECT_EQ(String(L"ΑΣ'Σ").toLowerCase(), L"ασ'ς");
+  EXPECT_EQ(String(L"Привет Мир").toUpperCase(), L"ПРИВЕТ МИР");
+  EXPECT_EQ(String(L"\U00010400x").toLowerCase(), L"\U00010428x");
+  EXPECT_EQ(String(L"ﬁ").toUpperCase(), L"FI");
+  String mixed = String(L"Mixed ASCII text long enough for vectors, ").repeat(3) + L"É";
+  EXPECT_EQ(mixed.toUpperCase(), String(L"MIXED ASCII TEXT LONG ENOUGH FOR VECTORS, ").repeat(3) + L"É");
+  EXPECT_EQ(mixed.toLowerCase(), String(L"mixed ascii text long enough for vectors, ").repeat(3) + L"é");
+}
+
+TEST(jscppString, normalize) {
+  String composed = L"caf\u00E9 \uAC00 \u1E69";
+  String decomposed = L"cafe\u0301 \u1100\u1161 s\u0323\u0307";
+  EXPECT_EQ(composed.normalize(), composed);
+  EXPECT_EQ(composed.normalize(L"NFD"), decomposed);
+  EXPECT_EQ(decomposed.normalize(L"NFC"), composed);
+  EXPECT_EQ(String(L"s\u0307\u0323").normalize(), L"\u1E69");
+  EXPECT_EQ(String(L"\u212B").normalize(), L"\u00C5");
+  EXPECT_EQ(String(L"\uFB01 x\u00B2").normalize(L"NFKC"), L"fi x2");
+  EXPECT_EQ(String(L"\u1E9B\u0323").normalize(L"NFKD"), L"s\u0323\u0307");
+  EXPECT_EQ(String(L"ascii only").normalize(L"NFD"), L"ascii only");
+#if JSCPP_USE_ERROR
+  EXPECT_THROW(composed.normalize(L"nfc"), std::exception);
+#else
+  EXPECT_DEATH_IF_SUPPORTED(composed.normalize(L"nfc"), "normalization form");
+#endif
+}
 
-  EXPECT_STREQ(String(L"中文简体 zh-cn || zh-hans").toUpperCase().data(), L"中文简体 ZH-CN || ZH-HANS");
-  EXPECT_STREQ(String("alphabet").toUpperCase().data(), L"ALPHABET");
+TEST(jscppString, localeCompare) {
+  EXPECT_EQ(String(L"a").localeCompare(L"a"), 0);
+  EXPECT_LT(String(L"a").localeCompare(L"B"), 0);
+  EXPECT_GT(String(L"b").localeCompare(L"A"), 0);
+  EXPECT_LT(String(L"a").localeCompare(L"A"), 0);
+  EXPECT_LT(String(L"resume").localeCompare(L"résumé"), 0);
+  EXPECT_LT(String(L"résumé").localeCompare(L"resumes"), 0);
+  EXPECT_LT(String(L"Äpfel").localeCompare(L"Birne"), 0);
+  EXPECT_EQ(String(L"caf\u00E9").localeCompare(L"cafe\u0301"), 0);
+
+  std::vector<String> names = { L"zeta", L"Émile", L"apple", L"Zoe", L"eve", L"Apple" };
+  std::sort(names.begin(), names.end(), [](const String& a, const String& b) { return a.localeCompare(b) < 0; });
+  EXPECT_EQ(names, std::vector<String>({ L"apple", L"Apple", L"Émile", L"eve", L"zeta", L"Zoe" }));
 }
 
 TEST(jscppString, trim) {
-  EXPECT_STREQ(String("   foo  ").trim().data(), L"foo");
-  EXPECT_STREQ(String("foo    ").trim().data(), L"foo");
-
-  EXPECT_STREQ(String("   foo  ").trimEnd().data(), L"   foo");
-  EXPECT_STREQ(String("   foo  ").trimStart().data(), L"foo  ");
+  EXPECT_EQ(String("   foo  ").trim(), L"foo");
+  EXPECT_EQ(String("foo    ").trim(), L"foo");
+
+  EXPECT_EQ(String("   foo  ").trimEnd(), L"   foo");
+  EXPECT_EQ(String("   foo  ").trimStart(), L"foo  ");
+
+  EXPECT_EQ(String(" foo  bar\t").trim(), L"foo  bar");
+  EXPECT_EQ(String(L"\xFEFF\x3000\x2028\r\n foo \xA0\x2009\x1680").trim(), L"foo");
+  EXPECT_EQ(String(L"\x200B foo \x200B").trim(), L"\x200B foo \x200B");
+  EXPECT_EQ(String(L"\xA0 \x2029").trim(), L"");
+  EXPECT_EQ(String(L"  \x4E2D\x6587 ").trimEnd(), L"  \x4E2D\x6587");
+  EXPECT_EQ(String("                    padded                    ").trim(), L"padded");
+
+  String line = "  [info] started  ";
+  StringView trimmed = StringView(line).trim();
+  EXPECT_EQ(trimmed, String("[info] started"));
+  EXPECT_EQ(trimmed.data(), line.data() + 2);
 }
 
 TEST(jscppString, rangeFor) {
@@ -121,6 +121,33 @@ TEST(jscppPath, parseAndFormat) {
   EXPECT_EQ(path::win32::format(obj4), L"C:\\path\\dir\\file.txt");
 }
 
+TEST(jscppPath, views) {
+  String file = "/home/user/dir/file.txt";
+  StringView view = file;
+  EXPECT_TRUE(path::posix::isAbsolute(view));
+  EXPECT_EQ(path::posix::dirname(view), String("/home/user/dir"));
+  EXPECT_EQ(path::posix::dirname(view).data(), file.data());
+  EXPECT_EQ(path::posix::basename(view), String("file.txt"));
+  EXPECT_EQ(path::posix::basename(view, String(".txt")), String("file"));
+  EXPECT_EQ(path::posix::extname(view), String(".txt"));
+  EXPECT_EQ(path::posix::dirname(StringView()), String("."));
+
+  path::ParsedPathView p = path::posix::parse(view);
+  EXPECT_EQ(p.root, String("/"));
+  EXPECT_EQ(p.dir, String("/home/user/dir"));
+  EXPECT_EQ(p.base, String("file.txt"));
+  EXPECT_EQ(p.ext, String(".txt"));
+  EXPECT_EQ(p.name, String("file"));
+  EXPECT_EQ(p.name.data(), file.data() + 15);
+
+  String winFile = "C:\\path\\dir\\file.txt";
+  path::ParsedPathView p2 = path::win32::parse(StringView(winFile));
+  EXPECT_EQ(p2.root, String("C:\\"));
+  EXPECT_EQ(p2.dir, String("C:\\path\\dir"));
+  EXPECT_EQ(p2.name, String("file"));
+  EXPECT_EQ(path::win32::dirname(StringView(winFile)), String("C:\\path\\dir"));
+}
+
 TEST(jscppPath, constants) {
   EXPECT_EQ(path::win32::sep, L"\\");
   EXPECT_EQ(path::posix::sep, L"/");
@@ -1,5 +1,15 @@
 #include "gtest/gtest.h"
 #include "jscpp/index.hpp"
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
 
 using namespace js;
 
@@ -48,11 +58,109 @@ TEST(jscppFilesystem, statAndLstat) {
   EXPECT_FALSE(fs::exists("slk2"));
 }
 
+TEST(jscppFilesystem, statFields) {
+  fs::writeFile("./tmpstat.txt", "12345");
+  fs::Stats stats = fs::stat("./tmpstat.txt");
+  EXPECT_TRUE(stats.isFile());
+  EXPECT_EQ(stats.size, 5);
+  EXPECT_EQ(stats.mask & fs::SF_BASIC & ~fs::SF_BLOCKS, fs::SF_BASIC & ~fs::SF_BLOCKS);
+  EXPECT_EQ(stats.mtimeNs / 1000000000, (int64_t)stats.mtime);
+  EXPECT_EQ(stats.atimeNs / 1000000000, (int64_t)stats.atime);
+  if (stats.mask & fs::SF_BIRTHTIME) {
+    EXPECT_LE(stats.birthtimeNs, stats.mtimeNs);
+  }
+#ifndef _WIN32
+  EXPECT_GT(stats.ino, 0);
+  EXPECT_GT(stats.blksize, 0);
+#endif
+
+  // The type is always there, whatever else is left out
+  fs::Stats typeOnly = fs::lstat("./tmpstat.txt", fs::SF_TYPE);
+  EXPECT_TRUE(typeOnly.mask & fs::SF_TYPE);
+  EXPECT_TRUE(typeOnly.isFile());
+  EXPECT_FALSE(fs::Stats().isFile());
+  EXPECT_EQ(fs::Stats().mask, 0);
+
+  fs::remove("./tmpstat.txt");
+}
+
+TEST(jscppFilesystem, statMany) {
+  fs::mkdirs("./tmpstatmany");
+  std::vector<String> paths;
+  for (int i = 0; i < 300; i++) {
+    String p = "./tmpstatmany/" + String(i);
+    if (i % 3 != 0) fs::writeFile(p, String(i));
+    paths.push_back(p);
+  }
+  paths.push_back("./tmpstatmany");
+
+  fs::StatManyOptions options;
+  for (int pass = 0; pass < 2; pass++) {
+    options.ioUring = pass == 0;
+    // A shallow queue, so slots get reused
+    options.concurrency = pass == 0 ? 8 : 0;
+    std::vector<std::pair<int, fs::Stats>> res = fs::statMany(paths, options);
+    ASSERT_EQ(res.size(), paths.size());
+    for (size_t i = 0; i + 1 < paths.size(); i++) {
+      if (i % 3 == 0) {
+        EXPECT_EQ(res[i].first, ENOENT);
+      } else {
+        EXPECT_EQ(res[i].first, 0);
+        EXPECT_TRUE(res[i].second.isFile());
+        EXPECT_EQ(res[i].second.size, (int64_t)String((int)i).length());
+        EXPECT_EQ(res[i].second.ino, fs::stat(paths[i]).ino);
+      }
+    }
+    EXPECT_EQ(res.back().first, 0);
+    EXPECT_TRUE(res.back().second.isDirectory());
+  }
+
+  EXPECT_TRUE(fs::statMany(std::vector<String>()).empty());
+  fs::remove("./tmpstatmany");
+}
+
 TEST(jscppFilesystem, readdir) {
   std::vector<String> items = fs::readdir(__dirname);
   console.log(items);
 }
 
+TEST(jscppFilesystem, readdirWithFileTypes) {
+  fs::mkdirs("./tmpreaddir/sub");
+  fs::writeFile("./tmpreaddir/file.txt", "x");
+  fs::writeFile(L"./tmpreaddir/\u6587\u4ef6", "x");
+
+  fs::DirentList list = fs::readdirWithFileTypes("./tmpreaddir");
+  ASSERT_EQ(list.size(), 3);
+  std::map<String, fs::FileType> types;
+  for (const fs::DirentInfo& entry : list) {
+    types[entry.name.toString()] = entry.type;
+  }
+  EXPECT_EQ(types[L"sub"], fs::FT_DIRECTORY);
+  EXPECT_EQ(types[L"file.txt"], fs::FT_FILE);
+  EXPECT_EQ(types[L"\u6587\u4ef6"], fs::FT_FILE);
+
+  // Moving keeps the names where they are
+  fs::DirentList moved = std::move(list);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_TRUE(types.count(moved[0].name.toString()) == 1);
+
+  fs::Dir dir = fs::opendir("./tmpreaddir");
+  size_t count = 0;
+  for (const fs::DirentView& entry : dir) {
+    count++;
+    String name = entry.name();
+    EXPECT_EQ(entry.type(), types[name]);
+    EXPECT_EQ(entry.isDirectory(), name == L"sub");
+  }
+  EXPECT_EQ(count, 3);
+  EXPECT_TRUE(dir.begin() == dir.end());
+  dir.close();
+
+  EXPECT_TRUE(fs::readdirWithFileTypes("./tmpreaddir/sub").empty());
+  JSCPP_EXPECT_THROW(fs::readdirWithFileTypes("./notexists"), "opendir");
+  fs::remove("./tmpreaddir");
+}
+
 TEST(jscppFilesystem, exists) {
 #ifndef __EMSCRIPTEN__
   EXPECT_TRUE(fs::exists(__filename));
@@ -129,6 +237,241 @@ TEST(jscppFilesystem, copy) {
   EXPECT_FALSE(fs::exists("./tmp"));
 }
 
+TEST(jscppFilesystem, copyFileStrategy) {
+  std::vector<uint8_t> data(3 * 1024 * 1024 + 7);
+  for (size_t i = 0; i < data.size(); i++) data[i] = (uint8_t)(i * 7);
+  fs::writeFile("testcopy.bin", data);
+#ifndef _WIN32
+  fs::chmod("testcopy.bin", 0640);
+#endif
+
+  fs::CopyFileOptions options;
+  options.preserveTimestamps = true;
+  fs::CopyFileStrategy strategy = fs::copyFile("testcopy.bin", "testcopy2.bin", options);
+  EXPECT_NE(strategy, fs::CF_NONE);
+  EXPECT_EQ(fs::readFile("testcopy2.bin"), data);
+  fs::Stats a = fs::stat("testcopy.bin");
+  fs::Stats b = fs::stat("testcopy2.bin");
+  EXPECT_EQ(a.mode, b.mode);
+  EXPECT_EQ(a.mtime, b.mtime);
+
+  options.failIfExists = true;
+  JSCPP_EXPECT_THROW(fs::copyFile("testcopy.bin", "testcopy2.bin", options), "");
+  EXPECT_EQ(fs::copyFile("testcopy.bin", "./testcopy.bin", options), fs::CF_NONE);
+
+  // Overwriting truncates a longer destination
+  fs::writeFile("testcopy.bin", "short");
+  fs::copyFile("testcopy.bin", "testcopy2.bin");
+  EXPECT_EQ(fs::readFileAsString("testcopy2.bin"), L"short");
+
+#ifdef __linux__
+  // procfs files report size 0 but still have content
+  fs::copyFile("/proc/self/status", "testcopy2.bin");
+  EXPECT_GT(fs::stat("testcopy2.bin").size, 0);
+#endif
+
+  fs::remove("testcopy.bin");
+  fs::remove("testcopy2.bin");
+}
+
+TEST(jscppFilesystem, parallelCopyAndRemove) {
+  for (int i = 0; i < 10; i++) {
+    String dir = L"./tmptree/d" + String(i) + L"/sub";
+    fs::mkdirs(dir);
+    for (int j = 0; j < 10; j++) {
+      fs::writeFile(path::join(dir, String(j) + L".txt"), String(i * 10 + j));
+    }
+    fs::writeFile(path::join(dir, L"ignored.skip"), "x");
+  }
+#ifndef _WIN32
+  fs::symlink("d0/sub/0.txt", "./tmptree/link");
+#endif
+
+  fs::CopyOptions options;
+  options.concurrency = 4;
+  options.filter = [](const String& source, const String&) {
+    return !source.endsWith(L".skip");
+  };
+  fs::copy("./tmptree", "./tmptree2", options);
+  EXPECT_EQ(fs::readFileAsString("./tmptree2/d7/sub/3.txt"), L"73");
+  EXPECT_FALSE(fs::exists("./tmptree2/d7/sub/ignored.skip"));
+#ifndef _WIN32
+  EXPECT_TRUE(fs::lstat("./tmptree2/link").isSymbolicLink());
+  EXPECT_EQ(fs::readFileAsString("./tmptree2/link"), L"0");
+#endif
+
+  // Every conflict is collected before throwing
+  options.errorOnExist = true;
+  JSCPP_EXPECT_THROW(fs::copy("./tmptree", "./tmptree2", options), "more errors");
+
+  fs::RemoveOptions removeOptions;
+  removeOptions.concurrency = 4;
+  fs::remove("./tmptree", removeOptions);
+  fs::remove("./tmptree2", removeOptions);
+  EXPECT_FALSE(fs::exists("./tmptree"));
+  EXPECT_FALSE(fs::exists("./tmptree2"));
+  EXPECT_NO_THROW(fs::remove("./tmptree", removeOptions));
+}
+
+TEST(jscppFilesystem, move) {
+  fs::mkdirs("testmove/a");
+  fs::writeFile("testmove/a/b.txt", "b");
+  uint64_t ino = fs::stat("testmove/a/b.txt").ino;
+
+  // A rename, so the file itself stays where it was on disk
+  fs::move("testmove", "testmoved");
+  EXPECT_FALSE(fs::exists("testmove"));
+  EXPECT_EQ(fs::stat("testmoved/a/b.txt").ino, ino);
+
+  fs::move("testmoved/a/b.txt", "testmoved/x/y/b.txt");
+  EXPECT_EQ(fs::readFileAsString("testmoved/x/y/b.txt"), "b");
+
+  fs::writeFile("testmoved/c.txt", "c");
+  fs::MoveOptions options;
+  options.noReplace = true;
+  std::error_code ec;
+  fs::move("testmoved/c.txt", "testmoved/x/y/b.txt", options, ec);
+  EXPECT_EQ(ec, std::errc::file_exists);
+  EXPECT_EQ(fs::readFileAsString("testmoved/x/y/b.txt"), "b");
+
+  options = fs::MoveOptions();
+  options.exchange = true;
+  fs::move("testmoved/c.txt", "testmoved/x/y/b.txt", options, ec);
+  if (!(ec == std::errc::operation_not_supported) && !(ec == std::errc::invalid_argument)) {
+    EXPECT_FALSE(ec);
+    EXPECT_EQ(fs::readFileAsString("testmoved/c.txt"), "b");
+    EXPECT_EQ(fs::readFileAsString("testmoved/x/y/b.txt"), "c");
+  }
+
+  // Into a directory that is already there, the contents are merged
+  fs::mkdirs("testmovesrc/y");
+  fs::writeFile("testmovesrc/y/d.txt", "d");
+  fs::move("testmovesrc", "testmoved/x");
+  EXPECT_FALSE(fs::exists("testmovesrc"));
+  EXPECT_TRUE(fs::exists("testmoved/x/y/b.txt"));
+  EXPECT_EQ(fs::readFileAsString("testmoved/x/y/d.txt"), "d");
+
+  fs::move("notexists", "testmoved/notexists", ec);
+  EXPECT_EQ(ec, std::errc::no_such_file_or_directory);
+
+#ifdef __linux__
+  // Across devices the files are copied and deleted one by one
+  fs::Stats shm;
+  if (fs::Stats::createNoThrow(shm, "/dev/shm", true) == 0 && shm.dev != fs::stat(".").dev) {
+    time_t mtime = fs::stat("testmoved/x/y/d.txt").mtime;
+    fs::move("testmoved", "/dev/shm/jscpp-testmoved");
+    EXPECT_FALSE(fs::exists("testmoved"));
+    EXPECT_EQ(fs::readFileAsString("/dev/shm/jscpp-testmoved/x/y/d.txt"), "d");
+    EXPECT_EQ(fs::stat("/dev/shm/jscpp-testmoved/x/y/d.txt").mtime, mtime);
+    fs::move("/dev/shm/jscpp-testmoved", "testmoved");
+    EXPECT_FALSE(fs::exists("/dev/shm/jscpp-testmoved"));
+  }
+#endif
+
+  fs::remove("testmoved");
+}
+
+TEST(jscppFilesystem, dirHandle) {
+  fs::mkdirs("./tmphandle/a/b");
+  fs::DirHandle root = fs::DirHandle::open("./tmphandle");
+  EXPECT_TRUE(root.isOpen());
+  EXPECT_TRUE(root.stat(L"a").isDirectory());
+  JSCPP_EXPECT_THROW(root.stat(L"missing"), "lstat");
+
+  fs::DirHandle a = root.openAt(L"a");
+  a.mkdir(L"c");
+  fs::writeFile("./tmphandle/a/c/file.txt", "x");
+  std::vector<String> items = a.readdir();
+  std::sort(items.begin(), items.end(), [](const String& l, const String& r) { return l.str() < r.str(); });
+  ASSERT_EQ(items.size(), 2);
+  EXPECT_EQ(items[0], L"b");
+  EXPECT_EQ(items[1], L"c");
+  // Listing again starts from the beginning
+  EXPECT_EQ(a.readdir().size(), 2);
+
+  fs::DirHandle c = a.openAt(L"c");
+  fs::Stats stats;
+  EXPECT_EQ(c.statNoThrow(stats, L"file.txt"), 0);
+  EXPECT_TRUE(stats.isFile());
+  c.unlink(L"file.txt");
+  EXPECT_EQ(c.statNoThrow(stats, L"file.txt"), ENOENT);
+  c.close();
+  EXPECT_FALSE(c.isOpen());
+  a.rmdir(L"c");
+  EXPECT_FALSE(fs::exists("./tmphandle/a/c"));
+  JSCPP_EXPECT_THROW(a.rmdir(L"c"), "rmdir");
+
+#ifndef _WIN32
+  root.symlink(L"a", L"link");
+  EXPECT_EQ(root.readlink(L"link"), L"a");
+  EXPECT_EQ(fs::readlink("./tmphandle/link"), L"a");
+  EXPECT_TRUE(root.stat(L"link").isSymbolicLink());
+  EXPECT_TRUE(root.stat(L"link", true).isDirectory());
+  JSCPP_EXPECT_THROW(root.openAt(L"link"), "opendir");
+  EXPECT_NO_THROW(root.openAt(L"link", true));
+#endif
+
+  fs::DirHandle moved = std::move(a);
+  EXPECT_FALSE(a.isOpen());
+  EXPECT_TRUE(moved.isOpen());
+
+  fs::remove("./tmphandle");
+  EXPECT_FALSE(fs::exists("./tmphandle"));
+}
+
+TEST(jscppFilesystem, walk) {
+  for (int i = 0; i < 5; i++) {
+    fs::mkdirs(L"./tmpwalk/d" + String(i) + L"/sub");
+    for (int j = 0; j < 20; j++) {
+      fs::writeFile(L"./tmpwalk/d" + String(i) + L"/sub/f" + String(j), "x");
+    }
+  }
+  fs::mkdirs("./tmpwalk/pruned/deep");
+
+  std::vector<fs::WalkEntry> entries;
+  fs::walk("./tmpwalk", [&](const fs::WalkEntry& entry) {
+    entries.push_back(entry);
+  });
+  EXPECT_EQ(entries.size(), 5 + 5 + 100 + 2);
+  size_t files = 0;
+  for (size_t i = 0; i < entries.size(); i++) {
+    const fs::WalkEntry& entry = entries[i];
+    EXPECT_EQ(path::basename(entry.path), entry.name);
+    if (entry.type == fs::FT_FILE) {
+      files++;
+      EXPECT_EQ(entry.depth, 2);
+      EXPECT_TRUE(fs::stat(entry.path).isFile());
+    }
+  }
+  EXPECT_EQ(files, 100);
+
+  fs::WalkOptions options;
+  options.maxDepth = 0;
+  size_t count = 0;
+  fs::walk("./tmpwalk", [&](const fs::WalkEntry&) { count++; }, options);
+  EXPECT_EQ(count, 6);
+
+  options.maxDepth = static_cast<size_t>(-1);
+  options.descend = [](const fs::WalkEntry& entry) { return !(entry.name == L"pruned"); };
+  options.concurrency = 4;
+  std::atomic<size_t> concurrent(0);
+  fs::walk("./tmpwalk", [&](const fs::WalkEntry&) { concurrent++; }, options);
+  EXPECT_EQ(concurrent.load(), 5 + 5 + 100 + 1);
+
+#ifndef _WIN32
+  // A link back to the root is listed but only walked once
+  fs::symlink("..", "./tmpwalk/d0/up");
+  options = fs::WalkOptions();
+  options.followSymlinks = true;
+  count = 0;
+  fs::walk("./tmpwalk", [&](const fs::WalkEntry&) { count++; }, options);
+  EXPECT_EQ(count, 5 + 5 + 100 + 2 + 1);
+#endif
+
+  JSCPP_EXPECT_THROW(fs::walk("./notexists", [](const fs::WalkEntry&) {}), "opendir");
+  fs::remove("./tmpwalk");
+}
+
 TEST(jscppFilesystem, readAndWrite) {
   String data = process.platform + L"测试\r\n";
   String append = L"append";
@@ -146,3 +489,542 @@ TEST(jscppFilesystem, readAndWrite) {
   fs::remove("testmkdir");
   JSCPP_EXPECT_THROW(fs::readFileAsString("notexists"), "No such file or directory");
 }
+
+TEST(jscppFilesystem, writeFileOptions) {
+  fs::WriteFileOptions options;
+  options.fsync = true;
+  fs::writeFile("testwriteopt.txt", "first", options);
+  EXPECT_EQ(fs::readFileAsString("testwriteopt.txt"), "first");
+
+  options.flag = fs::WF_EXCLUSIVE;
+  std::error_code ec;
+  fs::writeFile("testwriteopt.txt", "second", options, ec);
+  EXPECT_EQ(ec, std::errc::file_exists);
+
+  options = fs::WriteFileOptions();
+  options.atomic = true;
+#ifndef _WIN32
+  fs::chmod("testwriteopt.txt", 0600);
+#endif
+  fs::writeFile("testwriteopt.txt", "atomic", options);
+  EXPECT_EQ(fs::readFileAsString("testwriteopt.txt"), "atomic");
+#ifndef _WIN32
+  // The replaced file's permissions carry over
+  EXPECT_EQ(fs::stat("testwriteopt.txt").mode & 0777, 0600);
+#endif
+  options.flag = fs::WF_EXCLUSIVE;
+  fs::writeFile("testwriteopt.txt", "exclusive", options, ec);
+  EXPECT_EQ(ec, std::errc::file_exists);
+  options.flag = fs::WF_APPEND;
+  fs::writeFile("testwriteopt.txt", "append", options, ec);
+  EXPECT_EQ(ec, std::errc::invalid_argument);
+  EXPECT_EQ(fs::readFileAsString("testwriteopt.txt"), "atomic");
+
+  fs::mkdirs("testwriteoptdir");
+  options.flag = fs::WF_EXCLUSIVE;
+  fs::writeFile("testwriteoptdir/new.txt", "new", options);
+  EXPECT_EQ(fs::readFileAsString("testwriteoptdir/new.txt"), "new");
+  // No temporary files are left behind
+  EXPECT_EQ(fs::readdir("testwriteoptdir").size(), 1);
+  options.flag = fs::WF_WRITE;
+  fs::writeFile("testwriteoptdir", "dir", options, ec);
+  EXPECT_EQ(ec, std::errc::is_a_directory);
+  fs::writeFile("testwriteoptdir", "dir", fs::WriteFileOptions(), ec);
+  EXPECT_EQ(ec, std::errc::is_a_directory);
+
+#ifndef _WIN32
+  // Atomic writes through a symlink replace the file it points to
+  fs::writeFile("testwriteoptdir/real.txt", "old");
+  fs::symlink("real.txt", "testwriteoptdir/link");
+  fs::symlink("testwriteoptdir/link", "testwriteoptlink");
+  options.flag = fs::WF_WRITE;
+  fs::writeFile("testwriteoptlink", "new", options);
+  EXPECT_TRUE(fs::lstat("testwriteoptlink").isSymbolicLink());
+  EXPECT_TRUE(fs::lstat("testwriteoptdir/link").isSymbolicLink());
+  EXPECT_EQ(fs::readFileAsString("testwriteoptdir/real.txt"), "new");
+  fs::symlink("missing.txt", "testwriteoptdir/dangling");
+  fs::writeFile("testwriteoptdir/dangling", "created", options);
+  EXPECT_TRUE(fs::lstat("testwriteoptdir/dangling").isSymbolicLink());
+  EXPECT_EQ(fs::readFileAsString("testwriteoptdir/missing.txt"), "created");
+  fs::unlink("testwriteoptlink");
+#endif
+
+  fs::remove("testwriteoptdir");
+  fs::remove("testwriteopt.txt");
+}
+
+TEST(jscppFilesystem, mapFile) {
+  std::vector<uint8_t> data(200000);
+  for (size_t i = 0; i < data.size(); i++) data[i] = (uint8_t)(i * 31);
+  fs::writeFile("testmap.bin", data);
+
+  fs::MappedBuffer buf = fs::mapFile("testmap.bin", fs::MA_SEQUENTIAL);
+  ASSERT_EQ(buf.size(), data.size());
+  EXPECT_TRUE(buf.isMapped());
+  EXPECT_EQ(std::vector<uint8_t>(buf.data(), buf.data() + buf.size()), data);
+  EXPECT_EQ(fs::readFile("testmap.bin"), data);
+  fs::ByteView tail = buf.view(199990);
+  EXPECT_EQ(tail.size(), 10);
+  EXPECT_EQ(tail[0], data[199990]);
+  EXPECT_EQ(buf.view(5, 3).size(), 3);
+  buf.advise(fs::MA_RANDOM);
+
+  fs::MappedBuffer moved = std::move(buf);
+  EXPECT_EQ(buf.data(), nullptr);
+  EXPECT_EQ(moved.size(), data.size());
+  moved.close();
+  EXPECT_TRUE(moved.empty());
+  fs::remove("testmap.bin");
+
+  fs::writeFile("testmap.txt", "small");
+  fs::MappedBuffer small = fs::mapFile("testmap.txt");
+  EXPECT_FALSE(small.isMapped());
+  EXPECT_EQ(std::string((const char*)small.data(), small.size()), "small");
+  fs::writeFile("testmap.txt", "");
+  EXPECT_TRUE(fs::mapFile("testmap.txt").empty());
+  fs::remove("testmap.txt");
+
+#ifdef __linux__
+  // procfs reports a size of 0, so this goes through the read fallback
+  fs::MappedBuffer status = fs::mapFile("/proc/self/status");
+  EXPECT_FALSE(status.isMapped());
+  EXPECT_GT(status.size(), 0);
+  EXPECT_GT(fs::readFileAsString("/proc/self/status").length(), 0);
+#endif
+
+  JSCPP_EXPECT_THROW(fs::mapFile("notexists"), "No such file or directory");
+  fs::mkdirs("testmapdir");
+  JSCPP_EXPECT_THROW(fs::mapFile("testmapdir"), "");
+  fs::remove("testmapdir");
+}
+
+TEST(jscppFilesystem, fileHandle) {
+  fs::FileHandle f = fs::open("testhandle.bin", fs::OF_READ_WRITE | fs::OF_CREATE | fs::OF_TRUNCATE);
+  EXPECT_TRUE(f.isOpen());
+  EXPECT_EQ(f.path(), L"testhandle.bin");
+  std::vector<uint8_t> block(4096);
+  for (int i = 0; i < 4; i++) {
+    std::fill(block.begin(), block.end(), (uint8_t)('a' + i));
+    f.pwrite(block.data(), block.size(), (uint64_t)i * 4096);
+  }
+  EXPECT_EQ(f.stat().size, 16384);
+
+  char buf[8];
+  EXPECT_EQ(f.pread(buf, 4, 8192), 4);
+  EXPECT_EQ(std::string(buf, 4), "cccc");
+  // The positional forms left the offset at the start
+  EXPECT_EQ(f.read(buf, 2), 2);
+  EXPECT_EQ(std::string(buf, 2), "aa");
+  EXPECT_EQ(f.pread(buf, 8, 16380), 4);
+  EXPECT_EQ(f.pread(buf, 8, 20000), 0);
+
+  std::vector<fs::ByteView> parts;
+  parts.emplace_back((const uint8_t*)"hello ", 6);
+  parts.emplace_back((const uint8_t*)"", 0);
+  parts.emplace_back((const uint8_t*)"world", 5);
+  f.writev(parts, 4096);
+  char head[5], tail[6];
+  std::vector<fs::IoBuffer> into;
+  into.emplace_back((uint8_t*)head, 5);
+  into.emplace_back((uint8_t*)tail, 6);
+  EXPECT_EQ(f.readv(into, 4096), 11);
+  EXPECT_EQ(std::string(head, 5) + std::string(tail, 6), "hello world");
+  // From the current offset, 2 after the read above
+  EXPECT_EQ(f.readv(into), 11);
+  EXPECT_EQ(std::string(head, 5), "aaaaa");
+  f.writev(parts);
+  EXPECT_EQ(f.pread(buf, 6, 13), 6);
+  EXPECT_EQ(std::string(buf, 6), "hello ");
+
+  f.truncate(100);
+  EXPECT_EQ(f.stat(fs::SF_SIZE).size, 100);
+  f.allocate(0, 8192);
+  EXPECT_EQ(f.stat().size, 8192);
+  f.sync();
+  f.datasync();
+  f.advise(fs::FA_SEQUENTIAL);
+
+  fs::FileHandle moved = std::move(f);
+  EXPECT_FALSE(f.isOpen());
+  int fd = moved.release();
+  EXPECT_FALSE(moved.isOpen());
+  fs::FileHandle adopted = fs::FileHandle::adopt(fd, "testhandle.bin");
+  EXPECT_EQ(adopted.fd(), fd);
+  EXPECT_EQ(adopted.pread(buf, 2, 0), 2);
+  adopted.close();
+  EXPECT_FALSE(adopted.isOpen());
+
+  std::error_code ec;
+  fs::open("testhandle.bin", ec, fs::OF_WRITE | fs::OF_CREATE | fs::OF_EXCLUSIVE);
+  EXPECT_EQ(ec, std::errc::file_exists);
+  fs::FileHandle missing = fs::open("notexists", ec);
+  EXPECT_EQ(ec, std::errc::no_such_file_or_directory);
+  EXPECT_FALSE(missing.isOpen());
+  JSCPP_EXPECT_THROW(fs::open("notexists"), "No such file or directory, open \"notexists\"");
+
+  fs::FileHandle appender = fs::open("testhandle.bin", fs::OF_WRITE | fs::OF_APPEND);
+  appender.write("!", 1);
+  appender.close();
+  EXPECT_EQ(fs::stat("testhandle.bin").size, 8193);
+  fs::remove("testhandle.bin");
+}
+
+TEST(jscppFilesystem, async) {
+  fs::mkdirsAsync("testasync").get();
+  std::vector<std::future<void>> writes;
+  for (int i = 0; i < 20; i++) {
+    writes.push_back(fs::writeFileAsync(path::join(L"testasync", String(i) + L".txt"), String(i)));
+  }
+  for (size_t i = 0; i < writes.size(); i++) writes[i].get();
+  EXPECT_EQ(fs::readdirAsync("testasync").get().size(), 20);
+  EXPECT_EQ(fs::readFileAsStringAsync("testasync/7.txt").get(), L"7");
+  EXPECT_EQ(fs::statAsync("testasync/13.txt").get().size, 2);
+  EXPECT_TRUE(fs::existsAsync("testasync/0.txt").get());
+  fs::copyAsync("testasync", "testasync2").get();
+  EXPECT_EQ(fs::readFileAsync("testasync2/19.txt").get(), std::vector<uint8_t>({'1', '9'}));
+  fs::removeAsync("testasync2").get();
+  EXPECT_FALSE(fs::exists("testasync2"));
+
+  std::promise<std::error_code> missing;
+  fs::readFileAsStringAsync("testasync/none.txt", [&](const std::error_code& ec, String content) {
+    EXPECT_EQ(content, L"");
+    missing.set_value(ec);
+  });
+  EXPECT_EQ(missing.get_future().get(), std::errc::no_such_file_or_directory);
+  std::promise<std::error_code> appended;
+  fs::appendFileAsync("testasync/1.txt", "+", [&](const std::error_code& ec) { appended.set_value(ec); });
+  EXPECT_FALSE(appended.get_future().get());
+  EXPECT_EQ(fs::readFileAsString("testasync/1.txt"), L"1+");
+#if JSCPP_USE_ERROR
+  EXPECT_THROW(fs::statAsync("testasync/none.txt").get(), SystemError);
+#endif
+
+  // What a call or a callback throws must not escape the pool thread
+  fs::CopyOptions refuse;
+  refuse.filter = [](const String&, const String&) -> bool { throw std::runtime_error("filter says no"); };
+  std::promise<std::error_code> refused;
+  fs::copyAsync("testasync", "testasync3", [&](const std::error_code& ec) { refused.set_value(ec); }, refuse);
+  EXPECT_EQ(refused.get_future().get(), std::errc::operation_canceled);
+  EXPECT_THROW(fs::copyAsync("testasync", "testasync3", refuse).get(), std::runtime_error);
+  std::promise<void> thrown;
+  fs::existsAsync("testasync", [&](const std::error_code&, bool) {
+    thrown.set_value();
+    throw std::runtime_error("callback");
+  });
+  thrown.get_future().get();
+  EXPECT_TRUE(fs::existsAsync("testasync").get());
+  if (fs::exists("testasync3")) fs::remove("testasync3");
+
+  // Hold every pool thread so the next calls are still queued when cancelled
+  std::promise<void> gate;
+  std::shared_future<void> opened = gate.get_future().share();
+  for (unsigned i = 0; i < fs::threadPoolSize(); i++) {
+    fs::queueWork([opened](const std::error_code&) { opened.wait(); });
+  }
+  fs::CancelToken token;
+  std::future<String> doomed = fs::readFileAsStringAsync("testasync/1.txt", token);
+  std::promise<std::error_code> cancelled;
+  fs::statAsync("testasync", [&](const std::error_code& ec, fs::Stats) { cancelled.set_value(ec); }, fs::SF_ALL,
+                token);
+  std::future<bool> kept = fs::existsAsync("testasync");
+  token.cancel();
+  gate.set_value();
+  EXPECT_EQ(cancelled.get_future().get(), std::errc::operation_canceled);
+  EXPECT_TRUE(kept.get());
+#if JSCPP_USE_ERROR
+  try {
+    doomed.get();
+    FAIL();
+  } catch (const SystemError& e) {
+    EXPECT_STREQ(e.codeName(), "ECANCELED");
+  }
+#endif
+
+  EXPECT_FALSE(fs::configureThreadPool(fs::ThreadPoolOptions()));
+  fs::remove("testasync");
+}
+
+TEST(jscppFilesystem, readManyWriteMany) {
+  fs::mkdirs("testmany/dir");
+  std::vector<std::vector<uint8_t>> contents;
+  for (size_t i = 0; i < 300; i++) {
+    contents.push_back(std::vector<uint8_t>(i * 7, (uint8_t)i));
+  }
+  // Larger than the first read of a file with an unknown size
+  contents[1] = std::vector<uint8_t>(200000, 'x');
+  std::vector<std::pair<String, fs::ByteView>> files;
+  std::vector<String> paths;
+  for (size_t i = 0; i < contents.size(); i++) {
+    paths.push_back(path::join(L"testmany", String((unsigned long)i)));
+    files.push_back(std::make_pair(paths[i], fs::ByteView(contents[i].data(), contents[i].size())));
+  }
+  files.push_back(std::make_pair(String(L"testmany/dir"), fs::ByteView()));
+  files.push_back(std::make_pair(String(L"testmany/none/file"), fs::ByteView()));
+  paths.push_back(L"testmany/dir");
+  paths.push_back(L"testmany/none");
+
+  for (int uring = 1; uring >= 0; uring--) {
+    fs::WriteManyOptions writeOptions;
+    writeOptions.ioUring = uring != 0;
+    writeOptions.concurrency = 16;
+    writeOptions.fsync = uring != 0;
+    std::vector<int> written = fs::writeMany(files, writeOptions);
+    ASSERT_EQ(written.size(), files.size());
+    for (size_t i = 0; i < contents.size(); i++) EXPECT_EQ(written[i], 0);
+    EXPECT_EQ(written[300], EISDIR);
+    EXPECT_EQ(written[301], ENOENT);
+
+    fs::ReadManyOptions readOptions;
+    readOptions.ioUring = uring != 0;
+    std::vector<std::pair<int, std::vector<uint8_t>>> read = fs::readMany(paths, readOptions);
+    ASSERT_EQ(read.size(), paths.size());
+    for (size_t i = 0; i < contents.size(); i++) {
+      EXPECT_EQ(read[i].first, 0);
+      EXPECT_EQ(read[i].second, contents[i]);
+    }
+    EXPECT_EQ(read[300].first, EISDIR);
+    EXPECT_EQ(read[301].first, ENOENT);
+    EXPECT_TRUE(read[301].second.empty());
+  }
+
+#ifdef __linux__
+  // procfs reports a size of 0
+  std::vector<String> proc;
+  proc.push_back(L"/proc/self/status");
+  proc.push_back(L"/proc/self/stat");
+  std::vector<std::pair<int, std::vector<uint8_t>>> status = fs::readMany(proc);
+  EXPECT_EQ(status[0].first, 0);
+  EXPECT_GT(status[0].second.size(), 0);
+  EXPECT_GT(status[1].second.size(), 0);
+#endif
+
+  EXPECT_TRUE(fs::readMany(std::vector<String>()).empty());
+  fs::remove("testmany");
+}
+
+TEST(jscppFilesystem, streams) {
+  std::vector<uint8_t> data(300000);
+  for (size_t i = 0; i < data.size(); i++) data[i] = (uint8_t)(i * 13);
+
+  fs::WriteStreamOptions writeOptions;
+  writeOptions.highWaterMark = 4096;
+  fs::WriteStream out = fs::createWriteStream("teststream.bin", writeOptions);
+  // Small writes collect in the buffer, large ones partly skip it
+  size_t offset = 0;
+  size_t sizes[] = {1, 100, 4000, 10000, 0, 50000};
+  for (size_t i = 0; offset < data.size(); i++) {
+    size_t size = std::min(sizes[i % 6], data.size() - offset);
+    out.write(data.data() + offset, size);
+    offset += size;
+    EXPECT_LT(out.buffered(), 4096);
+  }
+  EXPECT_EQ(out.bytesWritten() + out.buffered(), data.size());
+  out.close();
+  EXPECT_FALSE(out.isOpen());
+  EXPECT_EQ(fs::readFile("teststream.bin"), data);
+
+  fs::ReadStreamOptions readOptions;
+  readOptions.highWaterMark = 4096;
+  fs::ReadStream in = fs::createReadStream("teststream.bin", readOptions);
+  std::vector<uint8_t> back;
+  const uint8_t* buffer = nullptr;
+  for (fs::ByteView chunk : in) {
+    EXPECT_LE(chunk.size(), 4096);
+    // Every chunk reuses the same buffer
+    if (buffer == nullptr) buffer = chunk.data();
+    EXPECT_EQ(chunk.data(), buffer);
+    back.insert(back.end(), chunk.begin(), chunk.end());
+  }
+  EXPECT_EQ(back, data);
+  EXPECT_TRUE(in.ended());
+  EXPECT_EQ(in.bytesRead(), data.size());
+  EXPECT_TRUE(in.read().empty());
+  // The next stream of that size gets the closed one's buffer
+  fs::ReadStream again = fs::createReadStream("teststream.bin", readOptions);
+  EXPECT_EQ(again.read().data(), buffer);
+
+  readOptions.start = 5000;
+  readOptions.end = 5009;
+  fs::ReadStream range = fs::createReadStream("teststream.bin", readOptions);
+  fs::ByteView slice = range.read();
+  ASSERT_EQ(slice.size(), 10);
+  EXPECT_EQ(std::vector<uint8_t>(slice.begin(), slice.end()),
+            std::vector<uint8_t>(data.begin() + 5000, data.begin() + 5010));
+  EXPECT_TRUE(range.read().empty());
+
+  fs::ReadStream source = fs::createReadStream("teststream.bin");
+  fs::WriteStream dest = fs::createWriteStream("teststream2.bin");
+  EXPECT_EQ(source.pipe(dest), data.size());
+  EXPECT_EQ(dest.buffered(), 0);
+  dest.close();
+  EXPECT_EQ(fs::readFile("teststream2.bin"), data);
+
+  writeOptions.flag = fs::WF_APPEND;
+  fs::WriteStream appender = fs::createWriteStream("teststream2.bin", writeOptions);
+  appender.write(fs::ByteView((const uint8_t*)"end", 3));
+  appender.close();
+  EXPECT_EQ(fs::stat("teststream2.bin").size, data.size() + 3);
+
+  std::error_code ec;
+  writeOptions.flag = fs::WF_EXCLUSIVE;
+  fs::createWriteStream("teststream2.bin", ec, writeOptions);
+  EXPECT_EQ(ec, std::errc::file_exists);
+  fs::createReadStream("notexists", ec);
+  EXPECT_EQ(ec, std::errc::no_such_file_or_directory);
+  readOptions.start = 10;
+  readOptions.end = 5;
+  fs::createReadStream("teststream.bin", ec, readOptions);
+  EXPECT_EQ(ec, std::errc::invalid_argument);
+  JSCPP_EXPECT_THROW(fs::createReadStream("notexists"), "No such file or directory, open \"notexists\"");
+
+#ifndef _WIN32
+  // Pipes are read as data arrives, without offsets
+  ASSERT_EQ(::mkfifo("teststream.fifo", 0600), 0);
+  std::promise<void> firstLine;
+  std::thread writer([&firstLine]() {
+    fs::WriteStream out = fs::createWriteStream("teststream.fifo");
+    out.write(fs::ByteView((const uint8_t*)"line\n", 5));
+    out.flush();
+    // The reader gets the first line without the writer closing the pipe
+    firstLine.get_future().wait();
+    for (int i = 1; i < 100; i++) {
+      out.write(fs::ByteView((const uint8_t*)"line\n", 5));
+      out.flush();
+    }
+  });
+  fs::ReadStream fifo = fs::createReadStream("teststream.fifo");
+  EXPECT_EQ(fifo.read().size(), 5);
+  firstLine.set_value();
+  size_t piped = 5;
+  for (fs::ByteView chunk : fifo) piped += chunk.size();
+  writer.join();
+  EXPECT_EQ(piped, 500);
+  EXPECT_TRUE(fifo.ended());
+  EXPECT_EQ(fs::createReadStream("/dev/null").read().size(), 0);
+  readOptions = fs::ReadStreamOptions();
+  readOptions.start = 1;
+  fs::createReadStream("/dev/null", ec, readOptions);
+  EXPECT_EQ(ec, std::errc::invalid_seek);
+  fs::unlink("teststream.fifo");
+#endif
+
+  fs::remove("teststream.bin");
+  fs::remove("teststream2.bin");
+}
+
+TEST(jscppFilesystem, errorCodes) {
+  const std::error_code missing = std::make_error_code(std::errc::no_such_file_or_directory);
+  std::error_code ec;
+
+  fs::stat("notexists", ec);
+  EXPECT_EQ(ec, missing);
+  fs::lstat("notexists", ec);
+  EXPECT_EQ(ec, missing);
+  fs::access("notexists", ec);
+  EXPECT_EQ(ec, missing);
+  fs::unlink("notexists", ec);
+  EXPECT_EQ(ec, missing);
+  fs::rmdir("notexists", ec);
+  EXPECT_EQ(ec, missing);
+  EXPECT_TRUE(fs::readFile("notexists", ec).empty());
+  EXPECT_EQ(ec, missing);
+  EXPECT_TRUE(fs::readdir("notexists", ec).empty());
+  EXPECT_EQ(ec, missing);
+  fs::opendir("notexists", ec);
+  EXPECT_EQ(ec, missing);
+  fs::realpath("notexists", ec);
+  EXPECT_EQ(ec, missing);
+  fs::readlink("notexists", ec);
+  EXPECT_EQ(ec, missing);
+  fs::rename("notexists", "notexists2", ec);
+  EXPECT_EQ(ec, missing);
+  fs::copyFile("notexists", "notexists2", ec);
+  EXPECT_EQ(ec, missing);
+  fs::copy("notexists", "notexists2", ec);
+  EXPECT_EQ(ec, missing);
+
+  // Nothing to remove is not an error
+  fs::remove("notexists", ec);
+  EXPECT_FALSE(ec);
+
+  fs::writeFile("testec.txt", "ec", ec);
+  EXPECT_FALSE(ec);
+  EXPECT_EQ(fs::readFileAsString("testec.txt", ec), "ec");
+  EXPECT_FALSE(ec);
+  fs::stat("notexists", ec);
+  EXPECT_TRUE(fs::stat("testec.txt", ec).isFile());
+  EXPECT_FALSE(ec);
+
+  fs::mkdirs("testec.txt/sub", ec);
+  EXPECT_EQ(ec, std::errc::no_such_file_or_directory);
+  fs::mkdirs("testec.txt", ec);
+  EXPECT_EQ(ec, std::errc::file_exists);
+
+  fs::mkdirs("testecdir/a/b", ec);
+  EXPECT_FALSE(ec);
+  fs::writeFile("testecdir/a/b/c.txt", "c", ec);
+  fs::writeFile("testecdir", "x", ec);
+  EXPECT_EQ(ec, std::errc::is_a_directory);
+  fs::rmdir("testecdir", ec);
+  EXPECT_TRUE(ec);
+  fs::copy("testecdir", "testecdir2", ec);
+  EXPECT_FALSE(ec);
+  EXPECT_EQ(fs::readFileAsString("testecdir2/a/b/c.txt"), "c");
+  fs::move("testecdir2", "testecdir3", ec);
+  EXPECT_FALSE(ec);
+  EXPECT_FALSE(fs::exists("testecdir2"));
+
+  size_t entries = 0;
+  fs::walk("testecdir3", [&](const fs::WalkEntry&) { entries++; }, ec);
+  EXPECT_FALSE(ec);
+  EXPECT_EQ(entries, 3);
+  fs::walk("notexists", [&](const fs::WalkEntry&) {}, ec);
+  EXPECT_EQ(ec, missing);
+
+  fs::remove("testecdir", ec);
+  EXPECT_FALSE(ec);
+  fs::remove("testecdir3", ec);
+  EXPECT_FALSE(ec);
+  fs::remove("testec.txt", ec);
+  EXPECT_FALSE(ec);
+  EXPECT_FALSE(fs::exists("testec.txt"));
+
+  JSCPP_EXPECT_THROW(fs::stat("notexists"), "No such file or directory, stat \"notexists\"");
+}
+
+#if JSCPP_USE_ERROR
+TEST(jscppFilesystem, systemError) {
+  try {
+    fs::rename("notexists", "notexists2");
+    FAIL();
+  } catch (const SystemError& e) {
+    EXPECT_EQ(e.code(), ENOENT);
+    EXPECT_STREQ(e.codeName(), "ENOENT");
+    EXPECT_EQ(e.errorCode(), std::errc::no_such_file_or_directory);
+    EXPECT_STREQ(e.syscall(), "rename");
+    EXPECT_EQ(e.path(), L"notexists");
+    EXPECT_EQ(e.dest(), L"notexists2");
+    EXPECT_NE(std::string(e.what()).find("rename \"notexists\" -> \"notexists2\""), std::string::npos);
+  }
+
+  fs::mkdirs("testsyserr/a");
+  try {
+    fs::rmdir("testsyserr");
+    FAIL();
+  } catch (const SystemError& e) {
+    EXPECT_STREQ(e.codeName(), "ENOTEMPTY");
+    EXPECT_STREQ(e.syscall(), "rmdir");
+  }
+
+  // A callback's own exception comes back unchanged
+  try {
+    fs::walk("testsyserr", [](const fs::WalkEntry&) { throw std::runtime_error("stop"); });
+    FAIL();
+  } catch (const std::runtime_error& e) {
+    EXPECT_STREQ(e.what(), "stop");
+  }
+  fs::remove("testsyserr");
+
+  EXPECT_THROW(fs::readFile("notexists"), Error);
+}
+#endif
@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+"""Generates src/internal/unicode_tables.cpp from Python's unicodedata.
+
+    python3 tools/unicode_tables.py > src/internal/unicode_tables.cpp
+
+Every table is a two-level lookup: stage1 maps cp >> SHIFT to a block of
+stage2, which maps the low bits to a record index. Identical blocks are
+stored once, which is what keeps the tables small.
+"""
+
+import sys
+import unicodedata
+
+SHIFT = 7
+BLOCK = 1 << SHIFT
+
+CASED = 1
+CASE_IGNORABLE = 2
+
+NFC_NO = 1
+NFC_MAYBE = 2
+NFKC_NO = 4
+NFKC_MAYBE = 8
+
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+# Word-break MidLetter, MidNumLet and Single_Quote, which are Case_Ignorable
+# without being in one of the categories below.
+CASE_IGNORABLE_EXTRA = {
+    0x0027, 0x002E, 0x003A, 0x00B7, 0x0387, 0x055F, 0x05F4, 0x2018, 0x2019,
+    0x2024, 0x2027, 0xFE13, 0xFE52, 0xFE55, 0xFF07, 0xFF0E, 0xFF1A,
+}
+
+
+def is_hangul(cp):
+    return HANGUL_FIRST <= cp <= HANGUL_LAST
+
+
+def two_level(values, default):
+    """Splits values into deduplicated blocks. Returns (stage1, stage2)."""
+    size = len(values)
+    while size > 0 and values[size - 1] == default:
+        size -= 1
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for start in range(0, size, BLOCK):
+        block = tuple(values[start:start + BLOCK]) + (default,) * max(0, start + BLOCK - len(values))
+        if block not in blocks:
+            blocks[block] = len(stage2) // BLOCK
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return stage1, stage2
+
+
+class Pool:
+    """Length-prefixed code point sequences, deduplicated. Offset 0 is empty."""
+
+    def __init__(self):
+        self.data = [0]
+        self.offsets = {}
+
+    def add(self, cps):
+        key = tuple(cps)
+        if key not in self.offsets:
+            self.offsets[key] = len(self.data)
+            self.data.append(len(cps))
+            self.data.extend(cps)
+        return self.offsets[key]
+
+
+def case_tables():
+    special = Pool()
+    records = [(0, 0, 0, 0, 0)]
+    index = {records[0]: 0}
+    values = []
+    for cp in range(0x110000):
+        ch = chr(cp)
+        lower = ch.lower()
+        upper = ch.upper()
+        # Simple mappings are the full mapping when it is one character.
+        # Otherwise the lowercase is its first character (U+0130) and the
+        # uppercase is the titlecase when that is one character (U+1F80).
+        simple_lower = ord(lower[0]) if len(lower) >= 1 and (len(lower) == 1 or cp == 0x0130) else cp
+        if len(upper) == 1:
+            simple_upper = ord(upper)
+        else:
+            title = ch.title()
+            simple_upper = ord(title) if len(title) == 1 else cp
+        category = unicodedata.category(ch)
+        flags = 0
+        if category in ('Lu', 'Ll', 'Lt') or lower != ch or upper != ch:
+            flags |= CASED
+        if category in ('Mn', 'Me', 'Cf', 'Lm', 'Sk') or cp in CASE_IGNORABLE_EXTRA:
+            flags |= CASE_IGNORABLE
+        record = (
+            simple_lower - cp,
+            simple_upper - cp,
+            special.add([ord(c) for c in lower]) if len(lower) > 1 else 0,
+            special.add([ord(c) for c in upper]) if len(upper) > 1 else 0,
+            flags,
+        )
+        if record not in index:
+            index[record] = len(records)
+            records.append(record)
+        values.append(index[record])
+    return records, values, special.data
+
+
+def norm_tables():
+    pool = Pool()
+    records = [(0, 0, 0, 0)]
+    index = {records[0]: 0}
+    values = []
+    pairs = []
+    seconds = set()
+    for cp in range(0x110000):
+        ch = chr(cp)
+        raw = unicodedata.decomposition(ch)
+        if raw and not raw.startswith('<') and not is_hangul(cp):
+            parts = [int(p, 16) for p in raw.split()]
+            if len(parts) == 2 and unicodedata.normalize('NFC', ch) == ch:
+                pairs.append((parts[0], parts[1], cp))
+                seconds.add(parts[1])
+    # Conjoining vowels and trailing consonants compose algorithmically
+    seconds.update(range(0x1161, 0x1176))
+    seconds.update(range(0x11A8, 0x11C3))
+
+    for cp in range(0x110000):
+        ch = chr(cp)
+        canon = 0
+        compat = 0
+        flags = 0
+        if not is_hangul(cp) and not (0xD800 <= cp <= 0xDFFF):
+            nfd = unicodedata.normalize('NFD', ch)
+            nfkd = unicodedata.normalize('NFKD', ch)
+            if nfd != ch:
+                canon = pool.add([ord(c) for c in nfd])
+            if nfkd != nfd:
+                compat = pool.add([ord(c) for c in nfkd])
+            if unicodedata.normalize('NFC', ch) != ch:
+                flags |= NFC_NO
+            if unicodedata.normalize('NFKC', ch) != ch:
+                flags |= NFKC_NO
+        if cp in seconds:
+            flags |= NFC_MAYBE | NFKC_MAYBE
+        record = (unicodedata.combining(ch), flags, canon, compat)
+        if record not in index:
+            index[record] = len(records)
+            records.append(record)
+        values.append(index[record])
+    pairs.sort()
+    return records, values, pool.data, pairs
+
+
+def emit_array(out, ctype, name, values, per_line=16, fmt='{}'):
+    out.append('const {} {}[{}] = {{'.format(ctype, name, len(values)))
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        out.append('  ' + ', '.join(fmt.format(v) for v in chunk) + ',')
+    out.append('};')
+    out.append('')
+
+
+def main():
+    out = []
+    out.append('// Generated by tools/unicode_tables.py from Unicode {}. Do not edit.'.format(unicodedata.unidata_version))
+    out.append('')
+    out.append('#include "./unicode.hpp"')
+    out.append('')
+    out.append('namespace js {')
+    out.append('namespace internal {')
+    out.append('namespace unicode {')
+    out.append('')
+
+    records, values, special = case_tables()
+    stage1, stage2 = two_level(values, 0)
+    assert len(records) < 0x10000 and len(special) < 0x10000
+    out.append('const uint32_t CASE_LIMIT = 0x{:X};'.format(len(stage1) << SHIFT))
+    out.append('')
+    emit_array(out, 'uint16_t', 'caseStage1', stage1)
+    emit_array(out, 'uint16_t', 'caseStage2', stage2)
+    out.append('const CaseRecord caseRecords[{}] = {{'.format(len(records)))
+    for r in records:
+        out.append('  {{ {}, {}, {}, {}, {} }},'.format(*r))
+    out.append('};')
+    out.append('')
+    emit_array(out, 'uint32_t', 'caseSpecial', special, 12, '0x{:X}')
+
+    records, values, pool, pairs = norm_tables()
+    stage1, stage2 = two_level(values, 0)
+    assert len(records) < 0x10000 and len(pool) < 0x10000
+    out.append('const uint32_t NORM_LIMIT = 0x{:X};'.format(len(stage1) << SHIFT))
+    out.append('')
+    emit_array(out, 'uint16_t', 'normStage1', stage1)
+    emit_array(out, 'uint16_t', 'normStage2', stage2)
+    out.append('const NormRecord normRecords[{}] = {{'.format(len(records)))
+    for r in records:
+        out.append('  {{ {}, {}, {}, {} }},'.format(*r))
+    out.append('};')
+    out.append('')
+    emit_array(out, 'uint32_t', 'normData', pool, 12, '0x{:X}')
+    out.append('const Composition compositions[{}] = {{'.format(len(pairs)))
+    for first, second, composite in pairs:
+        out.append('  {{ 0x{:X}, 0x{:X}, 0x{:X} }},'.format(first, second, composite))
+    out.append('};')
+    out.append('')
+
+    out.append('const CaseRecord& caseRecord(uint32_t cp) noexcept {')
+    out.append('  if (cp >= CASE_LIMIT) return caseRecords[0];')
+    out.append('  return caseRecords[caseStage2[((size_t)caseStage1[cp >> {0}] << {0}) | (cp & {1})]];'.format(SHIFT, BLOCK - 1))
+    out.append('}')
+    out.append('')
+    out.append('const uint32_t* caseSequence(uint16_t offset) noexcept {')
+    out.append('  return caseSpecial + offset;')
+    out.append('}')
+    out.append('')
+    out.append('const NormRecord& normRecord(uint32_t cp) noexcept {')
+    out.append('  if (cp >= NORM_LIMIT) return normRecords[0];')
+    out.append('  return normRecords[normStage2[((size_t)normStage1[cp >> {0}] << {0}) | (cp & {1})]];'.format(SHIFT, BLOCK - 1))
+    out.append('}')
+    out.append('')
+    out.append('const uint32_t* normSequence(uint16_t offset) noexcept {')
+    out.append('  return normData + offset;')
+    out.append('}')
+    out.append('')
+    out.append('const Composition* compositionsBegin() noexcept {')
+    out.append('  return compositions;')
+    out.append('}')
+    out.append('')
+    out.append('const Composition* compositionsEnd() noexcept {')
+    out.append('  return compositions + {};'.format(len(pairs)))
+    out.append('}')
+    out.append('')
+    out.append('}')
+    out.append('}')
+    out.append('}')
+    sys.stdout.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()